@@ -0,0 +1,25 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_ISCENEFLUSHLISTENER_H
+#define RAMSES_ISCENEFLUSHLISTENER_H
+
+namespace ramses
+{
+    class ISceneFlushListener
+    {
+    public:
+        virtual ~ISceneFlushListener() {};
+
+        // called when scene is flushed or saved to file, before scene changes are sent or written,
+        // so that deferred modifications are part of the flush or file
+        virtual void onSceneFlush() = 0;
+    };
+}
+
+#endif
@@ -20,9 +20,14 @@
 #include "GeometryBindingImpl.h"
 #include "RamsesObjectTypeUtils.h"
 #include "VisibilityModeUtils.h"
+#include "RamsesClientImpl.h"
 
 // internal
 #include "Resource/IResource.h"
+#include "Resource/ArrayResource.h"
+#include "Components/ManagedResource.h"
+#include "ClientApplicationLogic.h"
+#include "Math3d/BoundingBox.h"
 #include "SerializationContext.h"
 #include "Scene/ClientScene.h"
 
@@ -325,4 +330,78 @@ namespace ramses
     {
         return getIScene().getRenderable(m_renderableHandle).startVertex;
     }
+
+    status_t MeshNodeImpl::setBoundingBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ)
+    {
+        if (minX > maxX || minY > maxY || minZ > maxZ)
+        {
+            return addErrorEntry("MeshNode::setBoundingBox failed: minimum must not be greater than maximum!");
+        }
+
+        getIScene().setRenderableBoundingBox(m_renderableHandle, ramses_internal::BoundingBox({ minX, minY, minZ }, { maxX, maxY, maxZ }));
+        return StatusOK;
+    }
+
+    status_t MeshNodeImpl::setBoundingBoxFromVertexPositions(const ArrayResourceImpl& vertexPositions)
+    {
+        if (!isFromTheSameClientAs(vertexPositions))
+        {
+            return addErrorEntry("MeshNode::setBoundingBoxFromVertexPositions failed, vertexPositions is not from the same client as this MeshNode.");
+        }
+
+        if (vertexPositions.getElementType() != ramses_internal::EDataType_Vector3F || vertexPositions.getElementCount() == 0u)
+        {
+            return addErrorEntry("MeshNode::setBoundingBoxFromVertexPositions failed, vertexPositions must be a non-empty array of Vector3f.");
+        }
+
+        const ramses_internal::ResourceContentHash& hash = vertexPositions.getLowlevelResourceHash();
+        ramses_internal::ManagedResource managedRes = getClientImpl().getClientApplication().getResource(hash);
+        if (managedRes.getResourceObject() == nullptr)
+        {
+            managedRes = getClientImpl().getClientApplication().forceLoadResource(hash);
+            if (managedRes.getResourceObject() == nullptr)
+            {
+                return addErrorEntry("MeshNode::setBoundingBoxFromVertexPositions failed, could not load data of vertexPositions.");
+            }
+        }
+
+        const ramses_internal::ArrayResource* arrayResource = managedRes.getResourceObject()->convertTo<ramses_internal::ArrayResource>();
+        if (!arrayResource->isDeCompressedAvailable())
+        {
+            arrayResource->decompress();
+        }
+
+        const ramses_internal::Vector3* positions = static_cast<const ramses_internal::Vector3*>(arrayResource->getData());
+        ramses_internal::BoundingBox boundingBox;
+        for (uint32_t i = 0u; i < arrayResource->getElementCount(); ++i)
+        {
+            boundingBox.extend(positions[i]);
+        }
+
+        getIScene().setRenderableBoundingBox(m_renderableHandle, boundingBox);
+        return StatusOK;
+    }
+
+    status_t MeshNodeImpl::removeBoundingBox()
+    {
+        getIScene().setRenderableBoundingBox(m_renderableHandle, ramses_internal::BoundingBox());
+        return StatusOK;
+    }
+
+    status_t MeshNodeImpl::getBoundingBox(float& minX, float& minY, float& minZ, float& maxX, float& maxY, float& maxZ) const
+    {
+        const ramses_internal::BoundingBox& boundingBox = getIScene().getRenderable(m_renderableHandle).boundingBox;
+        if (boundingBox.isEmpty())
+        {
+            return addErrorEntry("MeshNode::getBoundingBox failed: no bounding box set!");
+        }
+
+        minX = boundingBox.min.x;
+        minY = boundingBox.min.y;
+        minZ = boundingBox.min.z;
+        maxX = boundingBox.max.x;
+        maxY = boundingBox.max.y;
+        maxZ = boundingBox.max.z;
+        return StatusOK;
+    }
 }
@@ -24,6 +24,7 @@ namespace ramses
     class GeometryBindingImpl;
     class AppearanceImpl;
     class UInt16Array;
+    class ArrayResourceImpl;
 
     class MeshNodeImpl final : public NodeImpl
     {
@@ -51,6 +52,10 @@ namespace ramses
         uint32_t getInstanceCount() const;
         status_t setStartVertex(uint32_t startVertex);
         uint32_t getStartVertex() const;
+        status_t setBoundingBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
+        status_t setBoundingBoxFromVertexPositions(const ArrayResourceImpl& vertexPositions);
+        status_t removeBoundingBox();
+        status_t getBoundingBox(float& minX, float& minY, float& minZ, float& maxX, float& maxY, float& maxZ) const;
 
         ramses_internal::RenderableHandle   getRenderableHandle() const;
 
@@ -463,7 +463,13 @@ namespace ramses
             return addErrorEntry("Cannot write resources to file, its already opened by the client.");
         }
 
+        // resources loaded from a previous version of the file may still use its memory mapping in place,
+        // so replace the file instead of overwriting it
         ramses_internal::File outputResources(fileDescription.getFilename());
+        if (outputResources.exists())
+        {
+            outputResources.remove();
+        }
         ramses_internal::BinaryFileOutputStream resourceOutputStream(outputResources);
         if (!outputResources.isOpen())
         {
@@ -555,7 +561,7 @@ namespace ramses
         }
 
         // write LL-TOC and LL resources
-        ramses_internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress);
+        ramses_internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress, &m_framework.getTaskQueue());
     }
 
     status_t RamsesClientImpl::writeSceneObjectsToStream(SceneImpl& scene, ramses_internal::IOutputStream& outputStream) const
@@ -583,6 +589,9 @@ namespace ramses
 
         WriteCurrentBuildVersionToStream(outputStream);
 
+        // modifications deferred until next flush are applied so that saved scene contains them
+        scene.notifyFlushListeners();
+
         const ResourceFileDescriptionVector& descriptions = resourceFileInformation.impl->descriptions;
         for (const auto& description : descriptions)
         {
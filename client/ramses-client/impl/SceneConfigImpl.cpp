@@ -20,4 +20,15 @@ namespace ramses
     {
         return m_publicationMode;
     }
+
+    status_t SceneConfigImpl::setCollapseRedundantSetters(bool enable)
+    {
+        m_collapseRedundantSetters = enable;
+        return StatusOK;
+    }
+
+    bool SceneConfigImpl::getCollapseRedundantSetters() const
+    {
+        return m_collapseRedundantSetters;
+    }
 }
@@ -21,9 +21,12 @@ namespace ramses
     public:
         status_t setPublicationMode(EScenePublicationMode publicationMode);
         EScenePublicationMode getPublicationMode() const;
+        status_t setCollapseRedundantSetters(bool enable);
+        bool getCollapseRedundantSetters() const;
 
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode_LocalAndRemote;
+        bool m_collapseRedundantSetters = false;
     };
 }
 
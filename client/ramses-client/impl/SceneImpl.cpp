@@ -94,12 +94,14 @@
 #include "DataSlotUtils.h"
 #include "PickableObjectImpl.h"
 #include "SceneReferenceImpl.h"
+#include "ISceneFlushListener.h"
 
 #include "Components/FlushTimeInformation.h"
 #include "PlatformAbstraction/PlatformMath.h"
 #include "Utils/TextureMathUtils.h"
 
 #include <array>
+#include <algorithm>
 
 namespace ramses
 {
@@ -111,7 +113,9 @@ namespace ramses
         , m_hlClient(ramsesClient)
     {
         LOG_INFO(ramses_internal::CONTEXT_CLIENT, "Scene::Scene: sceneId " << scene.getSceneId()  <<
-                 ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode_LocalAndRemote ? "LocalAndRemote" : "LocalOnly"));
+                 ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode_LocalAndRemote ? "LocalAndRemote" : "LocalOnly") <<
+                 ", collapseRedundantSetters " << sceneConfig.getCollapseRedundantSetters());
+        m_scene.setCollapseRedundantSetters(sceneConfig.getCollapseRedundantSetters());
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
         const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode_LocalOnly;
         getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
@@ -1351,6 +1355,8 @@ namespace ramses
 
         const ramses_internal::SceneVersionTag sceneVersionInternal(sceneVersion);
 
+        notifyFlushListeners();
+
         m_commandBuffer.execute(ramses_internal::SceneCommandVisitor(*this));
         applyHierarchicalVisibility();
 
@@ -1366,6 +1372,25 @@ namespace ramses
         return StatusOK;
     }
 
+    void SceneImpl::addFlushListener(ISceneFlushListener& listener)
+    {
+        assert(std::find(m_flushListeners.cbegin(), m_flushListeners.cend(), &listener) == m_flushListeners.cend());
+        m_flushListeners.push_back(&listener);
+    }
+
+    void SceneImpl::removeFlushListener(ISceneFlushListener& listener)
+    {
+        auto it = std::find(m_flushListeners.begin(), m_flushListeners.end(), &listener);
+        assert(it != m_flushListeners.end());
+        m_flushListeners.erase(it);
+    }
+
+    void SceneImpl::notifyFlushListeners()
+    {
+        for (auto listener : m_flushListeners)
+            listener->onSceneFlush();
+    }
+
     AnimationSystem* SceneImpl::createAnimationSystem(uint32_t flags, const char* name)
     {
         uint32_t creationFlags = ramses_internal::EAnimationSystemFlags_Default;
@@ -58,6 +58,7 @@ namespace ramses
     class AnimationSystemImpl;
     class AttributeInput;
     class NodeImpl;
+    class ISceneFlushListener;
     class RenderGroup;
     class RenderPass;
     class RenderBuffer;
@@ -224,6 +225,9 @@ namespace ramses
         status_t setExpirationTimestamp(uint64_t ptpExpirationTimestampInMilliseconds);
 
         status_t flush(sceneVersionTag_t sceneVersion);
+        void addFlushListener(ISceneFlushListener& listener);
+        void removeFlushListener(ISceneFlushListener& listener);
+        void notifyFlushListeners();
 
         const ramses_internal::ClientScene& getIScene() const;
         ramses_internal::ClientScene& getIScene();
@@ -293,6 +297,7 @@ namespace ramses
         ramses_internal::ClientScene&           m_scene;
         ramses_internal::SceneCommandBuffer     m_commandBuffer;
         sceneVersionTag_t                       m_nextSceneVersion;
+        std::vector<ISceneFlushListener*>       m_flushListeners;
 
         RamsesObjectRegistry m_objectRegistry;
 
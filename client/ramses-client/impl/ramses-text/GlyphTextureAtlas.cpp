@@ -7,6 +7,8 @@
 //  -------------------------------------------------------------------------
 
 #include "ramses-text/GlyphTextureAtlas.h"
+#include "ramses-client-api/Scene.h"
+#include "SceneImpl.h"
 #include "Utils/LogMacros.h"
 #include <assert.h>
 #include <algorithm>
@@ -17,13 +19,21 @@ namespace ramses
         : m_scene(scene)
         , m_pageSize(pageSize)
     {
+        m_scene.impl.addFlushListener(*this);
     }
 
     GlyphTextureAtlas::~GlyphTextureAtlas()
     {
+        m_scene.impl.removeFlushListener(*this);
         m_glyphAtlasPages.clear();
     }
 
+    void GlyphTextureAtlas::onSceneFlush()
+    {
+        for (auto& page : m_glyphAtlasPages)
+            page->updateTextureResource(m_cacheForGlyphPageDataUpdate);
+    }
+
     GlyphTexturePage& GlyphTextureAtlas::getPage(size_t atlasPage)
     {
         assert(atlasPage < m_glyphAtlasPages.size());
@@ -89,7 +99,7 @@ namespace ramses
         {
             GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
             glyphInfo.glyphMapping.emplace(atlasPage, GlyphMapping{ 1u, *it });
-            getPage(atlasPage).updateDataWithPadding(*it, &glyphInfo.data[0], m_cacheForGlyphPageDataUpdate);
+            getPage(atlasPage).updateDataWithPadding(*it, &glyphInfo.data[0]);
             it++;
         }
 
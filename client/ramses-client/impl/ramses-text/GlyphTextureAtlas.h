@@ -13,6 +13,7 @@
 #include "ramses-text-api/GlyphMetrics.h"
 #include "ramses-text/GlyphGeometry.h"
 #include "ramses-text/GlyphTexturePage.h"
+#include "ISceneFlushListener.h"
 
 #include <unordered_map>
 #include <memory>
@@ -22,11 +23,12 @@ namespace ramses
     class Scene;
     class TextureSampler;
 
-    class GlyphTextureAtlas
+    // Glyphs mapped to a page are uploaded to its texture once per scene flush, not per mapping
+    class GlyphTextureAtlas : public ISceneFlushListener
     {
     public:
         GlyphTextureAtlas(Scene& scene, QuadSize const& pageSize);
-        ~GlyphTextureAtlas();
+        virtual ~GlyphTextureAtlas() override;
 
         void registerGlyph(const GlyphKey& key, const QuadSize& size, GlyphData&& data);
         bool isGlyphRegistered(const GlyphKey& key) const;
@@ -36,6 +38,9 @@ namespace ramses
 
         const TextureSampler& getTextureSampler(size_t atlasPage) const;
 
+        // ISceneFlushListener
+        virtual void onSceneFlush() override;
+
         GlyphTextureAtlas(const GlyphTextureAtlas&) = delete;
         GlyphTextureAtlas& operator=(const GlyphTextureAtlas&) = delete;
         GlyphTextureAtlas(GlyphTextureAtlas&&) = delete;
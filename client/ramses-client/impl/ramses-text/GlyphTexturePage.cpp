@@ -11,29 +11,16 @@
 #include "ramses-client-api/TextureSampler.h"
 #include "ramses-client-api/Texture2DBuffer.h"
 #include <assert.h>
-
-
-namespace
-{
-    bool CanFitQuadInFreeSpace(const ramses::QuadSize& freeSpace, const ramses::QuadSize& quadToFit, uint32_t& remainingSpaceOut)
-    {
-        const bool canFit = freeSpace.x >= quadToFit.x && freeSpace.y >= quadToFit.y;
-        if (!canFit)
-        {
-            return false;
-        }
-        else
-        {
-            remainingSpaceOut = freeSpace.getArea() - quadToFit.getArea();
-            return true;
-        }
-    }
-}
+#include <algorithm>
+#include <limits>
 
 namespace ramses
 {
     GlyphTexturePage::GlyphTexturePage(Scene& scene, const QuadSize& size)
         : m_size(size)
+        , m_pageData(size.getArea(), 0u)
+        , m_dirtyMinX(size.x)
+        , m_dirtyMinY(size.y)
         , m_ownerScene(scene)
         , m_textureBuffer(*scene.createTexture2DBuffer(
             1u,
@@ -48,7 +35,7 @@ namespace ramses
             ETextureSamplingMethod_Linear,
             m_textureBuffer))
     {
-        m_freeQuads.push_back(Quad(QuadOffset(0, 0), size));
+        addFreeQuad(Quad(QuadOffset(0, 0), size));
     }
 
     GlyphTexturePage::~GlyphTexturePage()
@@ -57,7 +44,7 @@ namespace ramses
         m_ownerScene.destroy(m_textureSampler);
     }
 
-    void GlyphTexturePage::updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData, GlyphPageData& cacheForDataUpdate)
+    void GlyphTexturePage::updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData)
     {
         // Glyph size contains the padding, but the source pixel data does not...
         // TODO Violin correct glyph size to not contain the padding
@@ -68,15 +55,42 @@ namespace ramses
         assert(targetQuad.getOrigin().x + targetQuad.getSize().x <= m_size.x);
         assert(targetQuad.getOrigin().y + targetQuad.getSize().y <= m_size.y);
 
-        const uint32_t targetQuadArea = targetQuad.getSize().getArea();
-        if (cacheForDataUpdate.size() < targetQuadArea)
+        copyPaddingToPageData(targetQuad);
+        copyUpdateDataWithoutPaddingToPageData(targetQuad, sourceData);
+
+        m_dirtyMinX = std::min(m_dirtyMinX, targetQuad.getOrigin().x);
+        m_dirtyMinY = std::min(m_dirtyMinY, targetQuad.getOrigin().y);
+        m_dirtyMaxX = std::max(m_dirtyMaxX, targetQuad.getOrigin().x + targetQuad.getSize().x);
+        m_dirtyMaxY = std::max(m_dirtyMaxY, targetQuad.getOrigin().y + targetQuad.getSize().y);
+    }
+
+    void GlyphTexturePage::updateTextureResource(GlyphPageData& cacheForDataUpdate)
+    {
+        if (m_dirtyMinX >= m_dirtyMaxX || m_dirtyMinY >= m_dirtyMaxY)
+            return;
+
+        // All glyphs written since last update are uploaded at once, as a single quad enclosing all of them
+        const uint32_t dirtyWidth = m_dirtyMaxX - m_dirtyMinX;
+        const uint32_t dirtyHeight = m_dirtyMaxY - m_dirtyMinY;
+        if (cacheForDataUpdate.size() < dirtyWidth * dirtyHeight)
+        {
+            cacheForDataUpdate.resize(dirtyWidth * dirtyHeight);
+        }
+
+        for (uint32_t row = 0u; row < dirtyHeight; ++row)
         {
-            cacheForDataUpdate.resize(targetQuadArea);
+            const auto pageRowBegin = m_pageData.cbegin() + (m_dirtyMinY + row) * m_size.x + m_dirtyMinX;
+            std::copy(pageRowBegin, pageRowBegin + dirtyWidth, cacheForDataUpdate.begin() + row * dirtyWidth);
         }
 
-        copyPaddingToCache(targetQuad, cacheForDataUpdate);
-        copyUpdateDataWithoutPaddingToCache(targetQuad, sourceData, cacheForDataUpdate);
-        updateTextureResource(targetQuad, cacheForDataUpdate);
+        // Cast is needed because texture buffer API is more generic and allows more data types -> hence char*, not uint8_t
+        const char* castedData = reinterpret_cast<const char*>(cacheForDataUpdate.data());
+        m_textureBuffer.setData(castedData, 0, m_dirtyMinX, m_dirtyMinY, dirtyWidth, dirtyHeight);
+
+        m_dirtyMinX = m_size.x;
+        m_dirtyMinY = m_size.y;
+        m_dirtyMaxX = 0u;
+        m_dirtyMaxY = 0u;
     }
 
     const TextureSampler& GlyphTexturePage::getSampler() const
@@ -89,17 +103,18 @@ namespace ramses
         return m_textureBuffer;
     }
 
-    const Quads& GlyphTexturePage::getFreeSpace() const
+    const GlyphTexturePage::FreeQuads& GlyphTexturePage::getFreeSpace() const
     {
         return m_freeQuads;
     }
 
     QuadOffset GlyphTexturePage::claimSpace(QuadIndex freeQuadIndex, const QuadSize& subportionSize)
     {
-        const Quad box = m_freeQuads[freeQuadIndex];
+        assert(m_freeQuads.count(freeQuadIndex) == 1u);
+        const Quad box = m_freeQuads.at(freeQuadIndex);
         assert(subportionSize.y <= box.getSize().y && subportionSize.x <= box.getSize().x);
 
-        m_freeQuads.erase(m_freeQuads.begin() + freeQuadIndex);
+        removeFreeQuad(freeQuadIndex);
 
         const uint32_t px = box.getOrigin().x;
         const uint32_t py = box.getOrigin().y;
@@ -138,102 +153,148 @@ namespace ramses
     void GlyphTexturePage::releaseSpace(Quad box)
     {
         assert(box.getSize().getArea() != 0);
-        assert(m_freeQuads.end() == std::find_if(m_freeQuads.begin(), m_freeQuads.end(), [&box](Quad const& quad)
+        assert(m_freeQuads.end() == std::find_if(m_freeQuads.begin(), m_freeQuads.end(), [&box](FreeQuads::value_type const& freeQuad)
         {
-            return quad.intersects(box);
+            return freeQuad.second.intersects(box);
         }));
 
         while (mergeFreeQuad(box));
-        m_freeQuads.push_back(box);
+        addFreeQuad(box);
+    }
+
+    void GlyphTexturePage::addFreeQuad(const Quad& quad)
+    {
+        const QuadIndex freeQuadIndex = m_nextFreeQuadIndex++;
+        m_freeQuads.emplace(freeQuadIndex, quad);
+        m_freeQuadsBySize[quad.getSize().y].emplace(quad.getSize().x, freeQuadIndex);
+
+        const uint32_t minX = quad.getOrigin().x;
+        const uint32_t minY = quad.getOrigin().y;
+        const uint32_t maxX = minX + quad.getSize().x;
+        const uint32_t maxY = minY + quad.getSize().y;
+        m_leftEdges.emplace(Edge(minX, minY, maxY), freeQuadIndex);
+        m_rightEdges.emplace(Edge(maxX, minY, maxY), freeQuadIndex);
+        m_topEdges.emplace(Edge(minY, minX, maxX), freeQuadIndex);
+        m_bottomEdges.emplace(Edge(maxY, minX, maxX), freeQuadIndex);
+    }
+
+    void GlyphTexturePage::removeFreeQuad(QuadIndex freeQuadIndex)
+    {
+        const auto freeQuadIt = m_freeQuads.find(freeQuadIndex);
+        assert(freeQuadIt != m_freeQuads.end());
+        const Quad& quad = freeQuadIt->second;
+
+        const uint32_t minX = quad.getOrigin().x;
+        const uint32_t minY = quad.getOrigin().y;
+        const uint32_t maxX = minX + quad.getSize().x;
+        const uint32_t maxY = minY + quad.getSize().y;
+        m_leftEdges.erase(Edge(minX, minY, maxY));
+        m_rightEdges.erase(Edge(maxX, minY, maxY));
+        m_topEdges.erase(Edge(minY, minX, maxX));
+        m_bottomEdges.erase(Edge(maxY, minX, maxX));
+
+        const auto freeQuadsWithHeightIt = m_freeQuadsBySize.find(quad.getSize().y);
+        assert(freeQuadsWithHeightIt != m_freeQuadsBySize.end());
+        freeQuadsWithHeightIt->second.erase({ quad.getSize().x, freeQuadIndex });
+        if (freeQuadsWithHeightIt->second.empty())
+            m_freeQuadsBySize.erase(freeQuadsWithHeightIt);
+        m_freeQuads.erase(freeQuadIt);
     }
 
     // TODO Violin fix this, make it not have an "in and out" parameter
     bool GlyphTexturePage::mergeFreeQuad(Quad& freeQuadInAndOut)
     {
-        const uint32_t n = uint32_t(m_freeQuads.size());
-        for (uint32_t i = 0; i < n; i++)
-        {
-            Quad& box2 = m_freeQuads[i];
-            if (freeQuadInAndOut.merge(box2))
-            {
-                m_freeQuads.erase(m_freeQuads.begin() + i);
-                return true;
-            }
-        }
-        return false;
+        // Free quads do not intersect, so there is at most one neighbor sharing each of the edges.
+        // Oldest one is merged first, same as when searching through all free quads in order of creation.
+        const uint32_t minX = freeQuadInAndOut.getOrigin().x;
+        const uint32_t minY = freeQuadInAndOut.getOrigin().y;
+        const uint32_t maxX = minX + freeQuadInAndOut.getSize().x;
+        const uint32_t maxY = minY + freeQuadInAndOut.getSize().y;
+
+        QuadIndex candidate = std::numeric_limits<QuadIndex>::max();
+        FindMergeCandidate(m_rightEdges, Edge(minX, minY, maxY), candidate);
+        FindMergeCandidate(m_leftEdges, Edge(maxX, minY, maxY), candidate);
+        FindMergeCandidate(m_bottomEdges, Edge(minY, minX, maxX), candidate);
+        FindMergeCandidate(m_topEdges, Edge(maxY, minX, maxX), candidate);
+        if (candidate == std::numeric_limits<QuadIndex>::max())
+            return false;
+
+        const bool merged = freeQuadInAndOut.merge(m_freeQuads.at(candidate));
+        assert(merged);
+        (void)merged;
+        removeFreeQuad(candidate);
+        return true;
     }
 
-    void GlyphTexturePage::copyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate)
+    void GlyphTexturePage::FindMergeCandidate(const EdgeToFreeQuad& edges, const Edge& edge, QuadIndex& candidateInAndOut)
     {
-        const uint32_t targetRowCount = updateQuad.getSize().y;
-        const uint32_t targetColumnCount = updateQuad.getSize().x;
+        const auto edgeIt = edges.find(edge);
+        if (edgeIt != edges.end())
+            candidateInAndOut = std::min(candidateInAndOut, edgeIt->second);
+    }
 
-        for (uint32_t i = 0u; i < targetRowCount; ++i)
+    void GlyphTexturePage::copyPaddingToPageData(const Quad& updateQuad)
+    {
+        const uint32_t firstRow = updateQuad.getOrigin().y;
+        const uint32_t lastRow = firstRow + updateQuad.getSize().y - 1;
+        const uint32_t firstColumn = updateQuad.getOrigin().x;
+        const uint32_t lastColumn = firstColumn + updateQuad.getSize().x - 1;
+
+        for (uint32_t row = firstRow; row <= lastRow; ++row)
         {
-            cacheForDataUpdate[i * targetColumnCount] = 0; //first column
-            cacheForDataUpdate[i * targetColumnCount + targetColumnCount - 1] = 0; //last column
+            m_pageData[row * m_size.x + firstColumn] = 0; //first column
+            m_pageData[row * m_size.x + lastColumn] = 0; //last column
         }
 
-        for (uint32_t i = 0u; i < targetColumnCount; ++i)
+        for (uint32_t column = firstColumn; column <= lastColumn; ++column)
         {
-            cacheForDataUpdate[i] = 0; //first row
-            cacheForDataUpdate[i + (targetRowCount - 1) * targetColumnCount] = 0; // last row
+            m_pageData[firstRow * m_size.x + column] = 0; //first row
+            m_pageData[lastRow * m_size.x + column] = 0; // last row
         }
     }
 
-    void GlyphTexturePage::copyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate)
+    void GlyphTexturePage::copyUpdateDataWithoutPaddingToPageData(const Quad& updateQuad, const uint8_t* data)
     {
         const uint32_t targetRowCount = updateQuad.getSize().y;
         const uint32_t targetColumnCount = updateQuad.getSize().x;
         const uint32_t sourceColumnCount = targetColumnCount - 2;
         for (uint32_t targetRow = 1u; targetRow < targetRowCount - 1u; ++targetRow)
         {
-            for (uint32_t targetCol = 1u; targetCol < targetColumnCount - 1u; ++targetCol)
-            {
-                const uint32_t targetOffset = targetRow*(targetColumnCount)+targetCol;
-
-                // Exclude the padding
-                const uint32_t sourceRow = targetRow - 1;
-                const uint32_t sourceCol = targetCol - 1;
-
-                cacheForDataUpdate[targetOffset] = data[sourceColumnCount * sourceRow + sourceCol];
-            }
+            // Exclude the padding
+            const uint8_t* sourceRowBegin = data + sourceColumnCount * (targetRow - 1);
+            const uint32_t targetOffset = (updateQuad.getOrigin().y + targetRow) * m_size.x + updateQuad.getOrigin().x + 1;
+            std::copy(sourceRowBegin, sourceRowBegin + sourceColumnCount, m_pageData.begin() + targetOffset);
         }
     }
 
-    void GlyphTexturePage::updateTextureResource(const Quad& updateQuade, const GlyphPageData& pageData)
-    {
-        // Cast is needed because texture buffer API is more generic and allows more data types -> hence char*, not uint8_t
-        const char* castedData = reinterpret_cast<const char*>(pageData.data());
-        m_textureBuffer.setData(castedData, 0, updateQuade.getOrigin().x, updateQuade.getOrigin().y, updateQuade.getSize().x, updateQuade.getSize().y);
-    }
-
     GlyphTexturePage::QuadIndex GlyphTexturePage::findFreeSpace(QuadSize const& size) const
     {
         assert(size.getArea() > 0);
         assert(size.x <= m_size.x && size.y <= m_size.y);
 
-        uint32_t scoreOfBestFit = std::numeric_limits<uint32_t>::max();
-        GlyphTexturePage::QuadIndex bestQuadIndex = std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
-
-        for (GlyphTexturePage::QuadIndex i = 0; i < m_freeQuads.size(); i++)
+        // Free quad with smallest area that fits wastes least space, from quads with same area the first created is chosen.
+        // For every height that fits only the narrowest fitting quad is a candidate, heights are visited in ascending order
+        // until even the narrowest possible quad of that height cannot be smaller than best candidate.
+        QuadIndex bestFreeQuad = std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
+        uint32_t bestArea = std::numeric_limits<uint32_t>::max();
+        for (auto heightIt = m_freeQuadsBySize.lower_bound(size.y); heightIt != m_freeQuadsBySize.end(); ++heightIt)
         {
-            uint32_t newScore;
-            const bool canFit = CanFitQuadInFreeSpace(m_freeQuads[i].getSize(), size, newScore);
-            if (canFit)
+            const uint32_t height = heightIt->first;
+            if (static_cast<uint64_t>(height) * size.x > bestArea)
+                break;
+
+            const auto widthIt = heightIt->second.lower_bound({ size.x, 0u });
+            if (widthIt == heightIt->second.end())
+                continue;
+
+            const uint32_t area = height * widthIt->first;
+            if (area < bestArea || (area == bestArea && widthIt->second < bestFreeQuad))
             {
-                const bool fitsBetter = (newScore < scoreOfBestFit);
-                if (fitsBetter)
-                {
-                    bestQuadIndex = i;
-                    scoreOfBestFit = newScore;
-                }
-
-                if (scoreOfBestFit == 0)
-                    break;
+                bestArea = area;
+                bestFreeQuad = widthIt->second;
             }
         }
 
-        return bestQuadIndex;
+        return bestFreeQuad;
     }
 }
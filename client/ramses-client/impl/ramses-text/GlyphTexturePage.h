@@ -10,6 +10,9 @@
 #define RAMSES_GLYPHTEXTUREPAGE_H
 
 #include "ramses-text/Quad.h"
+#include <map>
+#include <set>
+#include <tuple>
 
 namespace ramses
 {
@@ -28,28 +31,58 @@ namespace ramses
         GlyphTexturePage& operator=(const GlyphTexturePage&) = delete;
         GlyphTexturePage& operator=(const GlyphTexturePage&&) = delete;
 
+        // Free quads are identified by index which stays valid until quad is claimed or merged,
+        // free space iterates quads in order they were created
         using QuadIndex = size_t;
+        using FreeQuads = std::map<QuadIndex, Quad>;
         using GlyphPageData = std::vector<uint8_t>;
 
         // Free space management
-        const Quads& getFreeSpace() const;
+        const FreeQuads& getFreeSpace() const;
         QuadOffset claimSpace(QuadIndex freeQuadIndex, const QuadSize& subportionSize);
         void releaseSpace(Quad quad);
         QuadIndex findFreeSpace(QuadSize const& size) const;
 
         // Texture data management
-        void updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData, GlyphPageData& cacheForDataUpdate);
+        // Data is written to page and uploaded to texture resource together with all other data written since last update
+        void updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData);
+        void updateTextureResource(GlyphPageData& cacheForDataUpdate);
         const Texture2DBuffer& getTextureBuffer() const;
         const TextureSampler& getSampler() const;
 
     private:
+        // position of edge, begin and end along edge
+        using Edge = std::tuple<uint32_t, uint32_t, uint32_t>;
+        using EdgeToFreeQuad = std::map<Edge, QuadIndex>;
+
+        void addFreeQuad(const Quad& quad);
+        void removeFreeQuad(QuadIndex freeQuadIndex);
         bool mergeFreeQuad(Quad& freeQuadInAndOut);
-        void copyPaddingToCache(const Quad& updateQuad, GlyphPageData& cacheForDataUpdate);
-        void copyUpdateDataWithoutPaddingToCache(const Quad& updateQuad, const uint8_t* data, GlyphPageData& cacheForDataUpdate);
-        void updateTextureResource(const Quad& updateQuade, const GlyphPageData& pageData);
+        static void FindMergeCandidate(const EdgeToFreeQuad& edges, const Edge& edge, QuadIndex& candidateInAndOut);
+        void copyPaddingToPageData(const Quad& updateQuad);
+        void copyUpdateDataWithoutPaddingToPageData(const Quad& updateQuad, const uint8_t* data);
 
         const QuadSize m_size;
-        Quads m_freeQuads;
+
+        FreeQuads m_freeQuads;
+        QuadIndex m_nextFreeQuadIndex = 0u;
+        // free quads by height, then by width and creation, so that best fitting free quad is found
+        // by visiting each distinct height at most once instead of all free quads
+        using FreeQuadsByWidth = std::set<std::pair<uint32_t, QuadIndex>>;
+        std::map<uint32_t, FreeQuadsByWidth> m_freeQuadsBySize;
+        // free quads with common edge can be merged, edges are indexed by side of quad they belong to
+        EdgeToFreeQuad m_leftEdges;
+        EdgeToFreeQuad m_rightEdges;
+        EdgeToFreeQuad m_topEdges;
+        EdgeToFreeQuad m_bottomEdges;
+
+        // copy of texture data, dirty quad is not yet uploaded to texture resource
+        GlyphPageData m_pageData;
+        uint32_t m_dirtyMinX;
+        uint32_t m_dirtyMinY;
+        uint32_t m_dirtyMaxX = 0u;
+        uint32_t m_dirtyMaxY = 0u;
+
         Scene& m_ownerScene;
         Texture2DBuffer& m_textureBuffer;
         TextureSampler&  m_textureSampler;
@@ -11,6 +11,7 @@
 #include "ramses-client-api/Appearance.h"
 #include "ramses-client-api/UInt16Array.h"
 #include "ramses-client-api/GeometryBinding.h"
+#include "ramses-client-api/Vector3fArray.h"
 
 // internal
 #include "NodeImpl.h"
@@ -114,4 +115,30 @@ namespace ramses
     {
         return impl.getInstanceCount();
     }
+
+    status_t MeshNode::setBoundingBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ)
+    {
+        const status_t status = impl.setBoundingBox(minX, minY, minZ, maxX, maxY, maxZ);
+        LOG_HL_CLIENT_API6(status, minX, minY, minZ, maxX, maxY, maxZ);
+        return status;
+    }
+
+    status_t MeshNode::setBoundingBoxFromVertexPositions(const Vector3fArray& vertexPositions)
+    {
+        const status_t status = impl.setBoundingBoxFromVertexPositions(vertexPositions.impl);
+        LOG_HL_CLIENT_API1(status, LOG_API_RAMSESOBJECT_STRING(vertexPositions));
+        return status;
+    }
+
+    status_t MeshNode::removeBoundingBox()
+    {
+        const status_t status = impl.removeBoundingBox();
+        LOG_HL_CLIENT_API_NOARG(status);
+        return status;
+    }
+
+    status_t MeshNode::getBoundingBox(float& minX, float& minY, float& minZ, float& maxX, float& maxY, float& maxZ) const
+    {
+        return impl.getBoundingBox(minX, minY, minZ, maxX, maxY, maxZ);
+    }
 }
@@ -37,4 +37,11 @@ namespace ramses
         LOG_HL_CLIENT_API1(status, publicationMode);
         return status;
     }
+
+    status_t SceneConfig::setCollapseRedundantSetters(bool enable)
+    {
+        const status_t status = impl.setCollapseRedundantSetters(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
 }
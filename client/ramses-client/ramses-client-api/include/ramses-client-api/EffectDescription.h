@@ -68,6 +68,9 @@ namespace ramses
         *        on the client, such as projection matrix, framebuffer resolution etc.
         *        Value of an uniform corresponding to the given semantic name
         *        will be automatically set based on its semantic type.
+        *        Model dependent semantics can be set on uniform arrays indexed by gl_InstanceID,
+        *        so that the renderer can merge renderables into one draw call
+        *        (see ramses::DisplayConfig::setDrawCallBatchingEnabled for the shader contract).
         * @param[in] inputName Name of the effect input as used in the shader source code.
         * @param[in] semanticType Semantic type to be used for given input.
         * @return StatusOK for success, otherwise the returned status can be used
@@ -145,6 +145,60 @@ namespace ramses
         */
         uint32_t getInstanceCount() const;
 
+        /**
+        * @brief Sets bounding box of this mesh in local space of the mesh node.
+        *        Renderer skips drawing of the mesh in a render pass if its bounding box
+        *        is completely outside of the view frustum of the render pass camera.
+        *        A mesh without bounding box is never culled.
+        *        Instanced meshes (instance count > 1 or vertex attributes with instancing divisor)
+        *        are never culled either, as the bounding box only covers the base mesh.
+        *
+        * @param[in] minX Minimum x coordinate of the bounding box
+        * @param[in] minY Minimum y coordinate of the bounding box
+        * @param[in] minZ Minimum z coordinate of the bounding box
+        * @param[in] maxX Maximum x coordinate of the bounding box
+        * @param[in] maxY Maximum y coordinate of the bounding box
+        * @param[in] maxZ Maximum z coordinate of the bounding box
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setBoundingBox(float minX, float minY, float minZ, float maxX, float maxY, float maxZ);
+
+        /**
+        * @brief Computes bounding box of this mesh from given vertex positions
+        *        and sets it, see #setBoundingBox for details.
+        *        Note that the bounding box is not updated automatically if vertex positions
+        *        used by the mesh change later on.
+        *
+        * @param[in] vertexPositions Vertex positions used by this mesh, must not be empty
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setBoundingBoxFromVertexPositions(const Vector3fArray& vertexPositions);
+
+        /**
+        * @brief Removes bounding box of this mesh, the mesh will never be culled by renderer.
+        *
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t removeBoundingBox();
+
+        /**
+        * @brief Gets bounding box of this mesh.
+        *
+        * @param[out] minX Minimum x coordinate of the bounding box
+        * @param[out] minY Minimum y coordinate of the bounding box
+        * @param[out] minZ Minimum z coordinate of the bounding box
+        * @param[out] maxX Maximum x coordinate of the bounding box
+        * @param[out] maxY Maximum y coordinate of the bounding box
+        * @param[out] maxZ Maximum z coordinate of the bounding box
+        * @return StatusOK for success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        *         Fails if no bounding box is set.
+        */
+        status_t getBoundingBox(float& minX, float& minY, float& minZ, float& maxX, float& maxY, float& maxZ) const;
+
         /**
         * Stores internal data for implementation specifics of MeshNode.
         */
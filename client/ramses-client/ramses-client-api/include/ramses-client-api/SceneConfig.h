@@ -50,6 +50,20 @@ namespace ramses
         */
         status_t setPublicationMode(EScenePublicationMode publicationMode);
 
+        /**
+        * @brief Enable collapsing of repeated scene updates within a flush.
+        *
+        * When enabled, a property that is set multiple times between two calls to Scene::flush
+        * (e.g. node translation, uniform input value, render state) is sent to renderer only with
+        * its last value. This reduces flush size and time needed to apply the flush on renderer side
+        * for applications that change the same values several times per flush. Disabled by default.
+        *
+        * @param[in] enable Whether to collapse repeated scene updates.
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setCollapseRedundantSetters(bool enable);
+
         /**
         * Stores internal data for implementation specifics of SceneConfig.
         */
@@ -70,6 +70,11 @@ namespace ramses
 
         /**
         * @brief Create the scene objects, e.g., mesh and appearance...etc, needed for rendering a text line (represented by glyph metrics)
+        *
+        * Glyphs newly put to the atlas textures are written to the texture data when the scene is flushed
+        * or saved to file (see RamsesClient::saveSceneToFile), together with glyphs of all other text lines
+        * created since then.
+        *
         * @param[in] glyphs The glyph metrics for which to create a text line
         * @param[in] effect The effect used for creating the appearance of the text line and rendering the meshes
         * @return Id of the text line created
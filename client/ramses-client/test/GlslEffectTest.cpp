@@ -311,6 +311,38 @@ TEST_F(AGlslEffect, canParseShaderInputs)
     EXPECT_EQ(EffectInputInformation("attributeFloat", 1, EDataType_FloatBuffer, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid), attributes[1]);
 }
 
+TEST_F(AGlslEffect, keepsSemanticOfUniformArrayUsedForDrawCallBatching)
+{
+    const char* vertexShader =
+        "#version 300 es\n"
+        "uniform highp mat4 mvpMatrix[16];\n"
+        "in vec3 a_position;\n"
+        "void main(void)\n"
+        "{\n"
+        "    gl_Position = mvpMatrix[gl_InstanceID] * vec4(a_position, 1.0);\n"
+        "}\n";
+    const char* fragmentShader =
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "out vec4 fragColor;\n"
+        "void main(void)\n"
+        "{\n"
+        "    fragColor = vec4(1.0);\n"
+        "}\n";
+
+    HashMap<String, EFixedSemantics> semantics;
+    semantics.put("mvpMatrix", EFixedSemantics_ModelViewProjectionMatrix);
+
+    GlslEffect ge(vertexShader, fragmentShader, emptyCompilerDefines, semantics, "");
+    std::unique_ptr<EffectResource> res(ge.createEffectResource(ResourceCacheFlag(0u)));
+    ASSERT_TRUE(res);
+
+    // renderer merges up to 16 renderables into one instanced draw call, see ramses::DisplayConfig::setDrawCallBatchingEnabled
+    const EffectInputInformationVector& uniforms = res->getUniformInputs();
+    ASSERT_EQ(1u, uniforms.size());
+    EXPECT_EQ(EffectInputInformation("mvpMatrix", 16, EDataType_Matrix44F, EFixedSemantics_ModelViewProjectionMatrix, EEffectInputTextureType_Invalid), uniforms[0]);
+}
+
 TEST_F(AGlslEffect, canParseSamplerInputsGLSLES2)
 {
     const char* vertexShader =
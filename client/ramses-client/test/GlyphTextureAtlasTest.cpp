@@ -8,10 +8,17 @@
 
 #include "ramses-text/GlyphTextureAtlas.h"
 #include "ramses-client-api/RamsesClient.h"
+#include "ramses-client-api/Scene.h"
+#include "ramses-client-api/Texture2DBuffer.h"
+#include "ramses-client-api/SceneObjectIterator.h"
+#include "ramses-client-api/ResourceFileDescriptionSet.h"
+#include "ramses-utils.h"
 #include "ramses-text/GlyphGeometry.h"
 #include "ramses-text-api/Glyph.h"
 #include "ramses-text-api/FontRegistry.h"
 #include "gtest/gtest.h"
+#include "Utils/File.h"
+#include <algorithm>
 
 namespace
 {
@@ -445,4 +452,47 @@ namespace ramses
         // TODO(Violin) does not work yet
         //EXPECT_EQ(0u, geometry4.atlasPage);
     }
+
+    TEST_F(AGlyphTextureAtlas, UploadsMappedGlyphsToPageTextureWhenSceneIsFlushed)
+    {
+        const GlyphMetricsVector glyphs =
+        {
+            { GlyphKey(GlyphId('a'), FakeFontId), 4, 3, 0, 0, 0 },
+            { GlyphKey(GlyphId('b'), FakeFontId), 2, 5, 0, 0, 0 }
+        };
+        for (const auto& glyph : glyphs)
+            m_atlas.registerGlyph(glyph.key, QuadSize(glyph.width, glyph.height), GlyphData(glyph.width * glyph.height, 0xFFu));
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry(glyphs).atlasPage);
+
+        SceneObjectIterator iterator(m_scene, ERamsesObjectType_Texture2DBuffer);
+        RamsesObject* pageTexture = iterator.getNext();
+        ASSERT_TRUE(nullptr != pageTexture);
+        const Texture2DBuffer& textureBuffer = *RamsesUtils::TryConvert<Texture2DBuffer>(*pageTexture);
+        EXPECT_TRUE(nullptr == iterator.getNext());
+
+        std::vector<uint8_t> texels(AtlasTextureWidth * AtlasTextureHeight, 0u);
+        textureBuffer.getMipLevelData(0u, reinterpret_cast<char*>(texels.data()), static_cast<uint32_t>(texels.size()));
+        EXPECT_EQ(0, std::count(texels.cbegin(), texels.cend(), 0xFFu));
+
+        m_scene.flush();
+        textureBuffer.getMipLevelData(0u, reinterpret_cast<char*>(texels.data()), static_cast<uint32_t>(texels.size()));
+        EXPECT_LT(0, std::count(texels.cbegin(), texels.cend(), 0xFFu));
+    }
+
+    TEST_F(AGlyphTextureAtlas, WritesMappedGlyphsToPageTextureWhenSceneIsSavedToFile)
+    {
+        const GlyphMetricsVector glyphs = { { GlyphKey(GlyphId('a'), FakeFontId), 4, 3, 0, 0, 0 } };
+        m_atlas.registerGlyph(glyphs.front().key, QuadSize(4, 3), GlyphData(4 * 3, 0xFFu));
+        EXPECT_EQ(0u, m_atlas.mapGlyphsAndCreateGeometry(glyphs).atlasPage);
+
+        SceneObjectIterator iterator(m_scene, ERamsesObjectType_Texture2DBuffer);
+        const Texture2DBuffer& textureBuffer = *RamsesUtils::TryConvert<Texture2DBuffer>(*iterator.getNext());
+
+        EXPECT_EQ(StatusOK, m_client.saveSceneToFile(m_scene, "glyphAtlasScene.ramscene", ResourceFileDescriptionSet(), false));
+        std::vector<uint8_t> texels(AtlasTextureWidth * AtlasTextureHeight, 0u);
+        textureBuffer.getMipLevelData(0u, reinterpret_cast<char*>(texels.data()), static_cast<uint32_t>(texels.size()));
+        EXPECT_LT(0, std::count(texels.cbegin(), texels.cend(), 0xFFu));
+
+        ramses_internal::File("glyphAtlasScene.ramscene").remove();
+    }
 }
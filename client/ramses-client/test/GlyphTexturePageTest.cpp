@@ -37,13 +37,36 @@ namespace ramses
         void expectFreeArea(uint32_t expected)
         {
             uint32_t area = 0;
-            for (auto const& quad : m_glyphPage->getFreeSpace())
+            for (auto const& freeQuad : m_glyphPage->getFreeSpace())
             {
-                area += quad.getSize().getArea();
+                area += freeQuad.second.getSize().getArea();
             }
             EXPECT_EQ(area, expected);
         }
 
+        GlyphTexturePage::QuadIndex getFirstFreeQuadIndex() const
+        {
+            assert(!m_glyphPage->getFreeSpace().empty());
+            return m_glyphPage->getFreeSpace().begin()->first;
+        }
+
+        GlyphTexturePage::QuadIndex getFreeQuadIndex(const QuadSize& size) const
+        {
+            for (auto const& freeQuad : m_glyphPage->getFreeSpace())
+            {
+                if (freeQuad.second.getSize() == size)
+                    return freeQuad.first;
+            }
+            return std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
+        }
+
+        std::vector<uint8_t> getPageTexels() const
+        {
+            std::vector<uint8_t> texels(PageWidth * PageHeight);
+            m_glyphPage->getTextureBuffer().getMipLevelData(0, reinterpret_cast<char*>(texels.data()), PageWidth * PageHeight);
+            return texels;
+        }
+
         enum class EClaimedQuadPosition
         {
             TopLeft = 0,
@@ -63,14 +86,12 @@ namespace ramses
         GlyphTexturePage::QuadIndex getFittingFreeQuadIndex(EClaimedQuadSize size) const
         {
             QuadSize quadSize = getQuadSize(size);
-            GlyphTexturePage::QuadIndex i(0);
-            for (auto const& quad : m_glyphPage->getFreeSpace())
+            for (auto const& freeQuad : m_glyphPage->getFreeSpace())
             {
-                if (quad.getSize().y >= quadSize.y && quad.getSize().x >= quadSize.x)
+                if (freeQuad.second.getSize().y >= quadSize.y && freeQuad.second.getSize().x >= quadSize.x)
                 {
-                    return i;
+                    return freeQuad.first;
                 }
-                i++;
             }
             return std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
         }
@@ -211,7 +232,8 @@ namespace ramses
         }
 
         GlyphTexturePage::GlyphPageData tempCache;
-        m_glyphPage->updateDataWithPadding(subPixelQuad, &texelData[0], tempCache);
+        m_glyphPage->updateDataWithPadding(subPixelQuad, &texelData[0]);
+        m_glyphPage->updateTextureResource(tempCache);
 
         uint8_t databuffer[PageWidth * PageHeight * 4];
         m_glyphPage->getTextureBuffer().getMipLevelData(0, reinterpret_cast<char*>(databuffer), PageWidth * PageHeight * 4);
@@ -246,6 +268,56 @@ namespace ramses
         }
     }
 
+    TEST_F(AGlyphTexturePage, UpdatesTextureOnceWithQuadEnclosingAllGlyphsWrittenSinceLastUpdate)
+    {
+        const Quad glyph1(QuadOffset(1, 2), QuadSize(3, 3));
+        const Quad glyph2(QuadOffset(6, 8), QuadSize(4, 3));
+        const GlyphTexturePage::GlyphPageData texelData1(1, 0x11);
+        const GlyphTexturePage::GlyphPageData texelData2(2, 0x22);
+
+        m_glyphPage->updateDataWithPadding(glyph1, &texelData1[0]);
+        m_glyphPage->updateDataWithPadding(glyph2, &texelData2[0]);
+        EXPECT_EQ(std::vector<uint8_t>(PageWidth * PageHeight, 0u), getPageTexels());
+
+        GlyphTexturePage::GlyphPageData tempCache;
+        m_glyphPage->updateTextureResource(tempCache);
+        // single update of quad from (1, 2) to (10, 11)
+        EXPECT_EQ(9u * 9u, tempCache.size());
+
+        const std::vector<uint8_t> texels = getPageTexels();
+        EXPECT_EQ(0x11, texels[3 * PageWidth + 2]);
+        EXPECT_EQ(0x22, texels[9 * PageWidth + 7]);
+        EXPECT_EQ(0x22, texels[9 * PageWidth + 8]);
+        EXPECT_EQ(0x00, texels[9 * PageWidth + 6]);
+
+        // nothing written since last update
+        tempCache.clear();
+        m_glyphPage->updateTextureResource(tempCache);
+        EXPECT_TRUE(tempCache.empty());
+    }
+
+    TEST_F(AGlyphTexturePage, KeepsDataOfPreviouslyUpdatedGlyphsWhenUpdatingQuadEnclosingThem)
+    {
+        const Quad glyph1(QuadOffset(0, 0), QuadSize(3, 3));
+        const Quad glyph2(QuadOffset(4, 4), QuadSize(3, 3));
+        const Quad glyph3(QuadOffset(8, 8), QuadSize(3, 3));
+        const GlyphTexturePage::GlyphPageData texelData1(1, 0x11);
+        const GlyphTexturePage::GlyphPageData texelData2(1, 0x22);
+        const GlyphTexturePage::GlyphPageData texelData3(1, 0x33);
+
+        GlyphTexturePage::GlyphPageData tempCache;
+        m_glyphPage->updateDataWithPadding(glyph2, &texelData2[0]);
+        m_glyphPage->updateTextureResource(tempCache);
+        m_glyphPage->updateDataWithPadding(glyph1, &texelData1[0]);
+        m_glyphPage->updateDataWithPadding(glyph3, &texelData3[0]);
+        m_glyphPage->updateTextureResource(tempCache);
+
+        const std::vector<uint8_t> texels = getPageTexels();
+        EXPECT_EQ(0x11, texels[1 * PageWidth + 1]);
+        EXPECT_EQ(0x22, texels[5 * PageWidth + 5]);
+        EXPECT_EQ(0x33, texels[9 * PageWidth + 9]);
+    }
+
     TEST_F(AGlyphTexturePage, NewGlyphPageHasOneFreeAreaWithWidthTimesHeightArea)
     {
         uint32_t fullArea = PageWidth * PageHeight;
@@ -255,7 +327,7 @@ namespace ramses
 
     TEST_F(AGlyphTexturePage, claimingAZeroSpaceIsANoop)
     {
-        m_glyphPage->claimSpace(0, QuadSize(0, 0));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(0, 0));
 
         uint32_t fullArea = PageWidth * PageHeight;
         expectFreeArea(fullArea);
@@ -266,7 +338,7 @@ namespace ramses
     {
         uint32_t fullArea = PageWidth * PageHeight;
         auto claimedSpace = QuadSize(3, 3);
-        auto offset = m_glyphPage->claimSpace(0, claimedSpace);
+        auto offset = m_glyphPage->claimSpace(getFirstFreeQuadIndex(), claimedSpace);
 
         expectFreeArea(fullArea - claimedSpace.getArea());
         EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 2u);
@@ -283,12 +355,12 @@ namespace ramses
         QuadSize claimedSpaceW(4, 4);
         QuadSize claimedSpaceH(3, 3);
 
-        auto offset = m_glyphPage->claimSpace(0, claimedSpace);
+        auto offset = m_glyphPage->claimSpace(getFirstFreeQuadIndex(), claimedSpace);
         expectFreeArea(fullArea - claimedSpace.getArea());
         EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 2u);
 
         {
-            auto offset2 = m_glyphPage->claimSpace(0, claimedSpaceH);
+            auto offset2 = m_glyphPage->claimSpace(getFirstFreeQuadIndex(), claimedSpaceH);
             expectFreeArea(fullArea - claimedSpace.getArea() - claimedSpaceH.getArea());
             EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 2u);
 
@@ -298,7 +370,7 @@ namespace ramses
         }
 
         {
-            auto offset2 = m_glyphPage->claimSpace(0, claimedSpaceW);
+            auto offset2 = m_glyphPage->claimSpace(getFirstFreeQuadIndex(), claimedSpaceW);
             expectFreeArea(fullArea - claimedSpace.getArea() - claimedSpaceW.getArea());
             EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 2u);
 
@@ -316,7 +388,7 @@ namespace ramses
     {
         uint32_t fullArea = PageWidth * PageHeight;
         auto claimedSpace = QuadSize(4, 4);
-        auto offset = m_glyphPage->claimSpace(0, claimedSpace);
+        auto offset = m_glyphPage->claimSpace(getFirstFreeQuadIndex(), claimedSpace);
 
         expectFreeArea(fullArea - claimedSpace.getArea());
         EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 2u);
@@ -332,7 +404,7 @@ namespace ramses
     {
         uint32_t fullArea = PageWidth * PageHeight;
         auto claimedSpace = QuadSize(4, 4);
-        auto offset = m_glyphPage->claimSpace(0, claimedSpace);
+        auto offset = m_glyphPage->claimSpace(getFirstFreeQuadIndex(), claimedSpace);
 
         expectFreeArea(fullArea - claimedSpace.getArea());
         EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 2u);
@@ -422,62 +494,107 @@ namespace ramses
 
     TEST_F(AGlyphTexturePage, FindsNoFreeSpaceForSizeTooBigForLeftoverSpace)
     {
-        m_glyphPage->claimSpace(0, QuadSize(5, 5));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(5, 5));
         EXPECT_EQ(m_glyphPage->findFreeSpace(QuadSize(PageWidth, PageHeight)), std::numeric_limits<GlyphTexturePage::QuadIndex>::max());
     }
 
     TEST_F(AGlyphTexturePage, FindsNoFreeSpaceForSizeTooBigForAllFreespaceQuads)
     {
-        m_glyphPage->claimSpace(0, QuadSize(5, 5));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(5, 5));
         // the next quad size would theoretically fit, but not with the segmentation after last claim
         EXPECT_EQ(m_glyphPage->findFreeSpace(QuadSize(PageWidth - 5, PageHeight)), std::numeric_limits<GlyphTexturePage::QuadIndex>::max());
     }
 
     TEST_F(AGlyphTexturePage, ChoosesExactFitFreespaceQuadWithFindFreespace)
     {
-        m_glyphPage->claimSpace(0, QuadSize(5, 5));
-        m_glyphPage->claimSpace(0, QuadSize(3, 3));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(5, 5));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(3, 3));
         std::vector<QuadSize> vec = { QuadSize(3, 2), QuadSize(PageWidth - 8, 5), QuadSize(PageWidth, PageHeight - 5) };
 
         for (auto const& entry : vec)
         {
-            auto it = m_glyphPage->getFreeSpace().begin();
-            GlyphTexturePage::QuadIndex index = 0;
-            for (; it != m_glyphPage->getFreeSpace().end(); ++it)
-            {
-                if (it->getSize() == entry)
-                    break;
-
-                index++;
-            }
-
-            EXPECT_NE(it, m_glyphPage->getFreeSpace().end());
+            const GlyphTexturePage::QuadIndex index = getFreeQuadIndex(entry);
+            EXPECT_NE(index, std::numeric_limits<GlyphTexturePage::QuadIndex>::max());
             EXPECT_EQ(m_glyphPage->findFreeSpace(entry), index);
         }
     }
 
     TEST_F(AGlyphTexturePage, ChoosesBestFitFreespaceQuadWithFindFreespace)
     {
-        m_glyphPage->claimSpace(0, QuadSize(5, 5));
-        m_glyphPage->claimSpace(0, QuadSize(3, 3));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(5, 5));
+        m_glyphPage->claimSpace(getFirstFreeQuadIndex(), QuadSize(3, 3));
         std::vector<QuadSize> vec = { QuadSize(3, 2), QuadSize(PageWidth - 8, 5), QuadSize(PageWidth, PageHeight - 5) }; //free space
         std::vector<QuadSize> vec2 = { QuadSize(1, 1), QuadSize(3, 3), QuadSize(PageWidth - 7, PageHeight - 5) }; // quads to find free space for
 
         assert(vec.size() == vec2.size());
         for (size_t i = 0; i < vec.size(); ++i)
         {
-            auto it = m_glyphPage->getFreeSpace().begin();
-            GlyphTexturePage::QuadIndex index = 0;
-            for (; it != m_glyphPage->getFreeSpace().end(); ++it)
-            {
-                if (it->getSize() == vec[i])
-                    break;
+            const GlyphTexturePage::QuadIndex index = getFreeQuadIndex(vec[i]);
+            EXPECT_NE(index, std::numeric_limits<GlyphTexturePage::QuadIndex>::max());
+            EXPECT_EQ(m_glyphPage->findFreeSpace(vec2[i]), index);
+        }
+    }
 
-                index++;
+    TEST_F(AGlyphTexturePage, FindsSmallestFittingFreespaceQuadCreatedFirstAmongManyFreeQuads)
+    {
+        const std::vector<QuadSize> glyphSizes = { QuadSize(3, 4), QuadSize(2, 2), QuadSize(4, 3), QuadSize(1, 5), QuadSize(3, 3) };
+        for (size_t i = 0u; i < 40u; ++i)
+        {
+            const QuadSize& size = glyphSizes[i % glyphSizes.size()];
+            const GlyphTexturePage::QuadIndex freeQuad = m_glyphPage->findFreeSpace(size);
+            if (freeQuad == std::numeric_limits<GlyphTexturePage::QuadIndex>::max())
+                break;
+            m_glyphPage->claimSpace(freeQuad, size);
+        }
+
+        for (uint32_t height = 1u; height <= PageHeight; ++height)
+        {
+            for (uint32_t width = 1u; width <= PageWidth; ++width)
+            {
+                GlyphTexturePage::QuadIndex expectedFreeQuad = std::numeric_limits<GlyphTexturePage::QuadIndex>::max();
+                uint32_t expectedArea = std::numeric_limits<uint32_t>::max();
+                for (const auto& freeQuad : m_glyphPage->getFreeSpace())
+                {
+                    const QuadSize& freeSize = freeQuad.second.getSize();
+                    if (freeSize.x >= width && freeSize.y >= height && freeSize.getArea() < expectedArea)
+                    {
+                        expectedFreeQuad = freeQuad.first;
+                        expectedArea = freeSize.getArea();
+                    }
+                }
+                EXPECT_EQ(expectedFreeQuad, m_glyphPage->findFreeSpace(QuadSize(width, height))) << width << "x" << height;
             }
+        }
+    }
 
-            EXPECT_NE(it, m_glyphPage->getFreeSpace().end());
-            EXPECT_EQ(m_glyphPage->findFreeSpace(vec2[i]), index);
+    TEST_F(AGlyphTexturePage, confidence_ClaimsSpaceForManyGlyphsWithoutOverlapAndReleasesAllOfIt)
+    {
+        const uint32_t fullArea = PageWidth * PageHeight;
+        const std::vector<QuadSize> glyphSizes = { QuadSize(3, 4), QuadSize(2, 2), QuadSize(4, 3), QuadSize(1, 5), QuadSize(3, 3) };
+
+        std::vector<Quad> claimedQuads;
+        uint32_t claimedArea = 0u;
+        for (size_t i = 0u; ; ++i)
+        {
+            const QuadSize& size = glyphSizes[i % glyphSizes.size()];
+            const GlyphTexturePage::QuadIndex freeQuad = m_glyphPage->findFreeSpace(size);
+            if (freeQuad == std::numeric_limits<GlyphTexturePage::QuadIndex>::max())
+                break;
+
+            const Quad claimedQuad(m_glyphPage->claimSpace(freeQuad, size), size);
+            EXPECT_LE(claimedQuad.getOrigin().x + size.x, PageWidth);
+            EXPECT_LE(claimedQuad.getOrigin().y + size.y, PageHeight);
+            for (const auto& otherQuad : claimedQuads)
+                EXPECT_FALSE(claimedQuad.intersects(otherQuad));
+
+            claimedQuads.push_back(claimedQuad);
+            claimedArea += size.getArea();
+            expectFreeArea(fullArea - claimedArea);
         }
+        EXPECT_GT(claimedQuads.size(), 10u);
+
+        for (const auto& claimedQuad : claimedQuads)
+            m_glyphPage->releaseSpace(claimedQuad);
+        expectFreeArea(fullArea);
     }
 }
@@ -11,6 +11,7 @@
 #include "ramses-client-api/MeshNode.h"
 #include "ramses-client-api/GeometryBinding.h"
 #include "ramses-client-api/UInt16Array.h"
+#include "ramses-client-api/Vector3fArray.h"
 
 #include "ClientTestUtils.h"
 #include "GeometryBindingImpl.h"
@@ -352,6 +353,75 @@ namespace ramses
         EXPECT_NE(StatusOK, m_meshNode->setInstanceCount(0u));
     }
 
+    TEST_F(MeshNodeTest, hasNoBoundingBoxInitially)
+    {
+        float minX, minY, minZ, maxX, maxY, maxZ;
+        EXPECT_NE(StatusOK, m_meshNode->getBoundingBox(minX, minY, minZ, maxX, maxY, maxZ));
+        EXPECT_TRUE(m_scene.impl.getIScene().getRenderable(m_meshNode->impl.getRenderableHandle()).boundingBox.isEmpty());
+    }
+
+    TEST_F(MeshNodeTest, setsAndGetsSameBoundingBox)
+    {
+        EXPECT_EQ(StatusOK, m_meshNode->setBoundingBox(-1.f, -2.f, -3.f, 4.f, 5.f, 6.f));
+
+        float minX, minY, minZ, maxX, maxY, maxZ;
+        EXPECT_EQ(StatusOK, m_meshNode->getBoundingBox(minX, minY, minZ, maxX, maxY, maxZ));
+        EXPECT_FLOAT_EQ(-1.f, minX);
+        EXPECT_FLOAT_EQ(-2.f, minY);
+        EXPECT_FLOAT_EQ(-3.f, minZ);
+        EXPECT_FLOAT_EQ(4.f, maxX);
+        EXPECT_FLOAT_EQ(5.f, maxY);
+        EXPECT_FLOAT_EQ(6.f, maxZ);
+
+        const BoundingBox& boundingBox = m_scene.impl.getIScene().getRenderable(m_meshNode->impl.getRenderableHandle()).boundingBox;
+        EXPECT_EQ(BoundingBox(Vector3(-1.f, -2.f, -3.f), Vector3(4.f, 5.f, 6.f)), boundingBox);
+    }
+
+    TEST_F(MeshNodeTest, doesNotAllowBoundingBoxWithMinimumGreaterThanMaximum)
+    {
+        EXPECT_NE(StatusOK, m_meshNode->setBoundingBox(1.f, 0.f, 0.f, 0.f, 1.f, 1.f));
+        EXPECT_NE(StatusOK, m_meshNode->setBoundingBox(0.f, 1.f, 0.f, 1.f, 0.f, 1.f));
+        EXPECT_NE(StatusOK, m_meshNode->setBoundingBox(0.f, 0.f, 1.f, 1.f, 1.f, 0.f));
+    }
+
+    TEST_F(MeshNodeTest, canRemoveBoundingBox)
+    {
+        EXPECT_EQ(StatusOK, m_meshNode->setBoundingBox(-1.f, -1.f, -1.f, 1.f, 1.f, 1.f));
+        EXPECT_EQ(StatusOK, m_meshNode->removeBoundingBox());
+
+        float minX, minY, minZ, maxX, maxY, maxZ;
+        EXPECT_NE(StatusOK, m_meshNode->getBoundingBox(minX, minY, minZ, maxX, maxY, maxZ));
+    }
+
+    TEST_F(MeshNodeTest, computesBoundingBoxFromVertexPositions)
+    {
+        const float positions[] = { 1.f, 2.f, 3.f,  -4.f, 0.f, 9.f,  0.f, -5.f, -6.f };
+        const Vector3fArray* vertexPositions = client.createConstVector3fArray(3u, positions);
+        ASSERT_TRUE(vertexPositions != nullptr);
+
+        EXPECT_EQ(StatusOK, m_meshNode->setBoundingBoxFromVertexPositions(*vertexPositions));
+
+        float minX, minY, minZ, maxX, maxY, maxZ;
+        EXPECT_EQ(StatusOK, m_meshNode->getBoundingBox(minX, minY, minZ, maxX, maxY, maxZ));
+        EXPECT_FLOAT_EQ(-4.f, minX);
+        EXPECT_FLOAT_EQ(-5.f, minY);
+        EXPECT_FLOAT_EQ(-6.f, minZ);
+        EXPECT_FLOAT_EQ(1.f, maxX);
+        EXPECT_FLOAT_EQ(2.f, maxY);
+        EXPECT_FLOAT_EQ(9.f, maxZ);
+    }
+
+    TEST_F(MeshNodeTest, reportsErrorWhenComputingBoundingBoxFromVertexPositionsFromAnotherClient)
+    {
+        RamsesFramework anotherFramework;
+        RamsesClient& anotherClient(*anotherFramework.createClient("anotherClient"));
+        const float positions[] = { 1.f, 2.f, 3.f };
+        const Vector3fArray* vertexPositions = anotherClient.createConstVector3fArray(1u, positions);
+        ASSERT_TRUE(vertexPositions != nullptr);
+
+        EXPECT_NE(StatusOK, m_meshNode->setBoundingBoxFromVertexPositions(*vertexPositions));
+    }
+
     TEST_F(MeshNodeTest, succeedsValidationIfNotUsingIndexArray)
     {
         setAnAppearanceForTesting();
@@ -93,6 +93,18 @@ namespace ramses
         EXPECT_EQ(StatusOK, distributedScene->publish(EScenePublicationMode_LocalOnly));
     }
 
+    TEST(DistributedSceneTest, collapsesRedundantSettersOnlyIfEnabledInConfig)
+    {
+        RamsesFramework framework;
+        RamsesClient& client(*framework.createClient(nullptr));
+        SceneConfig config;
+        const Scene* defaultScene = client.createScene(sceneId_t(1u), config);
+        config.setCollapseRedundantSetters(true);
+        const Scene* collapsingScene = client.createScene(sceneId_t(2u), config);
+        EXPECT_FALSE(defaultScene->impl.getIScene().getCollapseRedundantSetters());
+        EXPECT_TRUE(collapsingScene->impl.getIScene().getCollapseRedundantSetters());
+    }
+
     TEST(DistributedSceneTest, reportsErrorWhenPublishSceneIfNotConnected)
     {
         RamsesFramework framework;
@@ -0,0 +1,93 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_ANIMATIONBATCHEVALUATOR_H
+#define RAMSES_ANIMATIONBATCHEVALUATOR_H
+
+#include "Animation/AnimationProcessDataCache.h"
+#include "Animation/AnimationTime.h"
+#include "Utils/DataTypeUtils.h"
+#include <vector>
+#include <limits>
+
+namespace ramses_internal
+{
+    class ITaskQueue;
+
+    // Evaluates playing animations grouped into batches of same spline key type, data type and interpolation.
+    // Interpolated values of float based data types (Float, Vector2/3/4) are computed into contiguous arrays
+    // using SIMD where available and batches can be split into parts evaluated by tasks of a shared task queue.
+    // Results are applied to data binds afterwards on calling thread in order of process data cache,
+    // animations of other data types are processed there one by one.
+    class AnimationBatchEvaluator
+    {
+    public:
+        // parallel tasks are only enqueued once there are enough animations to process
+        explicit AnimationBatchEvaluator(ITaskQueue* taskQueue = nullptr, UInt32 maxNumParallelTasks = 0u);
+        ~AnimationBatchEvaluator();
+
+        AnimationBatchEvaluator(const AnimationBatchEvaluator&) = delete;
+        AnimationBatchEvaluator& operator=(const AnimationBatchEvaluator&) = delete;
+
+        void processAnimations(AnimationProcessDataCache& processDataCache, const AnimationTime& timeStamp);
+
+        // computes startValues + (endValues - startValues) * fractions per component
+        static void InterpolateLinear(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count);
+        // computes (fractions < 1 ? startValues : endValues) per component
+        static void InterpolateStep(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count);
+
+        static const UInt32 MinNumAnimationsPerTask = 1024u;
+
+    private:
+        class BatchEvaluationTask;
+
+        struct Batch
+        {
+            ESplineKeyType keyType = ESplineKeyType_Invalid;
+            EDataTypeID dataType = EDataTypeID_Invalid;
+            EInterpolationType interpolationType = EInterpolationType_Invalid;
+            UInt32 numComponents = 0u;
+
+            std::vector<AnimationProcessData*> animations;
+            // per component of every animation
+            std::vector<Float> startValues;
+            std::vector<Float> endValues;
+            std::vector<Float> fractions;
+            std::vector<Float> results;
+        };
+
+        struct PlayingAnimation
+        {
+            AnimationProcessData* processData;
+            UInt32 batchIdx;
+            UInt32 idxInBatch;
+        };
+
+        static const UInt32 UnbatchedAnimation = std::numeric_limits<UInt32>::max();
+
+        UInt32 getBatchIndex(const AnimationProcessData& processData);
+        void evaluateBatches(UInt32 partIdx, UInt32 numParts);
+        void evaluateBatchRange(Batch& batch, UInt32 beginIdx, UInt32 endIdx) const;
+        void applyResult(const PlayingAnimation& animation) const;
+        void processUnbatchedAnimation(AnimationProcessData& processData) const;
+
+        template <typename EDataType>
+        void gatherValues(Batch& batch, UInt32 idxInBatch) const;
+        template <template<typename> class Key, typename EDataType>
+        void gatherSplineKeyValues(Batch& batch, UInt32 idxInBatch) const;
+
+        ITaskQueue* const m_taskQueue;
+        const UInt32 m_maxNumParallelTasks;
+
+        AnimationTime m_timeStamp;
+        std::vector<Batch> m_batches;
+        std::vector<PlayingAnimation> m_playingAnimations;
+    };
+}
+
+#endif
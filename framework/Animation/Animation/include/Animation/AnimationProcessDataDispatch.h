@@ -26,6 +26,9 @@ namespace ramses_internal
         explicit AnimationProcessDataDispatch(const AnimationProcessData& processData);
 
         void dispatch();
+        // sets value interpolated beforehand (e.g. by batch evaluation) to destinations, spline is not dispatched
+        template <typename EDataType>
+        void dispatchDataBinds(const EDataType& interpolatedValue);
 
         template <template<typename> class Key, typename EDataType>
         void dispatchSpline(const Spline<Key, EDataType>& spline);
@@ -13,13 +13,15 @@
 #include "Animation/AnimationData.h"
 #include "Animation/AnimationProcessingFinished.h"
 #include "Animation/AnimationProcessDataCache.h"
+#include "Animation/AnimationBatchEvaluator.h"
 
 namespace ramses_internal
 {
     class AnimationProcessing : public AnimationLogicListener
     {
     public:
-        explicit AnimationProcessing(AnimationData& animationData);
+        // with task queue large numbers of active animations are evaluated in parallel
+        explicit AnimationProcessing(AnimationData& animationData, ITaskQueue* taskQueue = nullptr, UInt32 maxNumParallelTasks = 0u);
 
         // AnimationStateListener interface
         virtual void onAnimationStarted(AnimationHandle handle) override;
@@ -34,11 +36,11 @@ namespace ramses_internal
     private:
         void process(const AnimationTime& timeStamp);
         void processActiveAnimations();
-        void processAnimation(AnimationProcessData& processData);
         void resetProcessDataIfCached(AnimationHandle handle);
 
         AnimationProcessDataCache m_processDataCache;
         AnimationTime m_timeStamp;
+        AnimationBatchEvaluator m_batchEvaluator;
 
         AnimationProcessingFinished m_finishedAnimationProcessing;
     };
@@ -15,6 +15,8 @@
 
 namespace ramses_internal
 {
+    class ITaskQueue;
+
     enum EAnimationSystemFlags
     {
         EAnimationSystemFlags_Default        = 0,
@@ -25,7 +27,8 @@ namespace ramses_internal
     class AnimationSystem : public IAnimationSystem
     {
     public:
-        AnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo);
+        // with full processing large numbers of active animations are evaluated in parallel by tasks of given queue
+        AnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo, ITaskQueue* parallelProcessingQueue = nullptr);
         virtual ~AnimationSystem();
 
         virtual void                         setHandle(AnimationSystemHandle handle) override;
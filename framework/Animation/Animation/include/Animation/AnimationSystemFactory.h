@@ -15,6 +15,7 @@
 namespace ramses_internal
 {
     class SceneActionCollection;
+    class ITaskQueue;
     class IAnimationSystem;
     struct AnimationSystemSizeInformation;
 
@@ -28,13 +29,15 @@ namespace ramses_internal
     class AnimationSystemFactory
     {
     public:
-        AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector = nullptr);
+        // renderer side real time animation systems use given task queue for parallel processing
+        AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector = nullptr, ITaskQueue* parallelProcessingQueue = nullptr);
 
         IAnimationSystem* createAnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo);
 
     protected:
         EAnimationSystemOwner m_ownerType;
         SceneActionCollection* m_actionCollector;
+        ITaskQueue* m_parallelProcessingQueue;
     };
 }
 
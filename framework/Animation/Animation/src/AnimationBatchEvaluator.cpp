@@ -0,0 +1,376 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Animation/AnimationBatchEvaluator.h"
+#include "Animation/AnimationProcessing.h"
+#include "Animation/AnimationProcessDataDispatch.h"
+#include "Animation/Spline.h"
+#include "Animation/SplineKey.h"
+#include "Animation/SplineKeyTangents.h"
+#include "Animation/SplineSolver.h"
+#include "Math3d/Vector2.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Vector4.h"
+#include "Math3d/Math3dSimd.h"
+#include "TaskFramework/ITask.h"
+#include "TaskFramework/ITaskQueue.h"
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        UInt32 GetNumFloatComponents(EDataTypeID dataType)
+        {
+            switch (dataType)
+            {
+            case EDataTypeID_Float:
+                return 1u;
+            case EDataTypeID_Vector2f:
+                return 2u;
+            case EDataTypeID_Vector3f:
+                return 3u;
+            case EDataTypeID_Vector4f:
+                return 4u;
+            default:
+                return 0u;
+            }
+        }
+
+        const Float* GetComponents(const Float& value)
+        {
+            return &value;
+        }
+
+        template <typename VectorType>
+        const Float* GetComponents(const VectorType& value)
+        {
+            return value.data;
+        }
+    }
+
+    // Parts of batches are claimed one after another by thread owning the evaluator and by this task executed from task queue.
+    // Owning thread does not wait for queued tasks to start, it evaluates all parts not claimed yet itself and only waits
+    // for claimed parts to finish. A task executed after that finds no part left and does not touch the evaluator anymore.
+    class AnimationBatchEvaluator::BatchEvaluationTask : public ITask
+    {
+    public:
+        BatchEvaluationTask(AnimationBatchEvaluator& evaluator, UInt32 numParts)
+            : m_evaluator(evaluator)
+            , m_numParts(numParts)
+        {
+        }
+
+        virtual void execute() override
+        {
+            evaluateUnclaimedParts();
+        }
+
+        void evaluateUnclaimedParts()
+        {
+            for (UInt32 part = m_nextPart++; part < m_numParts; part = m_nextPart++)
+            {
+                m_evaluator.evaluateBatches(part, m_numParts);
+
+                std::lock_guard<std::mutex> guard(m_lock);
+                if (++m_numFinishedParts == m_numParts)
+                    m_allPartsFinished.notify_all();
+            }
+        }
+
+        void waitUntilAllPartsFinished()
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_allPartsFinished.wait(lock, [this]() { return m_numFinishedParts == m_numParts; });
+        }
+
+    private:
+        AnimationBatchEvaluator& m_evaluator;
+        const UInt32 m_numParts;
+        std::atomic<UInt32> m_nextPart{ 0u };
+
+        std::mutex m_lock;
+        std::condition_variable m_allPartsFinished;
+        UInt32 m_numFinishedParts = 0u;
+    };
+
+    AnimationBatchEvaluator::AnimationBatchEvaluator(ITaskQueue* taskQueue, UInt32 maxNumParallelTasks)
+        : m_taskQueue(taskQueue)
+        , m_maxNumParallelTasks(taskQueue != nullptr ? maxNumParallelTasks : 0u)
+        , m_timeStamp(0u)
+    {
+    }
+
+    AnimationBatchEvaluator::~AnimationBatchEvaluator() = default;
+
+    void AnimationBatchEvaluator::processAnimations(AnimationProcessDataCache& processDataCache, const AnimationTime& timeStamp)
+    {
+        m_timeStamp = timeStamp;
+        m_playingAnimations.clear();
+        for (auto& batch : m_batches)
+            batch.animations.clear();
+
+        UInt32 numBatchedAnimations = 0u;
+        for (AnimationProcessDataCache::DataProcessMap::Iterator it = processDataCache.begin(); it != processDataCache.end(); ++it)
+        {
+            AnimationProcessData& processData = it->value;
+            if (processData.m_animation.isPlaying(m_timeStamp))
+            {
+                const UInt32 batchIdx = getBatchIndex(processData);
+                UInt32 idxInBatch = 0u;
+                if (batchIdx != UnbatchedAnimation)
+                {
+                    auto& animations = m_batches[batchIdx].animations;
+                    idxInBatch = static_cast<UInt32>(animations.size());
+                    animations.push_back(&processData);
+                    ++numBatchedAnimations;
+                }
+                m_playingAnimations.push_back({ &processData, batchIdx, idxInBatch });
+            }
+        }
+
+        for (auto& batch : m_batches)
+        {
+            const size_t numValues = batch.animations.size() * batch.numComponents;
+            batch.startValues.resize(numValues);
+            batch.endValues.resize(numValues);
+            batch.fractions.resize(numValues);
+            batch.results.resize(numValues);
+        }
+
+        // every part processes its share of each batch, so that also small batches of many different types are distributed
+        const UInt32 numParts = std::min(m_maxNumParallelTasks + 1u, std::max(numBatchedAnimations / MinNumAnimationsPerTask, 1u));
+        if (numParts > 1u)
+        {
+            BatchEvaluationTask* task = new BatchEvaluationTask(*this, numParts);
+            for (UInt32 part = 1u; part < numParts; ++part)
+                m_taskQueue->enqueue(*task);
+            task->evaluateUnclaimedParts();
+            task->waitUntilAllPartsFinished();
+            task->release();
+        }
+        else
+        {
+            evaluateBatches(0u, 1u);
+        }
+
+        // data binds modify scene and are applied sequentially in same order as before batching
+        for (const auto& playingAnimation : m_playingAnimations)
+            applyResult(playingAnimation);
+    }
+
+    UInt32 AnimationBatchEvaluator::getBatchIndex(const AnimationProcessData& processData)
+    {
+        const SplineBase& spline = *processData.m_spline;
+        const ESplineKeyType keyType = spline.getKeyType();
+        const EDataTypeID dataType = spline.getDataType();
+        const EInterpolationType interpolationType = processData.m_interpolationType;
+
+        const UInt32 numComponents = GetNumFloatComponents(dataType);
+        const Bool supportedKeyType = (keyType == ESplineKeyType_Basic || keyType == ESplineKeyType_Tangents);
+        const Bool supportedInterpolation = (interpolationType == EInterpolationType_Step || interpolationType == EInterpolationType_Linear
+            || (interpolationType == EInterpolationType_Bezier && keyType == ESplineKeyType_Tangents));
+        if (numComponents == 0u || !supportedKeyType || !supportedInterpolation)
+            return UnbatchedAnimation;
+
+        const auto batchIt = std::find_if(m_batches.cbegin(), m_batches.cend(), [&](const Batch& batch)
+        {
+            return batch.keyType == keyType && batch.dataType == dataType && batch.interpolationType == interpolationType;
+        });
+        if (batchIt != m_batches.cend())
+            return static_cast<UInt32>(batchIt - m_batches.cbegin());
+
+        m_batches.push_back({});
+        Batch& batch = m_batches.back();
+        batch.keyType = keyType;
+        batch.dataType = dataType;
+        batch.interpolationType = interpolationType;
+        batch.numComponents = numComponents;
+
+        return static_cast<UInt32>(m_batches.size() - 1u);
+    }
+
+    void AnimationBatchEvaluator::evaluateBatches(UInt32 partIdx, UInt32 numParts)
+    {
+        for (auto& batch : m_batches)
+        {
+            const UInt32 numAnimations = static_cast<UInt32>(batch.animations.size());
+            const UInt32 beginIdx = numAnimations * partIdx / numParts;
+            const UInt32 endIdx = numAnimations * (partIdx + 1u) / numParts;
+            if (beginIdx < endIdx)
+                evaluateBatchRange(batch, beginIdx, endIdx);
+        }
+    }
+
+    void AnimationBatchEvaluator::evaluateBatchRange(Batch& batch, UInt32 beginIdx, UInt32 endIdx) const
+    {
+        for (UInt32 idx = beginIdx; idx < endIdx; ++idx)
+        {
+            AnimationProcessData& processData = *batch.animations[idx];
+            const SplineTimeStamp splineTime = AnimationProcessing::ComputeSplineTime(processData.m_animation, m_timeStamp);
+            const bool playReverse = (processData.m_animation.m_flags & Animation::EAnimationFlags_Reverse) != 0;
+            processData.m_splineIterator.setTimeStamp(splineTime, processData.m_spline, playReverse);
+
+            switch (batch.dataType)
+            {
+            case EDataTypeID_Float:
+                gatherValues<Float>(batch, idx);
+                break;
+            case EDataTypeID_Vector2f:
+                gatherValues<Vector2>(batch, idx);
+                break;
+            case EDataTypeID_Vector3f:
+                gatherValues<Vector3>(batch, idx);
+                break;
+            case EDataTypeID_Vector4f:
+                gatherValues<Vector4>(batch, idx);
+                break;
+            default:
+                assert(false);
+                break;
+            }
+        }
+
+        const UInt32 beginValueIdx = beginIdx * batch.numComponents;
+        const UInt32 numValues = (endIdx - beginIdx) * batch.numComponents;
+        switch (batch.interpolationType)
+        {
+        case EInterpolationType_Step:
+            InterpolateStep(&batch.startValues[beginValueIdx], &batch.endValues[beginValueIdx], &batch.fractions[beginValueIdx], &batch.results[beginValueIdx], numValues);
+            break;
+        case EInterpolationType_Linear:
+            InterpolateLinear(&batch.startValues[beginValueIdx], &batch.endValues[beginValueIdx], &batch.fractions[beginValueIdx], &batch.results[beginValueIdx], numValues);
+            break;
+        default:
+            // bezier results are solved directly when gathering
+            break;
+        }
+    }
+
+    template <typename EDataType>
+    void AnimationBatchEvaluator::gatherValues(Batch& batch, UInt32 idxInBatch) const
+    {
+        if (batch.keyType == ESplineKeyType_Basic)
+            gatherSplineKeyValues<SplineKey, EDataType>(batch, idxInBatch);
+        else
+            gatherSplineKeyValues<SplineKeyTangents, EDataType>(batch, idxInBatch);
+    }
+
+    template <template<typename> class Key, typename EDataType>
+    void AnimationBatchEvaluator::gatherSplineKeyValues(Batch& batch, UInt32 idxInBatch) const
+    {
+        const AnimationProcessData& processData = *batch.animations[idxInBatch];
+        const auto& spline = static_cast<const Spline<Key, EDataType>&>(*processData.m_spline);
+        const UInt32 valueIdx = idxInBatch * batch.numComponents;
+
+        if (batch.interpolationType == EInterpolationType_Bezier)
+        {
+            const SplineSolver<Key, EDataType> splineSolver(spline, processData.m_splineIterator, batch.interpolationType);
+            const EDataType interpolatedValue = splineSolver.getInterpolatedValue();
+            const Float* components = GetComponents(interpolatedValue);
+            std::copy(components, components + batch.numComponents, &batch.results[valueIdx]);
+            return;
+        }
+
+        const SplineSegment& segment = processData.m_splineIterator.getSegment();
+        const Float* startComponents = GetComponents(spline.getKey(segment.m_startIndex).m_value);
+        const Float* endComponents = GetComponents(spline.getKey(segment.m_endIndex).m_value);
+        std::copy(startComponents, startComponents + batch.numComponents, &batch.startValues[valueIdx]);
+        std::copy(endComponents, endComponents + batch.numComponents, &batch.endValues[valueIdx]);
+        std::fill_n(&batch.fractions[valueIdx], batch.numComponents, processData.m_splineIterator.getSegmentLocalTime());
+    }
+
+    void AnimationBatchEvaluator::applyResult(const PlayingAnimation& animation) const
+    {
+        if (animation.batchIdx == UnbatchedAnimation)
+        {
+            processUnbatchedAnimation(*animation.processData);
+            return;
+        }
+
+        const Batch& batch = m_batches[animation.batchIdx];
+        const Float* result = &batch.results[animation.idxInBatch * batch.numComponents];
+        AnimationProcessDataDispatch dataDispatch(*animation.processData);
+        switch (batch.dataType)
+        {
+        case EDataTypeID_Float:
+            dataDispatch.dispatchDataBinds(result[0]);
+            break;
+        case EDataTypeID_Vector2f:
+            dataDispatch.dispatchDataBinds(Vector2(result[0], result[1]));
+            break;
+        case EDataTypeID_Vector3f:
+            dataDispatch.dispatchDataBinds(Vector3(result[0], result[1], result[2]));
+            break;
+        case EDataTypeID_Vector4f:
+            dataDispatch.dispatchDataBinds(Vector4(result[0], result[1], result[2], result[3]));
+            break;
+        default:
+            assert(false);
+            break;
+        }
+    }
+
+    void AnimationBatchEvaluator::processUnbatchedAnimation(AnimationProcessData& processData) const
+    {
+        const SplineTimeStamp splineTime = AnimationProcessing::ComputeSplineTime(processData.m_animation, m_timeStamp);
+        const bool playReverse = (processData.m_animation.m_flags & Animation::EAnimationFlags_Reverse) != 0;
+        processData.m_splineIterator.setTimeStamp(splineTime, processData.m_spline, playReverse);
+
+        AnimationProcessDataDispatch dataDispatch(processData);
+        dataDispatch.dispatch();
+    }
+
+    void AnimationBatchEvaluator::InterpolateLinear(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count)
+    {
+        // same operations as Interpolator::InterpolateLinear (no fused multiply-add), so that results do not differ
+        UInt32 i = 0u;
+#if defined(RAMSES_MATH3D_SSE)
+        for (; i + 4u <= count; i += 4u)
+        {
+            const __m128 start = _mm_loadu_ps(startValues + i);
+            const __m128 diff = _mm_sub_ps(_mm_loadu_ps(endValues + i), start);
+            _mm_storeu_ps(results + i, _mm_add_ps(start, _mm_mul_ps(diff, _mm_loadu_ps(fractions + i))));
+        }
+#elif defined(RAMSES_MATH3D_NEON)
+        for (; i + 4u <= count; i += 4u)
+        {
+            const float32x4_t start = vld1q_f32(startValues + i);
+            const float32x4_t diff = vsubq_f32(vld1q_f32(endValues + i), start);
+            vst1q_f32(results + i, vaddq_f32(start, vmulq_f32(diff, vld1q_f32(fractions + i))));
+        }
+#endif
+        for (; i < count; ++i)
+            results[i] = startValues[i] + (endValues[i] - startValues[i]) * fractions[i];
+    }
+
+    void AnimationBatchEvaluator::InterpolateStep(const Float* startValues, const Float* endValues, const Float* fractions, Float* results, UInt32 count)
+    {
+        UInt32 i = 0u;
+#if defined(RAMSES_MATH3D_SSE)
+        const __m128 one = _mm_set1_ps(1.f);
+        for (; i + 4u <= count; i += 4u)
+        {
+            const __m128 useStart = _mm_cmplt_ps(_mm_loadu_ps(fractions + i), one);
+            _mm_storeu_ps(results + i, _mm_or_ps(_mm_and_ps(useStart, _mm_loadu_ps(startValues + i)), _mm_andnot_ps(useStart, _mm_loadu_ps(endValues + i))));
+        }
+#elif defined(RAMSES_MATH3D_NEON)
+        const float32x4_t one = vdupq_n_f32(1.f);
+        for (; i + 4u <= count; i += 4u)
+        {
+            const uint32x4_t useStart = vcltq_f32(vld1q_f32(fractions + i), one);
+            vst1q_f32(results + i, vbslq_f32(useStart, vld1q_f32(startValues + i), vld1q_f32(endValues + i)));
+        }
+#endif
+        for (; i < count; ++i)
+            results[i] = (fractions[i] < 1.f ? startValues[i] : endValues[i]);
+    }
+}
@@ -32,6 +32,18 @@ namespace ramses_internal
         }
     }
 
+    template <typename EDataType>
+    void AnimationProcessDataDispatch::dispatchDataBinds(const EDataType& interpolatedValue)
+    {
+        m_interpolatedValue.setValue(interpolatedValue);
+
+        for (const auto dataBind : m_processData.m_dataBinds)
+        {
+            assert(dataBind != nullptr);
+            dataBind->dispatch(*this);
+        }
+    }
+
     template <template<typename> class Key, typename EDataType>
     void AnimationProcessDataDispatch::dispatchSpline(const Spline<Key, EDataType>& spline)
     {
@@ -77,6 +89,11 @@ namespace ramses_internal
         return offset ^ interpolatedValue;
     }
 
+    template void AnimationProcessDataDispatch::dispatchDataBinds<Float>(const Float&);
+    template void AnimationProcessDataDispatch::dispatchDataBinds<Vector2>(const Vector2&);
+    template void AnimationProcessDataDispatch::dispatchDataBinds<Vector3>(const Vector3&);
+    template void AnimationProcessDataDispatch::dispatchDataBinds<Vector4>(const Vector4&);
+
     template void AnimationProcessDataDispatch::dispatchSpline<SplineKey, bool>(const Spline<SplineKey, bool>&);
     template void AnimationProcessDataDispatch::dispatchSpline<SplineKey, Int32>(const Spline<SplineKey, Int32>&);
     template void AnimationProcessDataDispatch::dispatchSpline<SplineKey, Int64>(const Spline<SplineKey, Int64>&);
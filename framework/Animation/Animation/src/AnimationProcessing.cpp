@@ -11,9 +11,10 @@
 
 namespace ramses_internal
 {
-    AnimationProcessing::AnimationProcessing(AnimationData& animationData)
+    AnimationProcessing::AnimationProcessing(AnimationData& animationData, ITaskQueue* taskQueue, UInt32 maxNumParallelTasks)
         : m_processDataCache(animationData)
         , m_timeStamp(0u)
+        , m_batchEvaluator(taskQueue, maxNumParallelTasks)
         , m_finishedAnimationProcessing(animationData)
     {
     }
@@ -64,27 +65,7 @@ namespace ramses_internal
 
     void AnimationProcessing::processActiveAnimations()
     {
-        for (AnimationProcessDataCache::DataProcessMap::Iterator it = m_processDataCache.begin();
-            it != m_processDataCache.end(); ++it)
-        {
-            AnimationProcessData& processData = it->value;
-            if (processData.m_animation.isPlaying(m_timeStamp))
-            {
-                processAnimation(processData);
-            }
-        }
-    }
-
-    void AnimationProcessing::processAnimation(AnimationProcessData& processData)
-    {
-        const SplineBase* const pSpline = processData.m_spline;
-        const SplineTimeStamp splineTime = ComputeSplineTime(processData.m_animation, m_timeStamp);
-        const bool playReverse = (processData.m_animation.m_flags & Animation::EAnimationFlags_Reverse) != 0;
-
-        processData.m_splineIterator.setTimeStamp(splineTime, pSpline, playReverse);
-
-        AnimationProcessDataDispatch dataDispatch(processData);
-        dataDispatch.dispatch();
+        m_batchEvaluator.processAnimations(m_processDataCache, m_timeStamp);
     }
 
     void AnimationProcessing::resetProcessDataIfCached(AnimationHandle handle)
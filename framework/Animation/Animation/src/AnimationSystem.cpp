@@ -11,10 +11,22 @@
 #include "Animation/SplineKeyTangents.h"
 #include "Animation/AnimationProcessing.h"
 #include "Scene/SceneDataBinding.h"
+#include <thread>
+#include <algorithm>
 
 namespace ramses_internal
 {
-    AnimationSystem::AnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo)
+    namespace
+    {
+        // leaves one core to thread calling animation processing, parallel tasks are only enqueued for large batches of animations
+        UInt32 GetMaxNumParallelProcessingTasks()
+        {
+            const UInt32 numCores = std::thread::hardware_concurrency();
+            return numCores > 1u ? std::min(numCores - 1u, 3u) : 0u;
+        }
+    }
+
+    AnimationSystem::AnimationSystem(UInt32 flags, const AnimationSystemSizeInformation& sizeInfo, ITaskQueue* parallelProcessingQueue)
         : m_animationData(sizeInfo)
         , m_animationLogic(m_animationData)
         , m_animationProcessing(nullptr)
@@ -27,7 +39,7 @@ namespace ramses_internal
         if (fullProcessing)
         {
             // Animation system with full data processing
-            m_animationProcessing = new AnimationProcessing(m_animationData);
+            m_animationProcessing = new AnimationProcessing(m_animationData, parallelProcessingQueue, parallelProcessingQueue != nullptr ? GetMaxNumParallelProcessingTasks() : 0u);
         }
         else
         {
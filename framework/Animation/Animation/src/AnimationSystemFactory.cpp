@@ -12,9 +12,10 @@
 
 namespace ramses_internal
 {
-    AnimationSystemFactory::AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector)
+    AnimationSystemFactory::AnimationSystemFactory(EAnimationSystemOwner ownerType, SceneActionCollection* actionCollector, ITaskQueue* parallelProcessingQueue)
         : m_ownerType(ownerType)
         , m_actionCollector(actionCollector)
+        , m_parallelProcessingQueue(parallelProcessingQueue)
     {
     }
 
@@ -27,9 +28,9 @@ namespace ramses_internal
             flags &= ~EAnimationSystemFlags_FullProcessing;
             return new AnimationSystem(flags, sizeInfo);
         case EAnimationSystemOwner_Renderer:
-            // Renderer requires full processing
+            // Renderer requires full processing, real time animation systems are processed every frame and can use parallel tasks
             flags |= EAnimationSystemFlags_FullProcessing;
-            return new AnimationSystem(flags, sizeInfo);
+            return new AnimationSystem(flags, sizeInfo, (flags & EAnimationSystemFlags_RealTime) != 0u ? m_parallelProcessingQueue : nullptr);
         case EAnimationSystemOwner_Client:
             assert(m_actionCollector != nullptr);
             return new ActionCollectingAnimationSystem(flags, *m_actionCollector, sizeInfo);
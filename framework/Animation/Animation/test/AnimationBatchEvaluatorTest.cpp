@@ -0,0 +1,247 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gmock/gmock.h"
+#include "Animation/AnimationBatchEvaluator.h"
+#include "Animation/AnimationLogic.h"
+#include "Animation/AnimationProcessing.h"
+#include "Animation/AnimationDataBind.h"
+#include "Animation/Interpolator.h"
+#include "Animation/SplineKey.h"
+#include "Animation/SplineIterator.h"
+#include "Animation/SplineSolver.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneDataBinding.h"
+#include "AnimationTestUtils.h"
+#include "MockTaskQueue.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include <memory>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class AnimationBatchEvaluatorTest : public testing::Test
+    {
+    protected:
+        typedef DataBindContainerToTraitsSelector<IScene>::ContainerTraitsClassType ContainerTraitsClass;
+
+        // scene with animated transformations processed by its own animation processing
+        struct AnimatedScene
+        {
+            explicit AnimatedScene(ITaskQueue* taskQueue = nullptr, UInt32 maxNumParallelTasks = 0u)
+                : logic(animationData)
+                , processing(animationData, taskQueue, maxNumParallelTasks)
+            {
+                logic.addListener(&processing);
+            }
+
+            Scene scene;
+            AnimationData animationData;
+            AnimationLogic logic;
+            AnimationProcessing processing;
+            std::vector<TransformHandle> transforms;
+        };
+
+        template <template<typename> class Key>
+        static void AddAnimation(AnimatedScene& animatedScene, const Spline<Key, Vector3>& spline, EInterpolationType interpolationType, TDataBindID dataBindID, Animation::Flags flags)
+        {
+            const TransformHandle transform = animatedScene.scene.allocateTransform(animatedScene.scene.allocateNode());
+            animatedScene.transforms.push_back(transform);
+
+            AnimationData& animationData = animatedScene.animationData;
+            const SplineHandle splineHandle = animationData.allocateSpline(spline);
+            const DataBindHandle dataBindHandle = animationData.allocateDataBinding(AnimationDataBind<IScene, Vector3, MemoryHandle>(animatedScene.scene, transform.asMemoryHandle(), dataBindID));
+            const AnimationInstanceHandle instanceHandle = animationData.allocateAnimationInstance(splineHandle, interpolationType);
+            animationData.addDataBindingToAnimationInstance(instanceHandle, dataBindHandle);
+
+            const AnimationHandle animationHandle = animationData.allocateAnimation(instanceHandle);
+            animationData.setAnimationProperties(animationHandle, 1.f, flags, 0u);
+            animationData.setAnimationTimeRange(animationHandle, AnimationTime(0u), AnimationTime(1000u));
+        }
+
+        static Vector3 GetKeyValue(UInt32 animationIdx, SplineTimeStamp keyTime)
+        {
+            return Vector3(static_cast<Float>(animationIdx), static_cast<Float>(keyTime) * 0.1f, static_cast<Float>((animationIdx * 7u + keyTime) % 13u) - 6.f);
+        }
+
+        static Spline<SplineKey, Vector3> CreateBasicSpline(UInt32 animationIdx)
+        {
+            Spline<SplineKey, Vector3> spline;
+            for (SplineTimeStamp keyTime = 0u; keyTime <= 1000u; keyTime += 100u + animationIdx % 50u)
+                spline.setKey(keyTime, SplineKey<Vector3>(GetKeyValue(animationIdx, keyTime)));
+            return spline;
+        }
+
+        static Spline<SplineKeyTangents, Vector3> CreateTangentsSpline(UInt32 animationIdx)
+        {
+            Spline<SplineKeyTangents, Vector3> spline;
+            for (SplineTimeStamp keyTime = 0u; keyTime <= 1000u; keyTime += 100u + animationIdx % 50u)
+                spline.setKey(keyTime, SplineKeyTangents<Vector3>(GetKeyValue(animationIdx, keyTime), Vector2(-10.f, -1.f), Vector2(10.f, 2.f)));
+            return spline;
+        }
+
+        // every 4th animation is of same type, see switch below
+        static void AddAnimations(AnimatedScene& animatedScene, UInt32 numAnimations)
+        {
+            for (UInt32 i = 0u; i < numAnimations; ++i)
+            {
+                const Spline<SplineKey, Vector3> basicSpline = CreateBasicSpline(i);
+                const Spline<SplineKeyTangents, Vector3> tangentsSpline = CreateTangentsSpline(i);
+
+                switch (i % 4u)
+                {
+                case 0u:
+                    AddAnimation(animatedScene, basicSpline, EInterpolationType_Linear, ContainerTraitsClass::TransformNode_Translation, 0u);
+                    break;
+                case 1u:
+                    AddAnimation(animatedScene, basicSpline, EInterpolationType_Step, ContainerTraitsClass::TransformNode_Scaling, 0u);
+                    break;
+                case 2u:
+                    AddAnimation(animatedScene, tangentsSpline, EInterpolationType_Bezier, ContainerTraitsClass::TransformNode_Rotation, Animation::EAnimationFlags_Reverse);
+                    break;
+                default:
+                    AddAnimation(animatedScene, tangentsSpline, EInterpolationType_Linear, ContainerTraitsClass::TransformNode_Translation, Animation::EAnimationFlags_Relative);
+                    break;
+                }
+            }
+        }
+
+        static void ExpectEqualTransformations(const AnimatedScene& expected, const AnimatedScene& actual)
+        {
+            ASSERT_EQ(expected.transforms.size(), actual.transforms.size());
+            for (size_t i = 0u; i < expected.transforms.size(); ++i)
+            {
+                EXPECT_EQ(expected.scene.getTranslation(expected.transforms[i]), actual.scene.getTranslation(actual.transforms[i]));
+                EXPECT_EQ(expected.scene.getRotation(expected.transforms[i]), actual.scene.getRotation(actual.transforms[i]));
+                EXPECT_EQ(expected.scene.getScaling(expected.transforms[i]), actual.scene.getScaling(actual.transforms[i]));
+            }
+        }
+    };
+
+    TEST_F(AnimationBatchEvaluatorTest, InterpolatesLinearSameAsInterpolator)
+    {
+        // count not multiple of SIMD width
+        const UInt32 count = 13u;
+        std::vector<Float> startValues(count);
+        std::vector<Float> endValues(count);
+        std::vector<Float> fractions(count);
+        for (UInt32 i = 0u; i < count; ++i)
+        {
+            startValues[i] = AnimationTestUtils::GetRandom<Float>();
+            endValues[i] = AnimationTestUtils::GetRandom<Float>();
+            fractions[i] = static_cast<Float>(i) / static_cast<Float>(count - 1u);
+        }
+
+        std::vector<Float> results(count);
+        AnimationBatchEvaluator::InterpolateLinear(startValues.data(), endValues.data(), fractions.data(), results.data(), count);
+        for (UInt32 i = 0u; i < count; ++i)
+            EXPECT_EQ(Interpolator::InterpolateLinear(startValues[i], endValues[i], fractions[i]), results[i]);
+    }
+
+    TEST_F(AnimationBatchEvaluatorTest, InterpolatesStepSameAsInterpolator)
+    {
+        const UInt32 count = 11u;
+        std::vector<Float> startValues(count);
+        std::vector<Float> endValues(count);
+        std::vector<Float> fractions(count);
+        for (UInt32 i = 0u; i < count; ++i)
+        {
+            startValues[i] = AnimationTestUtils::GetRandom<Float>();
+            endValues[i] = AnimationTestUtils::GetRandom<Float>();
+            fractions[i] = (i % 3u == 0u) ? 1.f : static_cast<Float>(i) / static_cast<Float>(count);
+        }
+
+        std::vector<Float> results(count);
+        AnimationBatchEvaluator::InterpolateStep(startValues.data(), endValues.data(), fractions.data(), results.data(), count);
+        for (UInt32 i = 0u; i < count; ++i)
+            EXPECT_EQ(Interpolator::InterpolateStep(startValues[i], endValues[i], fractions[i]), results[i]);
+    }
+
+    TEST_F(AnimationBatchEvaluatorTest, ProcessesManyAnimationsInParallelTasksSameAsSequentially)
+    {
+        const UInt32 numAnimations = 4u * AnimationBatchEvaluator::MinNumAnimationsPerTask;
+        ThreadedTaskExecutor taskExecutor(3u);
+        AnimatedScene sequentialScene;
+        AnimatedScene parallelScene(&taskExecutor, 3u);
+        AddAnimations(sequentialScene, numAnimations);
+        AddAnimations(parallelScene, numAnimations);
+
+        for (UInt64 time = 10u; time < 1000u; time += 77u)
+        {
+            sequentialScene.logic.setTime(time);
+            parallelScene.logic.setTime(time);
+            ExpectEqualTransformations(sequentialScene, parallelScene);
+        }
+
+        // some animations are finished in between, making batches differently sized than before
+        sequentialScene.animationData.setAnimationTimeRange(AnimationHandle(0u), AnimationTime(0u), AnimationTime(500u));
+        parallelScene.animationData.setAnimationTimeRange(AnimationHandle(0u), AnimationTime(0u), AnimationTime(500u));
+        sequentialScene.logic.setTime(999u);
+        parallelScene.logic.setTime(999u);
+        ExpectEqualTransformations(sequentialScene, parallelScene);
+    }
+
+    TEST_F(AnimationBatchEvaluatorTest, EvaluatesAllPartsItselfIfQueuedTasksAreNotExecutedInTime)
+    {
+        const UInt32 numAnimations = 4u * AnimationBatchEvaluator::MinNumAnimationsPerTask;
+        std::vector<ITask*> delayedTasks;
+        MockTaskQueue taskQueue;
+        EXPECT_CALL(taskQueue, enqueue(_)).Times(3).WillRepeatedly(Invoke([&delayedTasks](ITask& task)
+        {
+            task.addRef();
+            delayedTasks.push_back(&task);
+            return true;
+        }));
+
+        AnimatedScene sequentialScene;
+        std::unique_ptr<AnimatedScene> parallelScene(new AnimatedScene(&taskQueue, 3u));
+        AddAnimations(sequentialScene, numAnimations);
+        AddAnimations(*parallelScene, numAnimations);
+
+        sequentialScene.logic.setTime(321u);
+        parallelScene->logic.setTime(321u);
+        ExpectEqualTransformations(sequentialScene, *parallelScene);
+
+        // tasks executed late find nothing left to evaluate, also when evaluator is already gone
+        parallelScene.reset();
+        for (auto task : delayedTasks)
+        {
+            task->execute();
+            task->release();
+        }
+    }
+
+    TEST_F(AnimationBatchEvaluatorTest, AppliesSameValuesAsSplineSolver)
+    {
+        const UInt32 numAnimations = 8u;
+        AnimatedScene animatedScene;
+        AddAnimations(animatedScene, numAnimations);
+
+        for (UInt64 time = 10u; time < 1000u; time += 33u)
+        {
+            animatedScene.logic.setTime(time);
+
+            for (UInt32 i = 0u; i < numAnimations; i += 4u)
+            {
+                const Spline<SplineKey, Vector3> linearSpline = CreateBasicSpline(i);
+                SplineIterator linearIterator;
+                linearIterator.setTimeStamp(static_cast<SplineTimeStamp>(time), &linearSpline);
+                const Vector3 expectedTranslation = SplineSolver<SplineKey, Vector3>(linearSpline, linearIterator, EInterpolationType_Linear).getInterpolatedValue();
+                EXPECT_EQ(expectedTranslation, animatedScene.scene.getTranslation(animatedScene.transforms[i]));
+
+                const Spline<SplineKey, Vector3> stepSpline = CreateBasicSpline(i + 1u);
+                SplineIterator stepIterator;
+                stepIterator.setTimeStamp(static_cast<SplineTimeStamp>(time), &stepSpline);
+                const Vector3 expectedScaling = SplineSolver<SplineKey, Vector3>(stepSpline, stepIterator, EInterpolationType_Step).getInterpolatedValue();
+                EXPECT_EQ(expectedScaling, animatedScene.scene.getScaling(animatedScene.transforms[i + 1u]));
+            }
+        }
+    }
+}
@@ -75,6 +75,7 @@ namespace ramses_internal
         ESceneActionId_SetRenderableDataInstance,
         ESceneActionId_SetRenderableInstanceCount,
         ESceneActionId_SetRenderableStartVertex,
+        ESceneActionId_SetRenderableBoundingBox,
 
         // render states
         ESceneActionId_ReleaseState,
@@ -277,6 +278,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId_SetRenderableDataInstance);
             CreateNameForEnumID(ESceneActionId_SetRenderableInstanceCount);
             CreateNameForEnumID(ESceneActionId_SetRenderableStartVertex);
+            CreateNameForEnumID(ESceneActionId_SetRenderableBoundingBox);
 
             // render states
             CreateNameForEnumID(ESceneActionId_ReleaseState);
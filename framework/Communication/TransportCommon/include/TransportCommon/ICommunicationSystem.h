@@ -16,10 +16,11 @@
 #include "Components/ManagedResource.h"
 #include "Utils/IPeriodicLogSupplier.h"
 #include "Components/DcsmTypes.h"
+#include "Collections/Guid.h"
+#include <vector>
 
 namespace ramses_internal
 {
-    class Guid;
     class IConnectionStatusUpdateNotifier;
     class SceneActionCollection;
 
@@ -63,6 +64,18 @@ namespace ramses_internal
         virtual bool sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo) = 0;
         virtual uint64_t sendSceneActionList(const Guid& to, const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& actionListCounter) = 0;
 
+        // receivers paired with their action list counter, returns number of chunks sent to every receiver in the same order.
+        // Implementations can serialize the actions once for all receivers, by default they are sent to each receiver separately.
+        using SceneActionListReceivers = std::vector<std::pair<Guid, uint64_t>>;
+        virtual std::vector<uint64_t> multicastSceneActionList(const SceneActionListReceivers& receivers, const SceneId& sceneId, const SceneActionCollection& actions)
+        {
+            std::vector<uint64_t> numberOfChunksSent;
+            numberOfChunksSent.reserve(receivers.size());
+            for (const auto& receiver : receivers)
+                numberOfChunksSent.push_back(sendSceneActionList(receiver.first, sceneId, actions, receiver.second));
+            return numberOfChunksSent;
+        }
+
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<Byte>& data) = 0;
 
         // dcsm provider -> consumer
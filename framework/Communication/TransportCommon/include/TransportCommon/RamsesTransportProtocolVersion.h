@@ -9,6 +9,6 @@
 #ifndef RAMSES_RAMSESTRANSPORTPROTOCOLVERSION_H
 #define RAMSES_RAMSESTRANSPORTPROTOCOLVERSION_H
 
-#define RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR 101
+#define RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR 102
 
 #endif
@@ -62,6 +62,7 @@ namespace ramses_internal
 
         virtual bool sendInitializeScene(const Guid& to, const SceneInfo& sceneInfo) override;
         virtual uint64_t sendSceneActionList(const Guid& to, const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& actionListCounter) override;
+        virtual std::vector<uint64_t> multicastSceneActionList(const SceneActionListReceivers& receivers, const SceneId& sceneId, const SceneActionCollection& actions) override;
 
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<Byte>& data) override;
 
@@ -122,14 +123,29 @@ namespace ramses_internal
                 stream << static_cast<uint32_t>(0) << static_cast<uint32_t>(messageType);
             }
 
+            // message starting with content shared by several messages (including size and type), stream holds the rest
+            // and may be empty
+            OutMessage(const Guid& to_, EMessageId messageType_, std::shared_ptr<const std::vector<char>> sharedContent_)
+                : to(to_)
+                , messageType(messageType_)
+                , sharedContent(std::move(sharedContent_))
+            {
+            }
+
             // TODO(tobias) make move only in c++14
             OutMessage(OutMessage&&) noexcept = default;
             OutMessage(const OutMessage&) = default;
             OutMessage& operator=(const OutMessage&) = default;
 
+            // moves stream content to shared content, copies of message then share its data
+            void shareContent();
+
             Guid to;
             EMessageId messageType;
+            std::shared_ptr<const std::vector<char>> sharedContent;
             BinaryOutputStream stream;
+            // set when posted for sending to measure queueing delay, messages sent directly leave it unset
+            std::chrono::steady_clock::time_point postTime;
         };
 
         struct Participant
@@ -138,6 +154,8 @@ namespace ramses_internal
                         EParticipantType type_, EParticipantState state_);
             ~Participant();
 
+            bool isSending() const;
+
             NetworkParticipantAddress address;
             asio::ip::tcp::socket socket;
             asio::steady_timer connectTimer;
@@ -145,6 +163,7 @@ namespace ramses_internal
             std::deque<OutMessage> outQueueNormal;
             std::deque<OutMessage> outQueuePrio;
             std::vector<char> currentOutBuffer;
+            std::shared_ptr<const std::vector<char>> currentOutSharedBuffer;
 
             uint32_t lengthReceiveBuffer;
             std::vector<char> receiveBuffer;
@@ -11,14 +11,25 @@
 #include "Components/ResourceStreamSerialization.h"
 #include "Scene/SceneActionCollection.h"
 #include "TransportCommon/TransportUtilities.h"
+#include "Resource/ResourceCompressionUtils.h"
 #include "Utils/BinaryInputStream.h"
 #include "Utils/RawBinaryOutputStream.h"
 #include "Utils/StatisticCollection.h"
 #include "Utils/LogMacros.h"
 #include <thread>
+#include <array>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        void WriteMessageSize(std::vector<char>& messageStart, uint32_t fullSize)
+        {
+            RawBinaryOutputStream s(reinterpret_cast<uint8_t*>(messageStart.data()), static_cast<uint32_t>(messageStart.size()));
+            s << static_cast<uint32_t>(fullSize - sizeof(uint32_t));
+        }
+    }
+
     static const constexpr uint32_t ResourceDataSize = 300000;
 
     TCPConnectionSystem::TCPConnectionSystem(const NetworkParticipantAddress& participantAddress,
@@ -342,20 +353,34 @@ namespace ramses_internal
 
     void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
     {
-        assert(pp->currentOutBuffer.empty());
+        assert(!pp->isSending());
 
         pp->currentOutBuffer = msg.stream.release();
-        const uint32_t fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
+        pp->currentOutSharedBuffer = std::move(msg.sharedContent);
+        assert(pp->isSending());
+
+        if (msg.postTime != std::chrono::steady_clock::time_point())
+        {
+            const auto queueingDelay = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - msg.postTime);
+            m_statisticCollection.statMessageQueueingDelay.record(queueingDelay.count());
+        }
+
+        const uint32_t sharedSize = pp->currentOutSharedBuffer ? static_cast<uint32_t>(pp->currentOutSharedBuffer->size()) : 0u;
+        const uint32_t fullSize = sharedSize + static_cast<uint32_t>(pp->currentOutBuffer.size());
 
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
                   ", MsgType " << GetNameForMessageId(msg.messageType) << ", Size " << fullSize);
 
-        RawBinaryOutputStream s(reinterpret_cast<uint8_t*>(pp->currentOutBuffer.data()), static_cast<uint32_t>(pp->currentOutBuffer.size()));
-        const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
-        s << remainingSize;
+        // shared content already has size of whole message set
+        if (!pp->currentOutSharedBuffer)
+            WriteMessageSize(pp->currentOutBuffer, fullSize);
 
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
-                          [this, pp](asio::error_code e, std::size_t sentBytes) {
+        const std::array<asio::const_buffer, 2> buffers{ {
+            asio::const_buffer(pp->currentOutSharedBuffer ? pp->currentOutSharedBuffer->data() : nullptr, sharedSize),
+            asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()) } };
+
+        asio::async_write(pp->socket, buffers,
+                          [this, pp, fullSize](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
                                   LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: Send to "
@@ -367,9 +392,10 @@ namespace ramses_internal
                               else
                               {
                                   LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem(" << m_participantAddress.getParticipantName() << ")::sendMessageToParticipant: To " << pp->address.getParticipantId() <<
-                                            ", MsgBytes " << pp->currentOutBuffer.size() << ", SentBytes " << sentBytes);
+                                            ", MsgBytes " << fullSize << ", SentBytes " << sentBytes);
 
                                   pp->currentOutBuffer.clear();
+                                  pp->currentOutSharedBuffer.reset();
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -388,7 +414,7 @@ namespace ramses_internal
 
     void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() &&
+        if (!pp->isSending() &&
             (!pp->outQueueNormal.empty() || !pp->outQueuePrio.empty()))
         {
             auto& queue = pp->outQueuePrio.empty() ? pp->outQueueNormal : pp->outQueuePrio;
@@ -401,7 +427,7 @@ namespace ramses_internal
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty())
+        if (!pp->isSending())
         {
             assert(pp->outQueueNormal.empty());
             assert(pp->outQueuePrio.empty());
@@ -586,8 +612,14 @@ namespace ramses_internal
         }
 
         m_statisticCollection.statMessagesSent.incCounter(1);
-        asio::post(m_runState->m_io, [this, msg, hasPrio]() {
-                            const bool broadcast = msg.to.isInvalid();
+
+        // message queued for every participant only references the data when broadcasting
+        const bool broadcast = msg.to.isInvalid();
+        if (broadcast)
+            msg.shareContent();
+        msg.postTime = std::chrono::steady_clock::now();
+
+        asio::post(m_runState->m_io, [this, msg = std::move(msg), hasPrio, broadcast]() mutable {
                             if (broadcast)
                             {
                                 for (auto& p : m_establishedParticipants)
@@ -595,7 +627,6 @@ namespace ramses_internal
                                     ParticipantPtr& pp = p.value;
                                     assert(pp);
 
-                                    // cannot move here when broadcast to more than 1 participant
                                     if (hasPrio)
                                         pp->outQueuePrio.push_back(msg);
                                     else
@@ -987,18 +1018,23 @@ namespace ramses_internal
 
     // --
     uint64_t TCPConnectionSystem::sendSceneActionList(const Guid& to, const SceneId& sceneId, const SceneActionCollection& actions, const uint64_t& counterStart)
+    {
+        return multicastSceneActionList({ { to, counterStart } }, sceneId, actions).front();
+    }
+
+    std::vector<uint64_t> TCPConnectionSystem::multicastSceneActionList(const SceneActionListReceivers& receivers, const SceneId& sceneId, const SceneActionCollection& actions)
     {
         uint64_t numberOfChunks = 0u;
 
         auto sendChunk =
             [&](std::pair<uint32_t, uint32_t> actionRange, std::pair<const Byte*, const Byte*> dataRange, bool isIncomplete)
         {
-            LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem::sendSceneActionList: to " << to <<
-                ", sceneId " << sceneId.getValue() << ", actions [" << actionRange.first << ", " << actionRange.second <<
+            LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem::multicastSceneActionList: to " << receivers.size() <<
+                " receivers, sceneId " << sceneId.getValue() << ", actions [" << actionRange.first << ", " << actionRange.second <<
                 ") from " << actions.numberOfActions());
 
-
-            OutMessage msg(to, EMessageId_SendSceneActionList);
+            // chunk is serialized once and shared by messages to all receivers, only action list counter differs
+            OutMessage msg(Guid(), EMessageId_SendSceneActionList);
             msg.stream << static_cast<uint32_t>(actionRange.second - actionRange.first)
                        << static_cast<uint32_t>(dataRange.second - dataRange.first)
                        << sceneId.getValue();
@@ -1013,14 +1049,20 @@ namespace ramses_internal
             }
             msg.stream.write(dataRange.first, static_cast<uint32_t>(dataRange.second - dataRange.first));
 
-            msg.stream << (counterStart + numberOfChunks);
-            numberOfChunks++;
+            auto sharedContent = std::make_shared<std::vector<char>>(msg.stream.release());
+            WriteMessageSize(*sharedContent, static_cast<uint32_t>(sharedContent->size() + sizeof(uint64_t)));
 
-            return postMessageForSending(std::move(msg), true);
+            for (const auto& receiver : receivers)
+            {
+                OutMessage receiverMsg(receiver.first, EMessageId_SendSceneActionList, sharedContent);
+                receiverMsg.stream << (receiver.second + numberOfChunks);
+                postMessageForSending(std::move(receiverMsg), true);
+            }
+            numberOfChunks++;
         };
 
         TransportUtilities::SplitSceneActionsToChunks(actions, m_sendDataSizes.sceneActionNumber, m_sendDataSizes.sceneActionDataArray, sendChunk);
-        return numberOfChunks;
+        return std::vector<uint64_t>(receivers.size(), numberOfChunks);
     }
 
     void TCPConnectionSystem::handleSceneActionList(const ParticipantPtr& pp, BinaryInputStream& stream)
@@ -1259,29 +1301,36 @@ namespace ramses_internal
         if (!m_runState)
             return false;
 
-        // try to compress for network sending
+        // try to compress for network sending, usually already done in parallel by resource component
+        std::vector<const IResource*> resourcesToCompress;
+        resourcesToCompress.reserve(managedResources.size());
         for (const auto& managedResource : managedResources)
         {
             const IResource* resource = managedResource.getResourceObject();
             assert(resource != nullptr);
-            resource->compress(IResource::CompressionLevel::REALTIME);
+            resourcesToCompress.push_back(resource);
         }
+        ResourceCompressionUtils::CompressResources(std::move(resourcesToCompress), IResource::CompressionLevel::REALTIME, nullptr);
 
-        std::vector<Byte> buffer;
+        // resources are serialized directly behind message header (size, type and packet size) into a buffer
+        // which is then sent without copying
+        const uint32_t headerSize = 3u * sizeof(uint32_t);
+        std::shared_ptr<std::vector<char>> packet;
         bool result = true;
 
         auto preparePacketFun = [&](UInt32 neededSize) -> std::pair<Byte*, UInt32> {
-            buffer.resize(std::min(m_sendDataSizes.resourceDataArray, neededSize));
-            return std::make_pair(buffer.data(), static_cast<UInt32>(buffer.size()));
+            const UInt32 packetSize = std::min(m_sendDataSizes.resourceDataArray, neededSize);
+            packet = std::make_shared<std::vector<char>>(headerSize + packetSize);
+            return std::make_pair(reinterpret_cast<Byte*>(packet->data() + headerSize), packetSize);
         };
 
         auto finishedPacketFun = [&](UInt32 usedSize) {
-            assert(usedSize <= buffer.size());
+            assert(headerSize + usedSize <= packet->size());
+            packet->resize(headerSize + usedSize);
 
-            OutMessage msg(to, EMessageId_TransferResources);
-            msg.stream << usedSize;
-            msg.stream.write(buffer.data(), usedSize);
-            result &= postMessageForSending(std::move(msg), false);
+            RawBinaryOutputStream header(reinterpret_cast<uint8_t*>(packet->data()), headerSize);
+            header << static_cast<uint32_t>(packet->size() - sizeof(uint32_t)) << static_cast<uint32_t>(EMessageId_TransferResources) << usedSize;
+            result &= postMessageForSending(OutMessage(to, EMessageId_TransferResources, std::move(packet)), false);
 
             m_statisticCollection.statResourcesSentSize.incCounter(usedSize);
         };
@@ -1726,6 +1775,21 @@ namespace ramses_internal
         }
     }
 
+    bool TCPConnectionSystem::Participant::isSending() const
+    {
+        return currentOutSharedBuffer || !currentOutBuffer.empty();
+    }
+
+    void TCPConnectionSystem::OutMessage::shareContent()
+    {
+        if (!sharedContent)
+        {
+            auto content = std::make_shared<std::vector<char>>(stream.release());
+            WriteMessageSize(*content, static_cast<uint32_t>(content->size()));
+            sharedContent = std::move(content);
+        }
+    }
+
     // --- TCPConnectionSystem::RunState ---
     TCPConnectionSystem::RunState::RunState()
         : m_io()
@@ -36,10 +36,10 @@ namespace ramses_internal
     struct ResourceLoadInfo
     {
         ResourceLoadInfo()
-            : resourceStream(nullptr)
+            : resourceFile(nullptr)
         {}
 
-        BinaryFileInputStream* resourceStream;
+        ResourceFileInputStream* resourceFile;
         ResourceFileEntry fileEntry;
         Guid requesterId;
 
@@ -90,7 +90,7 @@ namespace ramses_internal
         virtual void handleResourcesNotAvailable(const ResourceContentHashVector& resources, const Guid& providerID) override;
 
         // internal / testing
-        void resourceHasBeenLoadedFromFile(IResource* loadedResource, uint32_t size);
+        void resourceHasBeenLoadedFromFile(IResource* loadedResource, uint64_t size);
         void handleArrivedResource(const ManagedResource& resource);
         bool isReceivingFromParticipant(const Guid& participant) const;
         bool hasRequestForResource(ResourceContentHash hash, RequesterID requester) const;
@@ -120,6 +120,7 @@ namespace ramses_internal
         void triggerLoadingResourcesFromFile();
 
         void sendResourcesFromFile(const std::vector<IResource*>& loadedResources, uint64_t bytesLoaded, const Guid& requesterId);
+        void sendResourcesViaNetwork(const Guid& requesterId, const ManagedResourceVector& resources);
         const ResourceInfo& getResourceInfo(const ResourceContentHash& hash) const;
         void storeResourceInfo(const ResourceContentHash& hash, const ResourceInfo& resourceInfo);
 
@@ -131,6 +132,7 @@ namespace ramses_internal
         ResourceStorage m_resourceStorage;
         std::deque<ResourceLoadInfo> m_resourcesToBeLoaded;
         EnqueueOnlyOneAtATimeQueue m_taskQueueForResourceLoading;
+        ITaskQueue& m_taskQueueForResourceCompression;
         UInt64 m_maximumBytesAllowedForResourceLoading;
         uint64_t m_bytesScheduledForLoading;
         ResourceFilesRegistry m_resourceFiles;
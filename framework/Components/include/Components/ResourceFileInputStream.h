@@ -11,6 +11,8 @@
 
 #include "Utils/File.h"
 #include "Utils/BinaryFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -20,6 +22,7 @@ namespace ramses_internal
         ResourceFileInputStream(const String& resourceFileName)
             : resourceFile(resourceFileName)
             , resourceStream(resourceFile)
+            , mappedFile(std::make_shared<MemoryMappedFile>(resourceFileName))
         {}
 
         const String getResourceFileName() const
@@ -32,6 +35,9 @@ namespace ramses_internal
 
     public:
         BinaryFileInputStream resourceStream;
+        // resources are read from the mapping if available, resourceStream is the fallback.
+        // Resources can use data in place from the mapping and share ownership of it
+        std::shared_ptr<MemoryMappedFile> mappedFile;
     };
 
     typedef std::shared_ptr<ResourceFileInputStream> ResourceFileInputStreamSPtr;
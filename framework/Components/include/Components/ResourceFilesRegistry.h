@@ -44,7 +44,7 @@ namespace ramses_internal
         bool hasResourceFile(const String& resourceFileName) const;
 
         bool canLoadResource(const ResourceContentHash& hash) const;
-        EStatus getEntry(const ResourceContentHash& hash, BinaryFileInputStream*& resourceStream, ResourceFileEntry& fileEntry) const;
+        EStatus getEntry(const ResourceContentHash& hash, ResourceFileInputStream*& resourceFile, ResourceFileEntry& fileEntry) const;
     private:
         ResourceFileInputStreamToFileContentMap m_resourceFiles;
     };
@@ -96,7 +96,7 @@ namespace ramses_internal
     }
 
     inline
-    EStatus ResourceFilesRegistry::getEntry(const ResourceContentHash& hash, BinaryFileInputStream*& resourceStream, ResourceFileEntry& fileEntry) const
+    EStatus ResourceFilesRegistry::getEntry(const ResourceContentHash& hash, ResourceFileInputStream*& resourceFile, ResourceFileEntry& fileEntry) const
     {
         for (const auto& iter : m_resourceFiles)
         {
@@ -104,7 +104,7 @@ namespace ramses_internal
             ResourceRegistryEntry* entry = fileContents.get(hash);
             if (entry != nullptr)
             {
-                resourceStream = &iter.key->resourceStream;
+                resourceFile = iter.key.get();
                 fileEntry = entry->fileEntry;
                 return EStatus_RAMSES_OK;
             }
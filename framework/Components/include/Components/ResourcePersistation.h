@@ -20,16 +20,19 @@ namespace ramses_internal
     class IInputStream;
     class BinaryFileInputStream;
     class BinaryFileOutputStream;
+    class ResourceFileInputStream;
     struct ResourceFileEntry;
+    class ITaskQueue;
 
     class ResourcePersistation
     {
     public:
-        static void WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress);
+        static void WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress, ITaskQueue* compressionTaskQueue = nullptr);
         static void WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource);
 
         static IResource* ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash);
         static IResource* RetrieveResourceFromStream(BinaryFileInputStream& inStream, const ResourceFileEntry& entry);
+        static IResource* RetrieveResourceFromFile(ResourceFileInputStream& resourceFile, const ResourceFileEntry& entry);
     };
 }
 
@@ -22,8 +22,8 @@ namespace ramses_internal
 {
     struct ResourceFileEntry
     {
-        UInt32 offsetInBytes;
-        UInt32 sizeInBytes;
+        UInt64 offsetInBytes;
+        UInt64 sizeInBytes;
         ResourceInfo resourceInfo;
     };
 
@@ -33,13 +33,21 @@ namespace ramses_internal
     {
     public:
         bool containsResource(const ResourceContentHash& hash) const;
-        void registerContents(const ResourceInfo& info, UInt32 offsetInBytes, UInt32 sizeInBytes);
+        void registerContents(const ResourceInfo& info, UInt64 offsetInBytes, UInt64 sizeInBytes);
         const ResourceFileEntry& getEntryForHash(const ResourceContentHash& hash) const;
         const TableOfContentsMap& getFileContents() const;
         bool readTOCPosAndTOCFromStream(BinaryFileInputStream& instream);
         void writeTOCToStream(IOutputStream& outstream);
 
+        // TOC is written as [marker, version, entries...]. Files without marker are legacy files
+        // where the marker position contains the entry count and offsets/sizes are 32 bit.
+        static const UInt32 FormatMarker = 0xFFFFFFFFu;
+        static const UInt32 FormatVersion = 2u;
+
     private:
+        template <typename OffsetType>
+        bool readEntriesFromStream(BinaryFileInputStream& instream, uint32_t numberOfEntries);
+
         TableOfContentsMap m_fileContents;
     };
 }
@@ -12,6 +12,7 @@
 #include "Scene/SceneDescriber.h"
 #include "Scene/SceneActionApplier.h"
 #include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneActionUtils.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "Utils/LogMacros.h"
 #include "Utils/StatisticCollection.h"
@@ -33,6 +34,9 @@ namespace ramses_internal
         SceneActionCollection collection;
         collection.swap(m_scene.getSceneActionCollection());
 
+        if (m_scene.getCollapseRedundantSetters())
+            SceneActionCollectionUtils::RemoveOverwrittenSetterActions(collection);
+
         const bool hasNewActions = !collection.empty();
 
         if (m_flushCounter == 0)
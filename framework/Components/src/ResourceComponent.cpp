@@ -18,6 +18,7 @@
 #include "TransportCommon/IConnectionStatusUpdateNotifier.h"
 #include "TransportCommon/ICommunicationSystem.h"
 #include "Components/ResourceStreamSerialization.h"
+#include "Resource/ResourceCompressionUtils.h"
 #include <algorithm>
 #include "PlatformAbstraction/PlatformTime.h"
 
@@ -29,6 +30,7 @@ namespace ramses_internal
         , m_connectionStatusUpdateNotifier(connectionStatusUpdateNotifier)
         , m_resourceStorage(frameworkLock)
         , m_taskQueueForResourceLoading(queue)
+        , m_taskQueueForResourceCompression(queue)
         , m_maximumBytesAllowedForResourceLoading(maximumTotalBytesForAsynResourceLoading)
         , m_bytesScheduledForLoading(0)
         , m_communicationSystem(communicationSystem)
@@ -107,7 +109,7 @@ namespace ramses_internal
             {
                 // try resource files
                 ResourceLoadInfo loadInfo;
-                const EStatus canLoadFromFile = m_resourceFiles.getEntry(id, loadInfo.resourceStream, loadInfo.fileEntry);
+                const EStatus canLoadFromFile = m_resourceFiles.getEntry(id, loadInfo.resourceFile, loadInfo.fileEntry);
                 if (canLoadFromFile == EStatus_RAMSES_OK)
                 {
                     loadInfo.requesterId = requesterId;
@@ -125,7 +127,7 @@ namespace ramses_internal
         if (!resourceToSendViaNetwork.empty())
         {
             m_statistics.statResourcesSentNumber.incCounter(static_cast<UInt32>(resourceToSendViaNetwork.size()));
-            m_communicationSystem.sendResources(requesterId, resourceToSendViaNetwork);
+            sendResourcesViaNetwork(requesterId, resourceToSendViaNetwork);
         }
 
         if (unavailableResources.size() > 0)
@@ -190,7 +192,7 @@ namespace ramses_internal
                 {
                     // only trigger request from file or network if not already requested by any requester
                     ResourceLoadInfo loadInfo;
-                    const EStatus canLoadResource = m_resourceFiles.getEntry(hash, loadInfo.resourceStream, loadInfo.fileEntry);
+                    const EStatus canLoadResource = m_resourceFiles.getEntry(hash, loadInfo.resourceFile, loadInfo.fileEntry);
                     if (canLoadResource == EStatus_RAMSES_OK)
                     {
                         m_resourcesToBeLoaded.push_back(loadInfo);
@@ -261,7 +263,7 @@ namespace ramses_internal
         {
             const ResourceLoadInfo nextResourceToBeLoaded = m_resourcesToBeLoaded[0];
             const uint64_t bytesUsedOrScheduled = m_resourceStorage.getBytesUsedByResourcesInMemory() + m_bytesScheduledForLoading;
-            const UInt32 sizeOfNextResource = nextResourceToBeLoaded.fileEntry.sizeInBytes;
+            const UInt64 sizeOfNextResource = nextResourceToBeLoaded.fileEntry.sizeInBytes;
             if (bytesUsedOrScheduled + sizeOfNextResource < m_maximumBytesAllowedForResourceLoading)
             {
                 if (shouldReserve)
@@ -411,7 +413,7 @@ namespace ramses_internal
         }
     }
 
-    void ResourceComponent::resourceHasBeenLoadedFromFile(IResource* loadedResource, uint32_t size)
+    void ResourceComponent::resourceHasBeenLoadedFromFile(IResource* loadedResource, uint64_t size)
     {
         PlatformGuard guard(m_frameworkLock);
         m_bytesScheduledForLoading -= size;
@@ -430,7 +432,19 @@ namespace ramses_internal
             managedResources.push_back(m_resourceStorage.manageResource(*loadedResource, true));
         }
         m_bytesScheduledForLoading -= bytesLoaded;
-        m_communicationSystem.sendResources(requesterId, managedResources);
+        sendResourcesViaNetwork(requesterId, managedResources);
+    }
+
+    void ResourceComponent::sendResourcesViaNetwork(const Guid& requesterId, const ManagedResourceVector& resources)
+    {
+        // resources are sent compressed, large sets are compressed in parallel using tasks of the framework task queue
+        std::vector<const IResource*> resourcesToCompress;
+        resourcesToCompress.reserve(resources.size());
+        for (const auto& resource : resources)
+            resourcesToCompress.push_back(resource.getResourceObject());
+        ResourceCompressionUtils::CompressResources(std::move(resourcesToCompress), IResource::CompressionLevel::REALTIME, &m_taskQueueForResourceCompression);
+
+        m_communicationSystem.sendResources(requesterId, resources);
     }
 
     void ResourceComponent::LoadResourcesFromFileTask::execute()
@@ -441,6 +455,10 @@ namespace ramses_internal
 
         const auto startTime = PlatformTime::GetMillisecondsMonotonic();
 
+        // let the OS read ahead all mapped ranges while resources are deserialized one by one
+        for (const auto& resInfo : m_resourcesToLoad)
+            resInfo.resourceFile->mappedFile->prefetch(resInfo.fileEntry.offsetInBytes, resInfo.fileEntry.sizeInBytes);
+
         struct NetworkResourceInfo {
             std::vector<IResource*> resources;
             uint64_t accumulatedFileSize;
@@ -448,7 +466,7 @@ namespace ramses_internal
         HashMap<Guid, NetworkResourceInfo> resourceToSendViaNetwork(m_resourcesToLoad.size());
         for(const auto& resInfo : m_resourcesToLoad)
         {
-            IResource* res = ResourcePersistation::RetrieveResourceFromStream(*resInfo.resourceStream, resInfo.fileEntry);
+            IResource* res = ResourcePersistation::RetrieveResourceFromFile(*resInfo.resourceFile, resInfo.fileEntry);
             if (!res)
             {
                 LOG_ERROR(CONTEXT_FRAMEWORK, "Unable to load resource of type " << EnumToString(resInfo.fileEntry.resourceInfo.type)
@@ -526,15 +544,15 @@ namespace ramses_internal
 
     ManagedResource ResourceComponent::forceLoadResource(const ResourceContentHash& hash)
     {
-        BinaryFileInputStream* resourceStream(nullptr);
+        ResourceFileInputStream* resourceFile(nullptr);
         ResourceFileEntry entry;
-        const EStatus canLoadFromFile = m_resourceFiles.getEntry(hash, resourceStream, entry);
+        const EStatus canLoadFromFile = m_resourceFiles.getEntry(hash, resourceFile, entry);
         if (canLoadFromFile == EStatus_RAMSES_OK)
         {
             m_statistics.statResourcesLoadedFromFileNumber.incCounter(1);
             m_statistics.statResourcesLoadedFromFileSize.incCounter(entry.sizeInBytes);
 
-            IResource* lowLevelResource = ResourcePersistation::RetrieveResourceFromStream(*resourceStream, entry);
+            IResource* lowLevelResource = ResourcePersistation::RetrieveResourceFromFile(*resourceFile, entry);
             return m_resourceStorage.manageResource(*lowLevelResource, true);
         }
         else
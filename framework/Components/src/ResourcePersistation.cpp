@@ -18,10 +18,29 @@
 #include "Components/ResourceTableOfContents.h"
 #include "Resource/ResourceInfo.h"
 #include "Resource/IResource.h"
+#include "Resource/ResourceCompressionUtils.h"
 #include "Components/SingleResourceSerialization.h"
+#include "Components/ResourceFileInputStream.h"
+#include "Components/ResourceSerializationHelper.h"
+#include "Resource/EResourceCompressionStatus.h"
+#include "Utils/BinaryInputStream.h"
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // resource data blobs are placed aligned in the file, so they can be used in place from a memory mapping.
+        // Blobs of at least one page start on a page boundary, smaller ones at least suitable for any element type
+        const UInt64 ResourceDataPageAlignment = 4096u;
+        const UInt64 ResourceDataMinimumAlignment = 16u;
+
+        UInt64 GetAlignedResourceDataOffset(UInt64 dataOffset, UInt64 dataSize)
+        {
+            const UInt64 alignment = (dataSize >= ResourceDataPageAlignment) ? ResourceDataPageAlignment : ResourceDataMinimumAlignment;
+            return (dataOffset + alignment - 1u) / alignment * alignment;
+        }
+    }
+
     void ResourcePersistation::WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource)
     {
         const IResource& r = *resource.getResourceObject();
@@ -33,7 +52,7 @@ namespace ramses_internal
         return SingleResourceSerialization::DeserializeResource(inStream, hash);
     }
 
-    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress)
+    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress, ITaskQueue* compressionTaskQueue)
     {
         // achieve maximum resource file loading speed by reading in increasing file position order
         // so store TOC first followed by all resources, as the toc is read before the resources
@@ -41,61 +60,75 @@ namespace ramses_internal
         UInt offsetForTOC = 0;
         outStream.getPos(offsetForTOC);
 
-        // get size and offset of resources by writing to dummy stream
-        VoidOutputStream dummyStream;
+        // get size of resources by writing to dummy streams, offsets are 64 bit to allow files larger than 4 GiB
         ResourceTableOfContents dummyToc;
-        std::vector<UInt32> resourceOffsetSize;
-        resourceOffsetSize.reserve(resourcesForFile.size() * 2);
-        UInt32 offsetBeforeWrite = 0;
-        UInt32 currentPosAfterWrite = 0;
+        std::vector<UInt64> resourceSizes;
+        std::vector<UInt64> resourceHeaderSizes;
+        resourceSizes.reserve(resourcesForFile.size());
+        resourceHeaderSizes.reserve(resourcesForFile.size());
 
         // possible compress all resources before writing
-        for (const auto& res : resourcesForFile)
+        if (compress)
         {
-            res.getResourceObject()->compress(compress ? IResource::CompressionLevel::OFFLINE : IResource::CompressionLevel::NONE);
+            std::vector<const IResource*> resourcesToCompress;
+            resourcesToCompress.reserve(resourcesForFile.size());
+            for (const auto& res : resourcesForFile)
+                resourcesToCompress.push_back(res.getResourceObject());
+            ResourceCompressionUtils::CompressResources(std::move(resourcesToCompress), IResource::CompressionLevel::OFFLINE, compressionTaskQueue);
         }
 
         for (const auto& res : resourcesForFile)
         {
+            VoidOutputStream dummyStream;
             WriteOneResourceToStream(dummyStream, res);
-            currentPosAfterWrite = dummyStream.getSize();
-            const UInt32 bytesWritten = currentPosAfterWrite - offsetBeforeWrite;
-            resourceOffsetSize.push_back(offsetBeforeWrite);
-            resourceOffsetSize.push_back(bytesWritten);
+            resourceSizes.push_back(dummyStream.getSize());
 
             const IResource* resourceObject = res.getResourceObject();
+            resourceHeaderSizes.push_back(ResourceSerializationHelper::ResourceMetadataSize(*resourceObject));
             dummyToc.registerContents(ResourceInfo(resourceObject), 0, 0);
-
-            offsetBeforeWrite = static_cast<UInt32>(currentPosAfterWrite);
         }
 
         // get size of TOC by writing to dummy stream
-        dummyToc.writeTOCToStream(dummyStream);
-        currentPosAfterWrite = dummyStream.getSize();
-        const UInt32 tocSize = currentPosAfterWrite - offsetBeforeWrite;
+        VoidOutputStream tocSizeStream;
+        dummyToc.writeTOCToStream(tocSizeStream);
+        const UInt64 tocSize = tocSizeStream.getSize();
 
-        // create final TOC with correct resource offsets
+        // create final TOC with correct resource offsets, resources are preceded by padding to align their data blob.
+        // Padding is not referenced by the TOC, so readers are not affected by it
         ResourceTableOfContents toc;
+        std::vector<UInt64> resourcePaddings;
+        resourcePaddings.reserve(resourcesForFile.size());
+        UInt64 fileOffset = static_cast<UInt64>(offsetForTOC) + tocSize;
         UInt32 i = 0;
         for (const auto& res : resourcesForFile)
         {
             const IResource* resourceObject = res.getResourceObject();
-            const UInt32 resourceOffset = resourceOffsetSize[i++];
-            const UInt32 resourceSize = resourceOffsetSize[i++];
-            toc.registerContents(ResourceInfo(resourceObject), static_cast<UInt32>(offsetForTOC) + tocSize + resourceOffset, resourceSize);
+            const UInt64 resourceSize = resourceSizes[i];
+            const UInt64 headerSize = resourceHeaderSizes[i];
+            ++i;
+            const UInt64 dataOffset = GetAlignedResourceDataOffset(fileOffset + headerSize, resourceSize - headerSize);
+            const UInt64 resourceOffset = dataOffset - headerSize;
+            resourcePaddings.push_back(resourceOffset - fileOffset);
+            toc.registerContents(ResourceInfo(resourceObject), resourceOffset, resourceSize);
+            fileOffset = resourceOffset + resourceSize;
         }
 
         // write final toc and resources to output stream
         toc.writeTOCToStream(outStream);
+        const std::vector<Byte> padding(static_cast<size_t>(ResourceDataPageAlignment), 0u);
+        i = 0;
         for (const auto& res : resourcesForFile)
         {
+            const UInt64 paddingSize = resourcePaddings[i++];
+            if (paddingSize > 0u)
+                outStream.write(padding.data(), static_cast<UInt32>(paddingSize));
             WriteOneResourceToStream(outStream, res);
         }
     }
 
     IResource* ResourcePersistation::RetrieveResourceFromStream(BinaryFileInputStream& inStream, const ResourceFileEntry& fileEntry)
     {
-        inStream.seek(fileEntry.offsetInBytes, EFileSeekOrigin_BeginningOfFile);
+        inStream.seek(static_cast<Int>(fileEntry.offsetInBytes), EFileSeekOrigin_BeginningOfFile);
 
         IResource* resource = ReadOneResourceFromStream(inStream, fileEntry.resourceInfo.hash);
 
@@ -104,4 +137,45 @@ namespace ramses_internal
         assert(currentPosAfterRead - fileEntry.offsetInBytes == fileEntry.sizeInBytes);
         return resource;
     }
+
+    IResource* ResourcePersistation::RetrieveResourceFromFile(ResourceFileInputStream& resourceFile, const ResourceFileEntry& fileEntry)
+    {
+        const MemoryMappedFile& mapping = *resourceFile.mappedFile;
+        if (!mapping.isMapped() ||
+            fileEntry.offsetInBytes > mapping.getSize() ||
+            fileEntry.sizeInBytes > mapping.getSize() - fileEntry.offsetInBytes)
+        {
+            return RetrieveResourceFromStream(resourceFile.resourceStream, fileEntry);
+        }
+
+        // read header directly from mapped memory, avoids seek and read calls for every resource
+        BinaryInputStream inStream(mapping.getData() + fileEntry.offsetInBytes);
+        ResourceSerializationHelper::DeserializedResourceHeader header = ResourceSerializationHelper::ResourceFromMetadataStream(inStream);
+        assert(header.resource != nullptr);
+        if (!header.resource)
+            return nullptr;
+
+        // data blob is used in place, the private mapping is copied on write only and the resource keeps the mapping alive
+        const UInt64 dataOffset = static_cast<UInt64>(inStream.readPositionUchar() - mapping.getData());
+        Byte* data = resourceFile.mappedFile->getData() + dataOffset;
+        if (header.compressionStatus == EResourceCompressionStatus_Compressed)
+        {
+            assert(dataOffset + header.compressedSize - fileEntry.offsetInBytes == fileEntry.sizeInBytes);
+            header.resource->setCompressedResourceData(CompressedResouceBlob(header.compressedSize, data, resourceFile.mappedFile), header.decompressedSize, fileEntry.resourceInfo.hash);
+        }
+        else
+        {
+            assert(dataOffset + header.decompressedSize - fileEntry.offsetInBytes == fileEntry.sizeInBytes);
+            // files written before data blobs were aligned may contain unaligned data, which is copied then
+            if (dataOffset % ResourceDataMinimumAlignment == 0u)
+            {
+                header.resource->setResourceData(ResourceBlob(header.decompressedSize, data, resourceFile.mappedFile), fileEntry.resourceInfo.hash);
+            }
+            else
+            {
+                header.resource->setResourceData(ResourceBlob(header.decompressedSize, data), fileEntry.resourceInfo.hash);
+            }
+        }
+        return header.resource;
+    }
 }
@@ -21,7 +21,7 @@ namespace ramses_internal
         return m_fileContents.contains(hash);
     }
 
-    void ResourceTableOfContents::registerContents(const ResourceInfo& resourceInfo, UInt32 offsetInBytes, UInt32 sizeInBytes)
+    void ResourceTableOfContents::registerContents(const ResourceInfo& resourceInfo, UInt64 offsetInBytes, UInt64 sizeInBytes)
     {
         ResourceFileEntry fileEntry;
         fileEntry.offsetInBytes = offsetInBytes;
@@ -38,6 +38,8 @@ namespace ramses_internal
     void ResourceTableOfContents::writeTOCToStream(IOutputStream& outstream)
     {
         const uint32_t numberOfEntries = static_cast<uint32_t>(m_fileContents.size());
+        outstream << FormatMarker;
+        outstream << FormatVersion;
         outstream << numberOfEntries;
 
         // sort resources to get deterministic file
@@ -71,8 +73,27 @@ namespace ramses_internal
 
     bool ResourceTableOfContents::readTOCPosAndTOCFromStream(BinaryFileInputStream& instream)
     {
+        uint32_t markerOrNumberOfEntries = 0;
+        instream >> markerOrNumberOfEntries;
+        if (markerOrNumberOfEntries != FormatMarker)
+            return readEntriesFromStream<uint32_t>(instream, markerOrNumberOfEntries);
+
+        uint32_t version = 0;
+        instream >> version;
+        if (version != FormatVersion)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ResourceTableOfContents::readTOCPosAndTOCFromStream: Unsupported table of contents version " << version << ", expected " << FormatVersion);
+            return false;
+        }
+
         uint32_t numberOfEntries = 0;
         instream >> numberOfEntries;
+        return readEntriesFromStream<uint64_t>(instream, numberOfEntries);
+    }
+
+    template <typename OffsetType>
+    bool ResourceTableOfContents::readEntriesFromStream(BinaryFileInputStream& instream, uint32_t numberOfEntries)
+    {
         std::array<uint32_t, EResourceType_NUMBER_OF_ELEMENTS> objectCounts = {};
 
         for (uint32_t i = 0; i < numberOfEntries; ++i)
@@ -84,10 +105,13 @@ namespace ramses_internal
             instream >> info.hash;
             instream >> info.decompressedSize;
             instream >> info.compressedSize;
-            UInt32 offsetInBytes = 0;
+            OffsetType offsetInBytes = 0;
             instream >> offsetInBytes;
-            UInt32 sizeInBytes = 0;
+            OffsetType sizeInBytes = 0;
             instream >> sizeInBytes;
+            if (instream.getState() != EStatus_RAMSES_OK || info.type >= EResourceType_NUMBER_OF_ELEMENTS)
+                return false;
+
             registerContents(info, offsetInBytes, sizeInBytes);
             ++objectCounts[info.type];
 
@@ -98,8 +98,10 @@ namespace ramses_internal
     {
         UNUSED(mode);
 
-        // send to network (no ownership transfer)
+        // send to network (no ownership transfer), actions are sent to all remote subscribers at once
         bool sendToSelf = false;
+        ICommunicationSystem::SceneActionListReceivers receivers;
+        receivers.reserve(toVec.size());
         for (const auto& to : toVec)
         {
             if (m_myID == to)
@@ -111,7 +113,19 @@ namespace ramses_internal
                 assert(mode != EScenePublicationMode_LocalOnly);
                 const uint64_t currentCounter = m_subscriptions[Subscription(to, sceneId)];
                 assert(currentCounter != 0);
-                const uint64_t numberOfChunksSent = m_communicationSystem.sendSceneActionList(to, sceneId, sceneAction, currentCounter);
+                receivers.push_back({ to, currentCounter });
+            }
+        }
+
+        if (!receivers.empty())
+        {
+            const std::vector<uint64_t> numberOfChunksSentToReceivers = m_communicationSystem.multicastSceneActionList(receivers, sceneId, sceneAction);
+            assert(numberOfChunksSentToReceivers.size() == receivers.size());
+            for (size_t i = 0u; i < receivers.size(); ++i)
+            {
+                const Guid& to = receivers[i].first;
+                const uint64_t currentCounter = receivers[i].second;
+                const uint64_t numberOfChunksSent = numberOfChunksSentToReceivers[i];
                 if (numberOfChunksSent > 0)
                 {
                     LOG_DEBUG(CONTEXT_FRAMEWORK, "SceneGraphComponent::sendSceneActionList: to " << to << ", counter for sceneid " << sceneId << " started at " << currentCounter << " sent " << numberOfChunksSent << " chunks");
@@ -1398,6 +1398,51 @@ TYPED_TEST(AClientSceneLogic_All, doesSendSceneToSubscriberAfterFlush)
     this->unpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, sendsAllRepeatedSetterActionsByDefault)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    this->m_scene.allocateNode(0, NodeHandle(0u));
+    this->m_scene.allocateTransform(NodeHandle(0u), TransformHandle(0u));
+    this->m_scene.setTranslation(TransformHandle(0u), Vector3(1.f));
+    this->m_scene.setTranslation(TransformHandle(0u), Vector3(2.f));
+
+    SceneActionCollection expectedActions(this->m_scene.getSceneActionCollection().copy());
+    SceneActionCollectionCreator creator(expectedActions);
+    creator.flush(2u, true, this->m_scene.getSceneSizeInformation());
+
+    this->expectSendOnActionList(expectedActions);
+    this->flush();
+
+    this->expectSceneUnpublish();
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsOnlyLastWriteOfRepeatedSetterActionsIfCollapsingEnabled)
+{
+    this->m_scene.setCollapseRedundantSetters(true);
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    this->m_scene.allocateNode(0, NodeHandle(0u));
+    this->m_scene.allocateTransform(NodeHandle(0u), TransformHandle(0u));
+    this->m_scene.setTranslation(TransformHandle(0u), Vector3(1.f));
+    this->m_scene.setRotation(TransformHandle(0u), Vector3(1.f));
+    this->m_scene.setTranslation(TransformHandle(0u), Vector3(2.f));
+    this->m_scene.setTranslation(TransformHandle(0u), Vector3(3.f));
+
+    SceneActionCollection expectedActions;
+    SceneActionCollectionCreator creator(expectedActions);
+    creator.allocateNode(0, NodeHandle(0u));
+    creator.allocateTransform(NodeHandle(0u), TransformHandle(0u));
+    creator.setTransformComponent(ETransformPropertyType_Rotation, TransformHandle(0u), Vector3(1.f));
+    creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(0u), Vector3(3.f));
+    creator.flush(2u, true, this->m_scene.getSceneSizeInformation());
+
+    this->expectSendOnActionList(expectedActions);
+    this->flush();
+
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_ShadowCopy, doesSendSceneAfterFlushToLateSubscribers)
 {
     this->publish();
@@ -17,6 +17,7 @@
 #include "Utils/BinaryFileInputStream.h"
 #include "ResourceMock.h"
 #include "Components/ResourceTableOfContents.h"
+#include "Components/ResourceFileInputStream.h"
 
 using namespace testing;
 
@@ -290,4 +291,93 @@ namespace ramses_internal
         EXPECT_EQ(String("Some effect with a name"), loadedResource->getName());
         delete loadedResource;
     }
+
+    TEST(ResourcePersistation, retrievesResourcesFromMemoryMappedResourceFile)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        float dataA[9];
+        for (uint32_t i = 0u; i < 9; ++i)
+        {
+            dataA[i] = static_cast<Float>(i);
+        }
+        ArrayResource res(EResourceType_VertexArray, 3, EDataType_Vector3F, reinterpret_cast<const Byte*>(dataA), ResourceCacheFlag(15u), "res1");
+        ManagedResource managedRes(res, dummyManagedResourceCallback);
+        EffectResource res2("foo", "bar", EffectInputInformationVector(), EffectInputInformationVector(), "effect", ResourceCacheFlag(16u));
+        ManagedResource managedRes2(res2, dummyManagedResourceCallback);
+
+        const String filename("mappedResourceFile");
+        {
+            File tempFile(filename);
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, { managedRes, managedRes2 }, false);
+        }
+
+        ResourceFileInputStream resourceFile(filename);
+        ASSERT_TRUE(resourceFile.mappedFile->isMapped());
+        ResourceTableOfContents loadedTOC;
+        ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(resourceFile.resourceStream));
+
+        std::unique_ptr<IResource> loadedResource(ResourcePersistation::RetrieveResourceFromFile(resourceFile, loadedTOC.getEntryForHash(res.getHash())));
+        ASSERT_TRUE(loadedResource);
+        EXPECT_EQ(0, PlatformMemory::Compare(dataA, loadedResource->getResourceData().data(), sizeof(dataA)));
+        EXPECT_EQ(String("res1"), loadedResource->getName());
+
+        loadedResource.reset(ResourcePersistation::RetrieveResourceFromFile(resourceFile, loadedTOC.getEntryForHash(res2.getHash())));
+        ASSERT_TRUE(loadedResource);
+        EXPECT_STREQ(res2.getVertexShader(), loadedResource->convertTo<EffectResource>()->getVertexShader());
+        EXPECT_EQ(String("effect"), loadedResource->getName());
+    }
+
+    TEST(ResourcePersistation, usesAlignedResourceDataInPlaceFromMemoryMappedResourceFile)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        std::vector<Float> dataA(3u * 1000u);
+        for (UInt32 i = 0u; i < dataA.size(); ++i)
+        {
+            dataA[i] = static_cast<Float>(i);
+        }
+        const Float dataB[3] = { 1.f, 2.f, 3.f };
+        ArrayResource res(EResourceType_VertexArray, 1000u, EDataType_Vector3F, reinterpret_cast<const Byte*>(dataA.data()), ResourceCacheFlag(0u), "large");
+        ArrayResource res2(EResourceType_VertexArray, 1u, EDataType_Vector3F, reinterpret_cast<const Byte*>(dataB), ResourceCacheFlag(0u), "small");
+        ManagedResource managedRes(res, dummyManagedResourceCallback);
+        ManagedResource managedRes2(res2, dummyManagedResourceCallback);
+
+        const String filename("alignedResourceFile");
+        {
+            File tempFile(filename);
+            BinaryFileOutputStream out(tempFile);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, { managedRes2, managedRes }, false);
+        }
+
+        std::unique_ptr<IResource> loadedResource;
+        std::unique_ptr<IResource> loadedResource2;
+        {
+            ResourceFileInputStream resourceFile(filename);
+            ASSERT_TRUE(resourceFile.mappedFile->isMapped());
+            ResourceTableOfContents loadedTOC;
+            ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(resourceFile.resourceStream));
+
+            loadedResource.reset(ResourcePersistation::RetrieveResourceFromFile(resourceFile, loadedTOC.getEntryForHash(res.getHash())));
+            loadedResource2.reset(ResourcePersistation::RetrieveResourceFromFile(resourceFile, loadedTOC.getEntryForHash(res2.getHash())));
+            ASSERT_TRUE(loadedResource);
+            ASSERT_TRUE(loadedResource2);
+
+            const Byte* mappingStart = resourceFile.mappedFile->getData();
+            const Byte* mappingEnd = mappingStart + resourceFile.mappedFile->getSize();
+            const Byte* data = loadedResource->getResourceData().data();
+            const Byte* data2 = loadedResource2->getResourceData().data();
+            EXPECT_TRUE(data >= mappingStart && data < mappingEnd);
+            EXPECT_TRUE(data2 >= mappingStart && data2 < mappingEnd);
+            EXPECT_EQ(0u, (data - mappingStart) % 4096u);
+            EXPECT_EQ(0u, (data2 - mappingStart) % 16u);
+        }
+
+        // resources keep mapping alive after file stream is gone
+        EXPECT_EQ(0, PlatformMemory::Compare(dataA.data(), loadedResource->getResourceData().data(), dataA.size() * sizeof(Float)));
+        EXPECT_EQ(0, PlatformMemory::Compare(dataB, loadedResource2->getResourceData().data(), sizeof(dataB)));
+    }
 }
@@ -44,7 +44,7 @@ namespace ramses_internal
         template<typename IRESOURCE>
         const IRESOURCE* sendAndReceiveResource(IRESOURCE& resource)
         {
-            uint32_t sizeResourcesSent = m_receiverTestWrapper->statisticCollection.statResourcesSentSize.getCounterValue();
+            uint64_t sizeResourcesSent = m_receiverTestWrapper->statisticCollection.statResourcesSentSize.getCounterValue();
 
             ManagedResource managedRes(resource, deleterMock);
             ResourceInfo resInfo(&resource);
@@ -95,4 +95,73 @@ namespace ramses_internal
         ASSERT_FALSE(returnValue);
     }
 
+    TEST(AResourceTableOfContents, canWriteAndReadOffsetsAndSizesBeyond4GB)
+    {
+        File tempFile("onDemandResourceFile");
+
+        ResourceTableOfContents toc;
+        ResourceContentHash hash(4711u, 0);
+        ResourceInfo resourceInfo(EResourceType_Texture2D, hash, 22u, 11u);
+        const UInt64 offsetInBytes = 0x1234567890ull;
+        const UInt64 sizeInBytes = 0x100000002ull;
+        toc.registerContents(resourceInfo, offsetInBytes, sizeInBytes);
+
+        {
+            BinaryFileOutputStream outstream(tempFile);
+            toc.writeTOCToStream(outstream);
+        }
+
+        BinaryFileInputStream instream(tempFile);
+        ResourceTableOfContents loadedTOC;
+        ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+        ASSERT_TRUE(loadedTOC.containsResource(hash));
+
+        const ResourceFileEntry loadedEntry = loadedTOC.getEntryForHash(hash);
+        EXPECT_EQ(resourceInfo, loadedEntry.resourceInfo);
+        EXPECT_EQ(offsetInBytes, loadedEntry.offsetInBytes);
+        EXPECT_EQ(sizeInBytes, loadedEntry.sizeInBytes);
+    }
+
+    TEST(AResourceTableOfContents, canReadLegacyTableOfContentsWith32BitOffsets)
+    {
+        File tempFile("legacyResourceFile");
+
+        ResourceContentHash hash(4711u, 0);
+        ResourceInfo resourceInfo(EResourceType_IndexArray, hash, 22u, 11u);
+        {
+            BinaryFileOutputStream outstream(tempFile);
+            outstream << static_cast<UInt32>(1u);
+            outstream << static_cast<UInt32>(resourceInfo.type);
+            outstream << resourceInfo.hash;
+            outstream << resourceInfo.decompressedSize;
+            outstream << resourceInfo.compressedSize;
+            outstream << static_cast<UInt32>(123u);
+            outstream << static_cast<UInt32>(456u);
+        }
+
+        BinaryFileInputStream instream(tempFile);
+        ResourceTableOfContents loadedTOC;
+        ASSERT_TRUE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+        ASSERT_TRUE(loadedTOC.containsResource(hash));
+
+        const ResourceFileEntry loadedEntry = loadedTOC.getEntryForHash(hash);
+        EXPECT_EQ(resourceInfo, loadedEntry.resourceInfo);
+        EXPECT_EQ(123u, loadedEntry.offsetInBytes);
+        EXPECT_EQ(456u, loadedEntry.sizeInBytes);
+    }
+
+    TEST(AResourceTableOfContents, failsReadingTableOfContentsWithUnknownVersion)
+    {
+        File tempFile("futureResourceFile");
+        {
+            BinaryFileOutputStream outstream(tempFile);
+            outstream << static_cast<UInt32>(ResourceTableOfContents::FormatMarker);
+            outstream << static_cast<UInt32>(ResourceTableOfContents::FormatVersion + 1u);
+            outstream << static_cast<UInt32>(0u);
+        }
+
+        BinaryFileInputStream instream(tempFile);
+        ResourceTableOfContents loadedTOC;
+        EXPECT_FALSE(loadedTOC.readTOCPosAndTOCFromStream(instream));
+    }
 }
@@ -268,6 +268,44 @@ namespace ramses_internal
         ASSERT_TRUE(waitForEvent());
     }
 
+    TEST_P(ASceneGraphProtocolSenderAndReceiverTest, multicastSceneActionListSendsAllChunksWithCounterOfReceiver)
+    {
+        const CommunicationSendDataSizes sendDataSizes = sender.getSendDataSizes();
+        const UInt32 expectedNumberOfMessages = sendDataSizes.sceneActionNumber == std::numeric_limits<UInt32>::max() ? 1u : 2u;
+        const UInt32 numberOfSceneActions     = sendDataSizes.sceneActionNumber == std::numeric_limits<UInt32>::max() ? 5u : sendDataSizes.sceneActionNumber + 1u;
+        const SceneId sceneId(1ull << 63);
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        for (UInt32 i = 0u; i < numberOfSceneActions; ++i)
+        {
+            creator.allocateNode(0u, NodeHandle(123u + i));
+        }
+
+        SceneActionCollection receivedActions;
+        std::vector<uint64_t> receivedCounters;
+        {
+            PlatformGuard g(receiverExpectCallLock);
+            EXPECT_CALL(consumerHandler, handleSceneActionList_rvr(sceneId, _, _, senderId))
+                .Times(expectedNumberOfMessages)
+                .WillRepeatedly(Invoke([&](auto, const auto& recvActions, auto counter, auto) {
+                                           receivedActions.append(recvActions);
+                                           receivedCounters.push_back(counter);
+                                           sendEvent();
+                                       }));
+        }
+        const std::vector<uint64_t> numberOfChunksSent = sender.multicastSceneActionList({ { receiverId, 7u } }, sceneId, actions);
+        EXPECT_EQ(std::vector<uint64_t>{ expectedNumberOfMessages }, numberOfChunksSent);
+        ASSERT_TRUE(waitForEvent(expectedNumberOfMessages));
+
+        EXPECT_EQ(actions, receivedActions);
+        ASSERT_EQ(expectedNumberOfMessages, receivedCounters.size());
+        for (UInt32 i = 0u; i < expectedNumberOfMessages; ++i)
+        {
+            EXPECT_EQ(7u + i, receivedCounters[i]);
+        }
+    }
+
     TEST_P(ASceneGraphProtocolSenderAndReceiverTest, sendRendererEvent)
     {
         SceneId sceneId{432};
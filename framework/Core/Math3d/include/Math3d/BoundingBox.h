@@ -0,0 +1,44 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BOUNDINGBOX_H
+#define RAMSES_BOUNDINGBOX_H
+
+#include "Math3d/Vector3.h"
+
+namespace ramses_internal
+{
+    class Matrix44f;
+
+    // Axis aligned box, default constructed box is empty (min > max) and contains nothing
+    class BoundingBox
+    {
+    public:
+        BoundingBox();
+        BoundingBox(const Vector3& _min, const Vector3& _max);
+
+        bool operator==(const BoundingBox& other) const;
+        bool operator!=(const BoundingBox& other) const;
+
+        bool isEmpty() const;
+        void extend(const Vector3& point);
+        void extend(const BoundingBox& other);
+
+        // box enclosing this box after transforming it with given matrix
+        BoundingBox transformed(const Matrix44f& matrix) const;
+
+        // true if box is guaranteed to be fully outside of the clip volume of given (model-view-projection) matrix,
+        // conservative test - box can still be reported as not outside even if it is not visible
+        bool isOutsideOfClipVolume(const Matrix44f& modelViewProjection) const;
+
+        Vector3 min;
+        Vector3 max;
+    };
+}
+
+#endif
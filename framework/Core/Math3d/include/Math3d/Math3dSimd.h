@@ -0,0 +1,24 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_MATH3D_MATH3DSIMD_H
+#define RAMSES_MATH3D_MATH3DSIMD_H
+
+// Selects instruction set used by Math3d types at compile time, scalar code is used if none is available.
+// Defining RAMSES_MATH3D_DISABLE_SIMD forces scalar code.
+#if !defined(RAMSES_MATH3D_DISABLE_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAMSES_MATH3D_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define RAMSES_MATH3D_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#endif
@@ -13,6 +13,7 @@
 #include "Math3d/Matrix33f.h"
 #include "Math3d/Vector4.h"
 #include "Math3d/Vector3.h"
+#include "Math3d/Math3dSimd.h"
 #include "Collections/IOutputStream.h"
 #include "Collections/IInputStream.h"
 #include "PlatformAbstraction/FmtBase.h"
@@ -63,6 +64,8 @@ namespace ramses_internal
         static constexpr Matrix44f Scaling(const Vector3& scaling);
         static constexpr Matrix44f Scaling(const Float x, const Float y, const Float z);
         static constexpr Matrix44f Scaling(const Float uniScale);
+        /// Equivalent to Translation(translation) * Scaling(scaling) * RotationEulerZYX(rotationXYZ)
+        static Matrix44f TranslationScalingRotationEulerZYX(const Vector3& translation, const Vector3& scaling, const Vector3& rotationXYZ);
 
         constexpr Matrix44f();
         /**
@@ -124,13 +127,13 @@ namespace ramses_internal
          * @param mat Matrix44 to multiply with the matrix
          * @return the resulting Matrix44
          */
-        constexpr Matrix44f operator*(const Matrix44f& mat) const;
+        Matrix44f operator*(const Matrix44f& mat) const;
 
         /**
          * Multiplies the matrix with another matrix and assigns the result
          * @param mat Matrix44 to multiply with the matrix
          */
-        constexpr void operator*=(const Matrix44f& mat);
+        void operator*=(const Matrix44f& mat);
 
         /**
          * Check if two matrices are equal
@@ -164,7 +167,7 @@ namespace ramses_internal
          * Transposes and returns a matrix
          * @return A transposed version of the current Matrix
          */
-        constexpr Matrix44f transpose() const;
+        Matrix44f transpose() const;
 
         /**
          * Computes the determinant of the matrix
@@ -176,7 +179,7 @@ namespace ramses_internal
          * Computes the inverse matrix and returns it as result
          * @ return the inverse matrix
          */
-        constexpr Matrix44f inverse() const;
+        Matrix44f inverse() const;
 
         /**
          * Rotates the given point with the rotation information from upper 3x3 matrix
@@ -314,37 +317,112 @@ namespace ramses_internal
     Vector4
     Matrix44f::operator*(const Vector4& vec) const
     {
+#if defined(RAMSES_MATH3D_SSE)
+        __m128 result = _mm_mul_ps(_mm_loadu_ps(data), _mm_set1_ps(vec.x));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(data + 4), _mm_set1_ps(vec.y)));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(data + 8), _mm_set1_ps(vec.z)));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_loadu_ps(data + 12), _mm_set1_ps(vec.w)));
+        Vector4 resultVec;
+        _mm_storeu_ps(resultVec.data, result);
+        return resultVec;
+#elif defined(RAMSES_MATH3D_NEON)
+        float32x4_t result = vmulq_n_f32(vld1q_f32(data), vec.x);
+        result = vaddq_f32(result, vmulq_n_f32(vld1q_f32(data + 4), vec.y));
+        result = vaddq_f32(result, vmulq_n_f32(vld1q_f32(data + 8), vec.z));
+        result = vaddq_f32(result, vmulq_n_f32(vld1q_f32(data + 12), vec.w));
+        Vector4 resultVec;
+        vst1q_f32(resultVec.data, result);
+        return resultVec;
+#else
         return Vector4(   m11 * vec.x + m12 * vec.y + m13 * vec.z + m14 * vec.w
                         , m21 * vec.x + m22 * vec.y + m23 * vec.z + m24 * vec.w
                         , m31 * vec.x + m32 * vec.y + m33 * vec.z + m34 * vec.w
                         , m41 * vec.x + m42 * vec.y + m43 * vec.z + m44 * vec.w);
+#endif
     }
 
-    constexpr inline
+    inline
     Matrix44f
     Matrix44f::operator*(const Matrix44f& mat) const
     {
+        // every column of result is a combination of columns of this matrix weighted by the column of other matrix,
+        // elements are summed up in the same order as in the scalar code
+#if defined(RAMSES_MATH3D_SSE)
+        const __m128 col1 = _mm_loadu_ps(data);
+        const __m128 col2 = _mm_loadu_ps(data + 4);
+        const __m128 col3 = _mm_loadu_ps(data + 8);
+        const __m128 col4 = _mm_loadu_ps(data + 12);
+        Matrix44f result;
+        for (UInt32 i = 0u; i < 16u; i += 4u)
+        {
+            __m128 resultCol = _mm_mul_ps(col1, _mm_set1_ps(mat.data[i]));
+            resultCol = _mm_add_ps(resultCol, _mm_mul_ps(col2, _mm_set1_ps(mat.data[i + 1])));
+            resultCol = _mm_add_ps(resultCol, _mm_mul_ps(col3, _mm_set1_ps(mat.data[i + 2])));
+            resultCol = _mm_add_ps(resultCol, _mm_mul_ps(col4, _mm_set1_ps(mat.data[i + 3])));
+            _mm_storeu_ps(result.data + i, resultCol);
+        }
+        return result;
+#elif defined(RAMSES_MATH3D_NEON)
+        const float32x4_t col1 = vld1q_f32(data);
+        const float32x4_t col2 = vld1q_f32(data + 4);
+        const float32x4_t col3 = vld1q_f32(data + 8);
+        const float32x4_t col4 = vld1q_f32(data + 12);
+        Matrix44f result;
+        for (UInt32 i = 0u; i < 16u; i += 4u)
+        {
+            float32x4_t resultCol = vmulq_n_f32(col1, mat.data[i]);
+            resultCol = vaddq_f32(resultCol, vmulq_n_f32(col2, mat.data[i + 1]));
+            resultCol = vaddq_f32(resultCol, vmulq_n_f32(col3, mat.data[i + 2]));
+            resultCol = vaddq_f32(resultCol, vmulq_n_f32(col4, mat.data[i + 3]));
+            vst1q_f32(result.data + i, resultCol);
+        }
+        return result;
+#else
         return Matrix44f(  m11 * mat.m11 + m12 * mat.m21 + m13 * mat.m31 + m14 * mat.m41, m11 * mat.m12 + m12 * mat.m22 + m13 * mat.m32 + m14 * mat.m42, m11 * mat.m13 + m12 * mat.m23 + m13 * mat.m33 + m14 * mat.m43, m11 * mat.m14 + m12 * mat.m24 + m13 * mat.m34 + m14 * mat.m44
                         , m21 * mat.m11 + m22 * mat.m21 + m23 * mat.m31 + m24 * mat.m41, m21 * mat.m12 + m22 * mat.m22 + m23 * mat.m32 + m24 * mat.m42, m21 * mat.m13 + m22 * mat.m23 + m23 * mat.m33 + m24 * mat.m43, m21 * mat.m14 + m22 * mat.m24 + m23 * mat.m34 + m24 * mat.m44
                         , m31 * mat.m11 + m32 * mat.m21 + m33 * mat.m31 + m34 * mat.m41, m31 * mat.m12 + m32 * mat.m22 + m33 * mat.m32 + m34 * mat.m42, m31 * mat.m13 + m32 * mat.m23 + m33 * mat.m33 + m34 * mat.m43, m31 * mat.m14 + m32 * mat.m24 + m33 * mat.m34 + m34 * mat.m44
                         , m41 * mat.m11 + m42 * mat.m21 + m43 * mat.m31 + m44 * mat.m41, m41 * mat.m12 + m42 * mat.m22 + m43 * mat.m32 + m44 * mat.m42, m41 * mat.m13 + m42 * mat.m23 + m43 * mat.m33 + m44 * mat.m43, m41 * mat.m14 + m42 * mat.m24 + m43 * mat.m34 + m44 * mat.m44);
+#endif
     }
 
-    constexpr inline
+    inline
     void
     Matrix44f::operator*=(const Matrix44f& mat)
     {
         *this = operator*(mat);
     }
 
-    constexpr inline
+    inline
     Matrix44f
     Matrix44f::transpose() const
     {
+#if defined(RAMSES_MATH3D_SSE)
+        __m128 col1 = _mm_loadu_ps(data);
+        __m128 col2 = _mm_loadu_ps(data + 4);
+        __m128 col3 = _mm_loadu_ps(data + 8);
+        __m128 col4 = _mm_loadu_ps(data + 12);
+        _MM_TRANSPOSE4_PS(col1, col2, col3, col4);
+        Matrix44f result;
+        _mm_storeu_ps(result.data, col1);
+        _mm_storeu_ps(result.data + 4, col2);
+        _mm_storeu_ps(result.data + 8, col3);
+        _mm_storeu_ps(result.data + 12, col4);
+        return result;
+#elif defined(RAMSES_MATH3D_NEON)
+        // de-interleaving load gives rows of the matrix
+        const float32x4x4_t rows = vld4q_f32(data);
+        Matrix44f result;
+        vst1q_f32(result.data, rows.val[0]);
+        vst1q_f32(result.data + 4, rows.val[1]);
+        vst1q_f32(result.data + 8, rows.val[2]);
+        vst1q_f32(result.data + 12, rows.val[3]);
+        return result;
+#else
         return Matrix44f(  m11, m21, m31, m41
                         , m12, m22, m32, m42
                         , m13, m23, m33, m43
                         , m14, m24, m34, m44);
+#endif
     }
 
     constexpr inline
@@ -358,7 +436,7 @@ namespace ramses_internal
         const Float m11m23 = m11 * m23;
         const Float m11m24 = m11 * m24;
         const Float m12m21 = m12 * m21;
-        const Float m14m21 = m12 * m21;
+        const Float m14m21 = m14 * m21;
         const Float m12m23 = m12 * m23;
         const Float m14m22 = m14 * m22;
         const Float m12m24 = m12 * m24;
@@ -386,37 +464,6 @@ namespace ramses_internal
                 - m14m21 * m32m43 - m14m22 * m33m41 - m14m23 * m31m42;
     }
 
-    constexpr inline
-    Matrix44f
-    Matrix44f::inverse() const
-    {
-        const Float det = determinant();
-
-        if (det == 0.0f)
-        {
-            return Matrix44f::Empty;
-        }
-
-        const Float invDet = 1.0f / det;
-
-        return Matrix44f( ( m22 * m44 * m33 - m22 * m43 * m34 - m44 * m32 * m23 + m43 * m32 * m24 - m42 * m24 * m33 + m42 * m23 * m34) * invDet,
-                        -( m43 * m32 * m14 - m43 * m34 * m12 + m42 * m13 * m34 - m42 * m14 * m33 - m44 * m32 * m13 + m44 * m33 * m12) * invDet,
-                        (-m22 * m44 * m13 + m22 * m43 * m14 - m43 * m12 * m24 + m42 * m24 * m13 + m44 * m12 * m23 - m42 * m23 * m14) * invDet,
-                        -( m13 * m32 * m24 + m12 * m23 * m34 + m22 * m14 * m33 - m12 * m24 * m33 - m22 * m13 * m34 - m14 * m32 * m23) * invDet,
-                        -( m21 * m44 * m33 - m21 * m43 * m34 + m41 * m23 * m34 - m44 * m31 * m23 - m41 * m24 * m33 + m24 * m43 * m31) * invDet,
-                        ( m11 * m44 * m33 - m11 * m43 * m34 - m44 * m31 * m13 + m41 * m13 * m34 - m41 * m14 * m33 + m43 * m31 * m14) * invDet,
-                        (-m11 * m44 * m23 + m11 * m43 * m24 - m21 * m14 * m43 + m44 * m21 * m13 + m41 * m14 * m23 - m41 * m13 * m24) * invDet,
-                        ( m11 * m23 * m34 - m11 * m24 * m33 + m21 * m14 * m33 - m23 * m31 * m14 - m21 * m13 * m34 + m24 * m31 * m13) * invDet,
-                        -( m31 * m22 * m44 - m42 * m24 * m31 - m41 * m34 * m22 - m44 * m32 * m21 + m41 * m32 * m24 + m42 * m21 * m34) * invDet,
-                        (-m42 * m31 * m14 + m31 * m44 * m12 + m14 * m41 * m32 - m12 * m41 * m34 + m11 * m42 * m34 - m32 * m11 * m44) * invDet,
-                        -( m22 * m41 * m14 - m11 * m22 * m44 - m42 * m21 * m14 + m44 * m21 * m12 - m41 * m12 * m24 + m11 * m42 * m24) * invDet,
-                        (-m34 * m11 * m22 + m34 * m21 * m12 + m31 * m14 * m22 + m32 * m11 * m24 - m32 * m21 * m14 - m31 * m12 * m24) * invDet,
-                        (-m22 * m41 * m33 + m22 * m43 * m31 + m41 * m32 * m23 - m43 * m32 * m21 + m42 * m21 * m33 - m42 * m23 * m31) * invDet,
-                        -( m11 * m42 * m33 - m11 * m43 * m32 - m42 * m31 * m13 + m41 * m13 * m32 - m41 * m12 * m33 + m43 * m31 * m12) * invDet,
-                        -( m43 * m11 * m22 - m43 * m21 * m12 - m41 * m13 * m22 - m42 * m11 * m23 + m42 * m21 * m13 + m41 * m12 * m23) * invDet,
-                        -(-m33 * m11 * m22 + m33 * m21 * m12 + m31 * m13 * m22 + m32 * m11 * m23 - m32 * m21 * m13 - m31 * m12 * m23) * invDet);
-    }
-
     constexpr inline
     Bool
     Matrix44f::operator==(const Matrix44f& other) const
@@ -531,6 +578,18 @@ namespace ramses_internal
         return Scaling(Vector3(uniScale, uniScale, uniScale));
     }
 
+    inline
+    Matrix44f Matrix44f::TranslationScalingRotationEulerZYX(const Vector3& translation, const Vector3& scaling, const Vector3& rotationXYZ)
+    {
+        // rows of rotation are scaled, translation is put to last column directly instead of multiplying the matrices
+        const Matrix33f rotation = Matrix33f::RotationEulerZYX(rotationXYZ);
+        return Matrix44f(
+            scaling.x * rotation.m11, scaling.x * rotation.m12, scaling.x * rotation.m13, translation.x,
+            scaling.y * rotation.m21, scaling.y * rotation.m22, scaling.y * rotation.m23, translation.y,
+            scaling.z * rotation.m31, scaling.z * rotation.m32, scaling.z * rotation.m33, translation.z,
+            0.0f, 0.0f, 0.0f, 1.0f);
+    }
+
     inline
     Vector3 Matrix44f::rotate(const Vector3& point) const
     {
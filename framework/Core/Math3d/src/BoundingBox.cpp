@@ -0,0 +1,111 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Math3d/BoundingBox.h"
+#include "Math3d/Matrix44f.h"
+#include "Math3d/Vector4.h"
+#include <algorithm>
+#include <array>
+
+namespace ramses_internal
+{
+    BoundingBox::BoundingBox()
+        : min(std::numeric_limits<Float>::max())
+        , max(std::numeric_limits<Float>::lowest())
+    {
+    }
+
+    BoundingBox::BoundingBox(const Vector3& _min, const Vector3& _max)
+        : min(_min)
+        , max(_max)
+    {
+    }
+
+    bool BoundingBox::operator==(const BoundingBox& other) const
+    {
+        return min == other.min && max == other.max;
+    }
+
+    bool BoundingBox::operator!=(const BoundingBox& other) const
+    {
+        return !(*this == other);
+    }
+
+    bool BoundingBox::isEmpty() const
+    {
+        return min.x > max.x || min.y > max.y || min.z > max.z;
+    }
+
+    void BoundingBox::extend(const Vector3& point)
+    {
+        min.set(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+        max.set(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+    }
+
+    void BoundingBox::extend(const BoundingBox& other)
+    {
+        if (other.isEmpty())
+            return;
+
+        extend(other.min);
+        extend(other.max);
+    }
+
+    BoundingBox BoundingBox::transformed(const Matrix44f& matrix) const
+    {
+        if (isEmpty())
+            return {};
+
+        // Arvo's method - transform extents per axis instead of transforming all 8 corners
+        const Vector3 translation(matrix.m14, matrix.m24, matrix.m34);
+        BoundingBox result(translation, translation);
+        for (UInt32 row = 0u; row < 3u; ++row)
+        {
+            for (UInt32 col = 0u; col < 3u; ++col)
+            {
+                const Float element = matrix.data[col * 4u + row];
+                const Float a = element * min[col];
+                const Float b = element * max[col];
+                result.min[row] += std::min(a, b);
+                result.max[row] += std::max(a, b);
+            }
+        }
+
+        return result;
+    }
+
+    bool BoundingBox::isOutsideOfClipVolume(const Matrix44f& modelViewProjection) const
+    {
+        if (isEmpty())
+            return false;
+
+        const std::array<Vector4, 8u> corners = { {
+            modelViewProjection * Vector4(min.x, min.y, min.z, 1.f),
+            modelViewProjection * Vector4(max.x, min.y, min.z, 1.f),
+            modelViewProjection * Vector4(min.x, max.y, min.z, 1.f),
+            modelViewProjection * Vector4(max.x, max.y, min.z, 1.f),
+            modelViewProjection * Vector4(min.x, min.y, max.z, 1.f),
+            modelViewProjection * Vector4(max.x, min.y, max.z, 1.f),
+            modelViewProjection * Vector4(min.x, max.y, max.z, 1.f),
+            modelViewProjection * Vector4(max.x, max.y, max.z, 1.f)
+        } };
+
+        // box is outside if all its corners are on the outer side of any of the 6 clip planes
+        const auto allOutside = [&corners](auto isOutside)
+        {
+            return std::all_of(corners.cbegin(), corners.cend(), isOutside);
+        };
+
+        return allOutside([](const Vector4& c) { return c.x < -c.w; })
+            || allOutside([](const Vector4& c) { return c.x >  c.w; })
+            || allOutside([](const Vector4& c) { return c.y < -c.w; })
+            || allOutside([](const Vector4& c) { return c.y >  c.w; })
+            || allOutside([](const Vector4& c) { return c.z < -c.w; })
+            || allOutside([](const Vector4& c) { return c.z >  c.w; });
+    }
+}
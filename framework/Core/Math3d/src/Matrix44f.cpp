@@ -19,4 +19,119 @@ namespace ramses_internal
                                     0.f, 0.f, 0.f, 0.f,
                                     0.f, 0.f, 0.f, 0.f,
                                     0.f, 0.f, 0.f, 0.f);
+
+    Matrix44f Matrix44f::inverse() const
+    {
+#if defined(RAMSES_MATH3D_SSE)
+        // cofactors computed using Cramer's rule on 2x2 sub-determinants, layout as in Intel AP-928,
+        // inverse of transposed matrix is transposed inverse so result is stored in the same layout as input
+        __m128 row0 = _mm_loadu_ps(data);
+        __m128 row1 = _mm_loadu_ps(data + 4);
+        __m128 row2 = _mm_loadu_ps(data + 8);
+        __m128 row3 = _mm_loadu_ps(data + 12);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        row1 = _mm_shuffle_ps(row1, row1, 0x4E);
+        row3 = _mm_shuffle_ps(row3, row3, 0x4E);
+
+        __m128 minor0;
+        __m128 minor1;
+        __m128 minor2;
+        __m128 minor3;
+
+        __m128 tmp = _mm_mul_ps(row2, row3);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+        minor0 = _mm_mul_ps(row1, tmp);
+        minor1 = _mm_mul_ps(row0, tmp);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+        minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+        minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+        minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+        tmp = _mm_mul_ps(row1, row2);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+        minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+        minor3 = _mm_mul_ps(row0, tmp);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+        minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+        minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+        minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+        tmp = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+        row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+        minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+        minor2 = _mm_mul_ps(row0, tmp);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+        minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+        minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+        minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+        tmp = _mm_mul_ps(row0, row1);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+        minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+        minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+        minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+        minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+        tmp = _mm_mul_ps(row0, row3);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+        minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+        minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+        minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+        minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+        tmp = _mm_mul_ps(row0, row2);
+        tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+        minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+        minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+        tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+        minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+        minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+        __m128 det = _mm_mul_ps(row0, minor0);
+        det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+        det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+        const Float detValue = _mm_cvtss_f32(det);
+        if (detValue == 0.0f)
+        {
+            return Matrix44f::Empty;
+        }
+
+        const __m128 invDet = _mm_set1_ps(1.0f / detValue);
+        Matrix44f result;
+        _mm_storeu_ps(result.data, _mm_mul_ps(minor0, invDet));
+        _mm_storeu_ps(result.data + 4, _mm_mul_ps(minor1, invDet));
+        _mm_storeu_ps(result.data + 8, _mm_mul_ps(minor2, invDet));
+        _mm_storeu_ps(result.data + 12, _mm_mul_ps(minor3, invDet));
+        return result;
+#else
+        const Float det = determinant();
+
+        if (det == 0.0f)
+        {
+            return Matrix44f::Empty;
+        }
+
+        const Float invDet = 1.0f / det;
+
+        return Matrix44f( ( m22 * m44 * m33 - m22 * m43 * m34 - m44 * m32 * m23 + m43 * m32 * m24 - m42 * m24 * m33 + m42 * m23 * m34) * invDet,
+                        -( m43 * m32 * m14 - m43 * m34 * m12 + m42 * m13 * m34 - m42 * m14 * m33 - m44 * m32 * m13 + m44 * m33 * m12) * invDet,
+                        (-m22 * m44 * m13 + m22 * m43 * m14 - m43 * m12 * m24 + m42 * m24 * m13 + m44 * m12 * m23 - m42 * m23 * m14) * invDet,
+                        -( m13 * m32 * m24 + m12 * m23 * m34 + m22 * m14 * m33 - m12 * m24 * m33 - m22 * m13 * m34 - m14 * m32 * m23) * invDet,
+                        -( m21 * m44 * m33 - m21 * m43 * m34 + m41 * m23 * m34 - m44 * m31 * m23 - m41 * m24 * m33 + m24 * m43 * m31) * invDet,
+                        ( m11 * m44 * m33 - m11 * m43 * m34 - m44 * m31 * m13 + m41 * m13 * m34 - m41 * m14 * m33 + m43 * m31 * m14) * invDet,
+                        (-m11 * m44 * m23 + m11 * m43 * m24 - m21 * m14 * m43 + m44 * m21 * m13 + m41 * m14 * m23 - m41 * m13 * m24) * invDet,
+                        ( m11 * m23 * m34 - m11 * m24 * m33 + m21 * m14 * m33 - m23 * m31 * m14 - m21 * m13 * m34 + m24 * m31 * m13) * invDet,
+                        -( m31 * m22 * m44 - m42 * m24 * m31 - m41 * m34 * m22 - m44 * m32 * m21 + m41 * m32 * m24 + m42 * m21 * m34) * invDet,
+                        (-m42 * m31 * m14 + m31 * m44 * m12 + m14 * m41 * m32 - m12 * m41 * m34 + m11 * m42 * m34 - m32 * m11 * m44) * invDet,
+                        -( m22 * m41 * m14 - m11 * m22 * m44 - m42 * m21 * m14 + m44 * m21 * m12 - m41 * m12 * m24 + m11 * m42 * m24) * invDet,
+                        (-m34 * m11 * m22 + m34 * m21 * m12 + m31 * m14 * m22 + m32 * m11 * m24 - m32 * m21 * m14 - m31 * m12 * m24) * invDet,
+                        (-m22 * m41 * m33 + m22 * m43 * m31 + m41 * m32 * m23 - m43 * m32 * m21 + m42 * m21 * m33 - m42 * m23 * m31) * invDet,
+                        -( m11 * m42 * m33 - m11 * m43 * m32 - m42 * m31 * m13 + m41 * m13 * m32 - m41 * m12 * m33 + m43 * m31 * m12) * invDet,
+                        -( m43 * m11 * m22 - m43 * m21 * m12 - m41 * m13 * m22 - m42 * m11 * m23 + m42 * m21 * m13 + m41 * m12 * m23) * invDet,
+                        -(-m33 * m11 * m22 + m33 * m21 * m12 + m31 * m13 * m22 + m32 * m11 * m23 - m32 * m21 * m13 - m31 * m12 * m23) * invDet);
+#endif
+    }
 }
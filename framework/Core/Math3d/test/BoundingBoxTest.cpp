@@ -0,0 +1,116 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Math3d/BoundingBox.h"
+#include "Math3d/Matrix44f.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include "Math3d/ProjectionParams.h"
+#include "gtest/gtest.h"
+
+namespace ramses_internal
+{
+    TEST(ABoundingBox, isEmptyWhenDefaultConstructed)
+    {
+        const BoundingBox box;
+        EXPECT_TRUE(box.isEmpty());
+    }
+
+    TEST(ABoundingBox, isNotEmptyWhenDegeneratedToPoint)
+    {
+        const BoundingBox box(Vector3(1.f, 2.f, 3.f), Vector3(1.f, 2.f, 3.f));
+        EXPECT_FALSE(box.isEmpty());
+    }
+
+    TEST(ABoundingBox, canBeCompared)
+    {
+        const BoundingBox box1(Vector3(1.f, 2.f, 3.f), Vector3(4.f, 5.f, 6.f));
+        const BoundingBox box2(Vector3(1.f, 2.f, 3.f), Vector3(4.f, 5.f, 6.f));
+        const BoundingBox box3;
+        EXPECT_TRUE(box1 == box2);
+        EXPECT_TRUE(box1 != box3);
+    }
+
+    TEST(ABoundingBox, extendsByPoints)
+    {
+        BoundingBox box;
+        box.extend(Vector3(1.f, -2.f, 3.f));
+        box.extend(Vector3(-1.f, 2.f, 0.f));
+        EXPECT_EQ(BoundingBox(Vector3(-1.f, -2.f, 0.f), Vector3(1.f, 2.f, 3.f)), box);
+    }
+
+    TEST(ABoundingBox, extendingByEmptyBoxKeepsBoxUnchanged)
+    {
+        BoundingBox box(Vector3(-1.f), Vector3(1.f));
+        box.extend(BoundingBox());
+        EXPECT_EQ(BoundingBox(Vector3(-1.f), Vector3(1.f)), box);
+    }
+
+    TEST(ABoundingBox, transformsToBoxEnclosingTransformedCorners)
+    {
+        const BoundingBox box(Vector3(-1.f, -2.f, -3.f), Vector3(1.f, 2.f, 3.f));
+        const Matrix44f transform = Matrix44f::Translation(10.f, 20.f, 30.f) * Matrix44f::RotationEulerZYX(0.f, 0.f, 90.f) * Matrix44f::Scaling(2.f);
+        const BoundingBox transformed = box.transformed(transform);
+
+        EXPECT_NEAR(6.f, transformed.min.x, 1e-4f);
+        EXPECT_NEAR(18.f, transformed.min.y, 1e-4f);
+        EXPECT_NEAR(24.f, transformed.min.z, 1e-4f);
+        EXPECT_NEAR(14.f, transformed.max.x, 1e-4f);
+        EXPECT_NEAR(22.f, transformed.max.y, 1e-4f);
+        EXPECT_NEAR(36.f, transformed.max.z, 1e-4f);
+    }
+
+    TEST(ABoundingBox, transformedEmptyBoxStaysEmpty)
+    {
+        EXPECT_TRUE(BoundingBox().transformed(Matrix44f::Translation(1.f, 2.f, 3.f)).isEmpty());
+    }
+
+    class ABoundingBoxInClipVolume : public ::testing::Test
+    {
+    protected:
+        const Matrix44f projection = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(90.f, 1.f, 1.f, 100.f));
+    };
+
+    TEST_F(ABoundingBoxInClipVolume, isNotOutsideIfInFrontOfCamera)
+    {
+        const BoundingBox box(Vector3(-1.f), Vector3(1.f));
+        EXPECT_FALSE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(0.f, 0.f, -10.f)));
+    }
+
+    TEST_F(ABoundingBoxInClipVolume, isNotOutsideIfIntersectingFrustumBorder)
+    {
+        const BoundingBox box(Vector3(-1.f), Vector3(1.f));
+        EXPECT_FALSE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(10.f, 0.f, -10.f)));
+    }
+
+    TEST_F(ABoundingBoxInClipVolume, isOutsideIfBehindCamera)
+    {
+        const BoundingBox box(Vector3(-1.f), Vector3(1.f));
+        EXPECT_TRUE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(0.f, 0.f, 10.f)));
+    }
+
+    TEST_F(ABoundingBoxInClipVolume, isOutsideIfBeyondFarPlane)
+    {
+        const BoundingBox box(Vector3(-1.f), Vector3(1.f));
+        EXPECT_TRUE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(0.f, 0.f, -200.f)));
+    }
+
+    TEST_F(ABoundingBoxInClipVolume, isOutsideIfNextToFrustum)
+    {
+        const BoundingBox box(Vector3(-1.f), Vector3(1.f));
+        EXPECT_TRUE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(20.f, 0.f, -10.f)));
+        EXPECT_TRUE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(-20.f, 0.f, -10.f)));
+        EXPECT_TRUE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(0.f, 20.f, -10.f)));
+        EXPECT_TRUE(box.isOutsideOfClipVolume(projection * Matrix44f::Translation(0.f, -20.f, -10.f)));
+    }
+
+    TEST_F(ABoundingBoxInClipVolume, emptyBoxIsNeverOutside)
+    {
+        EXPECT_FALSE(BoundingBox().isOutsideOfClipVolume(projection * Matrix44f::Translation(0.f, 0.f, 10.f)));
+    }
+}
@@ -662,4 +662,86 @@ namespace ramses_internal
         EXPECT_EQ("[1.0 2.0 3.0 4.0; 5.0 6.0 7.0 8.0; 9.0 10.0 11.0 12.0; 13.0 14.0 15.0 16.0]",
                   StringOutputStream::ToString(mat1));
     }
+
+    // results of vectorized operations compared against straightforward scalar computation
+    class AMatrix44fComputation : public testing::Test
+    {
+    protected:
+        static void ExpectNear(const Matrix44f& expected, const Matrix44f& actual, Float tolerance = 1e-5f)
+        {
+            for (UInt32 i = 0u; i < 16u; ++i)
+                EXPECT_NEAR(expected.data[i], actual.data[i], tolerance * std::max(1.f, std::abs(expected.data[i]))) << "element " << i;
+        }
+
+        static Matrix44f Multiply(const Matrix44f& mat1, const Matrix44f& mat2)
+        {
+            Matrix44f result = Matrix44f::Empty;
+            for (UInt32 i = 0u; i < 4u; ++i)
+                for (UInt32 j = 0u; j < 4u; ++j)
+                    for (UInt32 k = 0u; k < 4u; ++k)
+                        result.m(i, j) += mat1.m(i, k) * mat2.m(k, j);
+            return result;
+        }
+
+        const Matrix44f mat1{ 0.5f, -2.f, 3.25f, 4.f, 1.5f, 6.f, -7.f, 0.125f, 9.f, 1.f, 11.f, -12.f, 0.f, 0.f, 0.f, 1.f };
+        const Matrix44f mat2{ -3.f, 0.25f, 1.f, 2.f, 7.f, 5.5f, 0.f, -1.f, 2.f, 8.f, -0.75f, 3.f, 0.1f, 0.2f, 0.3f, 1.5f };
+        const Matrix44f transformation = Matrix44f::Translation(1.f, -2.f, 30.f) * Matrix44f::Scaling(0.5f, 2.f, 3.f) * Matrix44f::RotationEulerZYX(10.f, -45.f, 120.f);
+    };
+
+    TEST_F(AMatrix44fComputation, MultipliesMatrices)
+    {
+        ExpectNear(Multiply(mat1, mat2), mat1 * mat2);
+        ExpectNear(Multiply(mat2, mat1), mat2 * mat1);
+        ExpectNear(Multiply(transformation, mat2), transformation * mat2);
+
+        Matrix44f mat = mat1;
+        mat *= mat2;
+        ExpectNear(Multiply(mat1, mat2), mat);
+    }
+
+    TEST_F(AMatrix44fComputation, MultipliesMatrixWithVector)
+    {
+        const Vector4 vec(1.5f, -2.f, 0.25f, 1.f);
+        const Vector4 result = mat1 * vec;
+        for (UInt32 i = 0u; i < 4u; ++i)
+        {
+            const Float expected = mat1.m(i, 0) * vec.x + mat1.m(i, 1) * vec.y + mat1.m(i, 2) * vec.z + mat1.m(i, 3) * vec.w;
+            EXPECT_FLOAT_EQ(expected, result.data[i]);
+        }
+    }
+
+    TEST_F(AMatrix44fComputation, Transposes)
+    {
+        const Matrix44f transposed = mat1.transpose();
+        for (UInt32 i = 0u; i < 4u; ++i)
+            for (UInt32 j = 0u; j < 4u; ++j)
+                EXPECT_EQ(mat1.m(i, j), transposed.m(j, i));
+        EXPECT_EQ(mat1, transposed.transpose());
+    }
+
+    TEST_F(AMatrix44fComputation, InverseMultipliedWithMatrixGivesIdentity)
+    {
+        for (const auto& mat : { mat1, mat2, transformation, Matrix44f::Identity })
+        {
+            const Matrix44f inverse = mat.inverse();
+            ExpectNear(Matrix44f::Identity, mat * inverse, 1e-4f);
+            ExpectNear(Matrix44f::Identity, inverse * mat, 1e-4f);
+        }
+    }
+
+    TEST_F(AMatrix44fComputation, InverseOfSingularMatrixIsEmpty)
+    {
+        const Matrix44f singular(1.f, 2.f, 3.f, 4.f, 2.f, 4.f, 6.f, 8.f, 0.f, 1.f, 0.f, 1.f, 5.f, 0.f, 1.f, 1.f);
+        EXPECT_EQ(Matrix44f::Empty, singular.inverse());
+        EXPECT_EQ(Matrix44f::Empty, Matrix44f::Empty.inverse());
+    }
+
+    TEST_F(AMatrix44fComputation, ComposesTranslationScalingRotation)
+    {
+        const Vector3 translation(1.f, -2.f, 30.f);
+        const Vector3 scaling(0.5f, 2.f, 3.f);
+        const Vector3 rotation(10.f, -45.f, 120.f);
+        ExpectNear(transformation, Matrix44f::TranslationScalingRotationEulerZYX(translation, scaling, rotation));
+        ExpectNear(Matrix44f::Identity, Matrix44f::TranslationScalingRotationEulerZYX(Vector3(0.f), Vector3(1.f), Vector3(0.f)));
+    }
 }
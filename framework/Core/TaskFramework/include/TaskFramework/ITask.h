@@ -13,6 +13,13 @@
 
 namespace ramses_internal
 {
+    enum class ETaskPriority
+    {
+        High = 0,
+        Normal,
+        NUMBER_OF_ELEMENTS
+    };
+
     /**
      * Interface for a Task which executable.
      */
@@ -25,6 +32,14 @@ namespace ramses_internal
          */
         virtual void execute() = 0;
 
+        /**
+         * Queued tasks of high priority are executed before any task of normal priority.
+         * @return  priority of this Task.
+         */
+        virtual ETaskPriority getPriority() const
+        {
+            return ETaskPriority::Normal;
+        }
     };
 }
 
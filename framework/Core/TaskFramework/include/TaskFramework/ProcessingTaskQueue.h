@@ -9,46 +9,77 @@
 #ifndef RAMSES_PROCESSINGTASKQUEUE_H
 #define RAMSES_PROCESSINGTASKQUEUE_H
 
-#include "Collections/BlockingQueue.h"
 #include "ITask.h"
-
+#include <deque>
+#include <vector>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
 
 namespace ramses_internal
 {
     /**
-     * The processing task queue stores task which should be executed according with their execution observer.
+     * The processing task queue stores tasks until they are popped by the worker threads.
+     *
+     * Every worker has its own deques (one per priority) so that workers do not contend on a single lock.
+     * Tasks added from a worker thread are put to its own deque, tasks added from other threads are distributed
+     * round robin. A worker without tasks steals from the other workers, tasks of high priority are taken from
+     * all workers before tasks of normal priority. Adding a task wakes at most one idle worker.
+     * A nullptr can be added to unblock a waiting worker, it is popped like a task.
      */
     class ProcessingTaskQueue
     {
     public:
+        explicit ProcessingTaskQueue(UInt16 workerCount = 1u);
+        ~ProcessingTaskQueue();
+
+        ProcessingTaskQueue(const ProcessingTaskQueue&) = delete;
+        ProcessingTaskQueue& operator=(const ProcessingTaskQueue&) = delete;
+
         void addTask(ITask* taskToAdd);
+
+        /**
+         * Pops next task for the given worker, waits for a task if there is none.
+         * @param   worker      Index of the popping worker, taken modulo worker count
+         * @param   timeout     Maximum time to wait, 0 waits until there is a task
+         * @return  popped task (referenced by queue, caller has to release it) or nullptr if timed out
+         */
+        ITask* popTask(UInt16 worker, std::chrono::milliseconds timeout);
         ITask* popTask(std::chrono::milliseconds timeout = std::chrono::milliseconds{0});
+
         bool isEmpty() const;
+        UInt16 getWorkerCount() const;
 
     private:
-        BlockingQueue<ITask*> m_taskQueue;
-    };
-
-    inline void ProcessingTaskQueue::addTask(ITask* taskToAdd)
-    {
-        if (taskToAdd)
+        struct Worker
         {
-            taskToAdd->addRef();
-        }
-        m_taskQueue.push(taskToAdd);
-    }
+            std::mutex lock;
+            std::array<std::deque<ITask*>, static_cast<size_t>(ETaskPriority::NUMBER_OF_ELEMENTS)> tasks;
 
-    inline ITask* ProcessingTaskQueue::popTask(std::chrono::milliseconds timeout)
-    {
-        ITask* task = nullptr;
-        m_taskQueue.pop(&task, timeout);
-        return task;
-    }
+            // guarded by m_idleLock
+            std::condition_variable wakeUp;
+            bool wakeUpRequested = false;
+        };
 
-    inline bool ProcessingTaskQueue::isEmpty() const
-    {
-        return m_taskQueue.empty();
-    }
+        void pushToWorker(UInt16 workerIndex, ETaskPriority priority, ITask* task);
+        bool tryPop(UInt16 workerIndex, ITask*& task);
+        bool tryPopFromOwnDeque(UInt16 workerIndex, ETaskPriority priority, ITask*& task);
+        bool trySteal(UInt16 thiefIndex, ETaskPriority priority, ITask*& task);
+        bool waitForTask(UInt16 workerIndex, std::chrono::milliseconds timeout);
+        void wakeUpIdleWorker();
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::atomic<UInt32> m_nextWorkerForExternalTasks{ 0u };
+
+        // number of queued tasks, checked together with idle worker count to not miss wake ups
+        std::atomic<UInt32> m_taskCount{ 0u };
+        std::atomic<UInt32> m_idleWorkerCount{ 0u };
+        std::mutex m_idleLock;
+        std::vector<UInt16> m_idleWorkers;
+    };
 }
 
 #endif
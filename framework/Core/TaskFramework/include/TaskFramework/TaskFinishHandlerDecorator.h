@@ -22,6 +22,7 @@ namespace ramses_internal
         virtual ~TaskFinishHandlerDecorator();
 
         virtual void execute() override;
+        virtual ETaskPriority getPriority() const override;
 
     protected:
 
@@ -0,0 +1,189 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TaskFramework/ProcessingTaskQueue.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // worker which popped last on this thread, tasks added by a running task stay with its worker
+        thread_local const ProcessingTaskQueue* t_workerQueue = nullptr;
+        thread_local UInt16 t_workerIndex = 0u;
+
+        const ETaskPriority PrioritiesInPopOrder[] = { ETaskPriority::High, ETaskPriority::Normal };
+    }
+
+    ProcessingTaskQueue::ProcessingTaskQueue(UInt16 workerCount)
+    {
+        const UInt16 count = std::max<UInt16>(workerCount, 1u);
+        m_workers.reserve(count);
+        for (UInt16 i = 0u; i < count; ++i)
+            m_workers.push_back(std::unique_ptr<Worker>(new Worker));
+        m_idleWorkers.reserve(count);
+    }
+
+    ProcessingTaskQueue::~ProcessingTaskQueue()
+    {
+        if (t_workerQueue == this)
+            t_workerQueue = nullptr;
+    }
+
+    void ProcessingTaskQueue::addTask(ITask* taskToAdd)
+    {
+        // nullptr is used to unblock workers, it should not wait behind queued tasks
+        ETaskPriority priority = ETaskPriority::High;
+        if (taskToAdd)
+        {
+            taskToAdd->addRef();
+            priority = taskToAdd->getPriority();
+        }
+
+        const UInt16 workerIndex = (t_workerQueue == this) ? t_workerIndex : static_cast<UInt16>(m_nextWorkerForExternalTasks++ % m_workers.size());
+        pushToWorker(workerIndex, priority, taskToAdd);
+
+        if (m_idleWorkerCount.load() > 0u)
+            wakeUpIdleWorker();
+    }
+
+    ITask* ProcessingTaskQueue::popTask(UInt16 worker, std::chrono::milliseconds timeout)
+    {
+        const UInt16 workerIndex = static_cast<UInt16>(worker % m_workers.size());
+        t_workerQueue = this;
+        t_workerIndex = workerIndex;
+
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        ITask* task = nullptr;
+        while (!tryPop(workerIndex, task))
+        {
+            std::chrono::milliseconds remainingTime{ 0 };
+            if (timeout != std::chrono::milliseconds{ 0 })
+            {
+                remainingTime = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+                if (remainingTime <= std::chrono::milliseconds{ 0 })
+                    return nullptr;
+            }
+            if (!waitForTask(workerIndex, remainingTime))
+                return nullptr;
+        }
+        return task;
+    }
+
+    ITask* ProcessingTaskQueue::popTask(std::chrono::milliseconds timeout)
+    {
+        return popTask(0u, timeout);
+    }
+
+    bool ProcessingTaskQueue::isEmpty() const
+    {
+        return m_taskCount.load() == 0u;
+    }
+
+    UInt16 ProcessingTaskQueue::getWorkerCount() const
+    {
+        return static_cast<UInt16>(m_workers.size());
+    }
+
+    void ProcessingTaskQueue::pushToWorker(UInt16 workerIndex, ETaskPriority priority, ITask* task)
+    {
+        Worker& worker = *m_workers[workerIndex];
+        std::lock_guard<std::mutex> guard(worker.lock);
+        worker.tasks[static_cast<size_t>(priority)].push_back(task);
+        // counted while holding the lock, so that count never drops below number of queued tasks
+        m_taskCount.fetch_add(1u);
+    }
+
+    bool ProcessingTaskQueue::tryPop(UInt16 workerIndex, ITask*& task)
+    {
+        for (const auto priority : PrioritiesInPopOrder)
+        {
+            if (tryPopFromOwnDeque(workerIndex, priority, task) || trySteal(workerIndex, priority, task))
+                return true;
+        }
+        return false;
+    }
+
+    bool ProcessingTaskQueue::tryPopFromOwnDeque(UInt16 workerIndex, ETaskPriority priority, ITask*& task)
+    {
+        Worker& worker = *m_workers[workerIndex];
+        std::lock_guard<std::mutex> guard(worker.lock);
+        auto& tasks = worker.tasks[static_cast<size_t>(priority)];
+        if (tasks.empty())
+            return false;
+
+        // owner takes oldest task, so that tasks of one worker run in order they were added
+        task = tasks.front();
+        tasks.pop_front();
+        m_taskCount.fetch_sub(1u);
+        return true;
+    }
+
+    bool ProcessingTaskQueue::trySteal(UInt16 thiefIndex, ETaskPriority priority, ITask*& task)
+    {
+        const UInt16 workerCount = static_cast<UInt16>(m_workers.size());
+        for (UInt16 i = 1u; i < workerCount; ++i)
+        {
+            Worker& victim = *m_workers[(thiefIndex + i) % workerCount];
+            std::lock_guard<std::mutex> guard(victim.lock);
+            auto& tasks = victim.tasks[static_cast<size_t>(priority)];
+            if (!tasks.empty())
+            {
+                // thief takes newest task, which the victim would get to last
+                task = tasks.back();
+                tasks.pop_back();
+                m_taskCount.fetch_sub(1u);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ProcessingTaskQueue::waitForTask(UInt16 workerIndex, std::chrono::milliseconds timeout)
+    {
+        Worker& worker = *m_workers[workerIndex];
+        std::unique_lock<std::mutex> l(m_idleLock);
+        worker.wakeUpRequested = false;
+        m_idleWorkers.push_back(workerIndex);
+        // adding a task increments task count before checking idle count, here it is the other way round,
+        // so either the new task is seen here or this worker is seen idle and woken up
+        m_idleWorkerCount.fetch_add(1u);
+
+        bool timedOut = false;
+        if (m_taskCount.load() == 0u)
+        {
+            const auto isWokenUp = [&worker]() { return worker.wakeUpRequested; };
+            if (timeout == std::chrono::milliseconds{ 0 })
+                worker.wakeUp.wait(l, isWokenUp);
+            else
+                timedOut = !worker.wakeUp.wait_for(l, timeout, isWokenUp);
+        }
+
+        // when woken up, wakeUpIdleWorker already removed this worker from idle workers
+        if (!worker.wakeUpRequested)
+        {
+            m_idleWorkers.erase(std::find(m_idleWorkers.begin(), m_idleWorkers.end(), workerIndex));
+            m_idleWorkerCount.fetch_sub(1u);
+        }
+
+        return !timedOut;
+    }
+
+    void ProcessingTaskQueue::wakeUpIdleWorker()
+    {
+        std::lock_guard<std::mutex> guard(m_idleLock);
+        if (!m_idleWorkers.empty())
+        {
+            Worker& worker = *m_workers[m_idleWorkers.back()];
+            m_idleWorkers.pop_back();
+            m_idleWorkerCount.fetch_sub(1u);
+            worker.wakeUpRequested = true;
+            worker.wakeUp.notify_one();
+        }
+    }
+}
@@ -91,7 +91,7 @@ namespace ramses_internal
             m_aliveHandler.notifyAlive(m_workerIndex);
             while (!isCancelRequested())
             {
-                ITask* const pTaskToExecute = m_pBlockingTaskQueue->popTask(std::chrono::milliseconds{m_aliveHandler.calculateTimeout()});
+                ITask* const pTaskToExecute = m_pBlockingTaskQueue->popTask(m_workerIndex, std::chrono::milliseconds{m_aliveHandler.calculateTimeout()});
                 m_aliveHandler.notifyAlive(m_workerIndex);
                 if (nullptr != pTaskToExecute)
                 {
@@ -30,4 +30,9 @@ namespace ramses_internal
         m_watchedTask.execute();
         m_finisHandler.TaskFinished(m_watchedTask);
     }
+
+    ETaskPriority TaskFinishHandlerDecorator::getPriority() const
+    {
+        return m_watchedTask.getPriority();
+    }
 }
@@ -12,7 +12,7 @@
 namespace ramses_internal
 {
     ThreadedTaskExecutor::ThreadedTaskExecutor(UInt16 threadCount, const ThreadWatchdogConfig& watchdogConfig)
-        : m_taskQueue()
+        : m_taskQueue(threadCount)
         , m_threadPool()
         , m_acceptingNewTasks(true)
         , m_numberOfThreads(threadCount)
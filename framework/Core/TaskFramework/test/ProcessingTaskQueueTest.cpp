@@ -10,6 +10,8 @@
 #include "framework_common_gmock_header.h"
 #include "gmock/gmock.h"
 #include "PlatformAbstraction/PlatformTime.h"
+#include <thread>
+#include <atomic>
 
 using namespace testing;
 
@@ -21,6 +23,15 @@ namespace ramses_internal
         virtual void execute() override {};
     };
 
+    class HighPriorityTask : public MockTask
+    {
+    public:
+        virtual ETaskPriority getPriority() const override
+        {
+            return ETaskPriority::High;
+        }
+    };
+
     TEST(ProcessingTaskQueueTest, addAndPopTask)
     {
         ProcessingTaskQueue q;
@@ -75,4 +86,116 @@ namespace ramses_internal
         EXPECT_EQ(q.popTask(timeout), nullptr);
         EXPECT_GE(std::chrono::steady_clock::now() - start, timeout - tolerance);
     }
+
+    TEST(ProcessingTaskQueueTest, popsHighPriorityTasksFirst)
+    {
+        ProcessingTaskQueue q;
+        MockTask normal1;
+        MockTask normal2;
+        HighPriorityTask high;
+        q.addTask(&normal1);
+        q.addTask(&high);
+        q.addTask(&normal2);
+
+        EXPECT_EQ(&high, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_EQ(&normal1, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_EQ(&normal2, q.popTask(std::chrono::milliseconds{20}));
+    }
+
+    TEST(ProcessingTaskQueueTest, popsHighPriorityTaskOfOtherWorkerBeforeOwnNormalPriorityTask)
+    {
+        ProcessingTaskQueue q(2u);
+        MockTask normal;
+        HighPriorityTask high;
+        // tasks from non worker threads are distributed round robin
+        q.addTask(&normal);
+        q.addTask(&high);
+
+        EXPECT_EQ(&high, q.popTask(0u, std::chrono::milliseconds{20}));
+        EXPECT_EQ(&normal, q.popTask(0u, std::chrono::milliseconds{20}));
+    }
+
+    TEST(ProcessingTaskQueueTest, workerStealsTasksOfOtherWorkers)
+    {
+        ProcessingTaskQueue q(3u);
+        MockTask t1;
+        MockTask t2;
+        MockTask t3;
+        q.addTask(&t1);
+        q.addTask(&t2);
+        q.addTask(&t3);
+
+        EXPECT_EQ(&t2, q.popTask(1u, std::chrono::milliseconds{20}));
+        EXPECT_EQ(&t3, q.popTask(1u, std::chrono::milliseconds{20}));
+        EXPECT_EQ(&t1, q.popTask(1u, std::chrono::milliseconds{20}));
+        EXPECT_TRUE(q.isEmpty());
+    }
+
+    TEST(ProcessingTaskQueueTest, tasksAddedByWorkerThreadStayWithThatWorker)
+    {
+        ProcessingTaskQueue q(2u);
+        MockTask first;
+        MockTask followUp1;
+        MockTask followUp2;
+        q.addTask(&first);
+
+        std::thread worker([&]()
+        {
+            EXPECT_EQ(&first, q.popTask(0u, std::chrono::milliseconds{20}));
+            q.addTask(&followUp1);
+            q.addTask(&followUp2);
+        });
+        worker.join();
+
+        // both follow ups are in deque of worker 0, other worker steals newest one
+        EXPECT_EQ(&followUp2, q.popTask(1u, std::chrono::milliseconds{20}));
+        EXPECT_EQ(&followUp1, q.popTask(0u, std::chrono::milliseconds{20}));
+    }
+
+    TEST(ProcessingTaskQueueTest, waitingWorkersPopAllTasksAddedConcurrently)
+    {
+        class CountingTask : public ITask
+        {
+        public:
+            virtual void execute() override
+            {
+                ++executions;
+            }
+            std::atomic<UInt32> executions{ 0u };
+        };
+
+        constexpr UInt16 WorkerCount = 4u;
+        constexpr UInt32 TasksPerProducer = 5000u;
+        ProcessingTaskQueue q(WorkerCount);
+        CountingTask task;
+
+        std::vector<std::thread> workers;
+        for (UInt16 i = 0u; i < WorkerCount; ++i)
+        {
+            workers.emplace_back([&q, i]()
+            {
+                // wait without timeout, a missed wake up would block this test
+                while (ITask* t = q.popTask(i, std::chrono::milliseconds{0}))
+                {
+                    t->execute();
+                    t->release();
+                }
+            });
+        }
+
+        std::thread producer1([&]() { for (UInt32 i = 0u; i < TasksPerProducer; ++i) q.addTask(&task); });
+        std::thread producer2([&]() { for (UInt32 i = 0u; i < TasksPerProducer; ++i) q.addTask(&task); });
+        producer1.join();
+        producer2.join();
+
+        while (!q.isEmpty())
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        for (UInt16 i = 0u; i < WorkerCount; ++i)
+            q.addTask(nullptr);
+        for (auto& worker : workers)
+            worker.join();
+
+        EXPECT_EQ(2u * TasksPerProducer, task.executions.load());
+        EXPECT_EQ(1u, task.getReferenceCount());
+    }
 }
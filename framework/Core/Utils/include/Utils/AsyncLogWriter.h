@@ -0,0 +1,92 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_ASYNCLOGWRITER_H
+#define RAMSES_ASYNCLOGWRITER_H
+
+#include "Utils/LogLevel.h"
+#include "Collections/String.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include "PlatformAbstraction/PlatformEvent.h"
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+
+namespace ramses_internal
+{
+    class LogContext;
+    class LogMessage;
+
+    // Decouples logging threads from the log appenders. Messages are copied into a bounded ring buffer
+    // without taking a lock (multiple producers, one consumer at a time) and written by a background thread.
+    // When the buffer is full, messages of level Info and lower are dropped and counted, the drop count is
+    // reported with the next written messages. Warnings and errors are never dropped, push fails for them
+    // and the caller has to write them synchronously.
+    class AsyncLogWriter : public Runnable
+    {
+    public:
+        using WriteFunction = std::function<void(const LogMessage&)>;
+
+        AsyncLogWriter(UInt32 capacity, const WriteFunction& writeFunction);
+        virtual ~AsyncLogWriter() override;
+
+        AsyncLogWriter(const AsyncLogWriter&) = delete;
+        AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+        // global operator new does not respect the cache line alignment of the positions before C++17
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr);
+
+        // returns false if message was neither queued nor dropped
+        bool push(const LogMessage& message);
+
+        // writes all queued messages on calling thread
+        void flush();
+
+        UInt32 getCapacity() const;
+        UInt64 getDroppedMessageCount() const;
+
+    private:
+        static constexpr std::size_t CacheLineSize = 64u;
+
+        struct Entry
+        {
+            const LogContext* context = nullptr;
+            ELogLevel logLevel = ELogLevel::Off;
+            UInt64 timestampMilliseconds = 0u;
+            String message;
+        };
+
+        struct Cell
+        {
+            std::atomic<UInt64> sequence;
+            Entry entry;
+        };
+
+        virtual void run() override;
+        bool pop(Entry& entry);
+
+        const UInt64 m_mask;
+        std::unique_ptr<Cell[]> m_cells;
+        WriteFunction m_writeFunction;
+
+        // positions and drop counter are written by different threads, keep them on separate cache lines
+        alignas(CacheLineSize) std::atomic<UInt64> m_enqueuePosition{ 0u };
+        alignas(CacheLineSize) std::atomic<UInt64> m_dequeuePosition{ 0u };
+        alignas(CacheLineSize) std::atomic<UInt64> m_droppedMessages{ 0u };
+
+        std::mutex m_flushLock;
+        UInt64 m_reportedDroppedMessages = 0u;
+        PlatformEvent m_event;
+        PlatformThread m_thread;
+    };
+}
+
+#endif
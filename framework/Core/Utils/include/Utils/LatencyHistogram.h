@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_LATENCYHISTOGRAM_H
+#define RAMSES_LATENCYHISTOGRAM_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <atomic>
+#include <array>
+
+namespace ramses_internal
+{
+    class StringOutputStream;
+
+    // Histogram of durations (or any other non-negative values) to report percentiles instead of averages.
+    // Values are counted in buckets with logarithmic ranges, each range split in 32 linear sub-buckets, so that
+    // values below 64 are exact and larger values have a relative error below 1/32. Values are recorded lock-free
+    // and may be recorded from several threads while reading. To report and restart an interval while other threads
+    // keep recording, use moveTo instead of reading and resetting, so no recorded value gets lost in between.
+    class LatencyHistogram
+    {
+    public:
+        LatencyHistogram();
+
+        LatencyHistogram(const LatencyHistogram&) = delete;
+        LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+        void record(UInt64 value);
+        void reset();
+        // moves all values recorded so far into target (replacing its content) and removes them from this histogram,
+        // a value recorded concurrently either ends up in target or stays recorded here
+        void moveTo(LatencyHistogram& target);
+
+        UInt64 getCount() const;
+        UInt64 getMaxValue() const;
+        // returns a value that the given percentage of recorded values are lower or equal to, 0 if nothing recorded
+        UInt64 getPercentile(Float percentile) const;
+
+        // writes "p50/p95/p99/max" values separated by slashes
+        void writePercentilesToStream(StringOutputStream& str) const;
+
+        static constexpr UInt64 MaxTrackedValue = (UInt64(1u) << 40u) - 1u;
+
+    private:
+        static constexpr UInt32 SubBucketBits = 5u;
+        static constexpr UInt32 SubBucketCount = 1u << SubBucketBits;
+        static constexpr UInt32 BucketCount = (40u - SubBucketBits + 1u) * SubBucketCount;
+
+        static UInt32 GetBucketIndex(UInt64 value);
+        static UInt64 GetHighestValueInBucket(UInt32 index);
+
+        std::array<std::atomic<UInt32>, BucketCount> m_buckets;
+        std::atomic<UInt64> m_count;
+        std::atomic<UInt64> m_maxValue;
+    };
+}
+
+#endif
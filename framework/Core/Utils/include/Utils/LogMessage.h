@@ -11,6 +11,7 @@
 
 #include "Utils/LogLevel.h"
 #include "Collections/StringOutputStream.h"
+#include "PlatformAbstraction/PlatformTime.h"
 
 namespace ramses_internal
 {
@@ -20,21 +21,31 @@ namespace ramses_internal
     {
     public:
         LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream);
+        LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream, UInt64 timestampMilliseconds);
 
         const StringOutputStream& getStream() const;
         const LogContext& getContext() const;
         ELogLevel getLogLevel() const;
+        // absolute time in milliseconds when the message was logged
+        UInt64 getTimestampMilliseconds() const;
 
     private:
         const LogContext& m_context;
         const ELogLevel m_logLevel;
         const StringOutputStream& m_outputStream;
+        const UInt64 m_timestampMilliseconds;
     };
 
     inline LogMessage::LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream)
+        : LogMessage(context, logLevel, stream, PlatformTime::GetMillisecondsAbsolute())
+    {
+    }
+
+    inline LogMessage::LogMessage(const LogContext& context, ELogLevel logLevel, const StringOutputStream& stream, UInt64 timestampMilliseconds)
         : m_context(context)
         , m_logLevel(logLevel)
         , m_outputStream(stream)
+        , m_timestampMilliseconds(timestampMilliseconds)
     {
     }
 
@@ -52,6 +63,11 @@ namespace ramses_internal
     {
         return m_logLevel;
     }
+
+    inline UInt64 LogMessage::getTimestampMilliseconds() const
+    {
+        return m_timestampMilliseconds;
+    }
 }
 
 #endif
@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_MEMORYMAPPEDFILE_H
+#define RAMSES_MEMORYMAPPEDFILE_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "Collections/String.h"
+
+namespace ramses_internal
+{
+    // Private copy-on-write mapping of a whole file into memory, the file itself is never modified and
+    // pages are only copied when written. Mapping can fail (e.g. unsupported platform, empty file or not
+    // enough address space), users must check isMapped() and fall back to regular file reading.
+    class MemoryMappedFile
+    {
+    public:
+        explicit MemoryMappedFile(const String& path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        bool isMapped() const;
+        const Byte* getData() const;
+        Byte* getData();
+        UInt64 getSize() const;
+
+        // hint to the OS that the given range will be read soon
+        void prefetch(UInt64 offset, UInt64 size) const;
+
+        // true if path refers to the mapped file, compares file identity so that also
+        // differently spelled paths, symbolic and hard links to the mapped file are detected
+        bool isMappingOf(const String& path) const;
+
+    private:
+        Byte* m_data = nullptr;
+        UInt64 m_size = 0u;
+#ifdef _WIN32
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#else
+        UInt64 m_fileDevice = 0u;
+        UInt64 m_fileInode = 0u;
+#endif
+    };
+
+    inline bool MemoryMappedFile::isMapped() const
+    {
+        return m_data != nullptr;
+    }
+
+    inline const Byte* MemoryMappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    inline Byte* MemoryMappedFile::getData()
+    {
+        return m_data;
+    }
+
+    inline UInt64 MemoryMappedFile::getSize() const
+    {
+        return m_size;
+    }
+}
+
+#endif
@@ -54,6 +54,7 @@ namespace ramses_internal
         StatisticCollectionFramework& m_statisticCollection;
         UInt32 m_triggerCounter;
         HashMap<SceneId, StatisticCollectionScene*> m_statisticCollectionScenes;
+        LatencyHistogram m_messageQueueingDelaySummary;
 
         std::chrono::steady_clock::time_point m_previousSteadyTime;
         synchronized_clock::time_point m_previousSyncTime;
@@ -13,6 +13,7 @@
 #include "Utils/LogContext.h"
 #include "Utils/ConsoleLogAppender.h"
 #include "Utils/LogAppenderBase.h"
+#include "Utils/AsyncLogWriter.h"
 #include "Collections/Vector.h"
 #include "Collections/String.h"
 #include <mutex>
@@ -44,6 +45,13 @@ namespace ramses_internal
 
         void log(const LogMessage& msg);
 
+        // Logging threads only queue messages, a background thread writes them to the appenders.
+        // Can only be enabled once, stays enabled until the logger is destroyed.
+        void enableAsyncLogging(UInt32 queueCapacity = DefaultAsyncLogQueueCapacity);
+        bool isAsyncLoggingEnabled() const;
+        void flushAsyncLogMessages();
+        UInt64 getDroppedLogMessageCount() const;
+
         void applyContextFilterCommand(const String& command);
         std::vector<LogContextInformation> getAllContextsInformation() const;
 
@@ -63,12 +71,14 @@ namespace ramses_internal
     private:
         static const ELogLevel LogLevelDefault_Contexts = ELogLevel::Info;
         static const ELogLevel LogLevelDefault_Console = ELogLevel::Info;
+        static const UInt32 DefaultAsyncLogQueueCapacity = 4096u;
 
         static void UpdateConsoleLogLevelFromDefine(ELogLevel& loglevel);
         static void UpdateConsoleLogLevelFromEnvVar(ELogLevel& loglevel);
 
         void dltLogLevelChangeCallback(const String& contextId, int logLevelAsInt);
         LogContext* getLogContextById(const String& contextId);
+        void writeToAppenders(const LogMessage& msg);
 
         std::mutex m_appenderLock;
         bool m_isInitialized;
@@ -78,6 +88,8 @@ namespace ramses_internal
         std::vector<LogContext*> m_logContexts;
         std::vector<LogAppenderBase*> m_logAppenders;
         LogContext& m_fileTransferContext;
+        std::unique_ptr<AsyncLogWriter> m_asyncLogWriter;
+        std::atomic<AsyncLogWriter*> m_activeAsyncLogWriter{ nullptr };
     };
 
     inline RamsesLogger& GetRamsesLogger()
@@ -10,6 +10,7 @@
 #define RAMSES_STATISTICCOLLECTION_H
 
 #include "PlatformAbstraction/PlatformTypes.h"
+#include "Utils/LatencyHistogram.h"
 #include <limits>
 #include <tuple>
 #include <atomic>
@@ -161,10 +162,11 @@ namespace ramses_internal
         StatisticEntry<UInt32> statResourcesDestroyed;
         StatisticEntry<UInt32> statResourcesNumber; //updated by values of statResourcesCreated and statResourcesDestroyed
         StatisticEntry<UInt32> statResourcesSentNumber;
-        StatisticEntry<UInt32> statResourcesSentSize;
+        StatisticEntry<UInt64> statResourcesSentSize;
         StatisticEntry<UInt32> statResourcesReceivedNumber;
         StatisticEntry<UInt32> statResourcesLoadedFromFileNumber;
-        StatisticEntry<UInt32> statResourcesLoadedFromFileSize;
+        StatisticEntry<UInt64> statResourcesLoadedFromFileSize;
+        LatencyHistogram statMessageQueueingDelay; //time in microseconds from posting a message until it is sent, moved out by periodic logger
     };
 
     class StatisticCollectionScene : public StatisticCollection
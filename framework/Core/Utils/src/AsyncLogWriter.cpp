@@ -0,0 +1,187 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/AsyncLogWriter.h"
+#include "Utils/LogMessage.h"
+#include "Utils/LogMacros.h"
+#include <thread>
+#include <new>
+#include <cstdlib>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace ramses_internal
+{
+    namespace
+    {
+        const UInt32 WriteIntervalMilliseconds = 10u;
+
+        UInt64 RoundUpToPowerOfTwo(UInt32 value)
+        {
+            UInt64 result = 2u;
+            while (result < value)
+                result *= 2u;
+            return result;
+        }
+    }
+
+    AsyncLogWriter::AsyncLogWriter(UInt32 capacity, const WriteFunction& writeFunction)
+        : m_mask(RoundUpToPowerOfTwo(capacity) - 1u)
+        , m_cells(new Cell[m_mask + 1u])
+        , m_writeFunction(writeFunction)
+        , m_thread("R_AsyncLog")
+    {
+        for (UInt64 i = 0u; i <= m_mask; ++i)
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        m_thread.start(*this);
+    }
+
+    AsyncLogWriter::~AsyncLogWriter()
+    {
+        m_thread.cancel();
+        m_event.signal();
+        m_thread.join();
+        flush();
+    }
+
+    void* AsyncLogWriter::operator new(std::size_t size)
+    {
+#if defined(_WIN32)
+        void* ptr = _aligned_malloc(size, alignof(AsyncLogWriter));
+#else
+        void* ptr = nullptr;
+        if (posix_memalign(&ptr, alignof(AsyncLogWriter), size) != 0)
+            ptr = nullptr;
+#endif
+        if (!ptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    void AsyncLogWriter::operator delete(void* ptr)
+    {
+#if defined(_WIN32)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    bool AsyncLogWriter::push(const LogMessage& message)
+    {
+        UInt64 position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;)
+        {
+            cell = &m_cells[position & m_mask];
+            const UInt64 sequence = cell->sequence.load(std::memory_order_acquire);
+            const Int64 difference = static_cast<Int64>(sequence - position);
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+            {
+                // full, cell still holds the message from one round before
+                if (message.getLogLevel() <= ELogLevel::Warn)
+                    return false;
+                m_droppedMessages.fetch_add(1u, std::memory_order_relaxed);
+                return true;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->entry.context = &message.getContext();
+        cell->entry.logLevel = message.getLogLevel();
+        cell->entry.timestampMilliseconds = message.getTimestampMilliseconds();
+        cell->entry.message = message.getStream().data();
+        cell->sequence.store(position + 1u, std::memory_order_release);
+
+        // wake up writer early when half of the buffer is used, otherwise it writes in intervals
+        if (position + 1u - m_dequeuePosition.load(std::memory_order_relaxed) == (m_mask + 1u) / 2u)
+            m_event.signal();
+
+        return true;
+    }
+
+    bool AsyncLogWriter::pop(Entry& entry)
+    {
+        const UInt64 position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[position & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != position + 1u)
+            return false;
+
+        entry.context = cell.entry.context;
+        entry.logLevel = cell.entry.logLevel;
+        entry.timestampMilliseconds = cell.entry.timestampMilliseconds;
+        entry.message.swap(cell.entry.message);
+        cell.sequence.store(position + m_mask + 1u, std::memory_order_release);
+        m_dequeuePosition.store(position + 1u, std::memory_order_relaxed);
+        return true;
+    }
+
+    void AsyncLogWriter::flush()
+    {
+        // only one consumer may pop at a time
+        std::lock_guard<std::mutex> guard(m_flushLock);
+
+        // write at least everything pushed so far, a producer may still be copying a message into a cell
+        // in front of messages pushed after it, so wait for it instead of stopping at its cell
+        const UInt64 lastPushedPosition = m_enqueuePosition.load(std::memory_order_relaxed);
+
+        // message buffers are handed back to the cells by pop, so that pushing reuses their memory
+        Entry entry;
+        for (;;)
+        {
+            if (pop(entry))
+            {
+                StringOutputStream stream(std::move(entry.message));
+                m_writeFunction(LogMessage(*entry.context, entry.logLevel, stream, entry.timestampMilliseconds));
+                entry.message = stream.release();
+            }
+            else if (m_dequeuePosition.load(std::memory_order_relaxed) < lastPushedPosition)
+                std::this_thread::yield();
+            else
+                break;
+        }
+
+        const UInt64 droppedMessages = m_droppedMessages.load(std::memory_order_relaxed);
+        if (droppedMessages != m_reportedDroppedMessages)
+        {
+            StringOutputStream stream;
+            stream << "AsyncLogWriter: dropped " << droppedMessages - m_reportedDroppedMessages << " log messages because queue of size "
+                << m_mask + 1u << " was full (" << droppedMessages << " dropped in total)";
+            m_writeFunction(LogMessage(CONTEXT_FRAMEWORK, ELogLevel::Warn, stream));
+            m_reportedDroppedMessages = droppedMessages;
+        }
+    }
+
+    UInt32 AsyncLogWriter::getCapacity() const
+    {
+        return static_cast<UInt32>(m_mask + 1u);
+    }
+
+    UInt64 AsyncLogWriter::getDroppedMessageCount() const
+    {
+        return m_droppedMessages.load(std::memory_order_relaxed);
+    }
+
+    void AsyncLogWriter::run()
+    {
+        while (!isCancelRequested())
+        {
+            m_event.wait(WriteIntervalMilliseconds);
+            flush();
+        }
+    }
+}
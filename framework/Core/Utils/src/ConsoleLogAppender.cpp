@@ -9,7 +9,6 @@
 #include "Utils/ConsoleLogAppender.h"
 #include "Utils/LogMessage.h"
 #include "Utils/LogContext.h"
-#include "PlatformAbstraction/PlatformTime.h"
 #include "PlatformAbstraction/PlatformEnvironmentVariables.h"
 #include "PlatformAbstraction/PlatformConsole.h"
 #include "fmt/format.h"
@@ -32,7 +31,7 @@ namespace ramses_internal
         // TODO(tobias) make static initializer
         Console::EnsureConsoleInitialized();
 
-        const uint64_t now = PlatformTime::GetMillisecondsAbsolute();
+        const uint64_t now = logMessage.getTimestampMilliseconds();
         const char* logLevelColor = nullptr;
         const char* logLevelStr = nullptr;
 
@@ -0,0 +1,122 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/LatencyHistogram.h"
+#include "Collections/StringOutputStream.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ramses_internal
+{
+    constexpr UInt64 LatencyHistogram::MaxTrackedValue;
+    constexpr UInt32 LatencyHistogram::SubBucketBits;
+    constexpr UInt32 LatencyHistogram::SubBucketCount;
+    constexpr UInt32 LatencyHistogram::BucketCount;
+
+    LatencyHistogram::LatencyHistogram()
+    {
+        reset();
+    }
+
+    UInt32 LatencyHistogram::GetBucketIndex(UInt64 value)
+    {
+        // shift value until it fits in upper half of sub-buckets, the shift selects the logarithmic range
+        // (values below 2 * SubBucketCount need no shift and map directly to their index)
+        UInt32 shift = 0u;
+        while ((value >> shift) >= 2u * SubBucketCount)
+            ++shift;
+        return shift * SubBucketCount + static_cast<UInt32>(value >> shift);
+    }
+
+    UInt64 LatencyHistogram::GetHighestValueInBucket(UInt32 index)
+    {
+        if (index < 2u * SubBucketCount)
+            return index;
+        const UInt32 shift = index / SubBucketCount - 1u;
+        const UInt64 subBucket = index - shift * SubBucketCount;
+        return ((subBucket + 1u) << shift) - 1u;
+    }
+
+    void LatencyHistogram::record(UInt64 value)
+    {
+        const UInt64 clampedValue = std::min(value, MaxTrackedValue);
+        m_buckets[GetBucketIndex(clampedValue)].fetch_add(1u, std::memory_order_relaxed);
+        m_count.fetch_add(1u, std::memory_order_relaxed);
+
+        UInt64 maxValue = m_maxValue.load(std::memory_order_relaxed);
+        while (clampedValue > maxValue && !m_maxValue.compare_exchange_weak(maxValue, clampedValue, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void LatencyHistogram::reset()
+    {
+        for (auto& bucket : m_buckets)
+            bucket.store(0u, std::memory_order_relaxed);
+        m_count.store(0u, std::memory_order_relaxed);
+        m_maxValue.store(0u, std::memory_order_relaxed);
+    }
+
+    void LatencyHistogram::moveTo(LatencyHistogram& target)
+    {
+        // buckets are taken one by one, count is reduced only by the taken values so that values recorded
+        // meanwhile are not lost (max value of a concurrently recorded value may be attributed to this histogram)
+        UInt64 movedCount = 0u;
+        for (UInt32 i = 0u; i < BucketCount; ++i)
+        {
+            const UInt32 bucketCount = m_buckets[i].exchange(0u, std::memory_order_relaxed);
+            target.m_buckets[i].store(bucketCount, std::memory_order_relaxed);
+            movedCount += bucketCount;
+        }
+        m_count.fetch_sub(movedCount, std::memory_order_relaxed);
+        target.m_count.store(movedCount, std::memory_order_relaxed);
+        target.m_maxValue.store(m_maxValue.exchange(0u, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    UInt64 LatencyHistogram::getCount() const
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    UInt64 LatencyHistogram::getMaxValue() const
+    {
+        return m_maxValue.load(std::memory_order_relaxed);
+    }
+
+    UInt64 LatencyHistogram::getPercentile(Float percentile) const
+    {
+        // count is taken from buckets, total count may already include values recorded meanwhile
+        std::array<UInt32, BucketCount> counts;
+        UInt64 totalCount = 0u;
+        for (UInt32 i = 0u; i < BucketCount; ++i)
+        {
+            counts[i] = m_buckets[i].load(std::memory_order_relaxed);
+            totalCount += counts[i];
+        }
+        if (totalCount == 0u)
+            return 0u;
+
+        // multiply before dividing, so that percentiles of counts like 95% of 60 are not rounded up
+        const Double clampedPercentile = std::min(std::max(static_cast<Double>(percentile), 0.0), 100.0);
+        const UInt64 targetCount = std::max<UInt64>(1u, static_cast<UInt64>(std::ceil(clampedPercentile * totalCount / 100.0)));
+
+        UInt64 accumulatedCount = 0u;
+        for (UInt32 i = 0u; i < BucketCount; ++i)
+        {
+            accumulatedCount += counts[i];
+            if (accumulatedCount >= targetCount)
+                return std::min(GetHighestValueInBucket(i), getMaxValue());
+        }
+        return getMaxValue();
+    }
+
+    void LatencyHistogram::writePercentilesToStream(StringOutputStream& str) const
+    {
+        str << getPercentile(50.f) << "/" << getPercentile(95.f) << "/" << getPercentile(99.f) << "/" << getMaxValue();
+    }
+}
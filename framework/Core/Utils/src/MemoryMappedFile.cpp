@@ -0,0 +1,172 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/LogMacros.h"
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif !defined(__INTEGRITY)
+#define RAMSES_HAS_POSIX_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace ramses_internal
+{
+#if defined(_WIN32)
+    MemoryMappedFile::MemoryMappedFile(const String& path)
+    {
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0 ||
+            static_cast<UInt64>(fileSize.QuadPart) > std::numeric_limits<size_t>::max())
+        {
+            CloseHandle(file);
+            return;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            CloseHandle(file);
+            return;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (!view)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "MemoryMappedFile: could not map " << path << ", error " << GetLastError());
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return;
+        }
+
+        m_fileHandle = file;
+        m_mappingHandle = mapping;
+        m_data = static_cast<Byte*>(view);
+        m_size = static_cast<UInt64>(fileSize.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle)
+            CloseHandle(m_mappingHandle);
+        if (m_fileHandle)
+            CloseHandle(m_fileHandle);
+    }
+
+    void MemoryMappedFile::prefetch(UInt64, UInt64) const
+    {
+    }
+
+    bool MemoryMappedFile::isMappingOf(const String& path) const
+    {
+        if (!m_data)
+            return false;
+
+        HANDLE file = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        BY_HANDLE_FILE_INFORMATION otherInfo;
+        BY_HANDLE_FILE_INFORMATION mappedInfo;
+        const bool gotInfo = GetFileInformationByHandle(file, &otherInfo) && GetFileInformationByHandle(m_fileHandle, &mappedInfo);
+        CloseHandle(file);
+
+        return gotInfo &&
+            otherInfo.dwVolumeSerialNumber == mappedInfo.dwVolumeSerialNumber &&
+            otherInfo.nFileIndexHigh == mappedInfo.nFileIndexHigh &&
+            otherInfo.nFileIndexLow == mappedInfo.nFileIndexLow;
+    }
+
+#elif defined(RAMSES_HAS_POSIX_MMAP)
+    MemoryMappedFile::MemoryMappedFile(const String& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return;
+
+        struct stat fileStat;
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0 ||
+            static_cast<UInt64>(fileStat.st_size) > std::numeric_limits<size_t>::max())
+        {
+            ::close(fd);
+            return;
+        }
+
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+        void* mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // mapping stays valid after closing the descriptor
+        ::close(fd);
+        if (mapping == MAP_FAILED)
+        {
+            LOG_WARN(CONTEXT_FRAMEWORK, "MemoryMappedFile: could not map " << path << ", errno " << errno);
+            return;
+        }
+
+        m_data = static_cast<Byte*>(mapping);
+        m_size = size;
+        m_fileDevice = static_cast<UInt64>(fileStat.st_dev);
+        m_fileInode = static_cast<UInt64>(fileStat.st_ino);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            ::munmap(m_data, static_cast<size_t>(m_size));
+    }
+
+    void MemoryMappedFile::prefetch(UInt64 offset, UInt64 size) const
+    {
+        if (!m_data || offset >= m_size)
+            return;
+
+        // madvise needs page aligned start address
+        const UInt64 pageSize = static_cast<UInt64>(::sysconf(_SC_PAGESIZE));
+        const UInt64 alignedOffset = offset - (offset % pageSize);
+        const UInt64 alignedSize = std::min(m_size - alignedOffset, size + (offset - alignedOffset));
+        ::madvise(m_data + alignedOffset, static_cast<size_t>(alignedSize), MADV_WILLNEED);
+    }
+
+    bool MemoryMappedFile::isMappingOf(const String& path) const
+    {
+        struct stat fileStat;
+        return m_data && ::stat(path.c_str(), &fileStat) == 0 &&
+            static_cast<UInt64>(fileStat.st_dev) == m_fileDevice && static_cast<UInt64>(fileStat.st_ino) == m_fileInode;
+    }
+
+#else
+    MemoryMappedFile::MemoryMappedFile(const String&)
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+    }
+
+    void MemoryMappedFile::prefetch(UInt64, UInt64) const
+    {
+    }
+
+    bool MemoryMappedFile::isMappingOf(const String&) const
+    {
+        return false;
+    }
+#endif
+}
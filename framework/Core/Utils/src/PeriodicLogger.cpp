@@ -140,6 +140,9 @@ namespace ramses_internal
 
     void PeriodicLogger::printStatistic()
     {
+        // queueing delays are recorded by the sending thread, take them out instead of resetting them after logging
+        m_statisticCollection.statMessageQueueingDelay.moveTo(m_messageQueueingDelaySummary);
+
         LOG_INFO_F(CONTEXT_PERIODIC, ([&](ramses_internal::StringOutputStream& output) {
                     UInt32 numberTimeIntervals = m_statisticCollection.getNumberTimeIntervalsSinceLastSummaryReset();
                     output << "msgIn ";
@@ -166,6 +169,12 @@ namespace ramses_internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileNumber.getSummary(), numberTimeIntervals);
                     output << " resFS ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileSize.getSummary(), numberTimeIntervals);
+                    if (m_messageQueueingDelaySummary.getCount() > 0u)
+                    {
+                        output << " msgOQueued(p50/p95/p99/max) ";
+                        m_messageQueueingDelaySummary.writePercentilesToStream(output);
+                        output << "us";
+                    }
         }));
 
         m_statisticCollection.resetSummaries();
@@ -43,6 +43,10 @@ namespace ramses_internal
 
     RamsesLogger::~RamsesLogger()
     {
+        // queued messages refer to the contexts, write them before contexts are gone
+        m_activeAsyncLogWriter = nullptr;
+        m_asyncLogWriter.reset();
+
         for (auto& ctx : m_logContexts)
         {
             delete ctx;
@@ -175,6 +179,10 @@ namespace ramses_internal
             }
         }
 
+        ArgumentBool enableAsyncLog(parser, "la", "log-async", "write log messages from a background thread");
+        if (enableAsyncLog)
+            enableAsyncLogging();
+
         ArgumentBool enableSmokeTestContext(parser, "estc", "enableSmokeTestContext", "");
         if (!enableSmokeTestContext.wasDefined())
         {
@@ -183,7 +191,7 @@ namespace ramses_internal
         }
 
         LOG_INFO(CONTEXT_FRAMEWORK, "Ramses log levels: Contexts " << RamsesLogger::GetLogLevelText(logLevelContexts) <<
-                 ", Console " << RamsesLogger::GetLogLevelText(logLevelConsole));
+                 ", Console " << RamsesLogger::GetLogLevelText(logLevelConsole) << ", async " << isAsyncLoggingEnabled());
     }
 
     void RamsesLogger::applyContextFilterCommand(const String& command)
@@ -322,12 +330,54 @@ namespace ramses_internal
     {
         if (msg.getStream().size() > 0)
         {
-            std::lock_guard<std::mutex> guard(m_appenderLock);
-            for (auto& appender : m_logAppenders)
+            AsyncLogWriter* asyncLogWriter = m_activeAsyncLogWriter.load();
+            if (asyncLogWriter)
             {
-                appender->log(msg);
+                if (msg.getLogLevel() != ELogLevel::Fatal && asyncLogWriter->push(msg))
+                    return;
+                // fatal messages and messages not fitting into full queue are written synchronously, after everything queued before
+                asyncLogWriter->flush();
             }
+            writeToAppenders(msg);
+        }
+    }
+
+    void RamsesLogger::writeToAppenders(const LogMessage& msg)
+    {
+        std::lock_guard<std::mutex> guard(m_appenderLock);
+        for (auto& appender : m_logAppenders)
+        {
+            appender->log(msg);
+        }
+    }
+
+    void RamsesLogger::enableAsyncLogging(UInt32 queueCapacity)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_appenderLock);
+            if (m_asyncLogWriter)
+                return;
+            m_asyncLogWriter.reset(new AsyncLogWriter(queueCapacity, [this](const LogMessage& msg) { writeToAppenders(msg); }));
+            m_activeAsyncLogWriter = m_asyncLogWriter.get();
         }
+        LOG_INFO(CONTEXT_FRAMEWORK, "RamsesLogger::enableAsyncLogging: queue capacity " << m_asyncLogWriter->getCapacity());
+    }
+
+    bool RamsesLogger::isAsyncLoggingEnabled() const
+    {
+        return m_activeAsyncLogWriter.load() != nullptr;
+    }
+
+    void RamsesLogger::flushAsyncLogMessages()
+    {
+        if (AsyncLogWriter* asyncLogWriter = m_activeAsyncLogWriter.load())
+            asyncLogWriter->flush();
+    }
+
+    UInt64 RamsesLogger::getDroppedLogMessageCount() const
+    {
+        const AsyncLogWriter* asyncLogWriter = m_activeAsyncLogWriter.load();
+        return asyncLogWriter ? asyncLogWriter->getDroppedMessageCount() : 0u;
     }
 
     const char* RamsesLogger::GetLogLevelText(ELogLevel logLevel)
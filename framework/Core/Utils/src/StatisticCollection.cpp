@@ -54,6 +54,7 @@ namespace ramses_internal
         statResourcesReceivedNumber.reset();
         statResourcesLoadedFromFileNumber.reset();
         statResourcesLoadedFromFileSize.reset();
+        statMessageQueueingDelay.reset();
     }
 
     void StatisticCollectionFramework::resetSummaries()
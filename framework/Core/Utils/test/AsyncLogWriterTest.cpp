@@ -0,0 +1,194 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/AsyncLogWriter.h"
+#include "Utils/LogMessage.h"
+#include "Utils/LogContext.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <memory>
+#include <cstdint>
+
+namespace ramses_internal
+{
+    class AnAsyncLogWriter : public ::testing::Test
+    {
+    protected:
+        struct WrittenMessage
+        {
+            const LogContext* context;
+            ELogLevel logLevel;
+            std::string text;
+            UInt64 timestampMilliseconds;
+        };
+
+        AsyncLogWriter::WriteFunction createWriteFunction()
+        {
+            return [this](const LogMessage& msg)
+            {
+                std::lock_guard<std::mutex> guard(m_writtenLock);
+                m_written.push_back({ &msg.getContext(), msg.getLogLevel(), msg.getStream().data(), msg.getTimestampMilliseconds() });
+            };
+        }
+
+        bool push(AsyncLogWriter& writer, ELogLevel logLevel, const std::string& text)
+        {
+            const StringOutputStream stream(text);
+            return writer.push(LogMessage(m_context, logLevel, stream));
+        }
+
+        std::vector<WrittenMessage> getWritten()
+        {
+            std::lock_guard<std::mutex> guard(m_writtenLock);
+            return m_written;
+        }
+
+        LogContext m_context{ "test context", "TEST" };
+        std::mutex m_writtenLock;
+        std::vector<WrittenMessage> m_written;
+    };
+
+    TEST_F(AnAsyncLogWriter, roundsCapacityUpToPowerOfTwo)
+    {
+        AsyncLogWriter writer(100u, createWriteFunction());
+        EXPECT_EQ(128u, writer.getCapacity());
+    }
+
+    TEST_F(AnAsyncLogWriter, writesQueuedMessagesInOrderOnFlush)
+    {
+        AsyncLogWriter writer(16u, createWriteFunction());
+        EXPECT_TRUE(push(writer, ELogLevel::Info, "first"));
+        EXPECT_TRUE(push(writer, ELogLevel::Error, "second"));
+        writer.flush();
+
+        const auto written = getWritten();
+        ASSERT_EQ(2u, written.size());
+        EXPECT_EQ(&m_context, written[0].context);
+        EXPECT_EQ(ELogLevel::Info, written[0].logLevel);
+        EXPECT_EQ("first", written[0].text);
+        EXPECT_EQ(ELogLevel::Error, written[1].logLevel);
+        EXPECT_EQ("second", written[1].text);
+    }
+
+    TEST_F(AnAsyncLogWriter, writesMessagesWithTimestampOfPushNotOfWrite)
+    {
+        AsyncLogWriter writer(16u, createWriteFunction());
+        const StringOutputStream stream(std::string("msg"));
+        EXPECT_TRUE(writer.push(LogMessage(m_context, ELogLevel::Info, stream, 1234u)));
+        writer.flush();
+
+        const auto written = getWritten();
+        ASSERT_EQ(1u, written.size());
+        EXPECT_EQ(1234u, written[0].timestampMilliseconds);
+    }
+
+    TEST_F(AnAsyncLogWriter, canBeCreatedOnHeapWithPositionsOnSeparateCacheLines)
+    {
+        std::unique_ptr<AsyncLogWriter> writer(new AsyncLogWriter(16u, createWriteFunction()));
+        EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(writer.get()) % alignof(AsyncLogWriter));
+        EXPECT_TRUE(push(*writer, ELogLevel::Info, "msg"));
+        writer.reset();
+        EXPECT_EQ(1u, getWritten().size());
+    }
+
+    TEST_F(AnAsyncLogWriter, writesQueuedMessagesFromBackgroundThread)
+    {
+        AsyncLogWriter writer(16u, createWriteFunction());
+        EXPECT_TRUE(push(writer, ELogLevel::Info, "msg"));
+
+        for (int i = 0; i < 500 && getWritten().empty(); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_EQ(1u, getWritten().size());
+    }
+
+    TEST_F(AnAsyncLogWriter, writesQueuedMessagesWhenDestroyed)
+    {
+        {
+            AsyncLogWriter writer(16u, createWriteFunction());
+            for (int i = 0; i < 10; ++i)
+                push(writer, ELogLevel::Debug, "msg");
+        }
+        EXPECT_EQ(10u, getWritten().size());
+    }
+
+    TEST_F(AnAsyncLogWriter, dropsAndReportsInfoMessagesWhenFullButRejectsWarningsAndErrors)
+    {
+        // block writing so that queue cannot be emptied by background thread
+        std::vector<std::string> written;
+        std::mutex blockLock;
+        AsyncLogWriter blockedWriter(2u, [&](const LogMessage& msg)
+            {
+                std::lock_guard<std::mutex> guard(blockLock);
+                written.push_back(msg.getStream().data());
+            });
+
+        {
+            std::lock_guard<std::mutex> guard(blockLock);
+            // first message may be taken by background thread which then blocks, fill until queue is full
+            UInt32 queued = 0u;
+            while (blockedWriter.getDroppedMessageCount() == 0u)
+            {
+                EXPECT_TRUE(push(blockedWriter, ELogLevel::Info, "info"));
+                ++queued;
+                ASSERT_GT(10u, queued);
+            }
+            EXPECT_FALSE(push(blockedWriter, ELogLevel::Warn, "warn"));
+            EXPECT_FALSE(push(blockedWriter, ELogLevel::Error, "error"));
+            EXPECT_TRUE(push(blockedWriter, ELogLevel::Trace, "trace"));
+            EXPECT_EQ(2u, blockedWriter.getDroppedMessageCount());
+        }
+
+        blockedWriter.flush();
+        std::lock_guard<std::mutex> guard(blockLock);
+        ASSERT_FALSE(written.empty());
+        EXPECT_NE(std::string::npos, written.back().find("dropped 2 log messages"));
+    }
+
+    TEST_F(AnAsyncLogWriter, writesAllMessagesFromConcurrentProducers)
+    {
+        constexpr int ThreadCount = 4;
+        constexpr int MessagesPerThread = 2000;
+        {
+            AsyncLogWriter writer(64u, createWriteFunction());
+            std::vector<std::thread> producers;
+            for (int t = 0; t < ThreadCount; ++t)
+            {
+                producers.emplace_back([&, t]()
+                    {
+                        for (int i = 0; i < MessagesPerThread; ++i)
+                        {
+                            // warnings are never dropped, write synchronously like the logger does when queue is full
+                            const StringOutputStream stream(std::to_string(t) + ":" + std::to_string(i));
+                            const LogMessage msg(m_context, ELogLevel::Warn, stream);
+                            if (!writer.push(msg))
+                            {
+                                writer.flush();
+                                createWriteFunction()(msg);
+                            }
+                        }
+                    });
+            }
+            for (auto& producer : producers)
+                producer.join();
+        }
+
+        const auto written = getWritten();
+        ASSERT_EQ(static_cast<size_t>(ThreadCount * MessagesPerThread), written.size());
+
+        // messages of each producer keep their order
+        std::vector<int> nextIndex(ThreadCount, 0);
+        for (const auto& msg : written)
+        {
+            const auto separator = msg.text.find(':');
+            const int thread = std::stoi(msg.text.substr(0, separator));
+            const int index = std::stoi(msg.text.substr(separator + 1));
+            EXPECT_EQ(nextIndex[thread], index);
+            nextIndex[thread] = index + 1;
+        }
+    }
+}
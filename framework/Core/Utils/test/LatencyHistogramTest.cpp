@@ -0,0 +1,159 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/LatencyHistogram.h"
+#include "Collections/StringOutputStream.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace ramses_internal
+{
+    class ALatencyHistogram : public ::testing::Test
+    {
+    protected:
+        LatencyHistogram histogram;
+    };
+
+    TEST_F(ALatencyHistogram, isEmptyInitially)
+    {
+        EXPECT_EQ(0u, histogram.getCount());
+        EXPECT_EQ(0u, histogram.getMaxValue());
+        EXPECT_EQ(0u, histogram.getPercentile(50.f));
+    }
+
+    TEST_F(ALatencyHistogram, reportsExactPercentilesForSmallValues)
+    {
+        for (UInt64 value = 1u; value <= 60u; ++value)
+            histogram.record(value);
+
+        EXPECT_EQ(60u, histogram.getCount());
+        EXPECT_EQ(30u, histogram.getPercentile(50.f));
+        EXPECT_EQ(57u, histogram.getPercentile(95.f));
+        EXPECT_EQ(60u, histogram.getPercentile(100.f));
+        EXPECT_EQ(1u, histogram.getPercentile(0.f));
+        EXPECT_EQ(60u, histogram.getMaxValue());
+    }
+
+    TEST_F(ALatencyHistogram, reportsLargeValuesWithLimitedRelativeError)
+    {
+        const UInt64 values[] = { 100u, 1000u, 12345u, 999999u, 123456789u };
+        for (const auto value : values)
+        {
+            histogram.reset();
+            histogram.record(value);
+            histogram.record(value + 1000000000u);
+
+            const UInt64 percentile = histogram.getPercentile(50.f);
+            EXPECT_LE(value, percentile);
+            EXPECT_GE(value + value / 32u, percentile);
+        }
+    }
+
+    TEST_F(ALatencyHistogram, revealsSpikesHiddenByAverage)
+    {
+        for (UInt32 i = 0u; i < 990u; ++i)
+            histogram.record(16000u);
+        for (UInt32 i = 0u; i < 10u; ++i)
+            histogram.record(100000u);
+
+        EXPECT_GE(16500u, histogram.getPercentile(50.f));
+        EXPECT_GE(16500u, histogram.getPercentile(99.f));
+        EXPECT_LE(98000u, histogram.getPercentile(99.5f));
+        EXPECT_EQ(100000u, histogram.getMaxValue());
+    }
+
+    TEST_F(ALatencyHistogram, clampsValuesOutOfRange)
+    {
+        histogram.record(std::numeric_limits<UInt64>::max());
+        EXPECT_EQ(LatencyHistogram::MaxTrackedValue, histogram.getMaxValue());
+        EXPECT_EQ(LatencyHistogram::MaxTrackedValue, histogram.getPercentile(50.f));
+    }
+
+    TEST_F(ALatencyHistogram, canBeReset)
+    {
+        histogram.record(5u);
+        histogram.reset();
+        EXPECT_EQ(0u, histogram.getCount());
+        EXPECT_EQ(0u, histogram.getMaxValue());
+        EXPECT_EQ(0u, histogram.getPercentile(99.f));
+    }
+
+    TEST_F(ALatencyHistogram, movesRecordedValuesToOtherHistogram)
+    {
+        LatencyHistogram target;
+        target.record(1000u);
+        histogram.record(5u);
+        histogram.record(7u);
+
+        histogram.moveTo(target);
+        EXPECT_EQ(0u, histogram.getCount());
+        EXPECT_EQ(0u, histogram.getMaxValue());
+        EXPECT_EQ(2u, target.getCount());
+        EXPECT_EQ(7u, target.getMaxValue());
+        EXPECT_EQ(5u, target.getPercentile(50.f));
+
+        histogram.record(3u);
+        EXPECT_EQ(1u, histogram.getCount());
+        EXPECT_EQ(3u, histogram.getMaxValue());
+    }
+
+    TEST_F(ALatencyHistogram, writesPercentilesAndMax)
+    {
+        for (UInt64 value = 1u; value <= 40u; ++value)
+            histogram.record(value);
+
+        StringOutputStream str;
+        histogram.writePercentilesToStream(str);
+        EXPECT_STREQ("20/38/40/40", str.c_str());
+    }
+
+    TEST_F(ALatencyHistogram, countsValuesRecordedFromSeveralThreads)
+    {
+        std::vector<std::thread> threads;
+        for (UInt64 t = 0u; t < 4u; ++t)
+        {
+            threads.emplace_back([this, t]()
+                {
+                    for (UInt64 i = 0u; i < 10000u; ++i)
+                        histogram.record(t * 1000u + i % 100u);
+                });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        EXPECT_EQ(40000u, histogram.getCount());
+        EXPECT_EQ(3099u, histogram.getMaxValue());
+    }
+
+    TEST_F(ALatencyHistogram, doesNotLoseValuesMovedOutWhileRecording)
+    {
+        std::atomic<bool> recording(true);
+        std::thread recorder([this, &recording]()
+            {
+                for (UInt64 i = 0u; i < 100000u; ++i)
+                    histogram.record(i % 100u);
+                recording = false;
+            });
+
+        UInt64 movedCount = 0u;
+        LatencyHistogram summary;
+        while (recording)
+        {
+            histogram.moveTo(summary);
+            movedCount += summary.getCount();
+        }
+        recorder.join();
+        histogram.moveTo(summary);
+        movedCount += summary.getCount();
+
+        EXPECT_EQ(100000u, movedCount);
+        EXPECT_EQ(0u, histogram.getCount());
+    }
+}
@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/File.h"
+#include "Utils/BinaryFileOutputStream.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+
+namespace ramses_internal
+{
+    TEST(AMemoryMappedFile, mapsContentOfExistingFile)
+    {
+        const Char data[] = "some data to map";
+        {
+            File file("mappedFile");
+            BinaryFileOutputStream stream(file);
+            stream.write(data, sizeof(data));
+        }
+
+        MemoryMappedFile mapped("mappedFile");
+        ASSERT_TRUE(mapped.isMapped());
+        ASSERT_EQ(sizeof(data), mapped.getSize());
+        EXPECT_EQ(0, PlatformMemory::Compare(data, mapped.getData(), sizeof(data)));
+
+        mapped.prefetch(2u, 5u);
+        mapped.prefetch(100u, 5u);
+    }
+
+    TEST(AMemoryMappedFile, isNotMappedForNonExistingFile)
+    {
+        MemoryMappedFile mapped("thisFileDoesNotExist");
+        EXPECT_FALSE(mapped.isMapped());
+        EXPECT_EQ(nullptr, mapped.getData());
+        EXPECT_EQ(0u, mapped.getSize());
+    }
+
+    TEST(AMemoryMappedFile, isNotMappedForEmptyFile)
+    {
+        File file("emptyMappedFile");
+        file.createFile();
+
+        MemoryMappedFile mapped("emptyMappedFile");
+        EXPECT_FALSE(mapped.isMapped());
+    }
+
+    TEST(AMemoryMappedFile, detectsSameFileReachedViaDifferentPath)
+    {
+        const Char data[] = "some data to map";
+        for (const auto name : { "mappedFile", "otherMappedFile" })
+        {
+            File file(name);
+            BinaryFileOutputStream stream(file);
+            stream.write(data, sizeof(data));
+        }
+
+        MemoryMappedFile mapped("mappedFile");
+        ASSERT_TRUE(mapped.isMapped());
+        EXPECT_TRUE(mapped.isMappingOf("mappedFile"));
+        EXPECT_TRUE(mapped.isMappingOf("./mappedFile"));
+        EXPECT_FALSE(mapped.isMappingOf("otherMappedFile"));
+        EXPECT_FALSE(mapped.isMappingOf("thisFileDoesNotExist"));
+
+        MemoryMappedFile notMapped("thisFileDoesNotExist");
+        EXPECT_FALSE(notMapped.isMappingOf("thisFileDoesNotExist"));
+    }
+}
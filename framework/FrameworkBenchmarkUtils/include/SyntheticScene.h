@@ -0,0 +1,40 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SYNTHETICSCENE_H
+#define RAMSES_SYNTHETICSCENE_H
+
+#include "SceneAPI/IScene.h"
+#include "SceneAPI/Handles.h"
+#include "benchmark/benchmark.h"
+
+namespace ramses_internal
+{
+    class SceneActionCollection;
+
+    namespace SyntheticScene
+    {
+        // Environment variable with a comma separated list of scene sizes (e.g. "1000,50000"),
+        // overrides the default sizes of all benchmarks using SceneSizes
+        static const char* const SceneSizesEnvVar = "RAMSES_BENCHMARK_SCENE_SIZES";
+
+        // Registers the scene sizes a benchmark runs with, to be used as BENCHMARK(...)->Apply(SyntheticScene::SceneSizes)
+        void SceneSizes(benchmark::internal::Benchmark* bench);
+
+        // Fills an empty scene with nodeCount nodes forming a balanced tree with fan-out 4,
+        // each node has a transform and a renderable with its own uniform data instance.
+        // Renderables are distributed over render groups of 64 renderables and render passes of 16 groups,
+        // all passes render with the same camera. Works for scenes with explicit memory pools (uses explicit handles).
+        void Create(IScene& scene, UInt32 nodeCount);
+
+        // Writes a typical update flush for a scene created by Create: one translation and one uniform change per node
+        void WriteUpdates(SceneActionCollection& collection, UInt32 nodeCount, Float value);
+    }
+}
+
+#endif
@@ -0,0 +1,129 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "Scene/SceneActionCollection.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "Math3d/Vector3.h"
+#include "Math3d/Vector4.h"
+#include "SceneAPI/DataFieldInfo.h"
+#include "SceneAPI/SceneSizeInformation.h"
+#include "SceneAPI/ERenderableDataSlotType.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include "PlatformAbstraction/PlatformEnvironmentVariables.h"
+#include "Utils/StringUtils.h"
+#include <cstdlib>
+
+namespace ramses_internal
+{
+    namespace SyntheticScene
+    {
+        static const UInt32 FanOut = 4u;
+        static const UInt32 RenderablesPerGroup = 64u;
+        static const UInt32 GroupsPerPass = 16u;
+
+        void SceneSizes(benchmark::internal::Benchmark* bench)
+        {
+            String sizes;
+            if (PlatformEnvironmentVariables::get(SceneSizesEnvVar, sizes) && !sizes.empty())
+            {
+                StringVector tokens;
+                StringUtils::Tokenize(sizes, tokens, ',');
+                for (const auto& token : tokens)
+                {
+                    const auto size = std::strtoul(token.c_str(), nullptr, 10);
+                    if (size > 0u)
+                        bench->Arg(static_cast<int64_t>(size));
+                }
+            }
+            else
+            {
+                bench->RangeMultiplier(4)->Range(256, 16384);
+            }
+            bench->Unit(benchmark::kMicrosecond);
+        }
+
+        void Create(IScene& scene, UInt32 nodeCount)
+        {
+            const UInt32 groupCount = (nodeCount + RenderablesPerGroup - 1u) / RenderablesPerGroup;
+            const UInt32 passCount = (groupCount + GroupsPerPass - 1u) / GroupsPerPass;
+
+            // explicit handles and preallocation so that scenes with explicit memory pools can be filled as well
+            SceneSizeInformation sizeInfo;
+            sizeInfo.nodeCount = nodeCount;
+            sizeInfo.transformCount = nodeCount;
+            sizeInfo.renderableCount = nodeCount;
+            sizeInfo.cameraCount = 1u;
+            sizeInfo.datalayoutCount = 2u;
+            sizeInfo.datainstanceCount = nodeCount + 1u;
+            sizeInfo.renderGroupCount = groupCount;
+            sizeInfo.renderPassCount = passCount;
+            scene.preallocateSceneSize(sizeInfo);
+
+            DataFieldInfoVector dataFields;
+            dataFields.push_back(DataFieldInfo(EDataType_Vector4F));
+            dataFields.push_back(DataFieldInfo(EDataType_Matrix44F));
+            const DataLayoutHandle layout = scene.allocateDataLayout(dataFields, ResourceContentHash(0x1234u, 0u), DataLayoutHandle(0u));
+
+            DataFieldInfoVector viewportFields;
+            viewportFields.push_back(DataFieldInfo(EDataType_Vector2I));
+            viewportFields.push_back(DataFieldInfo(EDataType_Vector2I));
+            const DataLayoutHandle viewportLayout = scene.allocateDataLayout(viewportFields, ResourceContentHash::Invalid(), DataLayoutHandle(1u));
+            const DataInstanceHandle viewport = scene.allocateDataInstance(viewportLayout, DataInstanceHandle(nodeCount));
+
+            for (UInt32 i = 0u; i < nodeCount; ++i)
+                scene.allocateNode(0u, NodeHandle(i));
+            const CameraHandle camera = scene.allocateCamera(ECameraProjectionType_Perspective, NodeHandle(0u), viewport, CameraHandle(0u));
+
+            for (UInt32 passIdx = 0u; passIdx < passCount; ++passIdx)
+            {
+                const RenderPassHandle pass = scene.allocateRenderPass(GroupsPerPass, RenderPassHandle(passIdx));
+                scene.setRenderPassCamera(pass, camera);
+                scene.setRenderPassRenderOrder(pass, -static_cast<Int32>(passIdx));
+            }
+            for (UInt32 groupIdx = 0u; groupIdx < groupCount; ++groupIdx)
+            {
+                const RenderGroupHandle group = scene.allocateRenderGroup(RenderablesPerGroup, 0u, RenderGroupHandle(groupIdx));
+                scene.addRenderGroupToRenderPass(RenderPassHandle(groupIdx / GroupsPerPass), group, static_cast<Int32>(groupCount - groupIdx));
+            }
+
+            for (UInt32 i = 0u; i < nodeCount; ++i)
+            {
+                const NodeHandle node(i);
+                if (i > 0u)
+                    scene.addChildToNode(NodeHandle((i - 1u) / FanOut), node);
+
+                const TransformHandle transform = scene.allocateTransform(node, TransformHandle(i));
+                const Float value = static_cast<Float>(i % 100u);
+                scene.setTranslation(transform, Vector3(value, -value, 0.5f * value));
+                scene.setRotation(transform, Vector3(0.f, value, 0.f));
+
+                const DataInstanceHandle uniforms = scene.allocateDataInstance(layout, DataInstanceHandle(i));
+                scene.setDataSingleVector4f(uniforms, DataFieldHandle(0u), Vector4(value));
+
+                const RenderableHandle renderable = scene.allocateRenderable(node, RenderableHandle(i));
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+                scene.setRenderableIndexCount(renderable, 36u);
+
+                // pseudo random order within group so that sorting has work to do
+                scene.addRenderableToRenderGroup(RenderGroupHandle(i / RenderablesPerGroup), renderable, static_cast<Int32>((i * 7919u) % nodeCount));
+            }
+        }
+
+        void WriteUpdates(SceneActionCollection& collection, UInt32 nodeCount, Float value)
+        {
+            SceneActionCollectionCreator creator(collection);
+            const Vector4 color(value);
+            for (UInt32 i = 0u; i < nodeCount; ++i)
+            {
+                creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(i), Vector3(value, 0.f, -value));
+                creator.setDataVector4fArray(DataInstanceHandle(i), DataFieldHandle(0u), 1u, &color);
+            }
+        }
+    }
+}
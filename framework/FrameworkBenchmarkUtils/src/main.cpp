@@ -0,0 +1,22 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/RamsesLogger.h"
+#include "benchmark/benchmark.h"
+
+int main(int argc, char** argv)
+{
+    // keep log output out of machine readable results (e.g. --benchmark_format=json)
+    ramses_internal::GetRamsesLogger().setConsoleLogLevel(ramses_internal::ELogLevel::Off);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -13,21 +13,133 @@
 #include "PlatformAbstraction/PlatformError.h"
 #include "PlatformAbstraction/Hash.h"
 #include "PlatformAbstraction/PlatformMemory.h"
+#include <cassert>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <new>
 #include <algorithm>
+#include <utility>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace ramses_internal
 {
+    namespace internal
+    {
+        // Control bytes and group matching of HashMap, groups of 8 control bytes are matched at once using
+        // plain 64 bit integer arithmetic so that no particular instruction set is required.
+        namespace HashMapControl
+        {
+            // full slots store the lower 7 bits of the hash (0..127), all other states are negative
+            static const int8_t Empty = -128;
+            static const int8_t Deleted = -2;
+            static const int8_t Sentinel = -1;
+
+            static const size_t GroupSize = 8u;
+
+            inline uint32_t CountTrailingZeros(uint64_t value)
+            {
+                assert(value != 0u);
+#if defined(_MSC_VER) && defined(_WIN64)
+                unsigned long index = 0;
+                _BitScanForward64(&index, value);
+                return static_cast<uint32_t>(index);
+#elif defined(_MSC_VER)
+                unsigned long index = 0;
+                if (_BitScanForward(&index, static_cast<unsigned long>(value)))
+                    return static_cast<uint32_t>(index);
+                _BitScanForward(&index, static_cast<unsigned long>(value >> 32u));
+                return static_cast<uint32_t>(index) + 32u;
+#else
+                return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+            }
+
+            // mixes the bits of std::hash results, which often is identity for integral types
+            inline uint64_t MixHash(size_t hash)
+            {
+                uint64_t h = static_cast<uint64_t>(hash);
+                h ^= h >> 33u;
+                h *= 0xff51afd7ed558ccdull;
+                h ^= h >> 33u;
+                return h;
+            }
+
+            class Group
+            {
+            public:
+                explicit Group(const int8_t* pos)
+                {
+                    std::memcpy(&m_ctrl, pos, sizeof(m_ctrl));
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                    m_ctrl = __builtin_bswap64(m_ctrl);
+#endif
+                }
+
+                // bitmask with highest bit of every byte set that may store given hash part (false positives possible)
+                uint64_t match(int8_t h2) const
+                {
+                    const uint64_t x = m_ctrl ^ (Lsbs * static_cast<uint8_t>(h2));
+                    return (x - Lsbs) & ~x & Msbs;
+                }
+
+                uint64_t matchEmpty() const
+                {
+                    return (m_ctrl & (~m_ctrl << 6u)) & Msbs;
+                }
+
+                uint64_t matchEmptyOrDeleted() const
+                {
+                    return (m_ctrl & (~m_ctrl << 7u)) & Msbs;
+                }
+
+                // number of empty or deleted slots at group start, full slots and sentinel end the count
+                size_t countLeadingEmptyOrDeleted() const
+                {
+                    const uint64_t fullOrSentinel = ~matchEmptyOrDeleted() & Msbs;
+                    return fullOrSentinel != 0u ? IndexOfLowestMatch(fullOrSentinel) : GroupSize;
+                }
+
+                static size_t IndexOfLowestMatch(uint64_t mask)
+                {
+                    return CountTrailingZeros(mask) >> 3u;
+                }
+
+            private:
+                static const uint64_t Lsbs = 0x0101010101010101ull;
+                static const uint64_t Msbs = 0x8080808080808080ull;
+
+                uint64_t m_ctrl;
+            };
+
+            inline int8_t* EmptyControl()
+            {
+                // shared by all maps without allocated slots, begin() == end() and lookups end right away
+                static int8_t emptyControl[GroupSize] = { Sentinel, Sentinel, Sentinel, Sentinel, Sentinel, Sentinel, Sentinel, Sentinel };
+                return emptyControl;
+            }
+        }
+    }
+
     /**
      * Table object container where keys are found and retrieved via hashs.
+     *
+     * Open addressing hash table (swiss table like): key/value pairs are stored inline in one array of slots,
+     * a separate array holds one control byte per slot with 7 bits of the hash of full slots, which are probed
+     * in groups of 8 before any key is compared. Lookups of non-existing keys rarely touch the slots at all.
+     *
+     * Iterators and references stay valid on insertion without rehash and on removal of other elements.
+     * Iteration order is unspecified.
      */
     template <class Key, class T>
     class HashMap final
     {
     public:
-        /// defines the threshold after which the list will get resized.
+        /// defines the threshold after which the table will get resized (3/4 of all slots are usable).
         static const double DefaultHashMapMaxLoadFactor;
 
         /// defines the capacity to use for hash tablesize
@@ -44,35 +156,24 @@ namespace ramses_internal
 
             const Key key;
             T value;
-        };
 
-    private:
-        /**
-         * Data structure to hold a key/value pair inside the hash table
-         */
-        class HashMapEntry
-        {
-        public:
-            HashMapEntry()
-                : next(nullptr)
-                , previous(nullptr)
-                , isChainElement(false)
-            {
-                // 'preconnect' free entries
-                next = this + 1;
-            }
+        private:
+            struct InPlace {};
 
-            void constructKeyValue(const Key& key, const T& value)
+            template <typename KeyArg, typename... Args>
+            Pair(InPlace, KeyArg&& key_, Args&&... args)
+                : key(std::forward<KeyArg>(key_))
+                , value(std::forward<Args>(args)...)
             {
-                // placement new
-                new (keyValuePairMemory) Pair(key, value);
             }
 
-            void destructKeyValue()
-            {
-                // inplace destruction of typed value
-                reinterpret_cast<Pair*>(keyValuePairMemory)->~Pair();
-            }
+            friend class HashMap<Key, T>;
+        };
+
+    private:
+        struct Slot
+        {
+            alignas(Pair) char keyValuePairMemory[sizeof(Pair)];  // properly aligned memory for key and value
 
             Pair& getKeyValuePair()
             {
@@ -83,18 +184,22 @@ namespace ramses_internal
             {
                 return *reinterpret_cast<const Pair*>(keyValuePairMemory);
             }
+        };
 
-            HashMapEntry(const HashMapEntry& other)  = delete;
-            HashMapEntry& operator=(const HashMapEntry& other) = delete;
-
-        private:
-            HashMapEntry* next; // pointer to the next entry (chaining)
-            HashMapEntry* previous; // pointer to the previous entry (chaining)
-            alignas(Pair) char keyValuePairMemory[sizeof(Pair)];  // properly aligned memory for key and value
-            bool isChainElement; // true if the element is not the first element in a chain
+        // advances given control byte and slot to the next full slot or to the end sentinel
+        static void SkipEmptySlots(const int8_t*& ctrl, Slot*& slot)
+        {
+            // control bytes are followed by a group of sentinels, so whole groups can be read up to the end
+            while (*ctrl < internal::HashMapControl::Sentinel)
+            {
+                const size_t skip = internal::HashMapControl::Group(ctrl).countLeadingEmptyOrDeleted();
+                ctrl += skip;
+                slot += skip;
+            }
+        }
 
-            friend class HashMap<Key, T>;
-        };
+        template <typename K>
+        using EnableHeterogeneousKey = decltype(sizeof(HeterogeneousKeyHash<Key, typename std::decay<const K>::type>));
 
     public:
         class ConstIterator
@@ -104,24 +209,11 @@ namespace ramses_internal
             friend class HashMap;
             friend class Iterator;
 
-            /**
-             * Constructor.
-             * @param begin Pointer to the entry on which iteration should start.
-             * @param end Pointer to an entry on which iteration should end (if begin == end).
-             */
-            ConstIterator(HashMapEntry* begin)
-                : mCurrentHashMapEntry(begin)
-            {
-            }
-
             /**
              * Copy Constructor.
              * @param iter non-const iterator to copy
              */
-            ConstIterator(const ConstIterator& iter)
-                : mCurrentHashMapEntry(iter.mCurrentHashMapEntry)
-            {
-            }
+            ConstIterator(const ConstIterator& iter) = default;
 
             ConstIterator& operator=(const ConstIterator&) = default;
 
@@ -131,7 +223,7 @@ namespace ramses_internal
              */
             const Pair& operator*() const
             {
-                return mCurrentHashMapEntry->getKeyValuePair();
+                return mSlot->getKeyValuePair();
             }
 
             /**
@@ -140,7 +232,7 @@ namespace ramses_internal
              */
             const Pair* operator->() const
             {
-                return &mCurrentHashMapEntry->getKeyValuePair();
+                return &mSlot->getKeyValuePair();
             }
 
             /**
@@ -149,7 +241,7 @@ namespace ramses_internal
              */
             bool operator==(const ConstIterator& iter) const
             {
-                return (mCurrentHashMapEntry == iter.mCurrentHashMapEntry);
+                return (mCtrl == iter.mCtrl);
             }
 
             /**
@@ -158,7 +250,7 @@ namespace ramses_internal
              */
             bool operator!=(const ConstIterator& iter) const
             {
-                return (mCurrentHashMapEntry != iter.mCurrentHashMapEntry);
+                return (mCtrl != iter.mCtrl);
             }
 
             /**
@@ -167,7 +259,9 @@ namespace ramses_internal
              */
             ConstIterator& operator++()
             {
-                mCurrentHashMapEntry = mCurrentHashMapEntry->next;
+                ++mCtrl;
+                ++mSlot;
+                SkipEmptySlots(mCtrl, mSlot);
                 return *this;
             }
 
@@ -183,8 +277,16 @@ namespace ramses_internal
             }
 
         private:
-            HashMapEntry* mCurrentHashMapEntry;
+            ConstIterator(const int8_t* ctrl, Slot* slot)
+                : mCtrl(ctrl)
+                , mSlot(slot)
+            {
+            }
+
+            const int8_t* mCtrl;
+            Slot* mSlot;
         };
+
         /**
          * Internal helper class to perform iterations over the map entries.
          */
@@ -194,31 +296,19 @@ namespace ramses_internal
 
             friend class HashMap;
 
-            /**
-             * Constructor.
-             * @param begin Pointer to the entry on which iteration should start.
-             * @param end Pointer to an entry on which iteration should end (if begin == end).
-             */
-            Iterator(HashMapEntry* begin)
-                : mCurrentHashMapEntry(begin)
-            {
-            }
-
             /**
              * Copy Constructor.
              * @param iter non-const iterator to copy
              */
-            Iterator(const Iterator& iter)
-                : mCurrentHashMapEntry(iter.mCurrentHashMapEntry)
-            {
-            }
+            Iterator(const Iterator& iter) = default;
 
             /**
              * Convert Constructor
              * @param iter ConstIterator to convert from
              */
             Iterator(const ConstIterator& iter)
-                : mCurrentHashMapEntry(iter.mCurrentHashMapEntry)
+                : mCtrl(iter.mCtrl)
+                , mSlot(iter.mSlot)
             {
             }
 
@@ -230,12 +320,12 @@ namespace ramses_internal
              */
             Pair& operator*()
             {
-                return mCurrentHashMapEntry->getKeyValuePair();
+                return mSlot->getKeyValuePair();
             }
 
             const Pair& operator*() const
             {
-                return mCurrentHashMapEntry->getKeyValuePair();
+                return mSlot->getKeyValuePair();
             }
 
             /**
@@ -244,12 +334,12 @@ namespace ramses_internal
              */
             Pair* operator->()
             {
-                return &mCurrentHashMapEntry->getKeyValuePair();
+                return &mSlot->getKeyValuePair();
             }
 
             const Pair* operator->() const
             {
-                return &mCurrentHashMapEntry->getKeyValuePair();
+                return &mSlot->getKeyValuePair();
             }
 
             /**
@@ -258,7 +348,7 @@ namespace ramses_internal
              */
             bool operator==(const Iterator& iter) const
             {
-                return (mCurrentHashMapEntry == iter.mCurrentHashMapEntry);
+                return (mCtrl == iter.mCtrl);
             }
 
             /**
@@ -267,7 +357,7 @@ namespace ramses_internal
              */
             bool operator!=(const Iterator& iter) const
             {
-                return (mCurrentHashMapEntry != iter.mCurrentHashMapEntry);
+                return (mCtrl != iter.mCtrl);
             }
 
             /**
@@ -276,7 +366,9 @@ namespace ramses_internal
              */
             Iterator& operator++()
             {
-                mCurrentHashMapEntry = mCurrentHashMapEntry->next;
+                ++mCtrl;
+                ++mSlot;
+                SkipEmptySlots(mCtrl, mSlot);
                 return *this;
             }
 
@@ -292,7 +384,14 @@ namespace ramses_internal
             }
 
         private:
-            HashMapEntry* mCurrentHashMapEntry;
+            Iterator(const int8_t* ctrl, Slot* slot)
+                : mCtrl(ctrl)
+                , mSlot(slot)
+            {
+            }
+
+            const int8_t* mCtrl;
+            Slot* mSlot;
         };
 
 
@@ -310,7 +409,7 @@ namespace ramses_internal
 
         /**
          * Constructor.
-         *                   return NO_MEMORY if too many items were added.
+         * @param capacity number of elements which can be put without rehashing
          */
         HashMap(const size_t capcity);
 
@@ -326,8 +425,29 @@ namespace ramses_internal
          * @return value Value referenced by key. If no value is stored for given key, a default constructed object is added and returned
          */
         T& operator[](const Key& key);
+        T& operator[](Key&& key);
 
+        /**
+         * Puts given value for given key, an existing value for the key gets overwritten.
+         * @return iterator to the element
+         */
         Iterator put(const Key& key, const T& value);
+        Iterator put(const Key& key, T&& value);
+        Iterator put(Key&& key, const T& value);
+        Iterator put(Key&& key, T&& value);
+
+        /**
+         * Constructs a value in place from given arguments if there is no value for given key yet.
+         * An existing value is not modified and the arguments are not used then.
+         *
+         * @param key   Key value
+         * @param args  Arguments for the constructor of the value
+         * @return iterator to the element with given key and true if the element was newly added
+         */
+        template <typename... Args>
+        std::pair<Iterator, bool> emplace(const Key& key, Args&&... args);
+        template <typename... Args>
+        std::pair<Iterator, bool> emplace(Key&& key, Args&&... args);
 
         EStatus get(const Key& key, T& value) const;
         T*      get(const Key& key) const;
@@ -354,6 +474,19 @@ namespace ramses_internal
          */
         ConstIterator find(const Key& key) const;
 
+        /**
+         * Heterogeneous lookup with a type other than Key without constructing a Key,
+         * only available if HeterogeneousKeyHash<Key, K> is specialized (see Hash.h).
+         */
+        template <typename K, typename = EnableHeterogeneousKey<K>>
+        Iterator find(const K& key);
+        template <typename K, typename = EnableHeterogeneousKey<K>>
+        ConstIterator find(const K& key) const;
+        template <typename K, typename = EnableHeterogeneousKey<K>>
+        bool contains(const K& key) const;
+        template <typename K, typename = EnableHeterogeneousKey<K>>
+        T* get(const K& key) const;
+
         /**
          * Checks weather the given key is present in the table.
          *
@@ -393,7 +526,7 @@ namespace ramses_internal
         size_t size() const;
 
         /**
-         * Clears all keys and values of the hashtable.
+         * Clears all keys and values of the hashtable, keeps the allocated memory.
          */
         void clear();
 
@@ -422,11 +555,14 @@ namespace ramses_internal
         ConstIterator end() const;
 
         /**
-         * Reserve space for given number of bits elements. Does nothing if the
+         * Reserve space for given number of elements. Does nothing if the
          * HashMap is already bigger.
          */
         void reserve(size_t capacity);
 
+        /**
+         * Number of elements which can be stored without rehashing
+         */
         size_t capacity() const;
 
         /**
@@ -445,24 +581,35 @@ namespace ramses_internal
         void swap(HashMap<Key, T>& other);
 
     private:
-        static uint8_t BitSizeFromElementCount(size_t count);
-
-        uint8_t mBitCount; // bit size for the hash function
-        size_t mSize; // the size of the data list
-        size_t mThreshold; // defines when a rehashing may occur
-        HashMapEntry** mBuckets; // bucket list
-        HashMapEntry* mData; // placeholder for the data
-        HashMapEntry* mLastHashMapEntry; // pointer to the last entry in the map
-        HashMapEntry* mFirstFreeHashMapEntry; // start of pointer list of free entries
-        size_t mCount; // the current entry count
-
-        void initializeLastEntry();
+        static size_t SlotCountForCapacity(size_t capacity);
+        static size_t CapacityForSlotCount(size_t slotCount);
+        static uint64_t CalcHashValue(const Key& key);
+
+        template <typename K>
+        size_t findIndex(const K& key, uint64_t hashValue) const;
+        size_t findFirstNonFull(uint64_t hashValue) const;
+        size_t prepareInsert(uint64_t hashValue);
+        template <typename KeyArg, typename... Args>
+        std::pair<Iterator, bool> emplaceImpl(KeyArg&& key, Args&&... args);
+        template <typename KeyArg, typename ValueArg>
+        Iterator putImpl(KeyArg&& key, ValueArg&& value);
+        void removeAt(size_t index, T* value_old);
+
+        void setCtrl(size_t index, int8_t h2);
+        void allocate(size_t slotCount);
+        void deallocate();
         void destructAll();
-        void rehash();
-        size_t calcHashValue(const Key& key) const;
-        HashMapEntry* internalGet(const Key& key) const;
-        void internalPut(HashMapEntry* entry, size_t hashValue);
-        void internalRemove(HashMapEntry* entry, const size_t hashValue, T* value_old = nullptr);
+        void rehash(size_t slotCount);
+        void rehashAndGrowIfNecessary();
+
+        Iterator iteratorAt(size_t index);
+        ConstIterator iteratorAt(size_t index) const;
+
+        int8_t* mCtrl; // one control byte per slot followed by one group of sentinels
+        Slot* mSlots; // key value pairs, valid where control byte is full
+        size_t mSlotCount; // 0 or power of 2, at least group size
+        size_t mCount; // the current entry count
+        size_t mGrowthLeft; // elements which can be added until rehash, removed elements count until rehash
     };
 
     /**
@@ -477,77 +624,49 @@ namespace ramses_internal
     }
 
     template <class Key, class T>
-    const double HashMap<Key, T>::DefaultHashMapMaxLoadFactor = 0.8;
+    const double HashMap<Key, T>::DefaultHashMapMaxLoadFactor = 0.75;
     template <class Key, class T>
-    const size_t HashMap<Key, T>::DefaultHashMapCapacity =
-        static_cast<size_t>(std::ceil(16 * HashMap<Key, T>::DefaultHashMapMaxLoadFactor));
+    const size_t HashMap<Key, T>::DefaultHashMapCapacity = 12u;
 
     template <class Key, class T>
     inline HashMap<Key, T>::HashMap()
-        : mBitCount(BitSizeFromElementCount(DefaultHashMapCapacity))
-        , mSize(static_cast<size_t>(1) << mBitCount)
-        , mThreshold(static_cast<size_t>(mSize * DefaultHashMapMaxLoadFactor))
-        , mBuckets(new HashMapEntry*[mSize])
-        , mData(new HashMapEntry[mThreshold + 1])  // One dummy for the end
-        , mLastHashMapEntry(mData + mThreshold)
-        , mFirstFreeHashMapEntry(mData)
-        , mCount(0)
+        : mCtrl(internal::HashMapControl::EmptyControl())
+        , mSlots(nullptr)
+        , mSlotCount(0u)
+        , mCount(0u)
+        , mGrowthLeft(0u)
     {
-        PlatformMemory::Set(mBuckets, 0, sizeof(HashMapEntry*) * mSize);
-        initializeLastEntry();
+    }
+
+    template <class Key, class T>
+    inline HashMap<Key, T>::HashMap(const size_t capacity)
+        : HashMap()
+    {
+        if (capacity > 0u)
+            allocate(SlotCountForCapacity(capacity));
     }
 
     template <class Key, class T>
     inline HashMap<Key, T>::HashMap(const HashMap<Key, T>& other)
-        : mBitCount(other.mBitCount)
-        , mSize(other.mSize)
-        , mThreshold(other.mThreshold)
-        , mBuckets(new HashMapEntry*[mSize])
-        , mData(new HashMapEntry[mThreshold + 1])  //One dummy for the end
-        , mLastHashMapEntry(mData + mThreshold)
-        , mFirstFreeHashMapEntry(mData)
-        , mCount(0) // will get increased by internalPut
-    {
-        PlatformMemory::Set(mBuckets, 0, sizeof(HashMapEntry*) * mSize);
-        initializeLastEntry();
-
-        // right here, we have an empty map with the exact same size as the given other table
-        // now we put each entry of the other map into this map (this may be a lot less than the actual size)
-
-        typename HashMap<Key, T>::ConstIterator iter = other.begin();
-        while (iter != other.end())
+        : HashMap(other.size())
+    {
+        for (const auto& entry : other)
         {
-            mFirstFreeHashMapEntry->constructKeyValue(iter->key, iter->value);
-            internalPut(mFirstFreeHashMapEntry, calcHashValue(iter->key));
-            ++iter;
-            ++mFirstFreeHashMapEntry;
+            const uint64_t hashValue = CalcHashValue(entry.key);
+            const size_t index = findFirstNonFull(hashValue);
+            new (mSlots[index].keyValuePairMemory) Pair(entry.key, entry.value);
+            setCtrl(index, static_cast<int8_t>(hashValue & 0x7Fu));
+            --mGrowthLeft;
+            ++mCount;
         }
     }
 
     template <class Key, class T>
     inline HashMap<Key, T>::HashMap(HashMap<Key, T>&& other) noexcept
-        // poor mans move because must HashMap cannot work with nullptr data
         : HashMap()
     {
         static_assert(std::is_nothrow_move_constructible<HashMap>::value, "HashMap must be movable");
-
         swap(other);
-        other.clear();
-    }
-
-    template <class Key, class T>
-    inline HashMap<Key, T>::HashMap(const size_t capacity)
-        : mBitCount(BitSizeFromElementCount(capacity))
-        , mSize(static_cast<size_t>(1) << mBitCount)
-        , mThreshold(static_cast<size_t>(mSize * DefaultHashMapMaxLoadFactor))
-        , mBuckets(new HashMapEntry*[mSize])
-        , mData(new HashMapEntry[mThreshold + 1])  //One dummy for the end
-        , mLastHashMapEntry(mData + mThreshold)
-        , mFirstFreeHashMapEntry(mData)
-        , mCount(0)
-    {
-        PlatformMemory::Set(mBuckets, 0, sizeof(HashMapEntry*) * mSize);
-        initializeLastEntry();
     }
 
     template <class Key, class T>
@@ -558,30 +677,8 @@ namespace ramses_internal
             // self assignment
             return *this;
         }
-        destructAll();
-
-        delete[] mBuckets;
-        delete[] mData;
-
-        mCount = 0;
-        mSize = other.mSize;
-        mBitCount = other.mBitCount;
-        mThreshold = other.mThreshold;
-        mBuckets = new HashMapEntry*[mSize];
-        mData    = new HashMapEntry[mThreshold + 1];
-
-        PlatformMemory::Set(mBuckets, 0, sizeof(HashMapEntry*) * mSize);
-        mFirstFreeHashMapEntry = mData;
-        mLastHashMapEntry = mData + mThreshold;
-        initializeLastEntry();
-
-        HashMap::ConstIterator iter = other.begin();
-        while (iter != other.end())
-        {
-            put(iter->key, iter->value);
-            ++iter;
-        }
-
+        HashMap<Key, T> tmp(other);
+        swap(tmp);
         return *this;
     }
 
@@ -604,8 +701,7 @@ namespace ramses_internal
     inline HashMap<Key, T>::~HashMap()
     {
         destructAll();
-        delete[] mBuckets;
-        delete[] mData;
+        deallocate();
     }
 
     template <class Key, class T>
@@ -617,68 +713,164 @@ namespace ramses_internal
     template <class Key, class T>
     inline bool HashMap<Key, T>::contains(const Key& key) const
     {
-        return internalGet(key) != nullptr;
+        return findIndex(key, CalcHashValue(key)) != mSlotCount;
     }
 
     template <class Key, class T>
-    inline size_t HashMap<Key, T>::calcHashValue(const Key& key) const
+    inline uint64_t HashMap<Key, T>::CalcHashValue(const Key& key)
     {
-        size_t hash = 0;
-        // hash and shuffle bits around a bit to counteract effect of truncating upper bits only
-        HashCombine(hash, key);
-        if (mBitCount < 8*sizeof(size_t))
-            hash &= ((static_cast<size_t>(1) << mBitCount) - 1);
-        return hash;
+        return internal::HashMapControl::MixHash(std::hash<Key>()(key));
     }
 
     template <class Key, class T>
-    inline T& HashMap<Key, T>::operator[](const Key& key)
+    template <typename K>
+    inline size_t HashMap<Key, T>::findIndex(const K& key, uint64_t hashValue) const
     {
-        if (HashMapEntry* entry = internalGet(key))
-            return entry->getKeyValuePair().value;
-        //if key is not in hash table, add default constructed value to it
-        return put(key, T())->value;
+        using namespace internal::HashMapControl;
+        if (mSlotCount == 0u)
+            return 0u;
+
+        const int8_t h2 = static_cast<int8_t>(hashValue & 0x7Fu);
+        const size_t groupMask = mSlotCount / GroupSize - 1u;
+        size_t group = static_cast<size_t>(hashValue >> 7u) & groupMask;
+        // triangular probing visits every group once for power of 2 group counts
+        for (size_t step = 1u; ; ++step)
+        {
+            const Group g(mCtrl + group * GroupSize);
+            for (uint64_t matches = g.match(h2); matches != 0u; matches &= matches - 1u)
+            {
+                const size_t index = group * GroupSize + Group::IndexOfLowestMatch(matches);
+                if (mSlots[index].getKeyValuePair().key == key)
+                    return index;
+            }
+            // a group with empty slot never overflowed into next group
+            if (g.matchEmpty() != 0u)
+                return mSlotCount;
+            group = (group + step) & groupMask;
+        }
     }
 
     template <class Key, class T>
-    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::put(const Key& key, const T& value)
+    inline size_t HashMap<Key, T>::findFirstNonFull(uint64_t hashValue) const
     {
-        size_t hashValue = calcHashValue(key);
+        using namespace internal::HashMapControl;
+        assert(mSlotCount > 0u);
 
-        // check if we already have the key in the map, if so, just override the value
-        HashMapEntry* current = mBuckets[hashValue];
-        if (current)
+        const size_t groupMask = mSlotCount / GroupSize - 1u;
+        size_t group = static_cast<size_t>(hashValue >> 7u) & groupMask;
+        for (size_t step = 1u; ; ++step)
         {
-            do
-            {
-                if (current->getKeyValuePair().key == key)
-                {
-                    current->getKeyValuePair().value = value;
-                    return Iterator(current);
-                }
-                current = current->next;
-            }
-            while (current->isChainElement);
+            const uint64_t nonFull = Group(mCtrl + group * GroupSize).matchEmptyOrDeleted();
+            if (nonFull != 0u)
+                return group * GroupSize + Group::IndexOfLowestMatch(nonFull);
+            group = (group + step) & groupMask;
         }
+    }
 
-        // check if the next free entry is outside of the threshold (resizing would be necessary)
-        if (mFirstFreeHashMapEntry == mData + mThreshold)
+    template <class Key, class T>
+    inline size_t HashMap<Key, T>::prepareInsert(uint64_t hashValue)
+    {
+        if (mSlotCount == 0u)
         {
-            rehash();
-            hashValue = calcHashValue(key); // calculate the new index (in the resized map)
+            allocate(SlotCountForCapacity(DefaultHashMapCapacity));
         }
 
-        // the entry holding the values is the first free entry
-        HashMapEntry* newentry = mFirstFreeHashMapEntry;
+        size_t index = findFirstNonFull(hashValue);
+        // reusing a deleted slot does not need any growth
+        if (mGrowthLeft == 0u && mCtrl[index] != internal::HashMapControl::Deleted)
+        {
+            rehashAndGrowIfNecessary();
+            index = findFirstNonFull(hashValue);
+        }
+
+        if (mCtrl[index] == internal::HashMapControl::Empty)
+            --mGrowthLeft;
+        setCtrl(index, static_cast<int8_t>(hashValue & 0x7Fu));
+        ++mCount;
+        return index;
+    }
+
+    template <class Key, class T>
+    template <typename KeyArg, typename... Args>
+    inline std::pair<typename HashMap<Key, T>::Iterator, bool> HashMap<Key, T>::emplaceImpl(KeyArg&& key, Args&&... args)
+    {
+        const uint64_t hashValue = CalcHashValue(key);
+        const size_t existing = findIndex(key, hashValue);
+        if (existing != mSlotCount)
+            return std::make_pair(iteratorAt(existing), false);
+
+        const size_t index = prepareInsert(hashValue);
+        new (mSlots[index].keyValuePairMemory) Pair(typename Pair::InPlace(), std::forward<KeyArg>(key), std::forward<Args>(args)...);
+        return std::make_pair(iteratorAt(index), true);
+    }
+
+    template <class Key, class T>
+    template <typename KeyArg, typename ValueArg>
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::putImpl(KeyArg&& key, ValueArg&& value)
+    {
+        const uint64_t hashValue = CalcHashValue(key);
+        const size_t existing = findIndex(key, hashValue);
+        if (existing != mSlotCount)
+        {
+            // we already have the key in the map, just override the value
+            mSlots[existing].getKeyValuePair().value = std::forward<ValueArg>(value);
+            return iteratorAt(existing);
+        }
+
+        const size_t index = prepareInsert(hashValue);
+        new (mSlots[index].keyValuePairMemory) Pair(typename Pair::InPlace(), std::forward<KeyArg>(key), std::forward<ValueArg>(value));
+        return iteratorAt(index);
+    }
+
+    template <class Key, class T>
+    inline T& HashMap<Key, T>::operator[](const Key& key)
+    {
+        //if key is not in hash table, add default constructed value to it
+        return emplaceImpl(key).first->value;
+    }
+
+    template <class Key, class T>
+    inline T& HashMap<Key, T>::operator[](Key&& key)
+    {
+        return emplaceImpl(std::move(key)).first->value;
+    }
+
+    template <class Key, class T>
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::put(const Key& key, const T& value)
+    {
+        return putImpl(key, value);
+    }
 
-        // adjust the pointer to the next free entry ('preconnected' through constructor)
-        mFirstFreeHashMapEntry = mFirstFreeHashMapEntry->next;
+    template <class Key, class T>
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::put(const Key& key, T&& value)
+    {
+        return putImpl(key, std::move(value));
+    }
 
-        newentry->constructKeyValue(key, value);
+    template <class Key, class T>
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::put(Key&& key, const T& value)
+    {
+        return putImpl(std::move(key), value);
+    }
 
-        internalPut(newentry, hashValue);
+    template <class Key, class T>
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::put(Key&& key, T&& value)
+    {
+        return putImpl(std::move(key), std::move(value));
+    }
 
-        return Iterator(newentry);
+    template <class Key, class T>
+    template <typename... Args>
+    inline std::pair<typename HashMap<Key, T>::Iterator, bool> HashMap<Key, T>::emplace(const Key& key, Args&&... args)
+    {
+        return emplaceImpl(key, std::forward<Args>(args)...);
+    }
+
+    template <class Key, class T>
+    template <typename... Args>
+    inline std::pair<typename HashMap<Key, T>::Iterator, bool> HashMap<Key, T>::emplace(Key&& key, Args&&... args)
+    {
+        return emplaceImpl(std::move(key), std::forward<Args>(args)...);
     }
 
     template<class Key, class T>
@@ -696,107 +888,105 @@ namespace ramses_internal
     inline
     T* HashMap<Key, T>::get(const Key& key) const
     {
-        auto iter = find(key);
-        if (iter != end())
-            return const_cast<T*>(&iter->value);   // TODO(tobias) constness is broken and has to be fixed
+        const size_t index = findIndex(key, CalcHashValue(key));
+        if (index != mSlotCount)
+            return &mSlots[index].getKeyValuePair().value;   // TODO(tobias) constness is broken and has to be fixed
         return nullptr;
     }
 
     template <class Key, class T>
-    typename HashMap<Key, T>::Iterator HashMap<Key, T>::find(const Key& key)
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::find(const Key& key)
     {
-        if (HashMapEntry* entry = internalGet(key))
-        {
-            // set new iterator to this position
-            Iterator it(entry);
-            return it;
-        }
+        return iteratorAt(findIndex(key, CalcHashValue(key)));
+    }
 
-        // no entry found -> return end iterator
-        return end();
+    template <class Key, class T>
+    inline typename HashMap<Key, T>::ConstIterator HashMap<Key, T>::find(const Key& key) const
+    {
+        return iteratorAt(findIndex(key, CalcHashValue(key)));
     }
 
     template <class Key, class T>
-    typename HashMap<Key, T>::ConstIterator HashMap<Key, T>::find(const Key& key) const
+    template <typename K, typename>
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::find(const K& key)
     {
-        if (HashMapEntry* entry = internalGet(key))
-        {
-            // set new iterator to this position
-            ConstIterator it(entry);
-            return it;
-        }
+        using Hasher = HeterogeneousKeyHash<Key, typename std::decay<const K>::type>;
+        return iteratorAt(findIndex(key, internal::HashMapControl::MixHash(Hasher()(key))));
+    }
+
+    template <class Key, class T>
+    template <typename K, typename>
+    inline typename HashMap<Key, T>::ConstIterator HashMap<Key, T>::find(const K& key) const
+    {
+        using Hasher = HeterogeneousKeyHash<Key, typename std::decay<const K>::type>;
+        return iteratorAt(findIndex(key, internal::HashMapControl::MixHash(Hasher()(key))));
+    }
 
-        // no entry found -> return end iterator
-        return end();
+    template <class Key, class T>
+    template <typename K, typename>
+    inline bool HashMap<Key, T>::contains(const K& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <class Key, class T>
+    template <typename K, typename>
+    inline T* HashMap<Key, T>::get(const K& key) const
+    {
+        auto iter = find(key);
+        if (iter != end())
+            return const_cast<T*>(&iter->value);
+        return nullptr;
     }
 
     template <class Key, class T>
     inline bool HashMap<Key, T>::remove(const Key& key, T* value_old)
     {
-        const size_t hashValue = calcHashValue(key);
-        HashMapEntry* current = mBuckets[hashValue];
-        if (current)
+        const size_t index = findIndex(key, CalcHashValue(key));
+        if (index == mSlotCount)
         {
-            do
-            {
-                if (current->getKeyValuePair().key == key)
-                {
-                    internalRemove(current, hashValue, value_old);
-
-                    // done
-                    return true;
-                }
-                current = current->next;
-            }
-            while (current->isChainElement);
+            // element was not found
+            return false;
         }
 
-        // element was not found
-        return false;
+        removeAt(index, value_old);
+        return true;
     }
 
     template <class Key, class T>
     inline
     typename HashMap<Key, T>::Iterator HashMap<Key, T>::remove(Iterator iter, T* value_old)
     {
-        HashMapEntry* current = iter.mCurrentHashMapEntry;
-        size_t hashValue = calcHashValue(current->getKeyValuePair().key);
-
-        auto result = current->next;
-        internalRemove(current, hashValue, value_old);
-        return result;
+        const size_t index = static_cast<size_t>(iter.mSlot - mSlots);
+        removeAt(index, value_old);
+        ++iter;
+        return iter;
     }
 
     template <class Key, class T>
-    inline void HashMap<Key, T>::internalRemove(HashMapEntry* entry, const size_t hashValue, T* value_old)
+    inline void HashMap<Key, T>::removeAt(size_t index, T* value_old)
     {
+        using namespace internal::HashMapControl;
+        Pair& pair = mSlots[index].getKeyValuePair();
         if (value_old)
         {
             // perform the copy operation into the old value
-            *value_old = entry->getKeyValuePair().value;
+            *value_old = std::move(pair.value);
         }
+        pair.~Pair();
 
-        // destruct the value
-        entry->destructKeyValue();
-
-        // change the pointer to point to the next element,
-        // so that the current element is taken out of the chain
-        entry->previous->next = entry->next;
-        entry->next->previous = entry->previous;
-        if (mBuckets[hashValue] == entry)
+        // slot can become empty again only if no probe sequence ever continued past its group,
+        // otherwise it must be marked deleted to keep lookups of other keys working
+        const size_t groupStart = index & ~(GroupSize - 1u);
+        if (Group(mCtrl + groupStart).matchEmpty() != 0u)
         {
-            mBuckets[hashValue] = entry->next->isChainElement ? entry->next : nullptr;
-            entry->next->isChainElement = false;
+            setCtrl(index, Empty);
+            ++mGrowthLeft;
+        }
+        else
+        {
+            setCtrl(index, Deleted);
         }
-
-        // connect the unused entries:
-        // our next entry is the current first unused entry
-        // and we are the new first free entry.
-        entry->next          = mFirstFreeHashMapEntry;
-        mFirstFreeHashMapEntry = entry;
-        mFirstFreeHashMapEntry->previous = mLastHashMapEntry;
-
-        // decrease map count and adjust begin pointer
         --mCount;
     }
 
@@ -805,138 +995,166 @@ namespace ramses_internal
     {
         // destruct all valid values
         destructAll();
-
-        // reset all buckets and link entries to empty list
-        PlatformMemory::Set(mBuckets, 0, sizeof(HashMapEntry*) * mSize);
-        HashMapEntry* entry = mData;
-        for (size_t i = 0; i < mThreshold + 1; ++i)
+        if (mSlotCount > 0u)
         {
-            entry->previous = nullptr;
-            entry->next = entry + 1;
-            entry->isChainElement = false;
-            ++entry;
+            std::memset(mCtrl, static_cast<uint8_t>(internal::HashMapControl::Empty), mSlotCount);
+            mGrowthLeft = CapacityForSlotCount(mSlotCount);
         }
-
-        // init free and last
-        mFirstFreeHashMapEntry = mData;
-        initializeLastEntry();
         mCount = 0;
     }
 
     template <class Key, class T>
     inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::begin()
     {
-        return typename HashMap<Key, T>::Iterator(mLastHashMapEntry->next);
+        const int8_t* ctrl = mCtrl;
+        Slot* slot = mSlots;
+        SkipEmptySlots(ctrl, slot);
+        return Iterator(ctrl, slot);
     }
 
     template <class Key, class T>
     inline typename HashMap<Key, T>::ConstIterator HashMap<Key, T>::begin() const
     {
-        return typename HashMap<Key, T>::ConstIterator(mLastHashMapEntry->next);
+        const int8_t* ctrl = mCtrl;
+        Slot* slot = mSlots;
+        SkipEmptySlots(ctrl, slot);
+        return ConstIterator(ctrl, slot);
     }
 
     template <class Key, class T>
     inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::end()
     {
-        return typename HashMap<Key, T>::Iterator(mLastHashMapEntry);
+        return iteratorAt(mSlotCount);
     }
 
     template <class Key, class T>
     inline typename HashMap<Key, T>::ConstIterator HashMap<Key, T>::end() const
     {
-        return typename HashMap<Key, T>::ConstIterator(mLastHashMapEntry);
+        return iteratorAt(mSlotCount);
     }
 
     template <class Key, class T>
-    inline typename HashMap<Key, T>::HashMapEntry* HashMap<Key, T>::internalGet(const Key& key) const
+    inline typename HashMap<Key, T>::Iterator HashMap<Key, T>::iteratorAt(size_t index)
     {
-        const size_t hashValue = calcHashValue(key);
-        HashMapEntry* current = mBuckets[hashValue];
-        if (current)
-        {
-            do
-            {
-                if (current->getKeyValuePair().key == key)
-                {
-                    return current;
-                }
-                current = current->next;
-            }
-            while (current->isChainElement);
-        }
+        return Iterator(mCtrl + index, mSlots + index);
+    }
 
-        return nullptr;
+    template <class Key, class T>
+    inline typename HashMap<Key, T>::ConstIterator HashMap<Key, T>::iteratorAt(size_t index) const
+    {
+        return ConstIterator(mCtrl + index, mSlots + index);
     }
 
     template <class Key, class T>
-    inline void HashMap<Key, T>::internalPut(HashMapEntry* newentry, const size_t hashValue)
+    inline void HashMap<Key, T>::reserve(size_t requestedCapacity)
     {
-        // chaining of entries
-        HashMapEntry* entry = mBuckets[hashValue];
-        if (entry)
-        {
-            // chaining
-            entry->isChainElement = true;
-        }
-        else
+        if (requestedCapacity <= capacity())
         {
-            // we hit a free bucket
-            entry = mLastHashMapEntry->next;
+            return;
         }
+        rehash(SlotCountForCapacity(requestedCapacity));
+    }
 
-        mBuckets[hashValue]   = newentry;
-        newentry->next        = entry;
-        newentry->previous    = entry->previous;
-        newentry->isChainElement = false;
-        entry->previous->next = newentry;
-        entry->previous       = newentry;
-        ++mCount;
+    template <class Key, class T>
+    inline size_t HashMap<Key, T>::capacity() const
+    {
+        return CapacityForSlotCount(mSlotCount);
     }
 
     template <class Key, class T>
-    inline void HashMap<Key, T>::reserve(size_t requestedCapacity)
+    inline void HashMap<Key, T>::rehashAndGrowIfNecessary()
     {
-        if (requestedCapacity <= capacity())
+        // if mostly deleted slots use up the growth, get rid of them without growing,
+        // otherwise grow by factor 4 to keep number of rehashes low while filling
+        if (mCount * 2u <= capacity())
+            rehash(mSlotCount);
+        else
+            rehash(mSlotCount * 4u);
+    }
+
+    template <class Key, class T>
+    inline void HashMap<Key, T>::rehash(size_t slotCount)
+    {
+        int8_t* oldCtrl = mCtrl;
+        Slot* oldSlots = mSlots;
+        const size_t oldSlotCount = mSlotCount;
+
+        allocate(slotCount);
+        mGrowthLeft -= mCount;
+        for (size_t i = 0u; i < oldSlotCount; ++i)
         {
-            return;
+            if (oldCtrl[i] >= 0)
+            {
+                Pair& pair = oldSlots[i].getKeyValuePair();
+                const uint64_t hashValue = CalcHashValue(pair.key);
+                const size_t index = findFirstNonFull(hashValue);
+                // key is const and gets copied, moving out of it would be undefined behavior
+                new (mSlots[index].keyValuePairMemory) Pair(typename Pair::InPlace(), pair.key, std::move(pair.value));
+                setCtrl(index, static_cast<int8_t>(hashValue & 0x7Fu));
+                pair.~Pair();
+            }
         }
 
-        HashMap<Key, T> tmp(requestedCapacity);
-        for (Iterator it = begin(); it != end(); ++it)
+        if (oldSlotCount > 0u)
         {
-            tmp.put(it->key, it->value);
+            delete[] oldCtrl;
+            delete[] oldSlots;
         }
-        swap(tmp);
     }
 
     template <class Key, class T>
-    inline size_t HashMap<Key, T>::capacity() const
+    inline void HashMap<Key, T>::setCtrl(size_t index, int8_t h2)
     {
-        return mThreshold;
+        // write whole group word, a byte store followed by a group load of the same word
+        // (common when rehashing) would otherwise defeat store forwarding
+        uint64_t word;
+        int8_t* groupStart = mCtrl + (index & ~(internal::HashMapControl::GroupSize - 1u));
+        std::memcpy(&word, groupStart, sizeof(word));
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        const uint32_t shift = 56u - 8u * static_cast<uint32_t>(index & 7u);
+#else
+        const uint32_t shift = 8u * static_cast<uint32_t>(index & 7u);
+#endif
+        word = (word & ~(static_cast<uint64_t>(0xFFu) << shift)) | (static_cast<uint64_t>(static_cast<uint8_t>(h2)) << shift);
+        std::memcpy(groupStart, &word, sizeof(word));
     }
 
     template <class Key, class T>
-    inline void HashMap<Key, T>::rehash()
+    inline void HashMap<Key, T>::allocate(size_t slotCount)
     {
-        reserve(static_cast<size_t>(1) << (mBitCount + 1));
+        assert(slotCount >= internal::HashMapControl::GroupSize);
+        mCtrl = new int8_t[slotCount + internal::HashMapControl::GroupSize];
+        std::memset(mCtrl, static_cast<uint8_t>(internal::HashMapControl::Empty), slotCount);
+        std::memset(mCtrl + slotCount, static_cast<uint8_t>(internal::HashMapControl::Sentinel), internal::HashMapControl::GroupSize);
+        mSlots = new Slot[slotCount];
+        mSlotCount = slotCount;
+        mGrowthLeft = CapacityForSlotCount(slotCount);
     }
 
     template <class Key, class T>
-    inline void HashMap<Key, T>::initializeLastEntry()
+    inline void HashMap<Key, T>::deallocate()
     {
-        mLastHashMapEntry->previous = mLastHashMapEntry;
-        mLastHashMapEntry->next = mLastHashMapEntry;
+        if (mSlotCount > 0u)
+        {
+            delete[] mCtrl;
+            delete[] mSlots;
+        }
+        mCtrl = internal::HashMapControl::EmptyControl();
+        mSlots = nullptr;
+        mSlotCount = 0u;
+        mGrowthLeft = 0u;
     }
 
     template <class Key, class T>
-        inline void HashMap<Key, T>::destructAll()
+    inline void HashMap<Key, T>::destructAll()
     {
         // destruct regular values
-        HashMapEntry* entry = mLastHashMapEntry->next;
-        while (entry != mLastHashMapEntry)
+        if (std::is_trivially_destructible<Pair>::value)
+            return;
+        for (size_t i = 0u; i < mSlotCount; ++i)
         {
-            entry->destructKeyValue();
-            entry = entry->next;
+            if (mCtrl[i] >= 0)
+                mSlots[i].getKeyValuePair().~Pair();
         }
     }
 
@@ -944,21 +1162,27 @@ namespace ramses_internal
     inline void HashMap<Key, T>::swap(HashMap<Key, T>& other)
     {
         using std::swap;
-        swap(mBitCount, other.mBitCount);
-        swap(mSize, other.mSize);
-        swap(mThreshold, other.mThreshold);
-        swap(mBuckets, other.mBuckets);
-        swap(mData, other.mData);
-        swap(mLastHashMapEntry, other.mLastHashMapEntry);
-        swap(mFirstFreeHashMapEntry, other.mFirstFreeHashMapEntry);
+        swap(mCtrl, other.mCtrl);
+        swap(mSlots, other.mSlots);
+        swap(mSlotCount, other.mSlotCount);
         swap(mCount, other.mCount);
+        swap(mGrowthLeft, other.mGrowthLeft);
+    }
+
+    template <class Key, class T>
+    inline size_t HashMap<Key, T>::SlotCountForCapacity(size_t capacity)
+    {
+        size_t slotCount = internal::HashMapControl::GroupSize;
+        while (CapacityForSlotCount(slotCount) < capacity)
+            slotCount *= 2u;
+        return slotCount;
     }
 
     template <class Key, class T>
-    inline uint8_t HashMap<Key, T>::BitSizeFromElementCount(size_t count)
+    inline size_t HashMap<Key, T>::CapacityForSlotCount(size_t slotCount)
     {
-        const size_t countRespectingLoadFactor = static_cast<size_t>(std::ceil(count / DefaultHashMapMaxLoadFactor));
-        return static_cast<uint8_t>(std::ceil(std::log2(countRespectingLoadFactor)));
+        // max load factor 3/4, groups of 8 need more free slots than wider groups to end probing early
+        return slotCount - slotCount / 4u;
     }
 }
 
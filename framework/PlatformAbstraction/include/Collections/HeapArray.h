@@ -13,6 +13,7 @@
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "PlatformAbstraction/Macros.h"
 #include <memory>
+#include <cassert>
 
 namespace ramses_internal
 {
@@ -24,6 +25,8 @@ namespace ramses_internal
     public:
         explicit HeapArray(UInt size = 0, const T* data = nullptr);
         HeapArray(UInt size, HeapArray&& other);
+        // view on data owned by dataOwner, which is kept alive as long as the view exists
+        HeapArray(UInt size, T* data, std::shared_ptr<void> dataOwner);
 
         HeapArray(const HeapArray&) = delete;
         HeapArray& operator=(const HeapArray&) = delete;
@@ -34,12 +37,15 @@ namespace ramses_internal
         UInt size() const;
         T* data();
         const T* data() const;
+        bool isView() const;
 
         void setZero();
 
     private:
         UInt m_size;
         std::unique_ptr<T[]> m_data;
+        T* m_viewData = nullptr;
+        std::shared_ptr<void> m_viewDataOwner;
     };
 
     template <typename T, typename _uniqueId>
@@ -59,9 +65,22 @@ namespace ramses_internal
     HeapArray<T, _uniqueId>::HeapArray(UInt size, HeapArray&& other)
         : m_size(size)
         , m_data(std::move(other.m_data))
+        , m_viewData(other.m_viewData)
+        , m_viewDataOwner(std::move(other.m_viewDataOwner))
     {
         static_assert(std::is_nothrow_move_constructible<HeapArray>::value, "HeapArray must be movable");
         other.m_size = 0;
+        other.m_viewData = nullptr;
+    }
+
+    template <typename T, typename _uniqueId>
+    inline
+    HeapArray<T, _uniqueId>::HeapArray(UInt size, T* data, std::shared_ptr<void> dataOwner)
+        : m_size(size)
+        , m_viewData(data)
+        , m_viewDataOwner(std::move(dataOwner))
+    {
+        assert(m_viewDataOwner);
     }
 
     template <typename T, typename _uniqueId>
@@ -69,9 +88,12 @@ namespace ramses_internal
     HeapArray<T, _uniqueId>::HeapArray(HeapArray&& o) noexcept
         : m_size(o.m_size)
         , m_data(std::move(o.m_data))
+        , m_viewData(o.m_viewData)
+        , m_viewDataOwner(std::move(o.m_viewDataOwner))
     {
         static_assert(std::is_nothrow_move_assignable<HeapArray>::value, "HeapArray must be movable");
         o.m_size = 0;
+        o.m_viewData = nullptr;
     }
 
     template <typename T, typename _uniqueId>
@@ -82,7 +104,10 @@ namespace ramses_internal
         {
             m_size = o.m_size;
             m_data = std::move(o.m_data);
+            m_viewData = o.m_viewData;
+            m_viewDataOwner = std::move(o.m_viewDataOwner);
             o.m_size = 0;
+            o.m_viewData = nullptr;
         }
         return *this;
     }
@@ -98,23 +123,30 @@ namespace ramses_internal
     inline
     T* HeapArray<T, _uniqueId>::data()
     {
-        return m_data.get();
+        return isView() ? m_viewData : m_data.get();
     }
 
     template <typename T, typename _uniqueId>
     inline
     const T* HeapArray<T, _uniqueId>::data() const
     {
-        return m_data.get();
+        return isView() ? m_viewData : m_data.get();
+    }
+
+    template <typename T, typename _uniqueId>
+    inline
+    bool HeapArray<T, _uniqueId>::isView() const
+    {
+        return m_viewDataOwner != nullptr;
     }
 
     template <typename T, typename _uniqueId>
     inline
     void HeapArray<T, _uniqueId>::setZero()
     {
-        if (m_data)
+        if (data())
         {
-            PlatformMemory::Set(m_data.get(), 0, m_size);
+            PlatformMemory::Set(data(), 0, m_size);
         }
     }
 }
@@ -18,6 +18,7 @@
 #include "PlatformAbstraction/FmtBase.h"
 #include <string>
 #include <cctype>
+#include <cstring>
 
 namespace ramses_internal
 {
@@ -500,4 +501,25 @@ struct std::hash<ramses_internal::String>
     }
 };
 
+namespace ramses_internal
+{
+    template <>
+    struct HeterogeneousKeyHash<String, const char*>
+    {
+        size_t operator()(const char* key) const
+        {
+            return HashMemoryRange(key, std::strlen(key));
+        }
+    };
+
+    template <>
+    struct HeterogeneousKeyHash<String, std::string>
+    {
+        size_t operator()(const std::string& key) const
+        {
+            return HashMemoryRange(key.data(), key.size());
+        }
+    };
+}
+
 #endif
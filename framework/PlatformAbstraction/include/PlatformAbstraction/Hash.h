@@ -37,6 +37,12 @@ namespace ramses_internal
         return seed;
     }
 
+    // Opt-in for heterogeneous lookup in HashMap/HashSet with keys of type K instead of Key.
+    // Specializations must hash K to the same value std::hash<Key> gives for the equal Key
+    // and Key must be comparable with K via operator==.
+    template <typename Key, typename K>
+    struct HeterogeneousKeyHash;
+
     namespace internal
     {
         template <typename T>
@@ -8,8 +8,10 @@
 
 #include "Collections/HashMap.h"
 #include "ComplexTestType.h"
+#include "Collections/String.h"
 #include "gtest/gtest.h"
 #include <vector>
+#include <memory>
 
 namespace {
     struct MyStruct
@@ -971,4 +973,99 @@ TEST_F(HashMapTest, swapKeepsNumberOfObjectsUnchanged)
     expectRefCnt(3);
 }
 
+TEST_F(HashMapTest, emplaceConstructsValueOnlyIfKeyNotExisting)
+{
+    HashMap<RCKey, RCValue> ht;
+    auto res = ht.emplace(RCKey(1), 2u);
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ(RCValue(2u), res.first->value);
+    expectRefCnt(1);
+
+    res = ht.emplace(RCKey(1), 5u);
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ(RCValue(2u), res.first->value);
+    EXPECT_EQ(1u, ht.size());
+    expectRefCnt(1);
+}
+
+TEST_F(HashMapTest, canStoreMoveOnlyValues)
+{
+    HashMap<uint32_t, std::unique_ptr<uint32_t>> ht;
+    for (uint32_t i = 0; i < 100; ++i)
+        ht.put(i, std::unique_ptr<uint32_t>(new uint32_t(i)));
+    ht.emplace(100u, new uint32_t(100u));
+    ht[101u].reset(new uint32_t(101u));
+
+    ASSERT_EQ(102u, ht.size());
+    for (const auto& entry : ht)
+    {
+        ASSERT_TRUE(entry.value);
+        EXPECT_EQ(entry.key, *entry.value);
+    }
+
+    HashMap<uint32_t, std::unique_ptr<uint32_t>> moved(std::move(ht));
+    EXPECT_EQ(102u, moved.size());
+    EXPECT_EQ(0u, ht.size());
+    EXPECT_EQ(50u, **moved.get(50u));
+}
+
+TEST_F(HashMapTest, findsStringKeysWithoutConstructingString)
+{
+    HashMap<String, uint32_t> ht;
+    ht.put(String("foo"), 1u);
+    ht.put(String("bar"), 2u);
+
+    const char* foo = "foo";
+    EXPECT_TRUE(ht.contains(foo));
+    EXPECT_TRUE(ht.contains(std::string("bar")));
+    EXPECT_FALSE(ht.contains("baz"));
+    EXPECT_EQ(1u, ht.find("foo")->value);
+    EXPECT_EQ(2u, *ht.get(std::string("bar")));
+    EXPECT_EQ(nullptr, ht.get("baz"));
+
+    const HashMap<String, uint32_t>& constHt = ht;
+    EXPECT_TRUE(constHt.find("foo") != constHt.end());
+    EXPECT_TRUE(constHt.find(std::string("baz")) == constHt.end());
+}
+
+TEST_F(HashMapTest, repeatedInsertAndRemoveDoesNotGrowCapacity)
+{
+    HashMap<uint32_t, uint32_t> ht(100);
+    const size_t initialCapacity = ht.capacity();
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        ht.put(i, i);
+        if (i >= 50)
+        {
+            EXPECT_TRUE(ht.remove(i - 50));
+        }
+    }
+    EXPECT_EQ(50u, ht.size());
+    EXPECT_EQ(initialCapacity, ht.capacity());
+    for (uint32_t i = 10000 - 50; i < 10000; ++i)
+        EXPECT_EQ(i, *ht.get(i));
+    EXPECT_FALSE(ht.contains(0u));
+}
+
+TEST_F(HashMapTest, keepsAllElementsWhenGrowingAfterRemovals)
+{
+    HashMap<uint32_t, uint32_t> ht;
+    for (uint32_t i = 0; i < 1000; ++i)
+        ht.put(i, i);
+    for (uint32_t i = 0; i < 1000; i += 2)
+        EXPECT_TRUE(ht.remove(i));
+    for (uint32_t i = 1000; i < 3000; ++i)
+        ht.put(i, i);
+
+    EXPECT_EQ(2500u, ht.size());
+    size_t iterated = 0u;
+    for (const auto& entry : ht)
+    {
+        EXPECT_EQ(entry.key, entry.value);
+        EXPECT_TRUE(entry.key >= 1000u || entry.key % 2 == 1u);
+        ++iterated;
+    }
+    EXPECT_EQ(2500u, iterated);
+}
+
 } // namespace ramses_internal
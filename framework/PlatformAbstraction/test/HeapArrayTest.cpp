@@ -8,6 +8,7 @@
 
 #include "Collections/HeapArray.h"
 #include "gtest/gtest.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -90,4 +91,37 @@ namespace ramses_internal
         HeapArray<Byte> b(2, std::move(a));
         EXPECT_EQ(2u, b.size());
     }
+
+    TEST(AHeapArray, canBeViewOnDataKeepingItsOwnerAlive)
+    {
+        auto owner = std::make_shared<std::vector<Byte>>(std::vector<Byte>{ 1, 2, 3, 4 });
+        std::weak_ptr<std::vector<Byte>> weakOwner = owner;
+        HeapArray<Byte> view(4, owner->data(), owner);
+        owner.reset();
+
+        EXPECT_TRUE(view.isView());
+        EXPECT_FALSE(weakOwner.expired());
+        EXPECT_EQ(weakOwner.lock()->data(), view.data());
+        ASSERT_EQ(4u, view.size());
+        EXPECT_EQ(3u, view.data()[2]);
+    }
+
+    TEST(AHeapArray, movesViewWithOwnership)
+    {
+        auto owner = std::make_shared<std::vector<Byte>>(4u);
+        std::weak_ptr<std::vector<Byte>> weakOwner = owner;
+        Byte* data = owner->data();
+        HeapArray<Byte> view(4, data, std::move(owner));
+
+        HeapArray<Byte> b;
+        b = std::move(view);
+        EXPECT_FALSE(view.isView());
+        EXPECT_EQ(nullptr, view.data());
+        EXPECT_TRUE(b.isView());
+        EXPECT_EQ(weakOwner.lock()->data(), b.data());
+
+        b = HeapArray<Byte>(2);
+        EXPECT_FALSE(b.isView());
+        EXPECT_TRUE(weakOwner.expired());
+    }
 }
@@ -0,0 +1,33 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCECOMPRESSIONUTILS_H
+#define RAMSES_RESOURCECOMPRESSIONUTILS_H
+
+#include "Resource/IResource.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class ITaskQueue;
+
+    namespace ResourceCompressionUtils
+    {
+        // Compresses/decompresses the given resources. Large workloads are shared with up to maxNumParallelTasks tasks
+        // enqueued to taskQueue, calling thread processes all resources not claimed by a task yet itself and only waits
+        // for claimed ones. Without task queue or for small workloads everything is processed on calling thread.
+        // Returns when all resources are processed. Duplicate entries are allowed.
+        void CompressResources(std::vector<const IResource*> resources, IResource::CompressionLevel level, ITaskQueue* taskQueue, UInt32 maxNumParallelTasks = 3u);
+        void DecompressResources(std::vector<const IResource*> resources, ITaskQueue* taskQueue, UInt32 maxNumParallelTasks = 3u);
+
+        // below this amount of input data all work is done on calling thread
+        static constexpr UInt32 MinimumSizeForParallelProcessing = 256u * 1024u;
+    }
+}
+
+#endif
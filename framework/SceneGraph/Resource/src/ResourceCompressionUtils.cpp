@@ -0,0 +1,123 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Resource/ResourceCompressionUtils.h"
+#include "TaskFramework/ITask.h"
+#include "TaskFramework/ITaskQueue.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace ramses_internal
+{
+    namespace ResourceCompressionUtils
+    {
+        namespace
+        {
+            // Resources are claimed one after another by calling thread and by this task executed from task queue.
+            // Calling thread does not wait for queued tasks to start, it processes all resources not claimed yet itself and
+            // only waits for claimed ones to finish. A task executed after that finds no resource left.
+            class ProcessResourcesTask : public ITask
+            {
+            public:
+                ProcessResourcesTask(std::vector<const IResource*>&& resources, std::function<void(const IResource&)>&& fun)
+                    : m_resources(std::move(resources))
+                    , m_fun(std::move(fun))
+                {
+                }
+
+                virtual void execute() override
+                {
+                    processUnclaimedResources();
+                }
+
+                void processUnclaimedResources()
+                {
+                    for (size_t idx = m_nextIdx++; idx < m_resources.size(); idx = m_nextIdx++)
+                    {
+                        m_fun(*m_resources[idx]);
+
+                        std::lock_guard<std::mutex> guard(m_lock);
+                        if (++m_numFinished == m_resources.size())
+                            m_allFinished.notify_all();
+                    }
+                }
+
+                void waitUntilAllFinished()
+                {
+                    std::unique_lock<std::mutex> lock(m_lock);
+                    m_allFinished.wait(lock, [this]() { return m_numFinished == m_resources.size(); });
+                }
+
+            private:
+                const std::vector<const IResource*> m_resources;
+                const std::function<void(const IResource&)> m_fun;
+                std::atomic<size_t> m_nextIdx{ 0u };
+
+                std::mutex m_lock;
+                std::condition_variable m_allFinished;
+                size_t m_numFinished = 0u;
+            };
+
+            void ProcessInParallel(std::vector<const IResource*>& resources, UInt64 totalSize, ITaskQueue* taskQueue, UInt32 maxNumParallelTasks, std::function<void(const IResource&)>&& fun)
+            {
+                // same resource object must not be processed concurrently
+                std::sort(resources.begin(), resources.end());
+                resources.erase(std::unique(resources.begin(), resources.end()), resources.end());
+
+                const UInt32 numTasks = (taskQueue == nullptr || resources.size() < 2u || totalSize < MinimumSizeForParallelProcessing) ? 0u :
+                    std::min(maxNumParallelTasks, static_cast<UInt32>(resources.size()) - 1u);
+                if (numTasks == 0u)
+                {
+                    for (const auto r : resources)
+                        fun(*r);
+                    return;
+                }
+
+                // largest first, so that a single big resource does not end up last
+                std::sort(resources.begin(), resources.end(), [](const IResource* a, const IResource* b) {
+                    return a->getDecompressedDataSize() > b->getDecompressedDataSize();
+                });
+
+                ProcessResourcesTask* task = new ProcessResourcesTask(std::move(resources), std::move(fun));
+                for (UInt32 i = 0u; i < numTasks; ++i)
+                    taskQueue->enqueue(*task);
+                task->processUnclaimedResources();
+                task->waitUntilAllFinished();
+                task->release();
+            }
+        }
+
+        void CompressResources(std::vector<const IResource*> resources, IResource::CompressionLevel level, ITaskQueue* taskQueue, UInt32 maxNumParallelTasks)
+        {
+            if (level == IResource::CompressionLevel::NONE)
+                return;
+
+            UInt64 totalSize = 0u;
+            auto it = std::remove_if(resources.begin(), resources.end(), [](const IResource* r) { return r->isCompressedAvailable(); });
+            resources.erase(it, resources.end());
+            for (const auto r : resources)
+                totalSize += r->getDecompressedDataSize();
+
+            ProcessInParallel(resources, totalSize, taskQueue, maxNumParallelTasks, [level](const IResource& r) { r.compress(level); });
+        }
+
+        void DecompressResources(std::vector<const IResource*> resources, ITaskQueue* taskQueue, UInt32 maxNumParallelTasks)
+        {
+            UInt64 totalSize = 0u;
+            auto it = std::remove_if(resources.begin(), resources.end(), [](const IResource* r) { return r->isDeCompressedAvailable(); });
+            resources.erase(it, resources.end());
+            for (const auto r : resources)
+                totalSize += r->getDecompressedDataSize();
+
+            ProcessInParallel(resources, totalSize, taskQueue, maxNumParallelTasks, [](const IResource& r) { r.decompress(); });
+        }
+    }
+}
@@ -0,0 +1,160 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Resource/ResourceCompressionUtils.h"
+#include "Resource/ResourceBase.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include "MockTaskQueue.h"
+#include "gmock/gmock.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        class TestResource : public ResourceBase
+        {
+        public:
+            TestResource()
+                : ResourceBase(EResourceType_Invalid, ResourceCacheFlag(0), String())
+            {}
+
+            virtual void serializeResourceMetadataToStream(IOutputStream&) const override {}
+        };
+    }
+
+    class AResourceCompressionUtils : public ::testing::Test
+    {
+    protected:
+        void createResources(UInt32 count, UInt32 dataSize)
+        {
+            for (UInt32 i = 0; i < count; ++i)
+            {
+                ResourceBlob data(dataSize + i);
+                for (UInt32 idx = 0; idx < data.size(); ++idx)
+                    data.data()[idx] = static_cast<UInt8>((idx / 7) + i);
+                resources.push_back(std::make_unique<TestResource>());
+                resources.back()->setResourceData(std::move(data));
+            }
+        }
+
+        std::vector<const IResource*> getResourcePointers() const
+        {
+            std::vector<const IResource*> result;
+            for (const auto& r : resources)
+                result.push_back(r.get());
+            return result;
+        }
+
+        std::vector<std::unique_ptr<TestResource>> resources;
+        ThreadedTaskExecutor taskExecutor{ 3u };
+    };
+
+    TEST_F(AResourceCompressionUtils, compressesAllResourcesInParallelSameAsSerialCompression)
+    {
+        createResources(20u, 64u * 1024u);
+        ResourceCompressionUtils::CompressResources(getResourcePointers(), IResource::CompressionLevel::REALTIME, &taskExecutor);
+
+        for (const auto& r : resources)
+        {
+            ASSERT_TRUE(r->isCompressedAvailable());
+
+            TestResource serial;
+            serial.setResourceData(ResourceBlob(r->getResourceData().size(), r->getResourceData().data()));
+            serial.compress(IResource::CompressionLevel::REALTIME);
+            ASSERT_EQ(serial.getCompressedResourceData().size(), r->getCompressedResourceData().size());
+            EXPECT_EQ(0, PlatformMemory::Compare(serial.getCompressedResourceData().data(), r->getCompressedResourceData().data(), serial.getCompressedResourceData().size()));
+        }
+    }
+
+    TEST_F(AResourceCompressionUtils, canHandleDuplicateResourcesInInput)
+    {
+        createResources(4u, 128u * 1024u);
+        auto input = getResourcePointers();
+        const auto copy = input;
+        input.insert(input.end(), copy.begin(), copy.end());
+
+        ResourceCompressionUtils::CompressResources(input, IResource::CompressionLevel::REALTIME, &taskExecutor);
+        for (const auto& r : resources)
+            EXPECT_TRUE(r->isCompressedAvailable());
+    }
+
+    TEST_F(AResourceCompressionUtils, doesNotCompressWithCompressionLevelNone)
+    {
+        createResources(4u, 128u * 1024u);
+        ResourceCompressionUtils::CompressResources(getResourcePointers(), IResource::CompressionLevel::NONE, &taskExecutor);
+        for (const auto& r : resources)
+            EXPECT_FALSE(r->isCompressedAvailable());
+    }
+
+    TEST_F(AResourceCompressionUtils, decompressesAllResourcesInParallel)
+    {
+        createResources(20u, 64u * 1024u);
+        ResourceCompressionUtils::CompressResources(getResourcePointers(), IResource::CompressionLevel::REALTIME, &taskExecutor);
+
+        std::vector<std::unique_ptr<TestResource>> fromCompressed;
+        std::vector<const IResource*> input;
+        for (const auto& r : resources)
+        {
+            fromCompressed.push_back(std::make_unique<TestResource>());
+            fromCompressed.back()->setCompressedResourceData(CompressedResouceBlob(r->getCompressedResourceData().size(), r->getCompressedResourceData().data()),
+                r->getDecompressedDataSize(), r->getHash());
+            input.push_back(fromCompressed.back().get());
+        }
+
+        ResourceCompressionUtils::DecompressResources(input, &taskExecutor);
+
+        for (UInt32 i = 0; i < resources.size(); ++i)
+        {
+            ASSERT_TRUE(fromCompressed[i]->isDeCompressedAvailable());
+            ASSERT_EQ(resources[i]->getResourceData().size(), fromCompressed[i]->getResourceData().size());
+            EXPECT_EQ(0, PlatformMemory::Compare(resources[i]->getResourceData().data(), fromCompressed[i]->getResourceData().data(), resources[i]->getResourceData().size()));
+        }
+    }
+
+    TEST_F(AResourceCompressionUtils, processesSmallWorkloadsOnCallingThread)
+    {
+        createResources(3u, 2000u);
+        ::testing::StrictMock<MockTaskQueue> taskQueue;
+        ResourceCompressionUtils::CompressResources(getResourcePointers(), IResource::CompressionLevel::OFFLINE, &taskQueue);
+        for (const auto& r : resources)
+            EXPECT_TRUE(r->isCompressedAvailable());
+    }
+
+    TEST_F(AResourceCompressionUtils, compressesWithoutTaskQueueOnCallingThread)
+    {
+        createResources(20u, 64u * 1024u);
+        ResourceCompressionUtils::CompressResources(getResourcePointers(), IResource::CompressionLevel::REALTIME, nullptr);
+        for (const auto& r : resources)
+            EXPECT_TRUE(r->isCompressedAvailable());
+    }
+
+    TEST_F(AResourceCompressionUtils, processesAllResourcesItselfIfQueuedTasksAreNotExecutedInTime)
+    {
+        createResources(20u, 64u * 1024u);
+        std::vector<ITask*> delayedTasks;
+        MockTaskQueue taskQueue;
+        EXPECT_CALL(taskQueue, enqueue(::testing::_)).Times(3).WillRepeatedly(::testing::Invoke([&delayedTasks](ITask& task)
+        {
+            task.addRef();
+            delayedTasks.push_back(&task);
+            return true;
+        }));
+
+        ResourceCompressionUtils::CompressResources(getResourcePointers(), IResource::CompressionLevel::REALTIME, &taskQueue);
+        for (const auto& r : resources)
+            EXPECT_TRUE(r->isCompressedAvailable());
+
+        // tasks executed late find nothing left to process
+        for (auto task : delayedTasks)
+        {
+            task->execute();
+            task->release();
+        }
+    }
+}
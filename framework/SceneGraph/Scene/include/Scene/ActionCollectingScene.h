@@ -34,6 +34,7 @@ namespace ramses_internal
         virtual void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, UInt32 startVertex) override;
+        virtual void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) override;
         void                                setRenderableUniformsDataInstanceAndState (RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle);
 
         // Render state
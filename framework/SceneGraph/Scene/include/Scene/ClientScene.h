@@ -30,8 +30,20 @@ namespace ramses_internal
             return m_statisticCollection;
         }
 
+        // if enabled, only last write of setters repeated within one flush is sent
+        void setCollapseRedundantSetters(bool enable)
+        {
+            m_collapseRedundantSetters = enable;
+        }
+
+        bool getCollapseRedundantSetters() const
+        {
+            return m_collapseRedundantSetters;
+        }
+
     private:
         StatisticCollectionScene m_statisticCollection;
+        bool m_collapseRedundantSetters = false;
     };
 }
 
@@ -13,6 +13,8 @@
 
 namespace ramses_internal
 {
+    // Data instance refers to a data block it does not own, the block is allocated from and released to
+    // the DataInstanceStorage of the scene the instance belongs to
     class DataInstance
     {
     public:
@@ -20,9 +22,11 @@ namespace ramses_internal
         {
         }
 
-        DataInstance(DataLayoutHandle dataLayoutHandle, UInt32 size)
+        DataInstance(DataLayoutHandle dataLayoutHandle, Byte* data, UInt32 size)
             : m_dataLayoutHandle(dataLayoutHandle)
-            , m_data(size)
+            , m_size(size)
+            , m_data(data)
+            , m_version(NextVersion())
         {
         }
 
@@ -34,18 +38,26 @@ namespace ramses_internal
         template <typename DATATYPE>
         const DATATYPE* getTypedDataPointer(UInt32 fieldOffset) const
         {
-            return reinterpret_cast<const DATATYPE*>(&m_data[fieldOffset]);
+            assert(fieldOffset < m_size);
+            return reinterpret_cast<const DATATYPE*>(m_data + fieldOffset);
         }
 
         template <typename DATATYPE>
         void setTypedData(UInt32 fieldOffset, UInt32 elementCount, const DATATYPE* value)
         {
             const UInt32 fieldSizeInByte = sizeof(DATATYPE) * elementCount;
-            assert(fieldOffset + fieldSizeInByte <= m_data.size());
-            void* dest = &m_data[fieldOffset];
-            if (dest != value)
+            assert(fieldOffset + fieldSizeInByte <= m_size);
+            void* dest = m_data + fieldOffset;
+            if (dest == value)
+            {
+                // data was written in place already (scene action applier reads directly into instance memory),
+                // content may have changed
+                m_version = NextVersion();
+            }
+            else if (PlatformMemory::Compare(dest, value, fieldSizeInByte) != 0)
             {
                 PlatformMemory::Copy(dest, value, fieldSizeInByte);
+                m_version = NextVersion();
             }
         }
 
@@ -54,9 +66,30 @@ namespace ramses_internal
             return m_dataLayoutHandle;
         }
 
+        Byte* getData() const
+        {
+            return m_data;
+        }
+
+        UInt32 getDataSize() const
+        {
+            return m_size;
+        }
+
+        // Version is unique across all data instances and changes only if data content changes,
+        // equal versions therefore guarantee equal data
+        UInt64 getVersion() const
+        {
+            return m_version;
+        }
+
     private:
+        static UInt64 NextVersion();
+
         DataLayoutHandle m_dataLayoutHandle;
-        std::vector<Byte> m_data;
+        UInt32 m_size = 0u;
+        Byte* m_data = nullptr;
+        UInt64 m_version = 0u;
     };
 
     static_assert(std::is_nothrow_move_constructible<DataInstance>::value, "DataInstance must be movable");
@@ -0,0 +1,54 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DATAINSTANCESTORAGE_H
+#define RAMSES_DATAINSTANCESTORAGE_H
+
+#include "Collections/HashMap.h"
+#include <vector>
+#include <memory>
+
+namespace ramses_internal
+{
+    // Slab storage for the data of all data instances of a scene.
+    // Data blocks are bucketed by their size and handed out from chunks holding many blocks of the same size,
+    // so that instances of the same data layout lie next to each other in memory and allocating an instance
+    // does not need a heap allocation of its own. Blocks never move while allocated, released blocks are reused
+    // by the next allocation of the same size. Memory is only given back when the storage is destroyed.
+    class DataInstanceStorage
+    {
+    public:
+        // block sizes are padded to this alignment, sufficient for all data types a data layout can hold
+        static constexpr UInt32 BlockAlignment = 8u;
+
+        DataInstanceStorage() = default;
+        DataInstanceStorage(const DataInstanceStorage&) = delete;
+        DataInstanceStorage& operator=(const DataInstanceStorage&) = delete;
+
+        // returns zero initialized block of given size, nullptr for size 0
+        Byte* allocate(UInt32 size);
+        void release(Byte* block, UInt32 size);
+
+        UInt32 getChunkCount() const;
+
+    private:
+        struct Bucket
+        {
+            std::vector<std::unique_ptr<Byte[]>> chunks;
+            std::vector<Byte*> freeBlocks;
+            UInt32 blocksPerChunk = 0u;
+            UInt32 blocksUsedInLastChunk = 0u;
+        };
+
+        static UInt32 GetBlockSize(UInt32 size);
+
+        HashMap<UInt32, Bucket> m_buckets;
+    };
+}
+
+#endif
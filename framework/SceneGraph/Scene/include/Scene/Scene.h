@@ -31,6 +31,7 @@
 #include "Scene/TopologyTransform.h"
 #include "Scene/DataLayout.h"
 #include "Scene/DataInstance.h"
+#include "Scene/DataInstanceStorage.h"
 
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
@@ -67,6 +68,7 @@ namespace ramses_internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) override;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, UInt32 startVertex) override;
+        virtual void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) override;
         virtual const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const override final;
 
         // Render state
@@ -130,6 +132,7 @@ namespace ramses_internal
         virtual bool                        isDataInstanceAllocated         (DataInstanceHandle containerHandle) const override final;
         virtual UInt32                      getDataInstanceCount            () const override final;
         virtual DataLayoutHandle            getLayoutOfDataInstance         (DataInstanceHandle containerHandle) const override final;
+        UInt64                              getDataInstanceVersion          (DataInstanceHandle containerHandle) const;
 
         virtual const Float*                getDataFloatArray               (DataInstanceHandle containerHandle, DataFieldHandle field) const override final;
         virtual const Vector2*              getDataVector2fArray            (DataInstanceHandle containerHandle, DataFieldHandle field) const override final;
@@ -339,6 +342,7 @@ namespace ramses_internal
 
         typedef MEMORYPOOL<DataInstance, DataInstanceHandle> DataInstanceMemory;
         DataInstanceMemory          m_dataInstanceMemory;
+        DataInstanceStorage         m_dataInstanceStorage;
 
         typedef MEMORYPOOL<RenderGroup, RenderGroupHandle> RenderGroupMemoryType;
         RenderGroupMemoryType       m_renderGroups;
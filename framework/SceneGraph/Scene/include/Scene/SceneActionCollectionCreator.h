@@ -64,6 +64,7 @@ namespace ramses_internal
         void setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible);
         void setRenderableInstanceCount(RenderableHandle renderableHandle, UInt32 instanceCount);
         void setRenderableStartVertex(RenderableHandle renderableHandle, UInt32 startVertex);
+        void setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox);
 
         // Render state allocation
         void allocateRenderState(RenderStateHandle stateHandle);
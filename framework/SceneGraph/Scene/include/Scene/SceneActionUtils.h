@@ -10,6 +10,36 @@
 #define RAMSES_SCENEACTIONUTILS_H
 
 #include "Scene/SceneActionCollection.h"
+#include "Collections/HashMap.h"
+#include "PlatformAbstraction/Hash.h"
+
+namespace ramses_internal
+{
+    // Target of a setter action, identified by action type and the leading bytes of its payload
+    // (e.g. node handle and transform property, data instance handle and field)
+    struct SceneActionSetterTarget
+    {
+        ESceneActionId type;
+        UInt32 key[3];
+
+        bool operator==(const SceneActionSetterTarget& other) const
+        {
+            return type == other.type && key[0] == other.key[0] && key[1] == other.key[1] && key[2] == other.key[2];
+        }
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<ramses_internal::SceneActionSetterTarget>
+    {
+        size_t operator()(const ramses_internal::SceneActionSetterTarget& target) const
+        {
+            return ramses_internal::HashValue(target.type, target.key[0], target.key[1], target.key[2]);
+        }
+    };
+}
 
 namespace ramses_internal
 {
@@ -18,6 +48,28 @@ namespace ramses_internal
     public:
         static UInt32 CountNumberOfActionsOfType(const SceneActionCollection& actions, ESceneActionId type);
         static UInt32 CountNumberOfActionsOfType(const SceneActionCollection& actions, const SceneActionIdVector& types);
+
+        // Removes setter actions whose target (e.g. node transform component, data field, render state) is set again
+        // later in the same collection, keeping only the last write. All other actions keep their relative order.
+        // Returns number of removed actions.
+        static UInt32 RemoveOverwrittenSetterActions(SceneActionCollection& actions);
+    };
+
+    // Finds setter actions overwritten by later actions in a collection which only grows by appending.
+    // The last setter action of every target is kept indexed, so only appended actions need to be checked.
+    class OverwrittenSetterActionsTracker
+    {
+    public:
+        // checks actions appended to tracked collection since last call, returns number of actions newly found overwritten
+        UInt32 update(const SceneActionCollection& actions);
+        // removes all actions found overwritten so far from tracked collection, tracking continues on compacted collection
+        void removeOverwrittenActions(SceneActionCollection& actions);
+        UInt32 getNumberOfOverwrittenActions() const;
+
+    private:
+        HashMap<SceneActionSetterTarget, UInt32> m_lastSetterActionForTarget;
+        std::vector<bool> m_overwritten;
+        UInt32 m_numOverwritten = 0u;
     };
 }
 
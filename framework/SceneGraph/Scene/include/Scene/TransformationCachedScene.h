@@ -14,6 +14,7 @@
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
 #include "PlatformAbstraction/PlatformTypes.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -48,6 +49,11 @@ namespace ramses_internal
         Matrix44f                       updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const;
         bool                            isMatrixCacheDirty(ETransformationMatrixType matrixType, NodeHandle node) const;
 
+        // Updates matrix caches of all given nodes at once, afterwards updateMatrixCache for any of them only reads the cache.
+        // Dirty ancestor chains are gathered into contiguous arrays ordered parent before child, so that every dirty node
+        // is computed exactly once even if shared by many of the given nodes.
+        void                            updateMatrixCacheBatch(ETransformationMatrixType matrixType, const NodeHandleVector& nodes) const;
+
     protected:
         MatrixCacheEntry&           getMatrixCacheEntry(NodeHandle nodeHandle) const;
         bool                        markDirty(NodeHandle node) const;
@@ -67,6 +73,9 @@ namespace ramses_internal
         void                        computeObjectMatrixForNode(NodeHandle node, Matrix44f& chainMatrix) const;
         void                        propagateDirty(NodeHandle node) const;
 
+        void                        collectDirtyChainForBatch(ETransformationMatrixType matrixType, NodeHandle node) const;
+        bool                        computeLocalMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& localMatrix) const;
+
         // Cache
         typedef MEMORYPOOL<MatrixCacheEntry, NodeHandle> MatrixCachePool;
         mutable MatrixCachePool m_matrixCachePool;
@@ -76,6 +85,16 @@ namespace ramses_internal
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        // working arrays for batch update, index in batch is the same in all of them
+        // (parent index -1 means the chain starts from the matrix already stored for the node)
+        mutable NodeHandleVector        m_batchNodes;
+        mutable std::vector<Int32>      m_batchParentIndices;
+        mutable std::vector<Matrix44f>  m_batchLocalMatrices;
+        mutable std::vector<bool>       m_batchHasLocalMatrix;
+        mutable std::vector<Matrix44f>  m_batchMatrices;
+        // maps node memory handle to its index in batch
+        mutable std::vector<UInt32>     m_batchIndexOfNode;
     };
 }
 
@@ -349,6 +349,12 @@ namespace ramses_internal
         m_creator.setRenderableStartVertex(renderableHandle, startVertex);
     }
 
+    void ActionCollectingScene::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        ResourceChangeCollectingScene::setRenderableBoundingBox(renderableHandle, boundingBox);
+        m_creator.setRenderableBoundingBox(renderableHandle, boundingBox);
+    }
+
     void ActionCollectingScene::setRenderableUniformsDataInstanceAndState(RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle)
     {
         ResourceChangeCollectingScene::setRenderableDataInstance(renderableHandle, ERenderableDataSlotType_Uniforms, newDataInstance);
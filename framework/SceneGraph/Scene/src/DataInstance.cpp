@@ -0,0 +1,20 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/DataInstance.h"
+#include <atomic>
+
+namespace ramses_internal
+{
+    UInt64 DataInstance::NextVersion()
+    {
+        // data instances are modified from client and renderer threads
+        static std::atomic<UInt64> versionCounter{ 0u };
+        return ++versionCounter;
+    }
+}
@@ -0,0 +1,79 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/DataInstanceStorage.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // chunks start small so that scenes with few instances of a layout do not waste memory,
+        // and grow up to a size which keeps the number of heap allocations low for large scenes
+        constexpr UInt32 MinBlocksPerChunk = 16u;
+        constexpr UInt32 MaxChunkSizeInBytes = 64u * 1024u;
+    }
+
+    constexpr UInt32 DataInstanceStorage::BlockAlignment;
+
+    UInt32 DataInstanceStorage::GetBlockSize(UInt32 size)
+    {
+        return (size + BlockAlignment - 1u) / BlockAlignment * BlockAlignment;
+    }
+
+    Byte* DataInstanceStorage::allocate(UInt32 size)
+    {
+        if (size == 0u)
+            return nullptr;
+
+        const UInt32 blockSize = GetBlockSize(size);
+        Bucket& bucket = m_buckets[blockSize];
+
+        Byte* block = nullptr;
+        if (!bucket.freeBlocks.empty())
+        {
+            block = bucket.freeBlocks.back();
+            bucket.freeBlocks.pop_back();
+            PlatformMemory::Set(block, 0, blockSize);
+        }
+        else
+        {
+            if (bucket.chunks.empty() || bucket.blocksUsedInLastChunk == bucket.blocksPerChunk)
+            {
+                const UInt32 maxBlocksPerChunk = std::max(MinBlocksPerChunk, MaxChunkSizeInBytes / blockSize);
+                bucket.blocksPerChunk = bucket.chunks.empty() ? MinBlocksPerChunk : std::min(2u * bucket.blocksPerChunk, maxBlocksPerChunk);
+                // value initialization zeroes the whole chunk
+                bucket.chunks.emplace_back(new Byte[bucket.blocksPerChunk * blockSize]());
+                bucket.blocksUsedInLastChunk = 0u;
+            }
+            block = bucket.chunks.back().get() + bucket.blocksUsedInLastChunk * blockSize;
+            ++bucket.blocksUsedInLastChunk;
+        }
+
+        return block;
+    }
+
+    void DataInstanceStorage::release(Byte* block, UInt32 size)
+    {
+        if (block == nullptr)
+            return;
+
+        Bucket* bucket = m_buckets.get(GetBlockSize(size));
+        assert(bucket != nullptr);
+        bucket->freeBlocks.push_back(block);
+    }
+
+    UInt32 DataInstanceStorage::getChunkCount() const
+    {
+        UInt32 count = 0u;
+        for (const auto& bucket : m_buckets)
+            count += static_cast<UInt32>(bucket.value.chunks.size());
+        return count;
+    }
+}
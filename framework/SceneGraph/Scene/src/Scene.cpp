@@ -709,6 +709,12 @@ namespace ramses_internal
         m_renderables.getMemory(renderableHandle)->startVertex = startVertex;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        m_renderables.getMemory(renderableHandle)->boundingBox = boundingBox;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     const Renderable& SceneT<MEMORYPOOL>::getRenderable(RenderableHandle renderableHandle) const
     {
@@ -790,6 +796,13 @@ namespace ramses_internal
         return m_dataInstanceMemory.getMemory(containerHandle)->getLayoutHandle();
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    UInt64 SceneT<MEMORYPOOL>::getDataInstanceVersion(DataInstanceHandle containerHandle) const
+    {
+        assert(m_dataInstanceMemory.isAllocated(containerHandle));
+        return m_dataInstanceMemory.getMemory(containerHandle)->getVersion();
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     UInt32 SceneT<MEMORYPOOL>::getRenderableCount() const
     {
@@ -1036,12 +1049,14 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     DataInstanceHandle SceneT<MEMORYPOOL>::allocateDataInstance(DataLayoutHandle layoutHandle, DataInstanceHandle instanceHandle)
     {
+        static_assert(alignof(ResourceField) <= DataInstanceStorage::BlockAlignment && alignof(Matrix44f) <= DataInstanceStorage::BlockAlignment,
+            "data instance storage blocks must be aligned for all data field types");
         const DataLayout& layout = *m_dataLayoutMemory.getMemory(layoutHandle);
         const DataInstanceHandle containerHandle = m_dataInstanceMemory.allocate(instanceHandle);
 
         UInt32 dataInstanceSize = layout.getTotalSize();
         DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
-        *instance = DataInstance(layoutHandle, dataInstanceSize);
+        *instance = DataInstance(layoutHandle, m_dataInstanceStorage.allocate(dataInstanceSize), dataInstanceSize);
 
         // initialize data instance fields
         // TODO violin this can be generalized further, e.g. via templated static inplace contructor
@@ -1084,7 +1099,9 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataInstance(DataInstanceHandle containerHandle)
     {
-        assert(isDataLayoutAllocated(m_dataInstanceMemory.getMemory(containerHandle)->getLayoutHandle()));
+        const DataInstance& instance = *m_dataInstanceMemory.getMemory(containerHandle);
+        assert(isDataLayoutAllocated(instance.getLayoutHandle()));
+        m_dataInstanceStorage.release(instance.getData(), instance.getDataSize());
         m_dataInstanceMemory.release(containerHandle);
     }
 
@@ -409,6 +409,16 @@ namespace ramses_internal
             scene.setRenderableStartVertex(renderable, startVertex);
             break;
         }
+        case ESceneActionId_SetRenderableBoundingBox:
+        {
+            RenderableHandle renderable;
+            BoundingBox boundingBox;
+            action.read(renderable);
+            action.read(boundingBox.min.data);
+            action.read(boundingBox.max.data);
+            scene.setRenderableBoundingBox(renderable, boundingBox);
+            break;
+        }
         case ESceneActionId_AllocateRenderGroup:
         {
             UInt32 renderableCount = 0u;
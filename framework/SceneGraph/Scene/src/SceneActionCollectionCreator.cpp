@@ -268,6 +268,14 @@ namespace ramses_internal
         collection.write(startVertex);
     }
 
+    void SceneActionCollectionCreator::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        collection.beginWriteSceneAction(ESceneActionId_SetRenderableBoundingBox);
+        collection.write(renderableHandle);
+        collection.write(boundingBox.min.data);
+        collection.write(boundingBox.max.data);
+    }
+
     void SceneActionCollectionCreator::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         collection.beginWriteSceneAction(ESceneActionId_SetRenderableDataInstance);
@@ -8,10 +8,85 @@
 
 
 #include "Scene/SceneActionUtils.h"
+#include "PlatformAbstraction/PlatformMemory.h"
 #include <algorithm>
+#include <limits>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        static const UInt32 NotOverwritableSetter = std::numeric_limits<UInt32>::max();
+
+        // Returns number of payload bytes identifying the target of a setter action whose effect is fully
+        // replaced by a later action of same type and target, or NotOverwritableSetter for any other action
+        UInt32 GetSetterTargetKeySize(ESceneActionId type)
+        {
+            switch (type)
+            {
+            // handle, field and element count - a write with fewer elements does not replace all previous ones
+            case ESceneActionId_SetDataIntegerArray:
+            case ESceneActionId_SetDataFloatArray:
+            case ESceneActionId_SetDataVector2fArray:
+            case ESceneActionId_SetDataVector3fArray:
+            case ESceneActionId_SetDataVector4fArray:
+            case ESceneActionId_SetDataVector2iArray:
+            case ESceneActionId_SetDataVector3iArray:
+            case ESceneActionId_SetDataVector4iArray:
+            case ESceneActionId_SetDataMatrix22fArray:
+            case ESceneActionId_SetDataMatrix33fArray:
+            case ESceneActionId_SetDataMatrix44fArray:
+                return 3u * sizeof(UInt32);
+            // property type and node handle
+            case ESceneActionId_SetTransformComponent:
+            // handle and field/slot
+            case ESceneActionId_SetDataResource:
+            case ESceneActionId_SetDataTextureSamplerHandle:
+            case ESceneActionId_SetDataReference:
+            case ESceneActionId_SetRenderableDataInstance:
+                return 2u * sizeof(UInt32);
+            // handle
+            case ESceneActionId_SetRenderableStartIndex:
+            case ESceneActionId_SetRenderableIndexCount:
+            case ESceneActionId_SetRenderableVisibility:
+            case ESceneActionId_SetRenderableInstanceCount:
+            case ESceneActionId_SetRenderableStartVertex:
+            case ESceneActionId_SetRenderableBoundingBox:
+            case ESceneActionId_SetRenderableState:
+            case ESceneActionId_SetStateStencilOps:
+            case ESceneActionId_SetStateStencilFunc:
+            case ESceneActionId_SetStateDepthWrite:
+            case ESceneActionId_SetStateDepthFunc:
+            case ESceneActionId_SetStateScissorTest:
+            case ESceneActionId_SetStateCullMode:
+            case ESceneActionId_SetStateDrawMode:
+            case ESceneActionId_SetStateBlendOperations:
+            case ESceneActionId_SetStateBlendFactors:
+            case ESceneActionId_SetStateColorWriteMask:
+            case ESceneActionId_SetCameraFrustum:
+            case ESceneActionId_SetRenderPassClearColor:
+            case ESceneActionId_SetRenderPassClearFlag:
+            case ESceneActionId_SetRenderPassCamera:
+            case ESceneActionId_SetRenderPassRenderTarget:
+            case ESceneActionId_SetRenderPassRenderOrder:
+            case ESceneActionId_SetRenderPassEnabled:
+            case ESceneActionId_SetBlitPassRenderOrder:
+            case ESceneActionId_SetBlitPassEnabled:
+            case ESceneActionId_SetBlitPassRegions:
+            case ESceneActionId_SetPickableObjectId:
+            case ESceneActionId_SetPickableObjectCamera:
+            case ESceneActionId_SetPickableObjectEnabled:
+                return sizeof(UInt32);
+            // scene global state, only last one is relevant
+            case ESceneActionId_SetAckFlushState:
+            case ESceneActionId_Flush:
+                return 0u;
+            default:
+                return NotOverwritableSetter;
+            }
+        }
+    }
+
     UInt32 SceneActionCollectionUtils::CountNumberOfActionsOfType(const SceneActionCollection& actions, ESceneActionId type)
     {
         auto p = [&type](const SceneActionCollection::SceneActionReader& reader)-> bool
@@ -31,4 +106,79 @@ namespace ramses_internal
 
         return static_cast<UInt32>(std::count_if(actions.begin(),actions.end(), p));
     }
+
+    UInt32 SceneActionCollectionUtils::RemoveOverwrittenSetterActions(SceneActionCollection& actions)
+    {
+        OverwrittenSetterActionsTracker tracker;
+        const UInt32 numOverwritten = tracker.update(actions);
+        tracker.removeOverwrittenActions(actions);
+        return numOverwritten;
+    }
+
+    UInt32 OverwrittenSetterActionsTracker::update(const SceneActionCollection& actions)
+    {
+        const UInt32 numActions = actions.numberOfActions();
+        assert(numActions >= m_overwritten.size());
+        UInt32 numNewlyOverwritten = 0u;
+
+        for (UInt32 i = static_cast<UInt32>(m_overwritten.size()); i < numActions; ++i)
+        {
+            m_overwritten.push_back(false);
+            const auto action = actions[i];
+            const UInt32 keySize = GetSetterTargetKeySize(action.type());
+            if (keySize == NotOverwritableSetter)
+                continue;
+
+            assert(keySize <= action.size());
+            SceneActionSetterTarget target{ action.type(), { 0u, 0u, 0u } };
+            PlatformMemory::Copy(target.key, action.data(), keySize);
+            UInt32* lastSetterAction = m_lastSetterActionForTarget.get(target);
+            if (lastSetterAction != nullptr)
+            {
+                m_overwritten[*lastSetterAction] = true;
+                *lastSetterAction = i;
+                ++numNewlyOverwritten;
+            }
+            else
+            {
+                m_lastSetterActionForTarget.put(target, i);
+            }
+        }
+
+        m_numOverwritten += numNewlyOverwritten;
+        return numNewlyOverwritten;
+    }
+
+    void OverwrittenSetterActionsTracker::removeOverwrittenActions(SceneActionCollection& actions)
+    {
+        // tracker needs to be up to date with collection only if there is something to remove
+        if (m_numOverwritten == 0u)
+            return;
+        assert(actions.numberOfActions() == m_overwritten.size());
+
+        const UInt32 numActions = actions.numberOfActions();
+        std::vector<UInt32> compactedIndices(numActions);
+        SceneActionCollection compacted(actions.collectionData().size(), numActions - m_numOverwritten);
+        for (UInt32 i = 0u; i < numActions; ++i)
+        {
+            compactedIndices[i] = compacted.numberOfActions();
+            if (m_overwritten[i])
+                continue;
+            const auto action = actions[i];
+            compacted.addRawSceneActionInformation(action.type(), static_cast<UInt32>(compacted.collectionData().size()));
+            compacted.appendRawData(action.data(), action.size());
+        }
+        actions.swap(compacted);
+
+        // indexed setters are never overwritten, so they all keep their place in compacted collection
+        for (auto& lastSetterAction : m_lastSetterActionForTarget)
+            lastSetterAction.value = compactedIndices[lastSetterAction.value];
+        m_overwritten.assign(actions.numberOfActions(), false);
+        m_numOverwritten = 0u;
+    }
+
+    UInt32 OverwrittenSetterActionsTracker::getNumberOfOverwrittenActions() const
+    {
+        return m_numOverwritten;
+    }
 }
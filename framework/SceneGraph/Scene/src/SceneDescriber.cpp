@@ -138,7 +138,12 @@ namespace ramses_internal
         {
             if (source.isRenderableAllocated(r))
             {
-                collector.compoundRenderable(r, source.getRenderable(r));
+                const Renderable& renderable = source.getRenderable(r);
+                collector.compoundRenderable(r, renderable);
+                if (!renderable.boundingBox.isEmpty())
+                {
+                    collector.setRenderableBoundingBox(r, renderable.boundingBox);
+                }
             }
         }
     }
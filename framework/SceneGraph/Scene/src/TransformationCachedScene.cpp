@@ -9,9 +9,13 @@
 #include "Scene/TransformationCachedScene.h"
 #include "Utils/MemoryPoolExplicit.h"
 #include "Utils/MemoryPool.h"
+#include <algorithm>
+#include <limits>
 
 namespace ramses_internal
 {
+    static const UInt32 InvalidBatchIndex = std::numeric_limits<UInt32>::max();
+
     template <template<typename, typename> class MEMORYPOOL>
     TransformationCachedSceneT<MEMORYPOOL>::TransformationCachedSceneT(const SceneInfo& sceneInfo)
         : SceneT<MEMORYPOOL>(sceneInfo)
@@ -157,6 +161,117 @@ namespace ramses_internal
         return chainMatrix;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCacheBatch(ETransformationMatrixType matrixType, const NodeHandleVector& nodes) const
+    {
+        assert(m_batchNodes.empty());
+        m_batchIndexOfNode.resize(SceneT<MEMORYPOOL>::getNodeCount(), InvalidBatchIndex);
+
+        for (const auto node : nodes)
+            collectDirtyChainForBatch(matrixType, node);
+
+        // local matrices do not depend on each other, compute them in one pass over transformation data
+        const UInt32 batchSize = static_cast<UInt32>(m_batchNodes.size());
+        m_batchLocalMatrices.resize(batchSize);
+        m_batchHasLocalMatrix.resize(batchSize);
+        for (UInt32 i = 0u; i < batchSize; ++i)
+            m_batchHasLocalMatrix[i] = computeLocalMatrixForNode(matrixType, m_batchNodes[i], m_batchLocalMatrices[i]);
+
+        // parents are always stored before their children, so chain matrix of parent is final when child is processed
+        for (UInt32 i = 0u; i < batchSize; ++i)
+        {
+            Matrix44f& chainMatrix = m_batchMatrices[i];
+            const Int32 parentIndex = m_batchParentIndices[i];
+            if (parentIndex >= 0)
+                chainMatrix = m_batchMatrices[parentIndex];
+
+            if (m_batchHasLocalMatrix[i])
+            {
+                if (matrixType == ETransformationMatrixType_World)
+                    chainMatrix *= m_batchLocalMatrices[i];
+                else
+                    chainMatrix = m_batchLocalMatrices[i] * chainMatrix;
+            }
+        }
+
+        for (UInt32 i = 0u; i < batchSize; ++i)
+        {
+            const NodeHandle node = m_batchNodes[i];
+            setMatrixCache(matrixType, getMatrixCacheEntry(node), m_batchMatrices[i]);
+            m_batchIndexOfNode[node.asMemoryHandle()] = InvalidBatchIndex;
+        }
+
+        m_batchNodes.clear();
+        m_batchParentIndices.clear();
+        m_batchMatrices.clear();
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::collectDirtyChainForBatch(ETransformationMatrixType matrixType, NodeHandle node) const
+    {
+        const UInt32 chainStart = static_cast<UInt32>(m_batchNodes.size());
+        NodeHandle currentNode = node;
+        while (currentNode.isValid()
+            && m_batchIndexOfNode[currentNode.asMemoryHandle()] == InvalidBatchIndex
+            && getMatrixCacheEntry(currentNode).m_matrixDirty[matrixType])
+        {
+            m_batchNodes.push_back(currentNode);
+            currentNode = SceneT<MEMORYPOOL>::getParent(currentNode);
+        }
+
+        const UInt32 chainEnd = static_cast<UInt32>(m_batchNodes.size());
+        if (chainStart == chainEnd)
+            return;
+        std::reverse(m_batchNodes.begin() + chainStart, m_batchNodes.end());
+
+        // chain starts either from a node already in batch, from a clean ancestor or from root
+        Int32 chainParentIndex = -1;
+        Matrix44f chainStartMatrix = Matrix44f::Identity;
+        if (currentNode.isValid())
+        {
+            const UInt32 batchIndex = m_batchIndexOfNode[currentNode.asMemoryHandle()];
+            if (batchIndex != InvalidBatchIndex)
+                chainParentIndex = static_cast<Int32>(batchIndex);
+            else
+                chainStartMatrix = getMatrixCacheEntry(currentNode).m_matrix[matrixType];
+        }
+
+        for (UInt32 i = chainStart; i < chainEnd; ++i)
+        {
+            m_batchIndexOfNode[m_batchNodes[i].asMemoryHandle()] = i;
+            m_batchParentIndices.push_back(i == chainStart ? chainParentIndex : static_cast<Int32>(i - 1u));
+            m_batchMatrices.push_back(chainStartMatrix);
+        }
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    bool TransformationCachedSceneT<MEMORYPOOL>::computeLocalMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& localMatrix) const
+    {
+        if (getMatrixCacheEntry(node).m_isIdentity)
+            return false;
+
+        const TransformHandle* transformPtr = m_nodeToTransformMap.get(node);
+        if (transformPtr == nullptr)
+            return false;
+
+        const TransformHandle transform = *transformPtr;
+        if (matrixType == ETransformationMatrixType_World)
+        {
+            localMatrix = Matrix44f::TranslationScalingRotationEulerZYX(
+                SceneT<MEMORYPOOL>::getTranslation(transform),
+                SceneT<MEMORYPOOL>::getScaling(transform),
+                SceneT<MEMORYPOOL>::getRotation(transform));
+        }
+        else
+        {
+            localMatrix =
+                Matrix44f::RotationEulerZYX(SceneT<MEMORYPOOL>::getRotation(transform)).transpose() *
+                Matrix44f::Scaling(SceneT<MEMORYPOOL>::getScaling(transform).inverse()) *
+                Matrix44f::Translation(-SceneT<MEMORYPOOL>::getTranslation(transform));
+        }
+
+        return true;
+    }
 
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const
@@ -226,10 +341,10 @@ namespace ramses_internal
         if (transformPtr != nullptr)
         {
             const TransformHandle transform = *transformPtr;
-            const Matrix44f matrix =
-                Matrix44f::Translation(SceneT<MEMORYPOOL>::getTranslation(transform)) *
-                Matrix44f::Scaling(SceneT<MEMORYPOOL>::getScaling(transform)) *
-                Matrix44f::RotationEulerZYX(SceneT<MEMORYPOOL>::getRotation(transform));
+            const Matrix44f matrix = Matrix44f::TranslationScalingRotationEulerZYX(
+                SceneT<MEMORYPOOL>::getTranslation(transform),
+                SceneT<MEMORYPOOL>::getScaling(transform),
+                SceneT<MEMORYPOOL>::getRotation(transform));
 
             chainMatrix *= matrix;
         }
@@ -93,6 +93,12 @@ namespace ramses_internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderableBoundingBox(RenderableHandle renderableHandle, const BoundingBox& boundingBox)
+    {
+        m_actionCollector.setRenderableBoundingBox(renderableHandle, boundingBox);
+        flushPendingSceneActions();
+    }
+
     const Renderable& ActionTestScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_scene.getRenderable(renderableHandle);
@@ -382,6 +388,11 @@ namespace ramses_internal
         return m_scene.getLayoutOfDataInstance(containerHandle);
     }
 
+    UInt64 ActionTestScene::getDataInstanceVersion(DataInstanceHandle containerHandle) const
+    {
+        return m_scene.getDataInstanceVersion(containerHandle);
+    }
+
     const Float* ActionTestScene::getDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field) const
     {
         return m_scene.getDataFloatArray(containerHandle, field);
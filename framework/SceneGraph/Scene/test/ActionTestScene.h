@@ -42,6 +42,7 @@ namespace ramses_internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) override;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, UInt32 startVertex) override;
+        virtual void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) override;
         virtual const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const override;
 
         // Render state
@@ -109,6 +110,7 @@ namespace ramses_internal
         virtual bool                        isDataInstanceAllocated         (DataInstanceHandle containerHandle) const override;
         virtual UInt32                      getDataInstanceCount            () const override;
         virtual DataLayoutHandle            getLayoutOfDataInstance         (DataInstanceHandle containerHandle) const override;
+        UInt64                              getDataInstanceVersion          (DataInstanceHandle containerHandle) const;
 
         virtual const Float*                getDataFloatArray               (DataInstanceHandle containerHandle, DataFieldHandle field) const override;
         virtual const Vector2*              getDataVector2fArray            (DataInstanceHandle containerHandle, DataFieldHandle field) const override;
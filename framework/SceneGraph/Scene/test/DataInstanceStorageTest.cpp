@@ -0,0 +1,102 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/DataInstanceStorage.h"
+#include "framework_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class ADataInstanceStorage : public testing::Test
+    {
+    protected:
+        static bool IsZero(const Byte* block, UInt32 size)
+        {
+            return std::all_of(block, block + size, [](Byte b) { return b == 0u; });
+        }
+
+        DataInstanceStorage storage;
+    };
+
+    TEST_F(ADataInstanceStorage, hasNoChunksInitially)
+    {
+        EXPECT_EQ(0u, storage.getChunkCount());
+    }
+
+    TEST_F(ADataInstanceStorage, returnsNullForZeroSizeWithoutAllocatingChunk)
+    {
+        EXPECT_EQ(nullptr, storage.allocate(0u));
+        EXPECT_EQ(0u, storage.getChunkCount());
+        storage.release(nullptr, 0u);
+    }
+
+    TEST_F(ADataInstanceStorage, returnsZeroInitializedAlignedBlock)
+    {
+        const Byte* block = storage.allocate(13u);
+        ASSERT_NE(nullptr, block);
+        EXPECT_TRUE(IsZero(block, 13u));
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(block) % DataInstanceStorage::BlockAlignment);
+    }
+
+    TEST_F(ADataInstanceStorage, placesBlocksOfSameSizeNextToEachOther)
+    {
+        const Byte* block1 = storage.allocate(24u);
+        storage.allocate(4u);
+        const Byte* block2 = storage.allocate(24u);
+        const Byte* block3 = storage.allocate(20u);
+
+        EXPECT_EQ(block1 + 24u, block2);
+        // sizes are padded to alignment, so 20 bytes share the bucket of 24 bytes
+        EXPECT_EQ(block2 + 24u, block3);
+        EXPECT_EQ(2u, storage.getChunkCount());
+    }
+
+    TEST_F(ADataInstanceStorage, needsFewChunksForManyBlocks)
+    {
+        std::vector<const Byte*> blocks;
+        for (UInt32 i = 0u; i < 10000u; ++i)
+            blocks.push_back(storage.allocate(80u));
+
+        EXPECT_GT(20u, storage.getChunkCount());
+        for (UInt32 i = 1u; i < blocks.size(); ++i)
+            EXPECT_NE(blocks[i - 1], blocks[i]);
+    }
+
+    TEST_F(ADataInstanceStorage, keepsBlocksInPlaceWhenAllocatingMore)
+    {
+        Byte* block = storage.allocate(8u);
+        block[0] = 42u;
+        for (UInt32 i = 0u; i < 1000u; ++i)
+            storage.allocate(8u);
+
+        EXPECT_EQ(42u, block[0]);
+    }
+
+    TEST_F(ADataInstanceStorage, reusesReleasedBlockAndZeroesIt)
+    {
+        Byte* block = storage.allocate(16u);
+        std::fill(block, block + 16u, Byte(0xFF));
+        storage.release(block, 16u);
+
+        Byte* newBlock = storage.allocate(16u);
+        EXPECT_EQ(block, newBlock);
+        EXPECT_TRUE(IsZero(newBlock, 16u));
+        EXPECT_EQ(1u, storage.getChunkCount());
+    }
+
+    TEST_F(ADataInstanceStorage, doesNotReuseReleasedBlockForOtherSize)
+    {
+        Byte* block = storage.allocate(16u);
+        storage.release(block, 16u);
+
+        EXPECT_NE(block, storage.allocate(32u));
+    }
+}
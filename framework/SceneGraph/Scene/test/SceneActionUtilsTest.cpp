@@ -12,6 +12,7 @@
 
 #include "gtest/gtest.h"
 #include "Scene/SceneActionUtils.h"
+#include "Scene/SceneActionCollectionCreator.h"
 #include "Collections/Vector.h"
 
 namespace ramses_internal
@@ -133,6 +134,132 @@ namespace ramses_internal
         EXPECT_EQ(0u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actionsEmpty, singleType));
         EXPECT_EQ(0u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actionsEmpty, multiType));
     }
+    TEST_F(SceneActionVectorUtilsTest, RemovesNothingIfNoSetterIsOverwritten)
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.allocateNode(0u, NodeHandle(1u));
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(1.f));
+        creator.setTransformComponent(ETransformPropertyType_Rotation, TransformHandle(1u), Vector3(2.f));
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(2u), Vector3(3.f));
+        const SceneActionCollection expectedActions = actions.copy();
+
+        EXPECT_EQ(0u, SceneActionCollectionUtils::RemoveOverwrittenSetterActions(actions));
+        EXPECT_EQ(expectedActions, actions);
+    }
+
+    TEST_F(SceneActionVectorUtilsTest, KeepsOnlyLastWriteOfSetterAndOrderOfOtherActions)
+    {
+        const Float values1[] = { 1.f, 2.f };
+        const Float values2[] = { 3.f, 4.f };
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(1.f));
+        creator.setDataFloatArray(DataInstanceHandle(2u), DataFieldHandle(0u), 2u, values1);
+        creator.allocateNode(0u, NodeHandle(3u));
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(2.f));
+        creator.setDataFloatArray(DataInstanceHandle(2u), DataFieldHandle(0u), 2u, values2);
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(3.f));
+
+        SceneActionCollection expectedActions;
+        SceneActionCollectionCreator expectedCreator(expectedActions);
+        expectedCreator.allocateNode(0u, NodeHandle(3u));
+        expectedCreator.setDataFloatArray(DataInstanceHandle(2u), DataFieldHandle(0u), 2u, values2);
+        expectedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(3.f));
+
+        EXPECT_EQ(3u, SceneActionCollectionUtils::RemoveOverwrittenSetterActions(actions));
+        EXPECT_EQ(expectedActions, actions);
+    }
+
+    TEST_F(SceneActionVectorUtilsTest, KeepsDataArrayWritesWithDifferentElementCount)
+    {
+        const Float values[] = { 1.f, 2.f };
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.setDataFloatArray(DataInstanceHandle(2u), DataFieldHandle(0u), 2u, values);
+        creator.setDataFloatArray(DataInstanceHandle(2u), DataFieldHandle(0u), 1u, values);
+        const SceneActionCollection expectedActions = actions.copy();
+
+        EXPECT_EQ(0u, SceneActionCollectionUtils::RemoveOverwrittenSetterActions(actions));
+        EXPECT_EQ(expectedActions, actions);
+    }
+
+    TEST_F(SceneActionVectorUtilsTest, KeepsOnlyLastFlushAndAckFlushState)
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.setAckFlushState(true);
+        creator.flush(1u, false);
+        creator.allocateNode(0u, NodeHandle(3u));
+        creator.setAckFlushState(false);
+        creator.flush(2u, false);
+
+        SceneActionCollection expectedActions;
+        SceneActionCollectionCreator expectedCreator(expectedActions);
+        expectedCreator.allocateNode(0u, NodeHandle(3u));
+        expectedCreator.setAckFlushState(false);
+        expectedCreator.flush(2u, false);
+
+        EXPECT_EQ(2u, SceneActionCollectionUtils::RemoveOverwrittenSetterActions(actions));
+        EXPECT_EQ(expectedActions, actions);
+    }
+
+    TEST_F(SceneActionVectorUtilsTest, TrackerFindsSettersOverwrittenByAppendedActions)
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(1.f));
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(2u), Vector3(1.f));
+
+        OverwrittenSetterActionsTracker tracker;
+        EXPECT_EQ(0u, tracker.update(actions));
+
+        SceneActionCollection appendedActions;
+        SceneActionCollectionCreator appendedCreator(appendedActions);
+        appendedCreator.allocateNode(0u, NodeHandle(3u));
+        appendedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(2.f));
+        actions.append(appendedActions);
+        EXPECT_EQ(1u, tracker.update(actions));
+        EXPECT_EQ(1u, tracker.getNumberOfOverwrittenActions());
+
+        SceneActionCollection expectedActions;
+        SceneActionCollectionCreator expectedCreator(expectedActions);
+        expectedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(2u), Vector3(1.f));
+        expectedCreator.allocateNode(0u, NodeHandle(3u));
+        expectedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(2.f));
+
+        tracker.removeOverwrittenActions(actions);
+        EXPECT_EQ(0u, tracker.getNumberOfOverwrittenActions());
+        EXPECT_EQ(expectedActions, actions);
+    }
+
+    TEST_F(SceneActionVectorUtilsTest, TrackerKeepsTrackingSettersAfterRemovingOverwrittenActions)
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions);
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(1.f));
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(2.f));
+        creator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(2u), Vector3(1.f));
+
+        OverwrittenSetterActionsTracker tracker;
+        EXPECT_EQ(1u, tracker.update(actions));
+        tracker.removeOverwrittenActions(actions);
+
+        SceneActionCollection appendedActions;
+        SceneActionCollectionCreator appendedCreator(appendedActions);
+        appendedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(2u), Vector3(2.f));
+        actions.append(appendedActions);
+        EXPECT_EQ(1u, tracker.update(actions));
+        tracker.removeOverwrittenActions(actions);
+
+        SceneActionCollection expectedActions;
+        SceneActionCollectionCreator expectedCreator(expectedActions);
+        expectedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(1u), Vector3(2.f));
+        expectedCreator.setTransformComponent(ETransformPropertyType_Translation, TransformHandle(2u), Vector3(2.f));
+        EXPECT_EQ(expectedActions, actions);
+    }
 }
 
 #endif
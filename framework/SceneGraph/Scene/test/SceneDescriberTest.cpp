@@ -241,6 +241,23 @@ namespace ramses_internal
         EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId_CompoundRenderable));
     }
 
+    TEST_F(SceneDescriberTest, describesBoundingBoxOfRenderableOnlyIfSet)
+    {
+        const RenderableHandle renderableWithoutBounds = m_scene.allocateRenderable(m_scene.allocateNode());
+        const RenderableHandle renderableWithBounds = m_scene.allocateRenderable(m_scene.allocateNode());
+        const BoundingBox boundingBox(Vector3(-1.f, -2.f, -3.f), Vector3(1.f, 2.f, 3.f));
+        m_scene.setRenderableBoundingBox(renderableWithBounds, boundingBox);
+
+        SceneDescriber::describeScene<IScene>(m_scene, creator);
+        EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(actions, ESceneActionId_SetRenderableBoundingBox));
+
+        Scene newScene;
+        SceneActionApplierHelper sceneCreator(newScene);
+        sceneCreator.applyActionsOnScene(actions);
+        EXPECT_TRUE(newScene.getRenderable(renderableWithoutBounds).boundingBox.isEmpty());
+        EXPECT_EQ(boundingBox, newScene.getRenderable(renderableWithBounds).boundingBox);
+    }
+
     TEST_F(SceneDescriberTest, checksDescriptionActionsForSceneWithStateAndCompoundAction)
     {
         createState();
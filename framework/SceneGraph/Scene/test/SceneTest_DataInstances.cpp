@@ -199,4 +199,86 @@ namespace ramses_internal
         EXPECT_FALSE(dataResourceOut.dataBuffer.isValid());
         EXPECT_EQ(inDivisor, dataResourceOut.instancingDivisor);
     }
+
+    TYPED_TEST(AScene, DataInstancesHaveDifferentVersions)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType_Float) }, ResourceContentHash::Invalid());
+        const DataInstanceHandle instance1 = this->m_scene.allocateDataInstance(dataLayout);
+        const DataInstanceHandle instance2 = this->m_scene.allocateDataInstance(dataLayout);
+
+        EXPECT_NE(0u, this->m_scene.getDataInstanceVersion(instance1));
+        EXPECT_NE(0u, this->m_scene.getDataInstanceVersion(instance2));
+        EXPECT_NE(this->m_scene.getDataInstanceVersion(instance1), this->m_scene.getDataInstanceVersion(instance2));
+    }
+
+    TYPED_TEST(AScene, ChangesDataInstanceVersionIfDataChanged)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType_Float), DataFieldInfo(EDataType_DataReference) }, ResourceContentHash::Invalid());
+        const DataInstanceHandle instance = this->m_scene.allocateDataInstance(dataLayout);
+        const UInt64 initialVersion = this->m_scene.getDataInstanceVersion(instance);
+
+        this->m_scene.setDataSingleFloat(instance, DataFieldHandle(0u), 1.f);
+        const UInt64 versionAfterFloatChange = this->m_scene.getDataInstanceVersion(instance);
+        EXPECT_NE(initialVersion, versionAfterFloatChange);
+
+        this->m_scene.setDataReference(instance, DataFieldHandle(1u), DataInstanceHandle(13u));
+        EXPECT_NE(versionAfterFloatChange, this->m_scene.getDataInstanceVersion(instance));
+    }
+
+    // scene action applier writes data in place, version cannot be kept there when setting equal data
+    TEST(ASceneDataInstance, keepsVersionIfSetDataIsEqual)
+    {
+        Scene scene;
+        const DataLayoutHandle dataLayout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Float), DataFieldInfo(EDataType_DataReference) }, ResourceContentHash::Invalid());
+        const DataInstanceHandle instance = scene.allocateDataInstance(dataLayout);
+        const UInt64 initialVersion = scene.getDataInstanceVersion(instance);
+
+        scene.setDataSingleFloat(instance, DataFieldHandle(0u), 0.f);
+        scene.setDataReference(instance, DataFieldHandle(1u), DataInstanceHandle::Invalid());
+        EXPECT_EQ(initialVersion, scene.getDataInstanceVersion(instance));
+
+        scene.setDataSingleFloat(instance, DataFieldHandle(0u), 1.f);
+        const UInt64 versionAfterFloatChange = scene.getDataInstanceVersion(instance);
+        EXPECT_NE(initialVersion, versionAfterFloatChange);
+
+        scene.setDataSingleFloat(instance, DataFieldHandle(0u), 1.f);
+        EXPECT_EQ(versionAfterFloatChange, scene.getDataInstanceVersion(instance));
+    }
+
+    TYPED_TEST(AScene, InitializesDataInstanceFieldsWithZeroWhenReusingMemoryOfReleasedInstance)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType_Float), DataFieldInfo(EDataType_DataReference) }, ResourceContentHash::Invalid());
+        const DataInstanceHandle instance = this->m_scene.allocateDataInstance(dataLayout, DataInstanceHandle(1u));
+        this->m_scene.setDataSingleFloat(instance, DataFieldHandle(0u), 13.f);
+        this->m_scene.setDataReference(instance, DataFieldHandle(1u), DataInstanceHandle(7u));
+        this->m_scene.releaseDataInstance(instance);
+
+        const DataInstanceHandle newInstance = this->m_scene.allocateDataInstance(dataLayout, DataInstanceHandle(2u));
+        EXPECT_EQ(0.f, this->m_scene.getDataSingleFloat(newInstance, DataFieldHandle(0u)));
+        EXPECT_FALSE(this->m_scene.getDataReference(newInstance, DataFieldHandle(1u)).isValid());
+    }
+
+    TYPED_TEST(AScene, KeepsDataOfManyInstancesOfSameLayoutSeparate)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType_Vector4F), DataFieldInfo(EDataType_Matrix44F) }, ResourceContentHash::Invalid());
+        const DataLayoutHandle otherLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType_Int32) }, ResourceContentHash::Invalid());
+
+        constexpr UInt32 InstanceCount = 1000u;
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+        {
+            const DataInstanceHandle instance = this->m_scene.allocateDataInstance(dataLayout, DataInstanceHandle(2u * i));
+            this->m_scene.setDataSingleVector4f(instance, DataFieldHandle(0u), Vector4(static_cast<Float>(i)));
+            this->m_scene.setDataSingleMatrix44f(instance, DataFieldHandle(1u), Matrix44f(Vector4(static_cast<Float>(i)), Vector4(1.f), Vector4(2.f), Vector4(3.f)));
+
+            const DataInstanceHandle otherInstance = this->m_scene.allocateDataInstance(otherLayout, DataInstanceHandle(2u * i + 1u));
+            this->m_scene.setDataSingleInteger(otherInstance, DataFieldHandle(0u), -static_cast<Int32>(i));
+        }
+
+        for (UInt32 i = 0u; i < InstanceCount; ++i)
+        {
+            EXPECT_EQ(Vector4(static_cast<Float>(i)), this->m_scene.getDataSingleVector4f(DataInstanceHandle(2u * i), DataFieldHandle(0u)));
+            EXPECT_EQ(Matrix44f(Vector4(static_cast<Float>(i)), Vector4(1.f), Vector4(2.f), Vector4(3.f)), this->m_scene.getDataSingleMatrix44f(DataInstanceHandle(2u * i), DataFieldHandle(1u)));
+            EXPECT_EQ(-static_cast<Int32>(i), this->m_scene.getDataSingleInteger(DataInstanceHandle(2u * i + 1u), DataFieldHandle(0u)));
+        }
+    }
 }
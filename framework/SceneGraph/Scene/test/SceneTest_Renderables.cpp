@@ -122,4 +122,17 @@ namespace ramses_internal
         this->m_scene.setRenderableStartVertex(renderable, 132u);
         EXPECT_EQ(132u, this->m_scene.getRenderable(renderable).startVertex);
     }
+
+    TYPED_TEST(AScene, SetsBoundingBoxOfRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode());
+        EXPECT_TRUE(this->m_scene.getRenderable(renderable).boundingBox.isEmpty());
+
+        const BoundingBox boundingBox(Vector3(-1.f, -2.f, -3.f), Vector3(4.f, 5.f, 6.f));
+        this->m_scene.setRenderableBoundingBox(renderable, boundingBox);
+        EXPECT_EQ(boundingBox, this->m_scene.getRenderable(renderable).boundingBox);
+
+        this->m_scene.setRenderableBoundingBox(renderable, BoundingBox());
+        EXPECT_TRUE(this->m_scene.getRenderable(renderable).boundingBox.isEmpty());
+    }
 }
@@ -72,6 +72,7 @@ namespace ramses_internal
             scene.setRenderableVisibility(renderable, EVisibilityMode::Invisible);
             scene.setRenderableInstanceCount(renderable, renderableInstanceCount);
             scene.setRenderableStartVertex(renderable, startVertex);
+            scene.setRenderableBoundingBox(renderable, renderableBoundingBox);
 
             scene.allocateRenderable(child, renderable2);
 
@@ -268,6 +269,7 @@ namespace ramses_internal
             EXPECT_EQ(EVisibilityMode::Invisible, renderableData.visibilityMode);
             EXPECT_EQ(renderableInstanceCount, renderableData.instanceCount);
             EXPECT_EQ(startVertex, renderableData.startVertex);
+            EXPECT_EQ(renderableBoundingBox, renderableData.boundingBox);
         }
 
         template <typename OTHERSCENE>
@@ -628,6 +630,7 @@ namespace ramses_internal
         const UInt32                startIndex                      = 12u;
         const UInt32                indexCount                      = 13u;
         const UInt32                startVertex                     = 14u;
+        const BoundingBox           renderableBoundingBox           { Vector3(-1.f, -2.f, -3.f), Vector3(4.f, 5.f, 6.f) };
         const Vector3               t1Translation                   {1, 2, 3};
         const Vector3               t1Rotation                      {4, 5, 6};
         const Vector3               t1Scaling                       {7,8, 9};
@@ -264,4 +264,74 @@ namespace ramses_internal
 
         this->expectCorrectMatrices(child, expectedUpdatedChildWorldMatrix, expectedUpdatedChildObjectMatrix);
     }
+
+    TEST_F(ATransformationCachedScene, BatchUpdateGivesSameMatricesAsSingleNodeUpdate)
+    {
+        // parent with two children, one of them with a grandchild, node without transform in between
+        const auto createHierarchy = [](TransformationCachedScene& s)
+        {
+            const NodeHandle parent = s.allocateNode(0u, NodeHandle(10u));
+            const NodeHandle childLeft = s.allocateNode(0u, NodeHandle(11u));
+            const NodeHandle childRight = s.allocateNode(0u, NodeHandle(12u));
+            const NodeHandle nodeInBetween = s.allocateNode(0u, NodeHandle(13u));
+            const NodeHandle grandChild = s.allocateNode(0u, NodeHandle(14u));
+            s.addChildToNode(parent, childLeft);
+            s.addChildToNode(parent, childRight);
+            s.addChildToNode(childLeft, nodeInBetween);
+            s.addChildToNode(nodeInBetween, grandChild);
+
+            const TransformHandle parentTransform = s.allocateTransform(parent);
+            const TransformHandle childLeftTransform = s.allocateTransform(childLeft);
+            const TransformHandle grandChildTransform = s.allocateTransform(grandChild);
+            s.setTranslation(parentTransform, Vector3(1.f, 2.f, 3.f));
+            s.setRotation(parentTransform, Vector3(10.f, 20.f, 30.f));
+            s.setScaling(childLeftTransform, Vector3(2.f, 3.f, 4.f));
+            s.setRotation(grandChildTransform, Vector3(40.f, 50.f, 60.f));
+            s.setTranslation(grandChildTransform, Vector3(-1.f, 5.f, 7.f));
+
+            return NodeHandleVector{ parent, childLeft, childRight, nodeInBetween, grandChild };
+        };
+
+        TransformationCachedScene referenceScene;
+        const NodeHandleVector allNodes = createHierarchy(this->scene);
+        createHierarchy(referenceScene);
+
+        const NodeHandleVector nodesToUpdate{ allNodes[4], allNodes[2], allNodes[1], allNodes[4] };
+        this->scene.updateMatrixCacheBatch(ETransformationMatrixType_World, nodesToUpdate);
+        this->scene.updateMatrixCacheBatch(ETransformationMatrixType_Object, nodesToUpdate);
+
+        for (const auto node : allNodes)
+        {
+            EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, node));
+            EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_Object, node));
+            EXPECT_TRUE(matrixFloatEquals(referenceScene.updateMatrixCache(ETransformationMatrixType_World, node), this->scene.updateMatrixCache(ETransformationMatrixType_World, node)));
+            EXPECT_TRUE(matrixFloatEquals(referenceScene.updateMatrixCache(ETransformationMatrixType_Object, node), this->scene.updateMatrixCache(ETransformationMatrixType_Object, node)));
+        }
+    }
+
+    TEST_F(ATransformationCachedScene, BatchUpdateStartsFromCleanAncestor)
+    {
+        const NodeHandle child = this->scene.allocateNode();
+        const TransformHandle childTransform = this->scene.allocateTransform(child);
+        this->scene.addChildToNode(this->nodeWithTransform, child);
+        this->scene.setTranslation(this->transform, Vector3(1.f, 2.f, 3.f));
+        this->scene.setTranslation(childTransform, Vector3(4.f, 5.f, 6.f));
+
+        this->scene.updateMatrixCacheBatch(ETransformationMatrixType_World, { this->nodeWithTransform });
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithTransform));
+        EXPECT_TRUE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, child));
+
+        this->scene.setTranslation(childTransform, Vector3(7.f, 8.f, 9.f));
+        this->scene.updateMatrixCacheBatch(ETransformationMatrixType_World, { child });
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, child));
+        EXPECT_TRUE(matrixFloatEquals(Matrix44f::Translation(Vector3(8.f, 10.f, 12.f)), this->scene.updateMatrixCache(ETransformationMatrixType_World, child)));
+    }
+
+    TEST_F(ATransformationCachedScene, BatchUpdateIgnoresInvalidNodes)
+    {
+        this->scene.setScaling(this->transform, Vector3(0.5f));
+        this->scene.updateMatrixCacheBatch(ETransformationMatrixType_World, { NodeHandle::Invalid(), this->nodeWithTransform });
+        EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->nodeWithTransform));
+        this->expectCorrectMatrices(this->nodeWithTransform, Matrix44f::Scaling(0.5f), Matrix44f::Scaling(2.f));
+    }
 }
@@ -90,6 +90,7 @@ namespace ramses_internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) = 0;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, UInt32 instanceCount) = 0;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, UInt32 startVertex) = 0;
+        virtual void                        setRenderableBoundingBox        (RenderableHandle renderableHandle, const BoundingBox& boundingBox) = 0;
         virtual const Renderable&           getRenderable                   (RenderableHandle renderableHandle) const = 0;
 
         // Render state
@@ -12,6 +12,7 @@
 #include "SceneAPI/ResourceContentHash.h"
 #include "SceneAPI/Handles.h"
 #include "SceneAPI/ERenderableDataSlotType.h"
+#include "Math3d/BoundingBox.h"
 
 namespace ramses_internal
 {
@@ -34,6 +35,9 @@ namespace ramses_internal
 
         DataInstanceHandle dataInstances[ERenderableDataSlotType_MAX_SLOTS];
         RenderStateHandle renderState;
+
+        // optional bounds in local space of renderable's node, empty box means renderable is never culled
+        BoundingBox boundingBox;
     };
 }
 
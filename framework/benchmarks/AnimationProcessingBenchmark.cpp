@@ -0,0 +1,93 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneDataBinding.h"
+#include "Animation/AnimationData.h"
+#include "Animation/AnimationDataBind.h"
+#include "Animation/AnimationLogic.h"
+#include "Animation/AnimationProcessing.h"
+#include "Animation/SplineKey.h"
+#include "Animation/SplineKeyTangents.h"
+#include "TaskFramework/ThreadedTaskExecutor.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // animates translation (linear) and rotation (bezier) of every node in scene, all animations play for the whole benchmark
+        void CreateAnimations(AnimationData& animationData, IScene& scene, UInt32 nodeCount)
+        {
+            typedef DataBindContainerToTraitsSelector<IScene>::ContainerTraitsClassType ContainerTraitsClass;
+
+            Spline<SplineKey, Vector3> translationSpline;
+            Spline<SplineKeyTangents, Vector3> rotationSpline;
+            for (SplineTimeStamp keyTime = 0u; keyTime <= 10000u; keyTime += 500u)
+            {
+                const Float value = static_cast<Float>(keyTime % 1500u);
+                translationSpline.setKey(keyTime, SplineKey<Vector3>(Vector3(value, -value, 0.5f * value)));
+                rotationSpline.setKey(keyTime, SplineKeyTangents<Vector3>(Vector3(0.f, value * 0.1f, 0.f), Vector2(-100.f, 0.f), Vector2(100.f, 0.f)));
+            }
+            const SplineHandle translationSplineHandle = animationData.allocateSpline(translationSpline);
+            const SplineHandle rotationSplineHandle = animationData.allocateSpline(rotationSpline);
+
+            for (UInt32 i = 0u; i < nodeCount; ++i)
+            {
+                const MemoryHandle transform = TransformHandle(i).asMemoryHandle();
+                const Bool animateTranslation = (i % 2u == 0u);
+                const DataBindHandle dataBind = animationData.allocateDataBinding(AnimationDataBind<IScene, Vector3, MemoryHandle>(scene, transform,
+                    animateTranslation ? ContainerTraitsClass::TransformNode_Translation : ContainerTraitsClass::TransformNode_Rotation));
+                const AnimationInstanceHandle instance = animateTranslation ?
+                    animationData.allocateAnimationInstance(translationSplineHandle, EInterpolationType_Linear) :
+                    animationData.allocateAnimationInstance(rotationSplineHandle, EInterpolationType_Bezier);
+                animationData.addDataBindingToAnimationInstance(instance, dataBind);
+
+                const AnimationHandle animation = animationData.allocateAnimation(instance);
+                animationData.setAnimationProperties(animation, 1.f, Animation::EAnimationFlags_Looping, 10000u);
+                animationData.setAnimationTimeRange(animation, AnimationTime(0u), AnimationTime(std::numeric_limits<UInt32>::max()));
+            }
+        }
+
+        void AnimationCountsAndParallelTasks(benchmark::internal::Benchmark* bench)
+        {
+            for (const int animationCount : { 1000, 10000, 50000 })
+            {
+                for (const int parallelTaskCount : { 0, 1, 3 })
+                    bench->Args({ animationCount, parallelTaskCount });
+            }
+        }
+    }
+
+    // one update of renderer side animation system with thousands of concurrently playing animations
+    static void BM_AnimationProcessing_ProcessActiveAnimations(benchmark::State& state)
+    {
+        const UInt32 animationCount = static_cast<UInt32>(state.range(0));
+        const UInt32 parallelTaskCount = static_cast<UInt32>(state.range(1));
+
+        Scene scene;
+        SyntheticScene::Create(scene, animationCount);
+        AnimationData animationData;
+        AnimationLogic logic(animationData);
+        ThreadedTaskExecutor taskExecutor(3u);
+        AnimationProcessing processing(animationData, &taskExecutor, parallelTaskCount);
+        logic.addListener(&processing);
+        CreateAnimations(animationData, scene, animationCount);
+
+        AnimationTime::TimeStamp time = 0u;
+        for (auto _ : state)
+        {
+            time += 16u;
+            logic.setTime(time);
+        }
+        benchmark::DoNotOptimize(scene.getTranslation(TransformHandle(0u)));
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * animationCount);
+    }
+    BENCHMARK(BM_AnimationProcessing_ProcessActiveAnimations)->Apply(AnimationCountsAndParallelTasks)->UseRealTime();
+}
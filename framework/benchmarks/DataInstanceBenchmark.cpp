@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "Scene/Scene.h"
+#include "Math3d/Vector4.h"
+#include "Math3d/Matrix44f.h"
+
+namespace ramses_internal
+{
+    static void BM_Scene_AllocateDataInstances(benchmark::State& state)
+    {
+        const UInt32 instanceCount = static_cast<UInt32>(state.range(0));
+        for (auto _ : state)
+        {
+            Scene scene;
+            const DataLayoutHandle uniformLayout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Vector4F), DataFieldInfo(EDataType_Matrix44F) }, ResourceContentHash(0x1234u, 0u));
+            const DataLayoutHandle geometryLayout = scene.allocateDataLayout({ DataFieldInfo(EDataType_Indices), DataFieldInfo(EDataType_Vector3Buffer) }, ResourceContentHash(0x5678u, 0u));
+            for (UInt32 i = 0u; i < instanceCount; ++i)
+            {
+                scene.allocateDataInstance(uniformLayout);
+                scene.allocateDataInstance(geometryLayout);
+            }
+            benchmark::DoNotOptimize(scene.getDataInstanceCount());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * instanceCount * 2);
+    }
+    BENCHMARK(BM_Scene_AllocateDataInstances)->Apply(SyntheticScene::SceneSizes);
+
+    // reads the uniforms of every renderable in render order, like the renderer does when executing a frame
+    static void BM_Scene_ReadRenderableUniforms(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        Scene scene;
+        SyntheticScene::Create(scene, nodeCount);
+
+        for (auto _ : state)
+        {
+            Float sum = 0.f;
+            for (UInt32 i = 0u; i < nodeCount; ++i)
+            {
+                const DataInstanceHandle uniforms = scene.getRenderable(RenderableHandle(i)).dataInstances[ERenderableDataSlotType_Uniforms];
+                sum += scene.getDataSingleVector4f(uniforms, DataFieldHandle(0u)).x;
+                sum += scene.getDataSingleMatrix44f(uniforms, DataFieldHandle(1u)).m11;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+    BENCHMARK(BM_Scene_ReadRenderableUniforms)->Apply(SyntheticScene::SceneSizes);
+}
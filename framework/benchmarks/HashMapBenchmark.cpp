@@ -0,0 +1,198 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "Collections/HashMap.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include <vector>
+#include <unordered_map>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        std::vector<ResourceContentHash> CreateKeys(UInt32 count)
+        {
+            std::vector<ResourceContentHash> keys;
+            keys.reserve(count);
+            UInt64 state = 0x9E3779B97F4A7C15u;
+            for (UInt32 i = 0u; i < count; ++i)
+            {
+                state ^= state << 13u;
+                state ^= state >> 7u;
+                state ^= state << 17u;
+                keys.push_back(ResourceContentHash(state, i));
+            }
+            return keys;
+        }
+
+        // std::unordered_map as baseline for HashMap, both accessed through the same helpers
+        using StdMap = std::unordered_map<ResourceContentHash, UInt32>;
+
+        void Put(HashMap<ResourceContentHash, UInt32>& map, const ResourceContentHash& key, UInt32 value)
+        {
+            map.put(key, value);
+        }
+
+        void Put(StdMap& map, const ResourceContentHash& key, UInt32 value)
+        {
+            map[key] = value;
+        }
+
+        UInt32 FindValue(const HashMap<ResourceContentHash, UInt32>& map, const ResourceContentHash& key)
+        {
+            return map.find(key)->value;
+        }
+
+        UInt32 FindValue(const StdMap& map, const ResourceContentHash& key)
+        {
+            return map.find(key)->second;
+        }
+
+        bool Contains(const HashMap<ResourceContentHash, UInt32>& map, const ResourceContentHash& key)
+        {
+            return map.contains(key);
+        }
+
+        bool Contains(const StdMap& map, const ResourceContentHash& key)
+        {
+            return map.count(key) != 0u;
+        }
+
+        UInt32 Value(const HashMap<ResourceContentHash, UInt32>::Pair& entry)
+        {
+            return entry.value;
+        }
+
+        UInt32 Value(const StdMap::value_type& entry)
+        {
+            return entry.second;
+        }
+
+        void Remove(HashMap<ResourceContentHash, UInt32>& map, const ResourceContentHash& key)
+        {
+            map.remove(key);
+        }
+
+        void Remove(StdMap& map, const ResourceContentHash& key)
+        {
+            map.erase(key);
+        }
+    }
+
+    template <typename MapType>
+    static void BM_Put(benchmark::State& state)
+    {
+        const auto keys = CreateKeys(static_cast<UInt32>(state.range(0)));
+        for (auto _ : state)
+        {
+            MapType map;
+            for (UInt32 i = 0u; i < keys.size(); ++i)
+                Put(map, keys[i], i);
+            benchmark::DoNotOptimize(map.size());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * keys.size());
+    }
+    BENCHMARK_TEMPLATE(BM_Put, HashMap<ResourceContentHash, UInt32>)->Apply(SyntheticScene::SceneSizes);
+    BENCHMARK_TEMPLATE(BM_Put, StdMap)->Apply(SyntheticScene::SceneSizes);
+
+    template <typename MapType>
+    static void BM_Reserve_Put(benchmark::State& state)
+    {
+        const auto keys = CreateKeys(static_cast<UInt32>(state.range(0)));
+        for (auto _ : state)
+        {
+            MapType map;
+            map.reserve(keys.size());
+            for (UInt32 i = 0u; i < keys.size(); ++i)
+                Put(map, keys[i], i);
+            benchmark::DoNotOptimize(map.size());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * keys.size());
+    }
+    BENCHMARK_TEMPLATE(BM_Reserve_Put, HashMap<ResourceContentHash, UInt32>)->Apply(SyntheticScene::SceneSizes);
+    BENCHMARK_TEMPLATE(BM_Reserve_Put, StdMap)->Apply(SyntheticScene::SceneSizes);
+
+    template <typename MapType>
+    static void BM_Find(benchmark::State& state)
+    {
+        const auto keys = CreateKeys(static_cast<UInt32>(state.range(0)));
+        MapType map;
+        for (UInt32 i = 0u; i < keys.size(); ++i)
+            Put(map, keys[i], i);
+
+        for (auto _ : state)
+        {
+            UInt32 sum = 0u;
+            for (const auto& key : keys)
+                sum += FindValue(map, key);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * keys.size());
+    }
+    BENCHMARK_TEMPLATE(BM_Find, HashMap<ResourceContentHash, UInt32>)->Apply(SyntheticScene::SceneSizes);
+    BENCHMARK_TEMPLATE(BM_Find, StdMap)->Apply(SyntheticScene::SceneSizes);
+
+    template <typename MapType>
+    static void BM_FindMissing(benchmark::State& state)
+    {
+        const UInt32 count = static_cast<UInt32>(state.range(0));
+        const auto keys = CreateKeys(2u * count);
+        MapType map;
+        for (UInt32 i = 0u; i < count; ++i)
+            Put(map, keys[i], i);
+
+        for (auto _ : state)
+        {
+            UInt32 found = 0u;
+            for (UInt32 i = count; i < keys.size(); ++i)
+                found += Contains(map, keys[i]) ? 1u : 0u;
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+    }
+    BENCHMARK_TEMPLATE(BM_FindMissing, HashMap<ResourceContentHash, UInt32>)->Apply(SyntheticScene::SceneSizes);
+    BENCHMARK_TEMPLATE(BM_FindMissing, StdMap)->Apply(SyntheticScene::SceneSizes);
+
+    template <typename MapType>
+    static void BM_Iterate(benchmark::State& state)
+    {
+        const auto keys = CreateKeys(static_cast<UInt32>(state.range(0)));
+        MapType map;
+        for (UInt32 i = 0u; i < keys.size(); ++i)
+            Put(map, keys[i], i);
+
+        for (auto _ : state)
+        {
+            UInt32 sum = 0u;
+            for (const auto& entry : map)
+                sum += Value(entry);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * keys.size());
+    }
+    BENCHMARK_TEMPLATE(BM_Iterate, HashMap<ResourceContentHash, UInt32>)->Apply(SyntheticScene::SceneSizes);
+    BENCHMARK_TEMPLATE(BM_Iterate, StdMap)->Apply(SyntheticScene::SceneSizes);
+
+    template <typename MapType>
+    static void BM_PutRemove(benchmark::State& state)
+    {
+        const auto keys = CreateKeys(static_cast<UInt32>(state.range(0)));
+        MapType map;
+        for (auto _ : state)
+        {
+            for (UInt32 i = 0u; i < keys.size(); ++i)
+                Put(map, keys[i], i);
+            for (const auto& key : keys)
+                Remove(map, key);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * keys.size());
+    }
+    BENCHMARK_TEMPLATE(BM_PutRemove, HashMap<ResourceContentHash, UInt32>)->Apply(SyntheticScene::SceneSizes);
+    BENCHMARK_TEMPLATE(BM_PutRemove, StdMap)->Apply(SyntheticScene::SceneSizes);
+}
@@ -0,0 +1,95 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Math3d/Matrix44f.h"
+#include "Math3d/Vector4.h"
+#include "benchmark/benchmark.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        std::vector<Matrix44f> CreateMatrices(size_t count)
+        {
+            std::vector<Matrix44f> matrices;
+            matrices.reserve(count);
+            for (size_t i = 0u; i < count; ++i)
+            {
+                const Float f = static_cast<Float>(i % 360u);
+                matrices.push_back(Matrix44f::TranslationScalingRotationEulerZYX(Vector3(f, -f, 1.f), Vector3(1.5f), Vector3(f, 0.5f * f, 0.f)));
+            }
+            return matrices;
+        }
+
+        const size_t MatrixCount = 1024u;
+    }
+
+    static void BM_Matrix44f_Multiply(benchmark::State& state)
+    {
+        const auto matrices = CreateMatrices(MatrixCount);
+        std::vector<Matrix44f> results(MatrixCount);
+        for (auto _ : state)
+        {
+            for (size_t i = 0u; i + 1u < MatrixCount; ++i)
+                results[i] = matrices[i] * matrices[i + 1u];
+            benchmark::DoNotOptimize(results.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (MatrixCount - 1u));
+    }
+    BENCHMARK(BM_Matrix44f_Multiply);
+
+    static void BM_Matrix44f_MultiplyVector(benchmark::State& state)
+    {
+        const auto matrices = CreateMatrices(MatrixCount);
+        std::vector<Vector4> results(MatrixCount);
+        const Vector4 vec(1.f, 2.f, 3.f, 1.f);
+        for (auto _ : state)
+        {
+            for (size_t i = 0u; i < MatrixCount; ++i)
+                results[i] = matrices[i] * vec;
+            benchmark::DoNotOptimize(results.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MatrixCount);
+    }
+    BENCHMARK(BM_Matrix44f_MultiplyVector);
+
+    static void BM_Matrix44f_Inverse(benchmark::State& state)
+    {
+        const auto matrices = CreateMatrices(MatrixCount);
+        std::vector<Matrix44f> results(MatrixCount);
+        for (auto _ : state)
+        {
+            for (size_t i = 0u; i < MatrixCount; ++i)
+                results[i] = matrices[i].inverse();
+            benchmark::DoNotOptimize(results.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MatrixCount);
+    }
+    BENCHMARK(BM_Matrix44f_Inverse);
+
+    static void BM_Matrix44f_TranslationScalingRotation(benchmark::State& state)
+    {
+        std::vector<Matrix44f> results(MatrixCount);
+        for (auto _ : state)
+        {
+            for (size_t i = 0u; i < MatrixCount; ++i)
+            {
+                const Float f = static_cast<Float>(i);
+                results[i] = Matrix44f::TranslationScalingRotationEulerZYX(Vector3(f), Vector3(2.f), Vector3(f, f, f));
+            }
+            benchmark::DoNotOptimize(results.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * MatrixCount);
+    }
+    BENCHMARK(BM_Matrix44f_TranslationScalingRotation);
+}
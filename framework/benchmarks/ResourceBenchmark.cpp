@@ -0,0 +1,97 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Resource/ArrayResource.h"
+#include "Resource/LZ4CompressionUtils.h"
+#include "benchmark/benchmark.h"
+#include <vector>
+#include <cstring>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // exposes the hash computation which is otherwise only triggered once per resource
+        class HashBenchmarkResource : public ArrayResource
+        {
+        public:
+            using ArrayResource::ArrayResource;
+            using ResourceBase::updateHash;
+        };
+
+        // vertex-like float data: quantized positions on a grid with few distinct values, compresses roughly like real meshes
+        std::vector<Float> CreateVertexData(UInt32 floatCount)
+        {
+            std::vector<Float> data(floatCount);
+            UInt32 lcg = 12345u;
+            for (UInt32 i = 0u; i < floatCount; ++i)
+            {
+                lcg = lcg * 1664525u + 1013904223u;
+                data[i] = static_cast<Float>((i / 3u) % 512u) * 0.25f + static_cast<Float>(lcg >> 29u);
+            }
+            return data;
+        }
+
+        ResourceBlob CreateVertexBlob(UInt32 sizeInBytes)
+        {
+            const auto floats = CreateVertexData(sizeInBytes / sizeof(Float));
+            ResourceBlob blob(sizeInBytes);
+            std::memcpy(blob.data(), floats.data(), floats.size() * sizeof(Float));
+            return blob;
+        }
+
+        void ResourceSizes(benchmark::internal::Benchmark* bench)
+        {
+            bench->RangeMultiplier(8)->Range(64 << 10, 16 << 20)->Unit(benchmark::kMicrosecond);
+        }
+    }
+
+    static void BM_ResourceBase_UpdateHash(benchmark::State& state)
+    {
+        const UInt32 vec3Count = static_cast<UInt32>(state.range(0)) / (3u * sizeof(Float));
+        const auto data = CreateVertexData(vec3Count * 3u);
+        HashBenchmarkResource resource(EResourceType_VertexArray, vec3Count, EDataType_Vector3F, reinterpret_cast<const Byte*>(data.data()), ResourceCacheFlag_DoNotCache, "");
+
+        for (auto _ : state)
+        {
+            resource.updateHash();
+            benchmark::DoNotOptimize(resource.getHash());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+    BENCHMARK(BM_ResourceBase_UpdateHash)->Apply(ResourceSizes);
+
+    static void BM_LZ4_Compress(benchmark::State& state, LZ4CompressionUtils::CompressionLevel level)
+    {
+        const ResourceBlob blob = CreateVertexBlob(static_cast<UInt32>(state.range(0)));
+        size_t compressedSize = 0u;
+        for (auto _ : state)
+        {
+            const CompressedResouceBlob compressed = LZ4CompressionUtils::compress(blob, level);
+            compressedSize = compressed.size();
+            benchmark::DoNotOptimize(compressed.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+        state.counters["ratio"] = static_cast<double>(blob.size()) / static_cast<double>(compressedSize);
+    }
+    BENCHMARK_CAPTURE(BM_LZ4_Compress, Fast, LZ4CompressionUtils::CompressionLevel::Fast)->Apply(ResourceSizes);
+    BENCHMARK_CAPTURE(BM_LZ4_Compress, High, LZ4CompressionUtils::CompressionLevel::High)->Apply(ResourceSizes);
+
+    static void BM_LZ4_Decompress(benchmark::State& state)
+    {
+        const UInt32 size = static_cast<UInt32>(state.range(0));
+        const CompressedResouceBlob compressed = LZ4CompressionUtils::compress(CreateVertexBlob(size), LZ4CompressionUtils::CompressionLevel::Fast);
+        for (auto _ : state)
+        {
+            const ResourceBlob decompressed = LZ4CompressionUtils::decompress(compressed, size);
+            benchmark::DoNotOptimize(decompressed.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    }
+    BENCHMARK(BM_LZ4_Decompress)->Apply(ResourceSizes);
+}
@@ -0,0 +1,139 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneActionCollection.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneActionApplier.h"
+#include "Scene/SceneDescriber.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    static void BM_SceneActionCollection_WriteUpdates(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        SceneActionCollection collection;
+        for (auto _ : state)
+        {
+            collection.clear();
+            SyntheticScene::WriteUpdates(collection, nodeCount, 1.f);
+            benchmark::DoNotOptimize(collection.collectionData().data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * collection.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * collection.collectionData().size());
+    }
+    BENCHMARK(BM_SceneActionCollection_WriteUpdates)->Apply(SyntheticScene::SceneSizes);
+
+    static void BM_SceneActionCollection_ReadUpdates(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        SceneActionCollection collection;
+        SyntheticScene::WriteUpdates(collection, nodeCount, 1.f);
+
+        for (auto _ : state)
+        {
+            Float sum = 0.f;
+            for (auto& reader : collection)
+            {
+                switch (reader.type())
+                {
+                case ESceneActionId_SetTransformComponent:
+                {
+                    UInt32 component = 0u;
+                    TransformHandle transform;
+                    Vector3 vec;
+                    reader.read(component);
+                    reader.read(transform);
+                    reader.read(vec.data);
+                    sum += vec.x;
+                    break;
+                }
+                case ESceneActionId_SetDataVector4fArray:
+                {
+                    DataInstanceHandle instance;
+                    DataFieldHandle field;
+                    UInt32 elementCount = 0u;
+                    Vector4 vec;
+                    reader.read(instance);
+                    reader.read(field);
+                    reader.read(elementCount);
+                    for (UInt32 i = 0u; i < elementCount; ++i)
+                        reader.read(vec.data);
+                    sum += vec.w;
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * collection.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * collection.collectionData().size());
+    }
+    BENCHMARK(BM_SceneActionCollection_ReadUpdates)->Apply(SyntheticScene::SceneSizes);
+
+    static void BM_SceneActionCollection_DescribeScene(benchmark::State& state)
+    {
+        Scene scene;
+        SyntheticScene::Create(scene, static_cast<UInt32>(state.range(0)));
+
+        SceneActionCollection collection;
+        for (auto _ : state)
+        {
+            collection.clear();
+            SceneActionCollectionCreator creator(collection);
+            SceneDescriber::describeScene<IScene>(scene, creator);
+            benchmark::DoNotOptimize(collection.collectionData().data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * collection.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * collection.collectionData().size());
+    }
+    BENCHMARK(BM_SceneActionCollection_DescribeScene)->Apply(SyntheticScene::SceneSizes);
+
+    static void BM_SceneActionApplier_ApplyActionsOnScene_CreateScene(benchmark::State& state)
+    {
+        Scene sourceScene;
+        SyntheticScene::Create(sourceScene, static_cast<UInt32>(state.range(0)));
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator(collection);
+        SceneDescriber::describeScene<IScene>(sourceScene, creator);
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            std::unique_ptr<Scene> scene(new Scene);
+            state.ResumeTiming();
+
+            SceneActionApplier::ApplyActionsOnScene(*scene, collection);
+
+            state.PauseTiming();
+            scene.reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * collection.numberOfActions());
+    }
+    BENCHMARK(BM_SceneActionApplier_ApplyActionsOnScene_CreateScene)->Apply(SyntheticScene::SceneSizes);
+
+    static void BM_SceneActionApplier_ApplyActionsOnScene_Updates(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        Scene scene;
+        SyntheticScene::Create(scene, nodeCount);
+        SceneActionCollection collection;
+        SyntheticScene::WriteUpdates(collection, nodeCount, 2.f);
+
+        for (auto _ : state)
+            SceneActionApplier::ApplyActionsOnScene(scene, collection);
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * collection.numberOfActions());
+    }
+    BENCHMARK(BM_SceneActionApplier_ApplyActionsOnScene_Updates)->Apply(SyntheticScene::SceneSizes);
+}
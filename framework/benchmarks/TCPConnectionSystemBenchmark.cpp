@@ -0,0 +1,181 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#if defined(HAS_TCP_COMM)
+
+#include "TransportTCP/TCPConnectionSystem.h"
+#include "TransportCommon/IConnectionStatusListener.h"
+#include "TransportCommon/ServiceHandlerInterfaces.h"
+#include "Components/ManagedResource.h"
+#include "Components/IManagedResourceDeleterCallback.h"
+#include "Components/ResourceDeleterCallingCallback.h"
+#include "Components/ResourceStreamSerialization.h"
+#include "Resource/ArrayResource.h"
+#include "Utils/StatisticCollection.h"
+#include "benchmark/benchmark.h"
+#include <condition_variable>
+#include <mutex>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        const UInt16 LoopbackPort = 5977u;
+        const std::chrono::seconds WaitTimeout{ 10 };
+
+        class ResourceNotDeletedCallback : public IManagedResourceDeleterCallback
+        {
+        public:
+            virtual void managedResourceDeleted(const IResource& /*resource*/) override
+            {
+            }
+        };
+
+        // counts received resource data
+        class LoopbackReceiver : public IConnectionStatusListener, public IResourceConsumerServiceHandler
+        {
+        public:
+            virtual void newParticipantHasConnected(const Guid& /*guid*/) override
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                m_connected = true;
+                m_cond.notify_one();
+            }
+
+            virtual void participantHasDisconnected(const Guid& /*guid*/) override
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                m_connected = false;
+            }
+
+            virtual void handleSendResource(const absl::Span<const Byte>& data, const Guid& /*providerID*/) override
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                m_receivedBytes += data.size();
+                m_cond.notify_one();
+            }
+
+            virtual void handleResourcesNotAvailable(const ResourceContentHashVector& /*resources*/, const Guid& /*providerID*/) override
+            {
+            }
+
+            bool waitForConnection()
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                return m_cond.wait_for(lock, WaitTimeout, [&]() { return m_connected; });
+            }
+
+            bool waitForReceivedBytes(UInt64 receivedBytes)
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                return m_cond.wait_for(lock, WaitTimeout, [&]() { return m_receivedBytes >= receivedBytes; });
+            }
+
+        private:
+            std::mutex m_lock;
+            std::condition_variable m_cond;
+            bool m_connected = false;
+            UInt64 m_receivedBytes = 0u;
+        };
+
+        // vertex-like data which compresses poorly, so network transfer dominates
+        std::unique_ptr<IResource> CreateVertexResource(UInt32 sizeInBytes)
+        {
+            std::vector<Float> data(sizeInBytes / sizeof(Float));
+            UInt32 lcg = 12345u;
+            for (auto& value : data)
+            {
+                lcg = lcg * 1664525u + 1013904223u;
+                value = static_cast<Float>(lcg >> 8u);
+            }
+            return std::unique_ptr<IResource>(new ArrayResource(EResourceType_VertexArray, static_cast<UInt32>(data.size()), EDataType_Float,
+                reinterpret_cast<const Byte*>(data.data()), ResourceCacheFlag_DoNotCache, "benchmarkResource"));
+        }
+
+        // resource data size arriving at consumer, serialized same way as by connection system
+        UInt64 GetSerializedSize(const ManagedResourceVector& resources, UInt32 chunkSize)
+        {
+            std::vector<Byte> buffer;
+            UInt64 serializedSize = 0u;
+            auto preparePacketFun = [&](UInt32 neededSize) -> std::pair<Byte*, UInt32> {
+                buffer.resize(std::min(chunkSize, neededSize));
+                return std::make_pair(buffer.data(), static_cast<UInt32>(buffer.size()));
+            };
+            auto finishedPacketFun = [&](UInt32 usedSize) {
+                serializedSize += usedSize;
+            };
+
+            ResourceStreamSerializer serializer;
+            serializer.serialize(preparePacketFun, finishedPacketFun, resources);
+            return serializedSize;
+        }
+    }
+
+    // resources sent through loopback between provider acting as daemon and consumer, includes serialization and
+    // message queueing on sender side, compression is done once before measuring
+    static void BM_TCPConnectionSystem_SendResources(benchmark::State& state)
+    {
+        const UInt32 resourceSize = static_cast<UInt32>(state.range(0));
+        const Guid providerId(1u);
+        const Guid consumerId(2u);
+        const NetworkParticipantAddress providerAddress(providerId, "provider", "127.0.0.1", LoopbackPort);
+        const NetworkParticipantAddress consumerAddress(consumerId, "consumer", "127.0.0.1", 0u);
+
+        PlatformLock providerLock;
+        PlatformLock consumerLock;
+        StatisticCollectionFramework providerStatistics;
+        StatisticCollectionFramework consumerStatistics;
+        TCPConnectionSystem provider(providerAddress, 0u, providerAddress, false, providerLock, providerStatistics, std::chrono::milliseconds{ 1000 }, std::chrono::milliseconds{ 10000 });
+        TCPConnectionSystem consumer(consumerAddress, 0u, providerAddress, false, consumerLock, consumerStatistics, std::chrono::milliseconds{ 1000 }, std::chrono::milliseconds{ 10000 });
+
+        LoopbackReceiver receiver;
+        consumer.setResourceConsumerServiceHandler(&receiver);
+        provider.getRamsesConnectionStatusUpdateNotifier().registerForConnectionUpdates(&receiver);
+        provider.connectServices();
+        consumer.connectServices();
+
+        if (!receiver.waitForConnection())
+        {
+            state.SkipWithError("loopback connection could not be established");
+        }
+        else
+        {
+            const std::unique_ptr<IResource> resource = CreateVertexResource(resourceSize);
+            resource->compress(IResource::CompressionLevel::REALTIME);
+            ResourceNotDeletedCallback deleterCallback;
+            ResourceDeleterCallingCallback deleter(deleterCallback);
+            const ManagedResourceVector managedResources = { ManagedResource(*resource, deleter) };
+            const UInt64 serializedSize = GetSerializedSize(managedResources, provider.getSendDataSizes().resourceDataArray);
+
+            UInt64 expectedReceivedBytes = 0u;
+            for (auto _ : state)
+            {
+                {
+                    PlatformGuard guard(providerLock);
+                    provider.sendResources(consumerId, managedResources);
+                }
+                expectedReceivedBytes += serializedSize;
+                if (!receiver.waitForReceivedBytes(expectedReceivedBytes))
+                {
+                    state.SkipWithError("resources not received");
+                    break;
+                }
+            }
+
+            state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * resourceSize);
+            state.counters["compressionRatio"] = static_cast<double>(resourceSize) / static_cast<double>(serializedSize);
+        }
+
+        provider.getRamsesConnectionStatusUpdateNotifier().unregisterForConnectionUpdates(&receiver);
+        consumer.disconnectServices();
+        provider.disconnectServices();
+    }
+    BENCHMARK(BM_TCPConnectionSystem_SendResources)->RangeMultiplier(8)->Range(64 << 10, 16 << 20)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+#endif
@@ -0,0 +1,75 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "Scene/TransformationCachedScene.h"
+
+namespace ramses_internal
+{
+    // every iteration moves the root node, which invalidates the world matrices of the whole hierarchy
+    static void BM_TransformationCachedScene_UpdateMatrixCache(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        TransformationCachedScene scene;
+        SyntheticScene::Create(scene, nodeCount);
+
+        Float offset = 0.f;
+        for (auto _ : state)
+        {
+            offset += 1.f;
+            scene.setTranslation(TransformHandle(0u), Vector3(offset, 0.f, 0.f));
+            for (UInt32 i = 0u; i < nodeCount; ++i)
+                benchmark::DoNotOptimize(scene.updateMatrixCache(ETransformationMatrixType_World, NodeHandle(i)));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+    BENCHMARK(BM_TransformationCachedScene_UpdateMatrixCache)->Apply(SyntheticScene::SceneSizes);
+
+    static void BM_TransformationCachedScene_UpdateMatrixCacheBatch(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        TransformationCachedScene scene;
+        SyntheticScene::Create(scene, nodeCount);
+
+        NodeHandleVector nodes;
+        for (UInt32 i = 0u; i < nodeCount; ++i)
+            nodes.push_back(NodeHandle(i));
+
+        Float offset = 0.f;
+        for (auto _ : state)
+        {
+            offset += 1.f;
+            scene.setTranslation(TransformHandle(0u), Vector3(offset, 0.f, 0.f));
+            scene.updateMatrixCacheBatch(ETransformationMatrixType_World, nodes);
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+    BENCHMARK(BM_TransformationCachedScene_UpdateMatrixCacheBatch)->Apply(SyntheticScene::SceneSizes);
+
+    // only leaf transforms change, ancestors stay cached
+    static void BM_TransformationCachedScene_UpdateMatrixCache_LeafChanges(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        TransformationCachedScene scene;
+        SyntheticScene::Create(scene, nodeCount);
+
+        const UInt32 firstLeaf = nodeCount / 4u;
+        Float offset = 0.f;
+        for (auto _ : state)
+        {
+            offset += 1.f;
+            for (UInt32 i = firstLeaf; i < nodeCount; ++i)
+                scene.setTranslation(TransformHandle(i), Vector3(offset, 0.f, 0.f));
+            for (UInt32 i = firstLeaf; i < nodeCount; ++i)
+                benchmark::DoNotOptimize(scene.updateMatrixCache(ETransformationMatrixType_World, NodeHandle(i)));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (nodeCount - firstLeaf));
+    }
+    BENCHMARK(BM_TransformationCachedScene_UpdateMatrixCache_LeafChanges)->Apply(SyntheticScene::SceneSizes);
+}
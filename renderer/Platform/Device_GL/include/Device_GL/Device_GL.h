@@ -82,6 +82,11 @@ namespace ramses_internal
         virtual Bool                    getBinaryShader     (DeviceResourceHandle handleconst, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         virtual void                    deleteShader        (DeviceResourceHandle handle) override;
         virtual void                    activateShader      (DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle    startShaderCompilation(const EffectResource& shader) override;
+        virtual Bool                    isShaderCompilationFinished(DeviceResourceHandle pendingShader) override;
+        virtual DeviceResourceHandle    finishShaderCompilation(DeviceResourceHandle pendingShader, const EffectResource& shader) override;
+        virtual UniformDataVersion      getActiveShaderUniformDataVersion() const override;
+        virtual void                    setActiveShaderUniformDataVersion(const UniformDataVersion& version) override;
 
         virtual DeviceResourceHandle    allocateTexture2D   (UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
         virtual DeviceResourceHandle    allocateTexture3D   (UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
@@ -94,6 +99,15 @@ namespace ramses_internal
         virtual void                    activateTexture     (DeviceResourceHandle handle, DataFieldHandle field) override;
         virtual int                     getTextureAddress   (DeviceResourceHandle handle) const override;
 
+        virtual DeviceResourceHandle    allocateStagingBuffer(UInt32 sizeInBytes) override;
+        virtual Byte*                   getStagingBufferData(DeviceResourceHandle handle) override;
+        virtual void                    deleteStagingBuffer (DeviceResourceHandle handle) override;
+        virtual void                    uploadTextureDataFromStagingBuffer(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize) override;
+        virtual void                    uploadBufferDataFromStagingBuffer (DeviceResourceHandle handle, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize) override;
+        virtual DeviceResourceHandle    insertFence         () override;
+        virtual Bool                    isFenceSignaled     (DeviceResourceHandle handle) override;
+        virtual void                    deleteFence         (DeviceResourceHandle handle) override;
+
         virtual DeviceResourceHandle    uploadRenderBuffer  (const RenderBuffer& renderBuffer) override;
         virtual void                    deleteRenderBuffer  (DeviceResourceHandle handle) override;
 
@@ -145,6 +159,7 @@ namespace ramses_internal
         DebugOutput                 m_debugOutput;
         StringSet                   m_apiExtensions;
         std::vector<GLint>          m_supportedBinaryProgramFormats;
+        Bool                        m_parallelShaderCompileSupported = false;
 
         Bool getUniformLocation(DataFieldHandle field, GLInputLocation& location) const;
         Bool getAttributeLocation(DataFieldHandle field, GLInputLocation& location) const;
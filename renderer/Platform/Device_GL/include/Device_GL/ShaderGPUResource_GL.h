@@ -40,6 +40,9 @@ namespace ramses_internal
 
         bool                getBinaryInfo(UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
+        const UniformDataVersion& getUniformDataVersion() const;
+        void                      setUniformDataVersion(const UniformDataVersion& version) const;
+
     private:
         void                preloadVariableLocations(const EffectResource& effect);
         GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
@@ -53,6 +56,9 @@ namespace ramses_internal
         BufferSlotMap    m_bufferSlots;
         InputLocationMap m_uniformLocationMap;
         InputLocationMap m_attributeLocationMap;
+
+        // uniform values are part of GL program object state
+        mutable UniformDataVersion m_uniformDataVersion;
     };
 
     // inline implementation:
@@ -188,6 +194,16 @@ namespace ramses_internal
         binaryShaderFormat = BinaryShaderFormatID{ binaryFormat };
         return binarySize == length;
     }
+
+    inline const UniformDataVersion& ShaderGPUResource_GL::getUniformDataVersion() const
+    {
+        return m_uniformDataVersion;
+    }
+
+    inline void ShaderGPUResource_GL::setUniformDataVersion(const UniformDataVersion& version) const
+    {
+        m_uniformDataVersion = version;
+    }
 }
 
 #endif
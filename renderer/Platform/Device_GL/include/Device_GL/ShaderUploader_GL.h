@@ -24,8 +24,14 @@ namespace ramses_internal
         static Bool UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog);
         static Bool UploadShaderProgramFromBinary(const UInt8* binaryShaderData, UInt32 binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog);
 
+        // issues compilation and linking without querying their status, which would block until driver finishes them
+        static Bool StartShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog);
+        static Bool FinishShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfo, String& debugErrorLog);
+
     private:
         static GLHandle CompileShaderStage(const char* stageSource, GLenum shaderType, String& errorLogOut);
+        static Bool CheckShaderStageCompileStatus(GLHandle shaderHandle, const char* stageSource, String& errorLogOut);
+        static void DeleteShaderProgram(const ShaderProgramInfo& programShaderInfo);
         static Bool CheckShaderProgramLinkStatus(GLHandle shaderProgram, String& errorLogOut);
         static void PrintShaderSourceWithLineNumbers(const String& source);
     };
@@ -42,8 +42,18 @@
 #include "SceneAPI/TextureEnums.h"
 #include "PlatformAbstraction/Macros.h"
 
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
 namespace ramses_internal
 {
+#if defined(__linux__) || defined(__ghs__)
+    typedef void (GL_APIENTRYP MaxShaderCompilerThreadsProc)(GLuint count);
+#else
+    typedef void (APIENTRYP MaxShaderCompilerThreadsProc)(GLuint count);
+#endif
+
     // TODO Violin move again to other files, once GL headers are consolidated
     struct GLTextureInfo
     {
@@ -67,6 +77,56 @@ namespace ramses_internal
         const GLTextureInfo m_textureInfo;
     };
 
+    class StagingBufferGPUResource_GL : public GPUResource
+    {
+    public:
+        StagingBufferGPUResource_GL(UInt32 gpuAddress, UInt32 sizeInBytes, Byte* mappedData)
+            : GPUResource(gpuAddress, sizeInBytes)
+            , m_mappedData(mappedData)
+        {
+        }
+
+        Byte* const m_mappedData;
+        // staging buffer stays mapped until first transfer from it
+        mutable Bool m_mapped = true;
+    };
+
+    class FenceGPUResource_GL : public GPUResource
+    {
+    public:
+        explicit FenceGPUResource_GL(GLsync sync)
+            : GPUResource(0u, 0u)
+            , m_sync(sync)
+        {
+        }
+
+        const GLsync m_sync;
+    };
+
+    class PendingShaderGPUResource_GL : public GPUResource
+    {
+    public:
+        explicit PendingShaderGPUResource_GL(const ShaderProgramInfo& programInfo)
+            : GPUResource(programInfo.shaderProgramHandle, 0u)
+            , m_programInfo(programInfo)
+        {
+        }
+
+        const ShaderProgramInfo m_programInfo;
+    };
+
+    static void UnmapStagingBuffer(const StagingBufferGPUResource_GL& stagingBuffer, GLenum boundTarget)
+    {
+        if (stagingBuffer.m_mapped)
+        {
+            if (glUnmapBuffer(boundTarget) != GL_TRUE)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "Device_GL::UnmapStagingBuffer: content of staging buffer " << stagingBuffer.getGPUAddress() << " was corrupted while mapped");
+            }
+            stagingBuffer.m_mapped = false;
+        }
+    }
+
     Device_GL::Device_GL(IContext& context, UInt8 majorApiVersion, UInt8 minorApiVersion, bool isEmbedded)
         : Device_Base()
         , m_context(context)
@@ -575,6 +635,104 @@ namespace ramses_internal
         uploadTextureMipMapData(mipLevel, x, y, z, width, height, depth, texInfo, data, dataSize);
     }
 
+    DeviceResourceHandle Device_GL::allocateStagingBuffer(UInt32 sizeInBytes)
+    {
+        GLHandle glAddress = InvalidGLHandle;
+        glGenBuffers(1, &glAddress);
+        assert(glAddress != InvalidGLHandle);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, glAddress);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, sizeInBytes, nullptr, GL_STREAM_DRAW);
+        void* mappedData = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, sizeInBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        if (mappedData == nullptr)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "Device_GL::allocateStagingBuffer: failed to map staging buffer of size " << sizeInBytes);
+            glDeleteBuffers(1, &glAddress);
+            return DeviceResourceHandle::Invalid();
+        }
+
+        return m_resourceMapper.registerResource(*new StagingBufferGPUResource_GL(glAddress, sizeInBytes, static_cast<Byte*>(mappedData)));
+    }
+
+    Byte* Device_GL::getStagingBufferData(DeviceResourceHandle handle)
+    {
+        const auto& stagingBuffer = m_resourceMapper.getResourceAs<StagingBufferGPUResource_GL>(handle);
+        assert(stagingBuffer.m_mapped);
+        return stagingBuffer.m_mappedData;
+    }
+
+    void Device_GL::deleteStagingBuffer(DeviceResourceHandle handle)
+    {
+        const auto& stagingBuffer = m_resourceMapper.getResourceAs<StagingBufferGPUResource_GL>(handle);
+        const GLHandle resourceAddress = stagingBuffer.getGPUAddress();
+        if (stagingBuffer.m_mapped)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, resourceAddress);
+            UnmapStagingBuffer(stagingBuffer, GL_PIXEL_UNPACK_BUFFER);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &resourceAddress);
+        m_resourceMapper.deleteResource(handle);
+    }
+
+    void Device_GL::uploadTextureDataFromStagingBuffer(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize)
+    {
+        const auto& stagingResource = m_resourceMapper.getResourceAs<StagingBufferGPUResource_GL>(stagingBuffer);
+        assert(offset + dataSize <= stagingResource.getTotalSizeInBytes());
+
+        // with pixel unpack buffer bound the data pointer is interpreted as offset into that buffer
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingResource.getGPUAddress());
+        UnmapStagingBuffer(stagingResource, GL_PIXEL_UNPACK_BUFFER);
+        uploadTextureData(handle, mipLevel, 0u, 0u, z, width, height, depth, reinterpret_cast<const Byte*>(static_cast<UInt>(offset)), dataSize);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    void Device_GL::uploadBufferDataFromStagingBuffer(DeviceResourceHandle handle, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize)
+    {
+        const auto& stagingResource = m_resourceMapper.getResourceAs<StagingBufferGPUResource_GL>(stagingBuffer);
+        const auto& buffer = m_resourceMapper.getResource(handle);
+        assert(offset + dataSize <= stagingResource.getTotalSizeInBytes());
+        assert(dataSize <= buffer.getTotalSizeInBytes());
+
+        // copy targets are used so that vertex array and element array bindings are not affected
+        glBindBuffer(GL_COPY_READ_BUFFER, stagingResource.getGPUAddress());
+        UnmapStagingBuffer(stagingResource, GL_COPY_READ_BUFFER);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, buffer.getGPUAddress());
+        glBufferData(GL_COPY_WRITE_BUFFER, dataSize, nullptr, GL_STATIC_DRAW);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, offset, 0, dataSize);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+
+    DeviceResourceHandle Device_GL::insertFence()
+    {
+        const GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        assert(sync != nullptr);
+        return m_resourceMapper.registerResource(*new FenceGPUResource_GL(sync));
+    }
+
+    Bool Device_GL::isFenceSignaled(DeviceResourceHandle handle)
+    {
+        const auto& fence = m_resourceMapper.getResourceAs<FenceGPUResource_GL>(handle);
+        // zero timeout only queries status, flush makes sure the fence reaches GPU and will eventually be signaled
+        const GLenum status = glClientWaitSync(fence.m_sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0u);
+        if (status == GL_WAIT_FAILED)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::isFenceSignaled: failed to query fence status");
+            return true;
+        }
+        return status != GL_TIMEOUT_EXPIRED;
+    }
+
+    void Device_GL::deleteFence(DeviceResourceHandle handle)
+    {
+        const auto& fence = m_resourceMapper.getResourceAs<FenceGPUResource_GL>(handle);
+        glDeleteSync(fence.m_sync);
+        m_resourceMapper.deleteResource(handle);
+    }
+
     DeviceResourceHandle Device_GL::uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const TextureSwizzleArray& swizzle)
     {
         if (!handle.isValid())
@@ -1137,6 +1295,48 @@ namespace ramses_internal
         }
     }
 
+    DeviceResourceHandle Device_GL::startShaderCompilation(const EffectResource& effect)
+    {
+        if (!m_parallelShaderCompileSupported)
+            return DeviceResourceHandle::Invalid();
+
+        ShaderProgramInfo programInfo;
+        String debugErrorLog;
+        if (!ShaderUploader_GL::StartShaderProgramCompilation(effect, programInfo, debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::startShaderCompilation: shader compilation could not be started: " << debugErrorLog);
+            return DeviceResourceHandle::Invalid();
+        }
+
+        return m_resourceMapper.registerResource(*new PendingShaderGPUResource_GL(programInfo));
+    }
+
+    Bool Device_GL::isShaderCompilationFinished(DeviceResourceHandle pendingShader)
+    {
+        const auto& pendingShaderResource = m_resourceMapper.getResourceAs<PendingShaderGPUResource_GL>(pendingShader);
+        GLint completed = GL_FALSE;
+        glGetProgramiv(pendingShaderResource.m_programInfo.shaderProgramHandle, GL_COMPLETION_STATUS_KHR, &completed);
+        return completed != GL_FALSE;
+    }
+
+    DeviceResourceHandle Device_GL::finishShaderCompilation(DeviceResourceHandle pendingShader, const EffectResource& effect)
+    {
+        ShaderProgramInfo programInfo = m_resourceMapper.getResourceAs<PendingShaderGPUResource_GL>(pendingShader).m_programInfo;
+        m_resourceMapper.deleteResource(pendingShader);
+
+        String debugErrorLog;
+        if (ShaderUploader_GL::FinishShaderProgramCompilation(effect, programInfo, debugErrorLog))
+        {
+            const ShaderGPUResource_GL& shaderGpuResource = *new ShaderGPUResource_GL(effect, programInfo);
+            return m_resourceMapper.registerResource(shaderGpuResource);
+        }
+        else
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::finishShaderCompilation: shader upload failed: " << debugErrorLog);
+            return DeviceResourceHandle::Invalid();
+        }
+    }
+
     Bool Device_GL::getBinaryShader(DeviceResourceHandle handle, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat)
     {
         binaryShader.clear();
@@ -1164,6 +1364,18 @@ namespace ramses_internal
         m_activeShader = &shaderProgramGL;
     }
 
+    UniformDataVersion Device_GL::getActiveShaderUniformDataVersion() const
+    {
+        assert(nullptr != m_activeShader);
+        return m_activeShader->getUniformDataVersion();
+    }
+
+    void Device_GL::setActiveShaderUniformDataVersion(const UniformDataVersion& version)
+    {
+        assert(nullptr != m_activeShader);
+        m_activeShader->setUniformDataVersion(version);
+    }
+
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
     {
         const GPUResource& resource = m_resourceMapper.getResource(handle);
@@ -1325,6 +1537,19 @@ namespace ramses_internal
         {
             LOG_WARN(CONTEXT_RENDERER, "Device_GL::queryDeviceDependentFeatures:  anisotropic filtering not available on this device");
         }
+
+        // with parallel compile extension the driver compiles shaders on its own threads and completion can be polled without blocking
+        if (isApiExtensionAvailable("GL_KHR_parallel_shader_compile"))
+        {
+            const auto maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(m_context.getProcAddress("glMaxShaderCompilerThreadsKHR"));
+            if (maxShaderCompilerThreads)
+            {
+                // let driver decide on number of compiler threads
+                maxShaderCompilerThreads(0xFFFFFFFFu);
+                m_parallelShaderCompileSupported = true;
+            }
+        }
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::queryDeviceDependentFeatures:  parallel shader compilation " << (m_parallelShaderCompileSupported ? "available" : "not available"));
     }
 
     void Device_GL::readPixels(UInt8* buffer, UInt32 x, UInt32 y, UInt32 width, UInt32 height)
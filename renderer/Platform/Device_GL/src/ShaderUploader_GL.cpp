@@ -98,6 +98,68 @@ namespace ramses_internal
         }
     }
 
+    Bool ShaderUploader_GL::StartShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, String& debugErrorLog)
+    {
+        LOG_DEBUG(CONTEXT_RENDERER, "ShaderUploader_GL::StartShaderProgramCompilation:  compiling shaders for effect " << effect.getName());
+
+        const GLHandle vertexShaderHandle = glCreateShader(GL_VERTEX_SHADER);
+        const GLHandle fragmentShaderHandle = glCreateShader(GL_FRAGMENT_SHADER);
+        const GLHandle shaderProgramHandle = glCreateProgram();
+
+        if (InvalidGLHandle == vertexShaderHandle || InvalidGLHandle == fragmentShaderHandle || InvalidGLHandle == shaderProgramHandle)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::StartShaderProgramCompilation:  failed to create shader objects");
+            debugErrorLog = "Unable to create shader program";
+            glDeleteProgram(shaderProgramHandle);
+            glDeleteShader(vertexShaderHandle);
+            glDeleteShader(fragmentShaderHandle);
+            return false;
+        }
+
+        const char* vertexShaderSource = effect.getVertexShader();
+        const char* fragmentShaderSource = effect.getFragmentShader();
+        glShaderSource(vertexShaderHandle, 1, &vertexShaderSource, nullptr);
+        glCompileShader(vertexShaderHandle);
+        glShaderSource(fragmentShaderHandle, 1, &fragmentShaderSource, nullptr);
+        glCompileShader(fragmentShaderHandle);
+
+        // linking of shaders which failed to compile fails as well, errors are reported when compilation is finished
+        glAttachShader(shaderProgramHandle, fragmentShaderHandle);
+        glAttachShader(shaderProgramHandle, vertexShaderHandle);
+        glLinkProgram(shaderProgramHandle);
+
+        programShaderInfoOut.vertexShaderHandle = vertexShaderHandle;
+        programShaderInfoOut.fragmentShaderHandle = fragmentShaderHandle;
+        programShaderInfoOut.shaderProgramHandle = shaderProgramHandle;
+        return true;
+    }
+
+    Bool ShaderUploader_GL::FinishShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfo, String& debugErrorLog)
+    {
+        if (!CheckShaderStageCompileStatus(programShaderInfo.vertexShaderHandle, effect.getVertexShader(), debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramCompilation:  vertex shader failed to compile " << debugErrorLog.c_str());
+            DeleteShaderProgram(programShaderInfo);
+            return false;
+        }
+
+        if (!CheckShaderStageCompileStatus(programShaderInfo.fragmentShaderHandle, effect.getFragmentShader(), debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramCompilation:  fragment shader failed to compile " << debugErrorLog.c_str());
+            DeleteShaderProgram(programShaderInfo);
+            return false;
+        }
+
+        if (!CheckShaderProgramLinkStatus(programShaderInfo.shaderProgramHandle, debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramCompilation:  CheckShaderProgramLinkStatus failed");
+            DeleteShaderProgram(programShaderInfo);
+            return false;
+        }
+
+        return true;
+    }
+
     Bool ShaderUploader_GL::CheckShaderProgramLinkStatus(GLHandle shaderProgram, String& errorLogOut)
     {
         GLint linkStatus;
@@ -140,22 +202,8 @@ namespace ramses_internal
             glShaderSource(shaderHandle, 1, &stageSource, nullptr);
             glCompileShader(shaderHandle);
 
-            GLint compilationResult = GL_FALSE;
-            glGetShaderiv(shaderHandle, GL_COMPILE_STATUS, &compilationResult);
-
-            if (compilationResult == GL_FALSE)
+            if (!CheckShaderStageCompileStatus(shaderHandle, stageSource, errorLogOut))
             {
-                Int32 infoLength;
-                Int32 numberChars;
-                glGetShaderiv(shaderHandle, GL_INFO_LOG_LENGTH, &infoLength);
-
-                // Allocate Log Space
-                Char* info = new Char[infoLength];
-                glGetShaderInfoLog(shaderHandle, infoLength, &numberChars, info);
-                errorLogOut = String("Unable to compile shader stage: ") + String(info);
-                delete[] info;
-
-                PrintShaderSourceWithLineNumbers(stageSource);
                 glDeleteShader(shaderHandle);
                 shaderHandle = InvalidGLHandle;
             }
@@ -164,6 +212,37 @@ namespace ramses_internal
         return shaderHandle;
     }
 
+    Bool ShaderUploader_GL::CheckShaderStageCompileStatus(GLHandle shaderHandle, const char* stageSource, String& errorLogOut)
+    {
+        GLint compilationResult = GL_FALSE;
+        glGetShaderiv(shaderHandle, GL_COMPILE_STATUS, &compilationResult);
+
+        if (compilationResult == GL_FALSE)
+        {
+            Int32 infoLength;
+            Int32 numberChars;
+            glGetShaderiv(shaderHandle, GL_INFO_LOG_LENGTH, &infoLength);
+
+            // Allocate Log Space
+            Char* info = new Char[infoLength];
+            glGetShaderInfoLog(shaderHandle, infoLength, &numberChars, info);
+            errorLogOut = String("Unable to compile shader stage: ") + String(info);
+            delete[] info;
+
+            PrintShaderSourceWithLineNumbers(stageSource);
+            return false;
+        }
+
+        return true;
+    }
+
+    void ShaderUploader_GL::DeleteShaderProgram(const ShaderProgramInfo& programShaderInfo)
+    {
+        glDeleteProgram(programShaderInfo.shaderProgramHandle);
+        glDeleteShader(programShaderInfo.vertexShaderHandle);
+        glDeleteShader(programShaderInfo.fragmentShaderHandle);
+    }
+
     void ShaderUploader_GL::PrintShaderSourceWithLineNumbers(const String& source)
     {
         UInt32 lineNumber = 1;
@@ -100,6 +100,15 @@ namespace ramses_internal
         virtual Bool                    getBinaryShader             (DeviceResourceHandle handle, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) = 0;
         virtual void                    deleteShader                (DeviceResourceHandle handle) = 0;
         virtual void                    activateShader              (DeviceResourceHandle handle) = 0;
+        // Shader compilation can be started without blocking if device compiles shaders in parallel, otherwise invalid handle is returned
+        // and uploadShader has to be used. Finishing compilation deletes the pending handle and returns uploaded shader (or invalid handle if compilation failed),
+        // it blocks if compilation is not finished yet.
+        virtual DeviceResourceHandle    startShaderCompilation      (const EffectResource& effect) = 0;
+        virtual Bool                    isShaderCompilationFinished (DeviceResourceHandle pendingShader) = 0;
+        virtual DeviceResourceHandle    finishShaderCompilation     (DeviceResourceHandle pendingShader, const EffectResource& effect) = 0;
+        // uniform values are kept by shader, version of uniform data last set to active shader allows to skip setting them again
+        virtual UniformDataVersion      getActiveShaderUniformDataVersion() const = 0;
+        virtual void                    setActiveShaderUniformDataVersion(const UniformDataVersion& version) = 0;
 
         virtual DeviceResourceHandle    allocateTexture2D           (UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes) = 0;
         virtual DeviceResourceHandle    allocateTexture3D           (UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes) = 0;
@@ -112,6 +121,19 @@ namespace ramses_internal
         virtual void                    activateTexture             (DeviceResourceHandle handle, DataFieldHandle field) = 0;
         virtual int                     getTextureAddress           (DeviceResourceHandle handle) const = 0;
 
+        // Staging buffers are allocated mapped, their memory can be filled from any thread until content is transferred from them
+        // to a texture or buffer (which can only happen on device thread). Allocation fails with invalid handle if not supported by device.
+        // Texture data is always transferred for whole mip level, z offset encodes face of cube texture like in uploadTextureData.
+        // Fences tell when all commands issued before them (e.g. transfers from staging buffers) were executed by GPU.
+        virtual DeviceResourceHandle    allocateStagingBuffer       (UInt32 sizeInBytes) = 0;
+        virtual Byte*                   getStagingBufferData        (DeviceResourceHandle handle) = 0;
+        virtual void                    deleteStagingBuffer         (DeviceResourceHandle handle) = 0;
+        virtual void                    uploadTextureDataFromStagingBuffer(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize) = 0;
+        virtual void                    uploadBufferDataFromStagingBuffer (DeviceResourceHandle handle, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize) = 0;
+        virtual DeviceResourceHandle    insertFence                 () = 0;
+        virtual Bool                    isFenceSignaled             (DeviceResourceHandle handle) = 0;
+        virtual void                    deleteFence                 (DeviceResourceHandle handle) = 0;
+
         // Render buffers/targets
         virtual DeviceResourceHandle    uploadRenderBuffer          (const RenderBuffer& renderBuffer) = 0;
         virtual void                    deleteRenderBuffer          (DeviceResourceHandle handle) = 0;
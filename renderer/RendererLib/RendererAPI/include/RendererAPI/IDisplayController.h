@@ -33,6 +33,7 @@ namespace ramses_internal
         virtual void                    handleWindowEvents() = 0;
         virtual Bool                    canRenderNewFrame() const = 0;
         virtual void                    enableContext() = 0;
+        virtual void                    disableContext() = 0;
         virtual void                    swapBuffers() = 0;
         virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr) = 0;
         virtual void                    executePostProcessing() = 0;
@@ -93,6 +93,24 @@ namespace ramses_internal
     typedef std::vector<ScreenshotInfo> ScreenshotInfoVector;
 
     using BinaryShaderFormatID = StronglyTypedValue<UInt32, 0, struct BinaryShaderFormatIDTag>;
+
+    // Identifies content of uniform data instance together with all data instances it references,
+    // default constructed version never matches any real data
+    struct UniformDataVersion
+    {
+        UInt64 dataVersion = 0u;
+        UInt64 referencedDataVersion = 0u;
+
+        Bool operator==(const UniformDataVersion& other) const
+        {
+            return dataVersion == other.dataVersion && referencedDataVersion == other.referencedDataVersion;
+        }
+
+        Bool operator!=(const UniformDataVersion& other) const
+        {
+            return !operator==(other);
+        }
+    };
 }
 
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses_internal::StreamTextureSourceId)
@@ -9,9 +9,15 @@
 #include "renderer_common_gmock_header.h"
 #include "RendererFramework/RendererFrameworkLogic.h"
 #include "RendererLib/RendererCommandBuffer.h"
+#include "RendererLib/RendererResourceManager.h"
+#include "RendererLib/ResourceUploader.h"
+#include "RendererLib/FrameTimer.h"
+#include "RendererLib/RendererStatistics.h"
 #include "ComponentMocks.h"
 #include "ResourceMock.h"
 #include "MockConnectionStatusUpdateNotifier.h"
+#include "RenderBackendMock.h"
+#include "EmbeddedCompositingManagerMock.h"
 
 using namespace testing;
 
@@ -233,11 +239,10 @@ namespace ramses_internal
         EXPECT_EQ(ERendererCommand_UnpublishedScene, commands.getCommandType(0u));
         EXPECT_EQ(ERendererCommand_UnpublishedScene, commands.getCommandType(1u));
 
+        // order of unpublished scenes follows iteration order of known scenes and is not guaranteed
         const SceneInfoCommand& command1 = commands.getCommandData<SceneInfoCommand>(0u);
-        EXPECT_EQ(sceneId2, command1.sceneInformation.sceneID);
-
         const SceneInfoCommand& command2 = commands.getCommandData<SceneInfoCommand>(1u);
-        EXPECT_EQ(sceneId1, command2.sceneInformation.sceneID);
+        EXPECT_THAT(SceneIdVector({ command1.sceneInformation.sceneID, command2.sceneInformation.sceneID }), UnorderedElementsAre(sceneId1, sceneId2));
     }
 
     TEST_F(ARendererFrameworkLogic, generatesUnpublishRendererCommandsForScenesFromDisconnectedClient_DoesNotModifyOtherClientsScene)
@@ -259,11 +264,10 @@ namespace ramses_internal
         EXPECT_EQ(ERendererCommand_UnpublishedScene, commands.getCommandType(0u));
         EXPECT_EQ(ERendererCommand_UnpublishedScene, commands.getCommandType(1u));
 
+        // order of unpublished scenes follows iteration order of known scenes and is not guaranteed
         const SceneInfoCommand& command1 = commands.getCommandData<SceneInfoCommand>(0u);
-        EXPECT_EQ(sceneId2, command1.sceneInformation.sceneID);
-
         const SceneInfoCommand& command2 = commands.getCommandData<SceneInfoCommand>(1u);
-        EXPECT_EQ(sceneId1, command2.sceneInformation.sceneID);
+        EXPECT_THAT(SceneIdVector({ command1.sceneInformation.sceneID, command2.sceneInformation.sceneID }), UnorderedElementsAre(sceneId1, sceneId2));
     }
 
     TEST_F(ARendererFrameworkLogic, requestsResourcesViaResourceComponentWithCorrectProviderID)
@@ -280,6 +284,32 @@ namespace ramses_internal
         fixture.requestResourceAsyncronouslyFromFramework(resources, requester, sceneId);
     }
 
+    TEST_F(ARendererFrameworkLogic, requestsPrewarmedEffectsViaResourceComponentFromProviderOfSceneUsingDisplay)
+    {
+        fixture.handleNewScenesAvailable(SceneInfoVector(1, SceneInfo(sceneId, sceneName)), providerID, EScenePublicationMode_LocalAndRemote);
+        expectSceneCommand(ERendererCommand_PublishedScene);
+
+        StrictMock<RenderBackendStrictMock> renderBackend;
+        StrictMock<EmbeddedCompositingManagerMock> embeddedCompositingManager;
+        RendererStatistics stats;
+        ResourceUploader resourceUploader(stats);
+        FrameTimer frameTimer;
+        RendererResourceManager resourceManager(fixture, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(1), false, frameTimer, stats);
+
+        const ResourceContentHash effect(44u, 0);
+        const ResourceContentHash sceneResource(45u, 0);
+        resourceManager.prewarmEffects({ effect });
+        resourceManager.requestAndUnrequestPendingClientResources();
+
+        resourceManager.referenceClientResourcesForScene(sceneId, { sceneResource });
+        EXPECT_CALL(resourceComponent, requestResourceAsynchronouslyFromFramework(UnorderedElementsAre(effect, sceneResource), resourceManager.getRequesterID(), providerID));
+        resourceManager.requestAndUnrequestPendingClientResources();
+
+        EXPECT_CALL(resourceComponent, cancelResourceRequest(sceneResource, resourceManager.getRequesterID()));
+        resourceManager.unreferenceAllClientResourcesForScene(sceneId);
+        resourceManager.requestAndUnrequestPendingClientResources();
+    }
+
     TEST_F(ARendererFrameworkLogic, cancelsResourceRequestViaResourceComponent)
     {
         const ResourceContentHash resource(44u, 0);
@@ -18,14 +18,22 @@ namespace ramses_internal
     class IDevice;
     class RendererLogContext;
     class FrameTimer;
+    class DataLayout;
+    class EffectResource;
 
     class RenderExecutor
     {
     public:
-        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr);
+        // With draw call batching enabled consecutive renderables differing only in model dependent semantic uniforms
+        // are drawn by single instanced draw call, if their effect supports it (see EffectSupportsDrawCallBatching)
+        RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr, Bool drawCallBatchingEnabled = false);
 
         SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const;
 
+        // Effect supports batching if it declares all model dependent semantic uniforms as arrays which are accessed
+        // only by gl_InstanceID index in vertex shader and not used in fragment shader
+        static Bool EffectSupportsDrawCallBatching(const EffectResource& effect);
+
         // This is exposed and can be modified but acts as a global parameter
         static UInt32 NumRenderablesToRenderInBetweenTimeBudgetChecks;
         static const UInt32 DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks = 10u;
@@ -38,6 +46,7 @@ namespace ramses_internal
         void executeRenderStates    () const;
         void executeEffectAndInputs () const;
         void executeConstant        (EDataType dataType, UInt32 elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const;
+        UniformDataVersion getUniformDataVersion(DataInstanceHandle uniformData, const DataLayout& dataLayout) const;
         void executeDrawCall        () const;
 
         void setGlobalInternalStates    (const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const;
@@ -46,12 +55,23 @@ namespace ramses_internal
         void activateRenderTarget       (RenderTargetHandle renderTarget) const;
 
         void resolveAndSetSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const;
-        void setSemanticDataFields  () const;
+        void resolveAndSetSemanticArrayDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, UInt32 elementCount, Bool batchedRenderables) const;
+        void setSemanticDataFields  (Bool batchedRenderables) const;
         void executeCamera(CameraHandle camera) const;
+        Bool isRenderableCulled(RenderableHandle renderableHandle) const;
+        Bool isRenderableInstanced(RenderableHandle renderableHandle) const;
+        Bool hasInstancedVertexAttributes(DataInstanceHandle vertexData) const;
+
+        UInt32 collectRenderablesToBatch(const RenderableVector& orderedRenderables) const;
+        UInt32 getMaxBatchSize() const;
+        Bool canBeBatchedWithCurrentRenderable(RenderableHandle renderableHandle) const;
+        Bool hasEqualUniformValues(DataInstanceHandle uniformData, DataInstanceHandle otherUniformData, const DataLayout& dataLayout) const;
 
     private:
         Bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
+
+        const Bool m_drawCallBatchingEnabled;
     };
 
 }
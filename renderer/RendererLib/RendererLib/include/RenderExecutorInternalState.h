@@ -12,6 +12,7 @@
 #include "Math3d/Vector3.h"
 #include "Math3d/CameraMatrixHelper.h"
 #include "SceneAPI/Handles.h"
+#include "SceneAPI/SceneTypes.h"
 #include "RendererAPI/SceneRenderExecutionIterator.h"
 #include "RendererLib/FrameTimer.h"
 #include "RenderExecutorInternalRenderStates.h"
@@ -82,6 +83,7 @@ namespace ramses_internal
         const Matrix44f&           getCameraViewMatrix() const;
         const Vector3&             getCameraWorldPosition() const;
         const Matrix44f&           getViewMatrix() const;
+        const Matrix44f&           getViewProjectionMatrix() const;
         const Matrix44f&           getModelMatrix() const;
         const Matrix44f&           getModelViewMatrix() const;
         const Matrix44f&           getModelViewProjectionMatrix() const;
@@ -108,6 +110,15 @@ namespace ramses_internal
 
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
+        UInt32                                  m_numCulledRenderables = 0u;
+        UInt32                                  m_numRenderedRenderables = 0u;
+        UInt32                                  m_numMergedDrawCalls = 0u;
+
+        // renderables drawn by current instanced draw call, only used if draw call batching is enabled
+        RenderableVector                        m_batchedRenderables;
+        std::vector<Matrix44f>                  m_batchedMatrices;
+        std::vector<Matrix33f>                  m_batchedMatrices33;
+
     private:
         IDevice&                    m_device;
         const RendererCachedScene*  m_scene;
@@ -119,6 +130,7 @@ namespace ramses_internal
         Matrix44f                   m_projectionMatrix;
         Matrix44f                   m_cameraViewMatrix;
         Matrix44f                   m_viewMatrix;
+        Matrix44f                   m_viewProjectionMatrix;
         Matrix44f                   m_modelMatrix;
         Matrix44f                   m_modelViewMatrix;
         Matrix44f                   m_modelViewProjectionMatrix;
@@ -12,6 +12,8 @@
 #include "RendererLib/ResourceDescriptor.h"
 #include "Transfer/ResourceTypes.h"
 #include "Collections/HashMap.h"
+#include "Components/ManagedResource.h"
+#include <memory>
 
 namespace ramses_internal
 {
@@ -21,6 +23,8 @@ namespace ramses_internal
     struct RenderBuffer;
     class FrameTimer;
     class RendererStatistics;
+    class ResourceStagingThread;
+    class ITaskQueue;
 
     class ClientResourceUploadingManager
     {
@@ -32,7 +36,8 @@ namespace ramses_internal
             Bool keepEffects,
             const FrameTimer& frameTimer,
             RendererStatistics& stats,
-            UInt64 clientResourceCacheSize);
+            UInt64 clientResourceCacheSize,
+            ITaskQueue* decompressionTaskQueue = nullptr);
         ~ClientResourceUploadingManager();
 
         Bool hasAnythingToUpload() const;
@@ -40,14 +45,26 @@ namespace ramses_internal
 
         static const UInt32 NumResourcesToUploadInBetweenTimeBudgetChecks = 10u;
         static const UInt32 LargeResourceByteSizeThreshold = 250000u;
+        static const UInt32 MaxStagedUploadsByteSizeInFlight = 32u * 1024u * 1024u;
 
     private:
         void unloadClientResources(const ResourceContentHashVector& resourcesToUnload);
         void uploadClientResources(const ResourceContentHashVector& resourcesToUpload);
         void uploadClientResource(const ResourceDescriptor& rd);
+        void stageClientResources(ResourceContentHashVector& resourcesToUpload);
+        void updateStagedClientResources();
+        void transferStagedClientResources();
+        void removeStagedUpload(const ResourceContentHash& hash);
+        void finishAsyncClientResourceUpload(const ResourceDescriptor& rd, DeviceResourceHandle deviceHandle, UInt32 vramSize);
+        void releaseStagedClientResourceUploads();
+        void startEffectCompilations(ResourceContentHashVector& resourcesToUpload);
+        void updatePendingEffectCompilations();
+        void releasePendingEffectCompilations();
+        void discardPendingEffectCompilation(const ResourceContentHash& hash, const ManagedResource& resource, DeviceResourceHandle pendingHandle);
         void unloadClientResource(const ResourceDescriptor& rd);
         void getClientResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, Bool keepEffects, UInt64 sizeToBeFreed) const;
-        void getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const;
+        void getClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const;
+        static void DecompressClientResources(const RendererClientResourceRegistry& resources, const ResourceContentHashVector& resourcesToDecompress, ITaskQueue* taskQueue);
         UInt64 getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const;
 
         RendererClientResourceRegistry& m_clientResources;
@@ -56,6 +73,7 @@ namespace ramses_internal
 
         const Bool   m_keepEffects;
         const FrameTimer& m_frameTimer;
+        ITaskQueue* const m_decompressionTaskQueue;
 
         using SizeMap = HashMap<ResourceContentHash, UInt32>;
         SizeMap       m_clientResourceSizes;
@@ -63,6 +81,35 @@ namespace ramses_internal
         const UInt64  m_clientResourceCacheSize = 0u;
 
         RendererStatistics& m_stats;
+
+        // large textures and arrays are staged asynchronously: their data is written to staging buffer by worker thread,
+        // transferred to device resource on render thread and reported as uploaded only after fence tells that transfer is done
+        struct StagedUpload
+        {
+            ManagedResource resource;
+            DeviceResourceHandle stagingBuffer;
+            DeviceResourceHandle deviceHandle;
+            DeviceResourceHandle fence;
+            UInt32 resourceSize = 0u;
+            UInt32 vramSize = 0u;
+            Bool dataStaged = false;
+        };
+        using StagedUploadMap = HashMap<ResourceContentHash, StagedUpload>;
+        StagedUploadMap m_stagedUploads;
+        // staged uploads count towards cache size already while in flight, their staging buffers are capped by MaxStagedUploadsByteSizeInFlight
+        UInt64 m_stagedUploadsTotalSize = 0u;
+        Bool m_stagingSupported = true;
+        std::unique_ptr<ResourceStagingThread> m_stagingThread;
+
+        // effects compiled by driver in parallel are polled every frame and finished only when compilation is done,
+        // their resource data is kept until then
+        struct PendingEffect
+        {
+            ManagedResource resource;
+            DeviceResourceHandle pendingHandle;
+        };
+        using PendingEffectMap = HashMap<ResourceContentHash, PendingEffect>;
+        PendingEffectMap m_pendingEffects;
     };
 }
 
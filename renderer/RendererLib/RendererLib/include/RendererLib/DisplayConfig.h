@@ -12,6 +12,7 @@
 #include "RendererAPI/Types.h"
 #include "Math3d/Vector3.h"
 #include "Math3d/CameraMatrixHelper.h"
+#include "Transfer/ResourceTypes.h"
 
 namespace ramses_internal
 {
@@ -83,9 +84,15 @@ namespace ramses_internal
         Bool isResizable() const;
         void setResizable(Bool resizable);
 
+        Bool isDrawCallBatchingEnabled() const;
+        void setDrawCallBatchingEnabled(Bool enabled);
+
         UInt64 getGPUMemoryCacheSize() const;
         void setGPUMemoryCacheSize(UInt64 size);
 
+        const ResourceContentHashVector& getEffectsToPrewarm() const;
+        void setEffectsToPrewarm(const ResourceContentHashVector& effects);
+
         void setClearColor(const Vector4& clearColor);
         const Vector4& getClearColor() const;
 
@@ -97,6 +104,7 @@ namespace ramses_internal
         Bool m_borderless = false;
         Bool m_warpingEnabled = false;
         Bool m_resizable = false;
+        Bool m_drawCallBatchingEnabled = false;
 
         UInt32 m_desiredWindowWidth = 1280;
         UInt32 m_desiredWindowHeight = 480;
@@ -119,6 +127,7 @@ namespace ramses_internal
 
         Bool m_keepEffectsUploaded = true;
         UInt64 m_gpuMemoryCacheSize = 0u;
+        ResourceContentHashVector m_effectsToPrewarm;
         Vector4 m_clearColor{ 0.f, 0.f, 0.f, 1.0f };
     };
 }
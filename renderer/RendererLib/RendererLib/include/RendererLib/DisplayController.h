@@ -31,11 +31,12 @@ namespace ramses_internal
         friend class RendererLogger;
 
     public:
-        DisplayController(IRenderBackend& renderer, UInt32 samples = 1, UInt32 postProcessingEffectIds = EPostProcessingEffect_None);
+        DisplayController(IRenderBackend& renderer, UInt32 samples = 1, UInt32 postProcessingEffectIds = EPostProcessingEffect_None, Bool drawCallBatchingEnabled = false);
 
         virtual void                    handleWindowEvents() override;
         virtual Bool                    canRenderNewFrame() const override;
         virtual void                    enableContext() override;
+        virtual void                    disableContext() override;
         virtual void                    swapBuffers() override;
         virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom = {}, const FrameTimer* frameTimer = nullptr) override;
         virtual void                    executePostProcessing() override;
@@ -78,6 +79,7 @@ namespace ramses_internal
         const UInt32            m_displayHeight;
 
         std::unique_ptr<Postprocessing> m_postProcessing;
+        const Bool              m_drawCallBatchingEnabled;
     };
 }
 
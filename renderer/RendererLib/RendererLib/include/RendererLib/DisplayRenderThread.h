@@ -0,0 +1,65 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DISPLAYRENDERTHREAD_H
+#define RAMSES_DISPLAYRENDERTHREAD_H
+
+#include "RendererAPI/Types.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses_internal
+{
+    // Executes frames of a single display on its own thread.
+    // A frame is split into rendering, which reads scene state and must be finished before scenes of the display are updated again,
+    // and presenting, which waits for the display (buffer swap) and may overlap with the next scene update.
+    // Frames are started and waited for by one thread only (the thread updating the scenes).
+    class DisplayRenderThread : public Runnable
+    {
+    public:
+        using FrameFunction = std::function<void()>;
+
+        DisplayRenderThread(DisplayHandle display, const FrameFunction& renderFunction, const FrameFunction& presentFunction);
+        virtual ~DisplayRenderThread() override;
+
+        DisplayRenderThread(const DisplayRenderThread&) = delete;
+        DisplayRenderThread& operator=(const DisplayRenderThread&) = delete;
+
+        // must be idle
+        void startFrame();
+        void waitUntilRendered();
+        void waitUntilIdle();
+        Bool isIdle() const;
+        Bool isRendering() const;
+
+    private:
+        enum class EState
+        {
+            Idle,
+            Rendering,
+            Presenting
+        };
+
+        virtual void run() override;
+        void setState(EState state);
+
+        const FrameFunction m_renderFunction;
+        const FrameFunction m_presentFunction;
+
+        mutable std::mutex m_lock;
+        std::condition_variable m_stateChanged;
+        EState m_state = EState::Idle;
+        Bool m_stopRequested = false;
+
+        PlatformThread m_thread;
+    };
+}
+
+#endif
@@ -22,6 +22,7 @@ namespace ramses_internal
         virtual ~IResourceDeviceHandleAccessor() {}
 
         virtual DeviceResourceHandle getClientResourceDeviceHandle(const ResourceContentHash& resourceHash) const = 0;
+        virtual Bool                 getClientEffectSupportsDrawCallBatching(const ResourceContentHash& effectHash) const = 0;
         virtual DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle targetHandle, SceneId sceneId) const = 0;
         virtual DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle bufferHandle, SceneId sceneId) const = 0;
         virtual void                 getBlitPassRenderTargetsDeviceHandle(BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const = 0;
@@ -27,6 +27,12 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, UInt32& outVRAMSize) = 0;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) = 0;
+        // texture and array resources only, staging buffer is expected to contain decompressed resource data
+        virtual DeviceResourceHandle uploadResourceFromStagingBuffer(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, DeviceResourceHandle stagingBuffer, UInt32& outVRAMSize) = 0;
+        // effect resources only, invalid handle is returned if effect has to be uploaded synchronously using uploadResource
+        virtual DeviceResourceHandle startEffectCompilation(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject) = 0;
+        virtual Bool                 isEffectCompilationFinished(IRenderBackend& renderBackend, DeviceResourceHandle pendingEffect) = 0;
+        virtual DeviceResourceHandle finishEffectCompilation(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, DeviceResourceHandle pendingEffect, UInt32& outVRAMSize) = 0;
     };
 }
 
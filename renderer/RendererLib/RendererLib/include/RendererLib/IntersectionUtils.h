@@ -12,10 +12,16 @@
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "Math3d/Vector3.h"
 #include "Math3d/Vector2.h"
-#include "TransformationLinkCachedScene.h"
+#include "Math3d/Vector2i.h"
+#include "Math3d/Vector4.h"
+#include "Math3d/Matrix44f.h"
+#include "SceneAPI/SceneTypes.h"
 
 namespace ramses_internal
 {
+    class TriangleBVH;
+    class TransformationLinkCachedScene;
+
     class IntersectionUtils
     {
     public:
@@ -29,9 +35,12 @@ namespace ramses_internal
         static Vector3 CalculatePlaneNormal(const Triangle& triangle);
         static bool IntersectRayVsTriangle(const Triangle& triangle, const Vector3& rayOrigin, const Vector3& rayDir, Vector3& intersectionPointInModelSpace, float& distanceRayOriginToIntersection);
         static bool TestGeometryPicked(const Vector2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const Matrix44f& modelMatrix, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector3& intersectionPointInModelSpace);
+        static bool TestGeometryPicked(const Vector2& pickCoordsNDS, const TriangleBVH& geometryBVH, const Matrix44f& modelMatrix, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector3& intersectionPointInModelSpace);
         static void CheckSceneForIntersectedPickableObjects(const TransformationLinkCachedScene& scene, const Vector2i coordsInBufferSpace, PickableObjectIds& pickedObjects);
 
     private:
+        static void CalculatePickRayInWorldSpace(const Vector2& pickCoordsNDS, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector4& rayOriginWorld, Vector4& rayTargetWorld);
+        static bool TestGeometryPickedByRayInWorldSpace(const Vector4& rayOriginWorld, const Vector4& rayTargetWorld, const TriangleBVH& geometryBVH, const Matrix44f& modelMatrix, Vector3& intersectionPointInModelSpace);
         static bool TestPointInTriangle(const Triangle& triangle, const Vector3& planeNormal, const Vector3& testPoint);
         static bool CalculateRayVsPlaneIntersection(const Vector3& triangleVertex,
             const Vector3& triangleNormal,
@@ -62,6 +62,11 @@ namespace ramses_internal
         virtual Bool getBinaryShader(DeviceResourceHandle handle, UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
         virtual void deleteShader(DeviceResourceHandle handle) override;
         virtual void activateShader(DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle startShaderCompilation(const EffectResource& effect) override;
+        virtual Bool isShaderCompilationFinished(DeviceResourceHandle pendingShader) override;
+        virtual DeviceResourceHandle finishShaderCompilation(DeviceResourceHandle pendingShader, const EffectResource& effect) override;
+        virtual UniformDataVersion getActiveShaderUniformDataVersion() const override;
+        virtual void setActiveShaderUniformDataVersion(const UniformDataVersion& version) override;
         virtual DeviceResourceHandle allocateTexture2D(UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes) override;
         virtual DeviceResourceHandle allocateTexture3D(UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 dataSize) override;
         virtual DeviceResourceHandle allocateTextureCube(UInt32 faceSize, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 dataSize) override;
@@ -71,6 +76,14 @@ namespace ramses_internal
         virtual DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, UInt32 width, UInt32 height, ETextureFormat format, const UInt8* data, const TextureSwizzleArray& swizzle) override;
         virtual void deleteTexture(DeviceResourceHandle handle) override;
         virtual void activateTexture(DeviceResourceHandle handle, DataFieldHandle field) override;
+        virtual DeviceResourceHandle allocateStagingBuffer(UInt32 sizeInBytes) override;
+        virtual Byte*                getStagingBufferData(DeviceResourceHandle handle) override;
+        virtual void                 deleteStagingBuffer(DeviceResourceHandle handle) override;
+        virtual void                 uploadTextureDataFromStagingBuffer(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize) override;
+        virtual void                 uploadBufferDataFromStagingBuffer(DeviceResourceHandle handle, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize) override;
+        virtual DeviceResourceHandle insertFence() override;
+        virtual Bool                 isFenceSignaled(DeviceResourceHandle handle) override;
+        virtual void                 deleteFence(DeviceResourceHandle handle) override;
         virtual DeviceResourceHandle    uploadRenderBuffer(const RenderBuffer& renderBuffer) override;
         virtual void                    deleteRenderBuffer(DeviceResourceHandle handle) override;
         virtual DeviceResourceHandle    uploadTextureSampler(EWrapMethod wrapU, EWrapMethod wrapV, EWrapMethod wrapR, ESamplingMethod minSampling, ESamplingMethod magSampling, UInt32 anisotropyLevel) override;
@@ -17,11 +17,14 @@
 #include "RendererLib/DisplayEventHandlerManager.h"
 #include "RendererLib/RendererInterruptState.h"
 #include "RendererLib/DisplaySetup.h"
+#include "RendererLib/DisplayRenderThread.h"
+#include "RendererLib/FrameTimer.h"
 #include "FrameProfileRenderer.h"
 #include "MemoryStatistics.h"
 #include "Collections/Vector.h"
 #include "Collections/HashMap.h"
 #include <map>
+#include <memory>
 
 namespace ramses_internal
 {
@@ -62,6 +65,18 @@ namespace ramses_internal
 
         virtual void                markBufferWithSceneAsModified(SceneId sceneId);
         void                        setSkippingOfUnmodifiedBuffers(Bool enable);
+        // must be set before any display is created
+        void                        setRenderThreadPerDisplay(Bool enable);
+        Bool                        hasRenderThreadPerDisplay() const;
+        // blocks until the display's render thread presented its last frame and released the display context,
+        // must be called before using the display context outside of rendering, results of the frame are applied
+        void                        waitForDisplayRenderThread(DisplayHandle display);
+        // blocks until the display's render thread finished reading scenes and display setup of its current frame
+        // (it may still be presenting), must be called before modifying scenes assigned to the display
+        void                        waitForDisplayRendering(DisplayHandle display) const;
+        void                        waitForAllDisplaysRendering() const;
+        // display's render thread reads scenes assigned to it, displays without render thread are never being rendered
+        Bool                        isDisplayBeingRendered(DisplayHandle display) const;
 
         virtual void                createDisplayContext(const DisplayConfig& displayConfig, DisplayHandle display);
         virtual void                destroyDisplayContext(DisplayHandle display);
@@ -81,8 +96,13 @@ namespace ramses_internal
         Bool                        hasAnyBufferWithInterruptedRendering() const;
         void                        resetRenderInterruptState();
 
+        // waits for rendering of the display, the profile renderer is used by the display's render thread
         FrameProfileRenderer&       getFrameProfileRenderer(DisplayHandle display);
 
+        // draw calls of displays with render thread are counted on the render thread and reported with results of their last frame
+        void                        resetDrawCallCounts();
+        UInt32                      getDrawCallCount() const;
+
         Bool hasSystemCompositorController() const;
         void updateSystemCompositorController() const;
         void systemCompositorListIviSurfaces() const;
@@ -107,25 +127,72 @@ namespace ramses_internal
         void removeDisplayController(DisplayHandle display);
 
     private:
+        struct DisplayInfo;
+
         void handleDisplayEvents(DisplayHandle displayHandle);
-        void renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
-        void renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay);
-        void renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay, Bool& interrupted);
+        void renderToFramebuffer(DisplayHandle displayHandle, DisplayInfo& displayInfo, DisplayHandle& activeDisplay, FrameProfilerStatistics& profilerStatistics);
+        void renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayInfo& displayInfo, DisplayHandle& activeDisplay);
+        void renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayInfo& displayInfo, DisplayHandle& activeDisplay, const FrameTimer& frameTimer, RendererInterruptState& interruptState, Bool& interrupted);
+        void startDisplayFramesOnRenderThreads();
+        void renderDisplayOnRenderThread(DisplayHandle displayHandle, DisplayInfo& displayInfo);
+        void presentDisplayOnRenderThread(DisplayHandle displayHandle, DisplayInfo& displayInfo);
         IDisplayController* createDisplayControllerFromConfig(const DisplayConfig& config, DisplayEventHandler& displayEventHandler);
-        void processScheduledScreenshots(DisplayHandle display, IDisplayController& controller, DisplayHandle& activeDisplay);
+        static void ProcessScheduledScreenshots(DisplayHandle display, DisplayInfo& displayInfo, DisplayHandle& activeDisplay);
         Bool hasAnyOffscreenBufferToRerender(DisplayHandle display, Bool interruptible) const;
-        void onSceneWasRendered(const RendererCachedScene& scene);
+        static void OnSceneWasRendered(DisplayInfo& displayInfo, const RendererCachedScene& scene);
+        void applyRenderedFrameResults(DisplayHandle display, DisplayInfo& displayInfo);
+        void applyPresentedFrameResults(DisplayHandle display, DisplayInfo& displayInfo);
+        static void MarkAllBuffersToBeRerendered(DisplayInfo& displayInfo);
 
         static void ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController);
         static void ReorderDisplaysToStartWith(std::vector<DisplayHandle>& displays, DisplayHandle displayToStartWith);
 
+        // Results of rendering a display which are applied to statistics and expiration monitoring after rendering,
+        // so that displays rendered on their own threads only write to their own display info.
+        struct RenderedFrameResults
+        {
+            struct RenderedScene
+            {
+                SceneId sceneId;
+                UInt32  numCulled;
+                UInt32  numRendered;
+                UInt32  numMergedDrawCalls;
+            };
+
+            std::vector<RenderedScene>                              renderedScenes;
+            std::vector<std::pair<DeviceResourceHandle, Bool>>      swappedOffscreenBuffers;
+            std::vector<DeviceResourceHandle>                       interruptedOffscreenBuffers;
+            ScreenshotInfoVector                                    processedScreenshots;
+            Bool                                                    framebufferRendered = false;
+
+            // only used with render thread per display
+            RendererInterruptState                                  interruptState;
+            UInt32                                                  drawCallCount = 0u;
+        };
+
         struct DisplayInfo
         {
             IDisplayController*  displayController;
             Bool                 couldRenderLastFrame;
             DeviceResourceHandle frameBufferDeviceHandle;
             DisplaySetup         buffersSetup;
+            RenderedFrameResults renderedFrameResults;
+            ScreenshotInfoVector scheduledScreenshots;
+            std::unique_ptr<FrameProfileRenderer> frameProfileRenderer;
+
+            // Only used with render thread per display. The render thread accesses only the info of its display (never the displays map),
+            // scenes assigned to the display and the inputs below which are handed over when its frame is started.
+            std::unique_ptr<DisplayRenderThread> renderThread;
+            RendererInterruptState               interruptState;
+            FrameTimer                           frameTimer;
+            std::unique_ptr<FrameProfilerStatistics> profilerStatistics;
+            Bool                                 contextEnabledOnRenderThread = false;
+            // written by render thread while rendering/presenting, read when render thread is idle
+            UInt32                               presentedFrameCount = 0u;
+            Bool                                 embeddedCompositingClientsToNotify = false;
+            UInt32                               lastFrameDrawCallCount = 0u;
         };
+        // map nodes are stable, render threads keep a pointer to the info of their display
         using Displays = std::map<DisplayHandle, DisplayInfo>;
 
         IPlatformFactory&                      m_platformFactory;
@@ -142,20 +209,16 @@ namespace ramses_internal
         MemoryStatistics                       m_memoryStatistics;
 
         Bool                                   m_skipUnmodifiedBuffers = true;
+        Bool                                   m_renderThreadPerDisplay = false;
         RendererInterruptState                 m_rendererInterruptState;
         const FrameTimer&                      m_frameTimer;
         SceneExpirationMonitor&                m_expirationMonitor;
 
-        HashMap<DisplayHandle, ScreenshotInfoVector> m_scheduledScreenshots;
         ScreenshotInfoVector m_processedScreenshots;
 
-        using FrameProfilerMap = HashMap<DisplayHandle, FrameProfileRenderer*>;
-        FrameProfilerMap m_frameProfileRenderer;
-
         // temporary containers kept to avoid re-allocations
         std::vector<DisplayHandle> m_tempDisplaysToRender; // used in RendererLogger - adapt if changing behavior
         std::vector<DisplayHandle> m_tempDisplaysToSwapBuffers;
-        std::vector<SceneId> m_tempScenesRendered;
     };
 }
 
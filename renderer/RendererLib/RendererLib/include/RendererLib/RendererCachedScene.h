@@ -28,7 +28,21 @@ namespace ramses_internal
         void retriggerAllRenderOncePasses();
         void markAllRenderOncePassesAsRendered() const;
 
+        // counts renderables culled by view frustum, rendered and draw calls saved by batching since last collected
+        struct RenderingStatistics
+        {
+            UInt32 numCulled = 0u;
+            UInt32 numRendered = 0u;
+            UInt32 numMergedDrawCalls = 0u;
+        };
+        void trackRenderedRenderables(UInt32 numCulled, UInt32 numRendered, UInt32 numMergedDrawCalls) const;
+        RenderingStatistics collectRenderingStatistics() const;
+
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        virtual void                        setRenderableDataInstance       (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
+
+        virtual DataLayoutHandle            allocateDataLayout              (const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutHandle handle = DataLayoutHandle::Invalid()) override;
+        virtual void                        releaseDataLayout               (DataLayoutHandle layoutHandle) override;
 
         virtual void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         virtual void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order) override;
@@ -54,21 +68,60 @@ namespace ramses_internal
         const Matrix44f&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
     private:
+        friend class RendererCachedSceneBenchmarkAccess;
+
         void updatePassRenderableSorting();
+        void updateSortedRenderingPasses();
         void updateRenderablesInPass(RenderPassHandle passHandle);
         void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
+        void sortRenderGroup(RenderGroup& renderGroup);
+        void updateEffectSortRanks();
+        Bool containsDirtyRenderGroup(const RenderGroupOrderVector& renderGroups) const;
         Bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
 
+        void markRenderPassDirty(RenderPassHandle passHandle);
+        void markRenderGroupDirty(RenderGroupHandle groupHandle, Bool needsSorting);
+        void markRenderableRenderGroupsDirty(RenderableHandle renderableHandle, Bool needsSorting);
+        void markAllRenderPassesDirty();
+        void markRenderingPassesDirty() const;
+
         RenderingPassInfoVector m_sortedRenderingPasses;
         typedef std::vector<RenderableVector> PassRenderableOrder;
         PassRenderableOrder     m_passRenderableOrder;
+
+        // ordering is updated incrementally, only render passes which contain changed render groups
+        // are flattened again and only render groups whose content changed are sorted again
         mutable Bool            m_renderableOrderingDirty;
+        mutable Bool            m_renderingPassesDirty;
+        std::vector<Bool>       m_renderPassNeedsUpdate;
+        std::vector<Bool>       m_renderGroupNeedsSorting;
+        std::vector<Bool>       m_renderGroupChanged;
+        using RenderGroupHandleVector = std::vector<RenderGroupHandle>;
+        std::vector<RenderGroupHandleVector> m_renderableRenderGroups;
+
+        // effects are ranked by their hash so that sort keys order renderables same as RenderableComparator
+        Bool                    m_effectSortRanksDirty;
+        std::vector<UInt32>     m_dataLayoutEffectSortRanks;
+        UInt32                  m_effectSortRanksCount;
+        std::vector<ResourceContentHash> m_sortedEffectHashes;
+
+        struct RenderableSortEntry
+        {
+            UInt64 key;
+            RenderableOrderEntry entry;
+        };
+        // to avoid memory allocations the sort buffers are member variables
+        std::vector<RenderableSortEntry> m_sortEntries;
+        std::vector<RenderableSortEntry> m_sortEntriesScratch;
 
         typedef std::vector<Matrix44f> MatrixVector;
         MatrixVector            m_renderableMatrices;
+        NodeHandleVector        m_renderableNodes;
 
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
+
+        mutable RenderingStatistics m_renderingStatistics;
     };
 }
 
@@ -32,6 +32,7 @@ namespace ramses_internal
         void                       setResourceData      (const ResourceContentHash& hash, ManagedResource resourceObject, DeviceResourceHandle deviceHandle, EResourceType resourceType);
         void                       setResourceSize      (const ResourceContentHash& hash, UInt32 compressedSize, UInt32 decompressedSize);
         void                       setResourceVRAMSize  (const ResourceContentHash& hash, UInt32 vramSize);
+        void                       setEffectSupportsDrawCallBatching(const ResourceContentHash& hash, Bool supported);
 
         const ResourceDescriptors& getAllResourceDescriptors() const;
 
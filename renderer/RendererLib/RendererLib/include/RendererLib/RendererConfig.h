@@ -39,6 +39,8 @@ namespace ramses_internal
         void setFrameCallbackMaxPollTime(std::chrono::microseconds pollTime);
         void setRenderthreadLooptimingReportingPeriod(std::chrono::milliseconds period);
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
+        void setRenderThreadPerDisplayEnabled(Bool enabled);
+        Bool getRenderThreadPerDisplayEnabled() const;
     private:
         String m_waylandSocketEmbedded;
         String m_waylandSocketEmbeddedGroupName;
@@ -48,6 +50,7 @@ namespace ramses_internal
         String m_kpiFilename;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
         std::chrono::milliseconds m_renderThreadLoopTimingReportingPeriod { 0 }; // zero deactivates reporting
+        Bool m_renderThreadPerDisplayEnabled = false;
     };
 }
 
@@ -27,6 +27,7 @@ namespace ramses_internal
     class IRendererResourceCache;
     class FrameTimer;
     class RendererStatistics;
+    class ITaskQueue;
 
     class RendererResourceManager : public IRendererResourceManager
     {
@@ -40,7 +41,8 @@ namespace ramses_internal
             Bool keepEffects,
             const FrameTimer& frameTimer,
             RendererStatistics& stats,
-            UInt64 clientResourceCacheSize = 0u);
+            UInt64 clientResourceCacheSize = 0u,
+            ITaskQueue* decompressionTaskQueue = nullptr);
         virtual ~RendererResourceManager();
 
         // Client resources
@@ -53,7 +55,11 @@ namespace ramses_internal
         virtual Bool                 hasClientResourcesToBeUploaded() const override;
         virtual void                 uploadAndUnloadPendingClientResources() override;
 
+        // effects are referenced without any scene using them, they are uploaded as soon as they arrive and kept until destruction
+        void                         prewarmEffects(const ResourceContentHashVector& effects);
+
         virtual DeviceResourceHandle getClientResourceDeviceHandle(const ResourceContentHash& hash) const override;
+        virtual Bool                 getClientEffectSupportsDrawCallBatching(const ResourceContentHash& effectHash) const override;
         virtual EResourceStatus      getClientResourceStatus(const ResourceContentHash& hash) const override;
         virtual EResourceType        getClientResourceType(const ResourceContentHash& hash) const override;
 
@@ -105,6 +111,7 @@ namespace ramses_internal
         typedef HashMap<SceneId, ResourceContentHashVector> ResourcesPerSceneMap;
         typedef HashMap<SceneId, RendererSceneResourceRegistry> SceneResourceRegistryMap;
 
+        void addClientResourceRefs(SceneId sceneId, const ResourceContentHashVector& resources);
         void groupResourcesBySceneId(const ResourceContentHashVector& resources, ResourcesPerSceneMap& resourcesPerScene) const;
         void requestResourcesFromProvider(const ResourceContentHashVector& resources);
         RendererSceneResourceRegistry& getSceneResourceRegistry(SceneId sceneId);
@@ -136,6 +143,10 @@ namespace ramses_internal
         UInt64 m_numberOfArrivedResourcesInWrongStatus = 0u;
         UInt64 m_sizeOfArrivedResourcesInWrongStatus = 0u;
 
+        // effects to prewarm are requested from provider of first scene using resources of this display, until then they are kept here
+        ResourceContentHashVector m_effectsToPrewarm;
+        SceneId m_prewarmedEffectsProviderScene;
+
         friend class RendererLogger;
         // TODO Violin remove this after KPI monitor is reworked
         friend class GpuMemorySample;
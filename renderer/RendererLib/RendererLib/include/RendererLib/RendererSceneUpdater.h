@@ -39,6 +39,7 @@ namespace ramses_internal
     class TransformationLinkManager;
     class TextureLinkManager;
     class ISceneReferenceLogic;
+    class ITaskQueue;
 
     class RendererSceneUpdater : public IRendererSceneControl
     {
@@ -54,7 +55,8 @@ namespace ramses_internal
             RendererEventCollector& eventCollector,
             FrameTimer& frameTimer,
             SceneExpirationMonitor& expirationMonitor,
-            IRendererResourceCache* rendererResourceCache = nullptr);
+            IRendererResourceCache* rendererResourceCache = nullptr,
+            ITaskQueue* parallelProcessingQueue = nullptr);
         virtual ~RendererSceneUpdater();
 
         virtual void handleSceneActions(SceneId sceneId, SceneActionCollection& actionsForScene);
@@ -107,6 +109,7 @@ namespace ramses_internal
         void consolidatePendingSceneActions();
         void consolidatePendingSceneActions(SceneId sceneID, SceneActionCollection& actionsForScene);
         void consolidateResourceChanges(PendingFlush& flushInfo, const PendingFlushes& pendingFlushes, const SceneResourceChanges& resourceChanges, ResourceContentHashVector& newlyNeededClientResources) const;
+        void mergeLastPendingFlushWithPrevious(SceneId sceneID, PendingFlushes& pendingFlushes) const;
         void requestAndUploadAndUnloadResources(DisplayHandle& activeDisplay);
         void updateEmbeddedCompositingResources(DisplayHandle& activeDisplay);
         void tryToApplyPendingFlushes();
@@ -119,6 +122,9 @@ namespace ramses_internal
         void updateScenesStates();
 
         void activateDisplayContext(DisplayHandle& activeDisplay, DisplayHandle displayToActivate);
+        // scenes assigned to a display are read by its render thread (if enabled) while rendering and must not be modified
+        Bool isSceneBeingRendered(SceneId sceneId) const;
+        void waitForSceneRendering(SceneId sceneId) const;
 
         void resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager);
         void markScenesDependantOnModifiedConsumersAsModified(const DataReferenceLinkManager& dataRefLinkManager, const TransformationLinkManager &transfLinkManager, const TextureLinkManager& texLinkManager);
@@ -134,6 +140,7 @@ namespace ramses_internal
         SceneExpirationMonitor&                           m_expirationMonitor;
         ISceneReferenceLogic*                             m_sceneReferenceLogic = nullptr;
         IRendererResourceCache*                           m_rendererResourceCache = nullptr;
+        ITaskQueue*                                       m_parallelProcessingQueue = nullptr;
 
         AnimationSystemFactory                            m_animationSystemFactory;
 
@@ -12,6 +12,7 @@
 #include "SceneAPI/SceneId.h"
 #include "RendererAPI/Types.h"
 #include "Utils/StatisticCollection.h"
+#include "Utils/LatencyHistogram.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "Components/FlushTimeInformation.h"
 #include <map>
@@ -27,6 +28,8 @@ namespace ramses_internal
         UInt32 getDrawCallsPerFrame() const;
 
         void sceneRendered(SceneId sceneId);
+        void trackRenderablesCulling(SceneId sceneId, UInt numCulled, UInt numRendered);
+        void trackMergedDrawCalls(SceneId sceneId, UInt numMerged);
         void trackArrivedFlush(SceneId sceneId, UInt numSceneActions, UInt numAddedClientResources, UInt numRemovedClientResources, UInt numSceneResourceActions, std::chrono::milliseconds latency);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
@@ -35,7 +38,7 @@ namespace ramses_internal
         void offscreenBufferInterrupted(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped(DisplayHandle display);
 
-        void clientResourceUploaded(UInt byteSize);
+        void clientResourceUploaded(UInt byteSize, std::chrono::microseconds uploadTime);
         void sceneResourceUploaded(SceneId sceneId, UInt byteSize);
         void streamTextureUpdated(StreamTextureSourceId sourceId, UInt numUpdates);
         void shaderCompiled(std::chrono::microseconds microsecondsUsed, const String& name, SceneId sceneid);
@@ -56,10 +59,13 @@ namespace ramses_internal
         UInt64 m_lastFrameTick = 0u;
         UInt32 m_frameDurationMin = std::numeric_limits<UInt32>::max();
         UInt32 m_frameDurationMax = 0u;
+        LatencyHistogram m_frameDurations;
         UInt m_clientResourcesUploaded = 0u;
         UInt m_clientResourcesBytesUploaded = 0u;
+        LatencyHistogram m_clientResourceUploadTimes;
         UInt m_shadersCompiled = 0u;
         UInt64 m_microsecondsForShaderCompilation = 0u;
+        LatencyHistogram m_shaderCompileTimes;
         String m_maximumDurationShaderName;
         std::chrono::microseconds m_maximumDurationShaderTime = {};
         SceneId m_maximumDurationShaderScene;
@@ -83,11 +89,16 @@ namespace ramses_internal
             SummaryEntry<UInt> numClientResourcesRemovedPerFlush;
             SummaryEntry<UInt> numSceneResourceActionsPerFlush;
             SummaryEntry<int64_t> flushLatency;
+            LatencyHistogram flushLatencyHistogram;
 
             UInt sceneResourcesUploaded = 0u;
             UInt sceneResourcesBytesUploaded = 0u;
 
             UInt numRendered = 0u;
+
+            UInt numRenderablesCulled = 0u;
+            UInt numRenderablesRendered = 0u;
+            UInt numMergedDrawCalls = 0u;
         };
 
         struct OffscreenBufferStatistics
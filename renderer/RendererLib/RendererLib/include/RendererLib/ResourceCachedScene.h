@@ -51,6 +51,7 @@ namespace ramses_internal
         Bool                                renderableResourcesDirty    (const RenderableVector& handles) const;
 
         DeviceResourceHandle                getRenderableEffectDeviceHandle(RenderableHandle renderable) const;
+        Bool                                getRenderableEffectSupportsDrawCallBatching(RenderableHandle renderable) const;
         const DeviceHandleCache&            getCachedHandlesForVertexAttributes() const;
         const DeviceHandleVector&           getCachedHandlesForTextureSamplers() const;
         const DeviceHandleVector&           getCachedHandlesForRenderTargets() const;
@@ -88,6 +89,7 @@ namespace ramses_internal
         Bool updateTextureSamplerResourceAsStreamTexture(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager, const StreamTextureHandle streamTextureHandle, DeviceResourceHandle& deviceHandleInOut);
 
         DeviceHandleVector         m_effectDeviceHandleCache;
+        BoolVector                 m_effectSupportsDrawCallBatchingCache;
         DeviceHandleCache          m_deviceHandleCacheForVertexAttributes;
         mutable DeviceHandleVector m_deviceHandleCacheForTextures;
         DeviceHandleVector         m_renderTargetCache;
@@ -32,6 +32,8 @@ namespace ramses_internal
         UInt32 compressedSize = 0;
         UInt32 decompressedSize = 0;
         UInt32 vramSize = 0;
+        // effect resources only, validated when uploaded (see RenderExecutor::EffectSupportsDrawCallBatching)
+        Bool effectSupportsDrawCallBatching = false;
     };
 
     typedef HashMap<ResourceContentHash, ResourceDescriptor> ResourceDescriptors;
@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_RESOURCESTAGINGTHREAD_H
+#define RAMSES_RESOURCESTAGINGTHREAD_H
+
+#include "Transfer/ResourceTypes.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace ramses_internal
+{
+    class IResource;
+
+    // Fills staging memory with resource data off the render thread. Resources must be decompressed before, they are
+    // shared with other threads and only read here. Resources and staging memory must stay valid until reported as staged,
+    // transfer from staging buffers to device resources is left to the render thread.
+    class ResourceStagingThread : public Runnable
+    {
+    public:
+        ResourceStagingThread();
+        virtual ~ResourceStagingThread() override;
+
+        ResourceStagingThread(const ResourceStagingThread&) = delete;
+        ResourceStagingThread& operator=(const ResourceStagingThread&) = delete;
+
+        void stageResource(const ResourceContentHash& hash, const IResource& resource, Byte* stagingMemory);
+        // appends hashes of resources whose data was fully written to staging memory since last call
+        void getStagedResources(ResourceContentHashVector& stagedResources);
+
+    private:
+        virtual void run() override;
+
+        struct StagingJob
+        {
+            ResourceContentHash hash;
+            const IResource* resource;
+            Byte* stagingMemory;
+        };
+
+        std::mutex m_lock;
+        std::condition_variable m_jobAdded;
+        std::deque<StagingJob> m_jobs;
+        ResourceContentHashVector m_stagedResources;
+        Bool m_stopRequested = false;
+
+        PlatformThread m_thread;
+    };
+}
+
+#endif
@@ -29,10 +29,16 @@ namespace ramses_internal
 
         virtual DeviceResourceHandle uploadResource(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, UInt32& outVRAMSize) override;
         virtual void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
+        virtual DeviceResourceHandle uploadResourceFromStagingBuffer(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, DeviceResourceHandle stagingBuffer, UInt32& outVRAMSize) override;
+        virtual DeviceResourceHandle startEffectCompilation(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject) override;
+        virtual Bool                 isEffectCompilationFinished(IRenderBackend& renderBackend, DeviceResourceHandle pendingEffect) override;
+        virtual DeviceResourceHandle finishEffectCompilation(IRenderBackend& renderBackend, const ResourceDescriptor& resourceObject, DeviceResourceHandle pendingEffect, UInt32& outVRAMSize) override;
 
     private:
-        DeviceResourceHandle uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize);
+        DeviceResourceHandle uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize, DeviceResourceHandle stagingBuffer = DeviceResourceHandle::Invalid());
         DeviceResourceHandle queryBinaryShaderCacheAndUploadEffect(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash, SceneId sceneid);
+        void reportSupportedBinaryShaderFormats(IDevice& device);
+        void storeBinaryShaderToCache(IDevice& device, DeviceResourceHandle shaderHandle, ResourceContentHash hash, SceneId sceneid);
 
         static UInt32 EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate);
 
@@ -12,6 +12,7 @@
 #include "SceneAPI/SceneSizeInformation.h"
 #include "SceneAPI/SceneVersionTag.h"
 #include "Scene/SceneActionCollection.h"
+#include "Scene/SceneActionUtils.h"
 #include "Scene/SceneResourceChanges.h"
 #include "SceneReferencing/SceneReferenceAction.h"
 #include "Transfer/ResourceTypes.h"
@@ -28,6 +29,10 @@ namespace ramses_internal
         UInt64                flushIndex = 0u;
         FlushTimeInformation  timeInfo;
         SceneVersionTag       versionTag;
+        // number of flushes from client merged into this pending flush
+        UInt32                numberOfClientFlushes = 1u;
+        // setter actions of merged flushes overwritten by later ones, removed from sceneActions lazily
+        OverwrittenSetterActionsTracker overwrittenSetterActions;
 
         // Resource lists below are consolidated for this flush and all previous pending flushes.
         // When a subset of flushes is to be applied, only the lists of the last one in that set need to be checked/processed.
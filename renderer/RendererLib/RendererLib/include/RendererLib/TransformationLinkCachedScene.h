@@ -10,6 +10,8 @@
 #define RAMSES_TRANSFORMATIONLINKCACHEDSCENE_H
 
 #include "RendererLib/SceneLinkScene.h"
+#include "RendererLib/TriangleBVH.h"
+#include "Collections/HashMap.h"
 
 namespace ramses_internal
 {
@@ -27,9 +29,16 @@ namespace ramses_internal
         virtual void                    setScaling(TransformHandle transform, const Vector3& scaling) override;
 
         virtual void                    releaseDataSlot(DataSlotHandle handle) override;
+
+        virtual void                    releaseDataBuffer(DataBufferHandle handle) override;
+        virtual void                    updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data) override;
+
         Matrix44f updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const;
         void      propagateDirtyToConsumers(NodeHandle node) const;
 
+        // BVH of pickable geometry is built on first use and kept until geometry data buffer changes
+        const TriangleBVH& getPickableGeometryBVH(DataBufferHandle geometryBuffer) const;
+
     private:
         void getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const;
         void resolveMatrix(ETransformationMatrixType matrixType, NodeHandle node, Matrix44f& chainMatrix) const;
@@ -37,6 +46,8 @@ namespace ramses_internal
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        mutable HashMap<DataBufferHandle, TriangleBVH> m_pickableGeometryBVHs;
     };
 }
 
@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TRIANGLEBVH_H
+#define RAMSES_TRIANGLEBVH_H
+
+#include "RendererLib/IntersectionUtils.h"
+#include "Math3d/Matrix44f.h"
+#include <vector>
+#include <limits>
+
+namespace ramses_internal
+{
+    // Bounding volume hierarchy over triangle geometry (9 floats per triangle) used to accelerate picking.
+    // Triangles are stored reordered so that every leaf references a contiguous range of them.
+    class TriangleBVH
+    {
+    public:
+        struct BoundingBox
+        {
+            Vector3 min{ std::numeric_limits<float>::max() };
+            Vector3 max{ std::numeric_limits<float>::lowest() };
+
+            void extend(const Vector3& point);
+            void extend(const BoundingBox& other);
+            bool isValid() const;
+            BoundingBox transform(const Matrix44f& matrix) const;
+            // slab test, rayInvDir is component-wise inverse of ray direction
+            bool intersectRay(const Vector3& rayOrigin, const Vector3& rayInvDir, float maxDistance) const;
+        };
+
+        TriangleBVH() = default;
+        TriangleBVH(const float* geometry, size_t geometrySize);
+
+        bool isEmpty() const;
+        UInt32 getTriangleCount() const;
+        const BoundingBox& getBoundingBox() const;
+
+        // finds nearest intersected triangle, rayDir must be normalized
+        bool intersectRay(const Vector3& rayOrigin, const Vector3& rayDir, Vector3& intersectionPoint, float& distanceRayOriginToIntersection) const;
+
+        static const UInt32 MaxTrianglesPerLeaf = 4u;
+
+    private:
+        struct Node
+        {
+            BoundingBox bounds;
+            // leaf: triangles [firstTriangleOrRightChild, firstTriangleOrRightChild + triangleCount)
+            // inner node (triangleCount == 0): left child follows in node array, right child is at firstTriangleOrRightChild
+            UInt32 firstTriangleOrRightChild = 0u;
+            UInt32 triangleCount = 0u;
+            UInt32 splitAxis = 0u;
+        };
+
+        struct BuildEntry
+        {
+            Vector3 centroid;
+            UInt32 triangleIdx;
+        };
+
+        UInt32 buildNode(std::vector<BuildEntry>& buildEntries, const std::vector<BoundingBox>& triangleBounds, UInt32 begin, UInt32 end);
+
+        std::vector<IntersectionUtils::Triangle> m_triangles;
+        std::vector<Node> m_nodes;
+        BoundingBox m_emptyBounds;
+    };
+}
+
+#endif
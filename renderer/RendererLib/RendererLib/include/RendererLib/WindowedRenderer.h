@@ -50,6 +50,7 @@ namespace ramses_internal
     class RendererCommandBuffer;
     class Ramsh;
     class RendererStatistics;
+    class ITaskQueue;
 
     class WindowedRenderer
     {
@@ -59,7 +60,8 @@ namespace ramses_internal
             IRendererSceneEventSender& rendererSceneSender,
             IPlatformFactory& platformFactory,
             RendererStatistics& m_rendererStatistics,
-            const String& monitorFilename = String());
+            const String& monitorFilename = String(),
+            ITaskQueue* parallelProcessingQueue = nullptr);
 
         void doOneLoop(ELoopMode loopMode, std::chrono::microseconds sleepTime = std::chrono::microseconds{0});
 
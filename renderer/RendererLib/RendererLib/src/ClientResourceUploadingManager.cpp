@@ -11,10 +11,14 @@
 #include "RendererLib/IResourceUploader.h"
 #include "RendererLib/FrameTimer.h"
 #include "RendererLib/RendererStatistics.h"
+#include "RendererLib/ResourceStagingThread.h"
+#include "RenderExecutor.h"
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererAPI/IEmbeddedCompositingManager.h"
 #include "RendererAPI/IDevice.h"
 #include "Utils/LogMacros.h"
+#include "Resource/ResourceCompressionUtils.h"
+#include "Resource/EffectResource.h"
 #include "PlatformAbstraction/PlatformTime.h"
 
 namespace ramses_internal
@@ -26,12 +30,14 @@ namespace ramses_internal
         Bool keepEffects,
         const FrameTimer& frameTimer,
         RendererStatistics& stats,
-        UInt64 clientResourceCacheSize)
+        UInt64 clientResourceCacheSize,
+        ITaskQueue* decompressionTaskQueue)
         : m_clientResources(resources)
         , m_uploader(uploader)
         , m_renderBackend(renderBackend)
         , m_keepEffects(keepEffects)
         , m_frameTimer(frameTimer)
+        , m_decompressionTaskQueue(decompressionTaskQueue)
         , m_clientResourceCacheSize(clientResourceCacheSize)
         , m_stats(stats)
     {
@@ -39,6 +45,9 @@ namespace ramses_internal
 
     ClientResourceUploadingManager::~ClientResourceUploadingManager()
     {
+        releaseStagedClientResourceUploads();
+        releasePendingEffectCompilations();
+
         // Unload all remaining resources that were kept due to caching strategy.
         // Or in case display is being destructed together with scenes and there is no more rendering,
         // ie. no more deferred upload/unloads
@@ -60,15 +69,23 @@ namespace ramses_internal
 
     void ClientResourceUploadingManager::uploadAndUnloadPendingResources()
     {
+        updateStagedClientResources();
+        updatePendingEffectCompilations();
+
         ResourceContentHashVector resourcesToUpload;
         UInt64 sizeToUpload = 0u;
-        getAndPrepareClientResourcesToUploadNext(resourcesToUpload, sizeToUpload);
-        const UInt64 sizeToBeFreed = getAmountOfMemoryToBeFreedForNewResources(sizeToUpload);
+        getClientResourcesToUploadNext(resourcesToUpload, sizeToUpload);
+        // staged uploads in flight are not uploaded yet but will take their place in cache
+        const UInt64 sizeToBeFreed = getAmountOfMemoryToBeFreedForNewResources(sizeToUpload + m_stagedUploadsTotalSize);
 
         ResourceContentHashVector resourcesToUnload;
         getClientResourcesToUnloadNext(resourcesToUnload, m_keepEffects, sizeToBeFreed);
 
         unloadClientResources(resourcesToUnload);
+        // resources are shared with other threads, they are decompressed here so that staging thread only reads them
+        DecompressClientResources(m_clientResources, resourcesToUpload, m_decompressionTaskQueue);
+        stageClientResources(resourcesToUpload);
+        startEffectCompilations(resourcesToUpload);
         uploadClientResources(resourcesToUpload);
     }
 
@@ -88,8 +105,10 @@ namespace ramses_internal
         {
             const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(resourcesToUpload[i]);
             const UInt32 resourceSize = rd.resource.getResourceObject()->getDecompressedDataSize();
+            const auto uploadStart = std::chrono::steady_clock::now();
             uploadClientResource(rd);
-            m_stats.clientResourceUploaded(resourceSize);
+            const auto uploadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - uploadStart);
+            m_stats.clientResourceUploaded(resourceSize, uploadTime);
             sizeUploaded += resourceSize;
 
             const Bool checkTimeLimit = (i % NumResourcesToUploadInBetweenTimeBudgetChecks == 0) || rd.type == EResourceType_Effect || resourceSize > LargeResourceByteSizeThreshold;
@@ -133,6 +152,8 @@ namespace ramses_internal
             m_clientResourceTotalUploadedSize += resourceSize;
             m_clientResources.setResourceStatus(rd.hash, EResourceStatus_Uploaded);
             m_clientResources.setResourceVRAMSize(rd.hash, vramSize);
+            if (rd.type == EResourceType_Effect)
+                m_clientResources.setEffectSupportsDrawCallBatching(rd.hash, RenderExecutor::EffectSupportsDrawCallBatching(*pResource->convertTo<EffectResource>()));
         }
         else
         {
@@ -144,6 +165,282 @@ namespace ramses_internal
         m_clientResources.setResourceData(rd.hash, ManagedResource(), deviceHandle, pResource->getTypeID());
     }
 
+    void ClientResourceUploadingManager::stageClientResources(ResourceContentHashVector& resourcesToUpload)
+    {
+        if (!m_stagingSupported)
+            return;
+
+        auto it = resourcesToUpload.begin();
+        while (it != resourcesToUpload.end())
+        {
+            const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(*it);
+            const Bool canBeStaged = rd.type == EResourceType_Texture2D || rd.type == EResourceType_Texture3D || rd.type == EResourceType_TextureCube
+                || rd.type == EResourceType_VertexArray || rd.type == EResourceType_IndexArray;
+            const IResource* pResource = rd.resource.getResourceObject();
+            const UInt32 resourceSize = pResource->getDecompressedDataSize();
+            if (!canBeStaged || resourceSize <= LargeResourceByteSizeThreshold)
+            {
+                ++it;
+                continue;
+            }
+
+            // staging memory in flight is capped, resource stays provided and is staged in later frame (one resource alone may exceed the cap)
+            if (m_stagedUploadsTotalSize > 0u && m_stagedUploadsTotalSize + resourceSize > MaxStagedUploadsByteSizeInFlight)
+            {
+                it = resourcesToUpload.erase(it);
+                continue;
+            }
+
+            IDevice& device = m_renderBackend.getDevice();
+            const DeviceResourceHandle stagingBuffer = device.allocateStagingBuffer(resourceSize);
+            if (!stagingBuffer.isValid())
+            {
+                LOG_INFO(CONTEXT_RENDERER, "ClientResourceUploadingManager::stageClientResources: device failed to provide staging buffer, all resources will be uploaded synchronously");
+                m_stagingSupported = false;
+                return;
+            }
+
+            if (!m_stagingThread)
+                m_stagingThread.reset(new ResourceStagingThread);
+
+            LOG_TRACE(CONTEXT_RENDERER, "ClientResourceUploadingManager::stageClientResources: staging resource #" << rd.hash << " (" << EnumToString(rd.type) << ", " << resourceSize << " B)");
+            StagedUpload stagedUpload;
+            stagedUpload.resource = rd.resource;
+            stagedUpload.stagingBuffer = stagingBuffer;
+            stagedUpload.resourceSize = resourceSize;
+            m_stagedUploads.put(rd.hash, stagedUpload);
+            m_stagedUploadsTotalSize += resourceSize;
+            m_stagingThread->stageResource(rd.hash, *pResource, device.getStagingBufferData(stagingBuffer));
+
+            it = resourcesToUpload.erase(it);
+        }
+    }
+
+    void ClientResourceUploadingManager::updateStagedClientResources()
+    {
+        if (m_stagedUploads.size() == 0u)
+            return;
+
+        IDevice& device = m_renderBackend.getDevice();
+
+        // resources with GPU transfer already issued are done once fence is signaled,
+        // they are checked before transferring newly staged ones which cannot be finished in this frame anyway
+        ResourceContentHashVector finishedUploads;
+        for (auto& stagedUpload : m_stagedUploads)
+        {
+            StagedUpload& upload = stagedUpload.value;
+            if (upload.fence.isValid() && device.isFenceSignaled(upload.fence))
+            {
+                device.deleteFence(upload.fence);
+                device.deleteStagingBuffer(upload.stagingBuffer);
+                finishedUploads.push_back(stagedUpload.key);
+            }
+        }
+
+        for (const auto& hash : finishedUploads)
+        {
+            const StagedUpload& upload = *m_stagedUploads.get(hash);
+            // resource might have been unregistered (or even registered again) while being staged
+            const Bool stillToBeUploaded = m_clientResources.containsResource(hash) && m_clientResources.getResourceDescriptor(hash).status == EResourceStatus_Provided;
+            if (stillToBeUploaded)
+                finishAsyncClientResourceUpload(m_clientResources.getResourceDescriptor(hash), upload.deviceHandle, upload.vramSize);
+            else
+                m_uploader.unloadResource(m_renderBackend, upload.resource.getResourceObject()->getTypeID(), hash, upload.deviceHandle);
+            removeStagedUpload(hash);
+        }
+
+        if (m_stagingThread)
+        {
+            ResourceContentHashVector stagedResources;
+            m_stagingThread->getStagedResources(stagedResources);
+            for (const auto& hash : stagedResources)
+                m_stagedUploads.get(hash)->dataStaged = true;
+        }
+
+        transferStagedClientResources();
+    }
+
+    void ClientResourceUploadingManager::transferStagedClientResources()
+    {
+        ResourceContentHashVector uploadsToTransfer;
+        for (const auto& stagedUpload : m_stagedUploads)
+        {
+            if (stagedUpload.value.dataStaged && !stagedUpload.value.fence.isValid())
+                uploadsToTransfer.push_back(stagedUpload.key);
+        }
+
+        IDevice& device = m_renderBackend.getDevice();
+        for (const auto& hash : uploadsToTransfer)
+        {
+            StagedUpload& upload = *m_stagedUploads.get(hash);
+            const Bool stillToBeUploaded = m_clientResources.containsResource(hash) && m_clientResources.getResourceDescriptor(hash).status == EResourceStatus_Provided;
+            if (!stillToBeUploaded)
+            {
+                device.deleteStagingBuffer(upload.stagingBuffer);
+                removeStagedUpload(hash);
+                continue;
+            }
+
+            const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(hash);
+            const auto uploadStart = std::chrono::steady_clock::now();
+            upload.deviceHandle = m_uploader.uploadResourceFromStagingBuffer(m_renderBackend, rd, upload.stagingBuffer, upload.vramSize);
+            const auto uploadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - uploadStart);
+            m_stats.clientResourceUploaded(rd.decompressedSize, uploadTime);
+
+            if (upload.deviceHandle.isValid())
+            {
+                upload.fence = device.insertFence();
+            }
+            else
+            {
+                device.deleteStagingBuffer(upload.stagingBuffer);
+                finishAsyncClientResourceUpload(rd, DeviceResourceHandle::Invalid(), 0u);
+                removeStagedUpload(hash);
+            }
+
+            // transfers share time budget with synchronous uploads, remaining ones are transferred in next frames
+            if (m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ClientResourcesUpload))
+            {
+                LOG_INFO(CONTEXT_RENDERER, "ClientResourceUploadingManager::transferStagedClientResources: Interrupt: Exceeded time for client resource upload");
+                break;
+            }
+        }
+    }
+
+    void ClientResourceUploadingManager::removeStagedUpload(const ResourceContentHash& hash)
+    {
+        const StagedUpload& upload = *m_stagedUploads.get(hash);
+        assert(m_stagedUploadsTotalSize >= upload.resourceSize);
+        m_stagedUploadsTotalSize -= upload.resourceSize;
+        m_stagedUploads.remove(hash);
+    }
+
+    void ClientResourceUploadingManager::finishAsyncClientResourceUpload(const ResourceDescriptor& rd, DeviceResourceHandle deviceHandle, UInt32 vramSize)
+    {
+        const IResource* pResource = rd.resource.getResourceObject();
+        assert(pResource != nullptr);
+
+        if (deviceHandle.isValid())
+        {
+            const UInt32 resourceSize = pResource->getDecompressedDataSize();
+            m_clientResourceSizes.put(rd.hash, resourceSize);
+            m_clientResourceTotalUploadedSize += resourceSize;
+            m_clientResources.setResourceStatus(rd.hash, EResourceStatus_Uploaded);
+            m_clientResources.setResourceVRAMSize(rd.hash, vramSize);
+            if (rd.type == EResourceType_Effect)
+                m_clientResources.setEffectSupportsDrawCallBatching(rd.hash, RenderExecutor::EffectSupportsDrawCallBatching(*pResource->convertTo<EffectResource>()));
+        }
+        else
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::finishAsyncClientResourceUpload failed to upload resource #" << rd.hash << " (" << EnumToString(rd.type) << ")");
+            m_clientResources.setResourceStatus(rd.hash, EResourceStatus_Broken);
+        }
+
+        // release reference to managed resource
+        m_clientResources.setResourceData(rd.hash, ManagedResource(), deviceHandle, pResource->getTypeID());
+    }
+
+    void ClientResourceUploadingManager::releaseStagedClientResourceUploads()
+    {
+        // worker must not write to staging memory anymore
+        m_stagingThread.reset();
+
+        for (const auto& stagedUpload : m_stagedUploads)
+        {
+            const StagedUpload& upload = stagedUpload.value;
+            IDevice& device = m_renderBackend.getDevice();
+            if (upload.fence.isValid())
+                device.deleteFence(upload.fence);
+            device.deleteStagingBuffer(upload.stagingBuffer);
+            if (upload.deviceHandle.isValid())
+                m_uploader.unloadResource(m_renderBackend, upload.resource.getResourceObject()->getTypeID(), stagedUpload.key, upload.deviceHandle);
+        }
+        m_stagedUploads.clear();
+        m_stagedUploadsTotalSize = 0u;
+    }
+
+    void ClientResourceUploadingManager::startEffectCompilations(ResourceContentHashVector& resourcesToUpload)
+    {
+        auto it = resourcesToUpload.begin();
+        while (it != resourcesToUpload.end())
+        {
+            const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(*it);
+            if (rd.type != EResourceType_Effect)
+            {
+                ++it;
+                continue;
+            }
+
+            const DeviceResourceHandle pendingHandle = m_uploader.startEffectCompilation(m_renderBackend, rd);
+            if (!pendingHandle.isValid())
+            {
+                // uploaded synchronously together with other resources
+                ++it;
+                continue;
+            }
+
+            LOG_TRACE(CONTEXT_RENDERER, "ClientResourceUploadingManager::startEffectCompilations: compiling effect #" << rd.hash << " in parallel");
+            PendingEffect pendingEffect;
+            pendingEffect.resource = rd.resource;
+            pendingEffect.pendingHandle = pendingHandle;
+            m_pendingEffects.put(rd.hash, pendingEffect);
+
+            it = resourcesToUpload.erase(it);
+        }
+    }
+
+    void ClientResourceUploadingManager::updatePendingEffectCompilations()
+    {
+        ResourceContentHashVector finishedCompilations;
+        for (const auto& pendingEffect : m_pendingEffects)
+        {
+            if (m_uploader.isEffectCompilationFinished(m_renderBackend, pendingEffect.value.pendingHandle))
+                finishedCompilations.push_back(pendingEffect.key);
+        }
+
+        for (const auto& hash : finishedCompilations)
+        {
+            const PendingEffect& pendingEffect = *m_pendingEffects.get(hash);
+            // effect might have been unregistered (or even registered again) while being compiled
+            const Bool stillToBeUploaded = m_clientResources.containsResource(hash) && m_clientResources.getResourceDescriptor(hash).status == EResourceStatus_Provided;
+            if (stillToBeUploaded)
+            {
+                const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(hash);
+                const auto uploadStart = std::chrono::steady_clock::now();
+                UInt32 vramSize = 0u;
+                const DeviceResourceHandle deviceHandle = m_uploader.finishEffectCompilation(m_renderBackend, rd, pendingEffect.pendingHandle, vramSize);
+                const auto uploadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - uploadStart);
+                m_stats.clientResourceUploaded(rd.decompressedSize, uploadTime);
+                finishAsyncClientResourceUpload(rd, deviceHandle, vramSize);
+            }
+            else
+            {
+                discardPendingEffectCompilation(hash, pendingEffect.resource, pendingEffect.pendingHandle);
+            }
+            m_pendingEffects.remove(hash);
+        }
+    }
+
+    void ClientResourceUploadingManager::releasePendingEffectCompilations()
+    {
+        for (const auto& pendingEffect : m_pendingEffects)
+            discardPendingEffectCompilation(pendingEffect.key, pendingEffect.value.resource, pendingEffect.value.pendingHandle);
+        m_pendingEffects.clear();
+    }
+
+    void ClientResourceUploadingManager::discardPendingEffectCompilation(const ResourceContentHash& hash, const ManagedResource& resource, DeviceResourceHandle pendingHandle)
+    {
+        // there is no way to abort compilation, wait for it and delete resulting shader
+        ResourceDescriptor rd;
+        rd.hash = hash;
+        rd.type = EResourceType_Effect;
+        rd.resource = resource;
+        UInt32 vramSize = 0u;
+        const DeviceResourceHandle deviceHandle = m_uploader.finishEffectCompilation(m_renderBackend, rd, pendingHandle, vramSize);
+        if (deviceHandle.isValid())
+            m_uploader.unloadResource(m_renderBackend, EResourceType_Effect, hash, deviceHandle);
+    }
+
     void ClientResourceUploadingManager::unloadClientResource(const ResourceDescriptor& rd)
     {
         assert(rd.sceneUsage.empty());
@@ -193,7 +490,7 @@ namespace ramses_internal
         }
     }
 
-    void ClientResourceUploadingManager::getAndPrepareClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const
+    void ClientResourceUploadingManager::getClientResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, UInt64& totalSize) const
     {
         assert(resourcesToUpload.empty());
 
@@ -201,17 +498,28 @@ namespace ramses_internal
         const ResourceContentHashVector& providedResources = m_clientResources.getAllProvidedResources();
         for(const auto& resource : providedResources)
         {
+            // resources being staged or compiled are still provided until their upload is finished
+            if (m_stagedUploads.contains(resource) || m_pendingEffects.contains(resource))
+                continue;
+
             const ResourceDescriptor& rd = m_clientResources.getResourceDescriptor(resource);
             assert(rd.status == EResourceStatus_Provided);
             assert(rd.resource.getResourceObject() != nullptr);
-            const IResource* resourceObj = rd.resource.getResourceObject();
-            resourceObj->decompress();
-            totalSize += resourceObj->getDecompressedDataSize();
+            totalSize += rd.resource.getResourceObject()->getDecompressedDataSize();
 
             resourcesToUpload.push_back(resource);
         }
     }
 
+    void ClientResourceUploadingManager::DecompressClientResources(const RendererClientResourceRegistry& resources, const ResourceContentHashVector& resourcesToDecompress, ITaskQueue* taskQueue)
+    {
+        std::vector<const IResource*> resourceObjects;
+        resourceObjects.reserve(resourcesToDecompress.size());
+        for (const auto& resource : resourcesToDecompress)
+            resourceObjects.push_back(resources.getResourceDescriptor(resource).resource.getResourceObject());
+        ResourceCompressionUtils::DecompressResources(std::move(resourceObjects), taskQueue);
+    }
+
     UInt64 ClientResourceUploadingManager::getAmountOfMemoryToBeFreedForNewResources(UInt64 sizeToUpload) const
     {
         if (m_clientResourceCacheSize == 0u)
@@ -184,6 +184,16 @@ namespace ramses_internal
         return m_keepEffectsUploaded;
     }
 
+    Bool DisplayConfig::isDrawCallBatchingEnabled() const
+    {
+        return m_drawCallBatchingEnabled;
+    }
+
+    void DisplayConfig::setDrawCallBatchingEnabled(Bool enabled)
+    {
+        m_drawCallBatchingEnabled = enabled;
+    }
+
     void DisplayConfig::setProjectionParams(const ProjectionParams& params)
     {
         m_projectionParams = params;
@@ -214,6 +224,16 @@ namespace ramses_internal
         m_gpuMemoryCacheSize = size;
     }
 
+    const ResourceContentHashVector& DisplayConfig::getEffectsToPrewarm() const
+    {
+        return m_effectsToPrewarm;
+    }
+
+    void DisplayConfig::setEffectsToPrewarm(const ResourceContentHashVector& effects)
+    {
+        m_effectsToPrewarm = effects;
+    }
+
     void DisplayConfig::setClearColor(const Vector4& clearColor)
     {
         m_clearColor = clearColor;
@@ -264,7 +284,9 @@ namespace ramses_internal
             m_integrityRGLDeviceUnit     == other.m_integrityRGLDeviceUnit &&
             m_startVisibleIvi            == other.m_startVisibleIvi &&
             m_resizable                  == other.m_resizable &&
+            m_drawCallBatchingEnabled    == other.m_drawCallBatchingEnabled &&
             m_gpuMemoryCacheSize         == other.m_gpuMemoryCacheSize &&
+            m_effectsToPrewarm           == other.m_effectsToPrewarm &&
             m_clearColor                 == other.m_clearColor &&
             m_windowsWindowHandle        == other.m_windowsWindowHandle &&
             m_waylandDisplay             == other.m_waylandDisplay;
@@ -21,7 +21,7 @@
 
 namespace ramses_internal
 {
-    DisplayController::DisplayController(IRenderBackend& renderer, UInt32 /*samples*/, UInt32 postProcessingEffectIds)
+    DisplayController::DisplayController(IRenderBackend& renderer, UInt32 /*samples*/, UInt32 postProcessingEffectIds, Bool drawCallBatchingEnabled)
         : m_renderBackend(renderer)
         , m_device(m_renderBackend.getDevice())
         , m_embeddedCompositingManager(m_device, m_renderBackend.getEmbeddedCompositor(), m_renderBackend.getTextureUploadingAdapter())
@@ -29,6 +29,7 @@ namespace ramses_internal
         , m_displayWidth(m_renderBackend.getSurface().getWindow().getWidth())
         , m_displayHeight(m_renderBackend.getSurface().getWindow().getHeight())
         , m_postProcessing(new Postprocessing(postProcessingEffectIds, m_displayWidth, m_displayHeight, m_device))
+        , m_drawCallBatchingEnabled(drawCallBatchingEnabled)
     {
     }
 
@@ -47,6 +48,11 @@ namespace ramses_internal
         m_renderBackend.getSurface().enable();
     }
 
+    void DisplayController::disableContext()
+    {
+        m_renderBackend.getSurface().disable();
+    }
+
     void DisplayController::swapBuffers()
     {
         ISurface& surface = m_renderBackend.getSurface();
@@ -59,7 +65,7 @@ namespace ramses_internal
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, DeviceResourceHandle buffer, const Viewport& viewport, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
     {
         const FrameBufferInfo fbInfo(buffer, m_projectionParams, viewport);
-        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer);
+        RenderExecutor executor(m_renderBackend.getDevice(), fbInfo, renderFrom, frameTimer, m_drawCallBatchingEnabled);
 
         return executor.executeScene(scene, getViewMatrix());
     }
@@ -0,0 +1,93 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/DisplayRenderThread.h"
+#include <string>
+
+namespace ramses_internal
+{
+    DisplayRenderThread::DisplayRenderThread(DisplayHandle display, const FrameFunction& renderFunction, const FrameFunction& presentFunction)
+        : m_renderFunction(renderFunction)
+        , m_presentFunction(presentFunction)
+        , m_thread(String("R_DispThrd" + std::to_string(display.asMemoryHandle())))
+    {
+        m_thread.start(*this);
+    }
+
+    DisplayRenderThread::~DisplayRenderThread()
+    {
+        waitUntilIdle();
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stopRequested = true;
+        }
+        m_stateChanged.notify_all();
+        m_thread.join();
+    }
+
+    void DisplayRenderThread::startFrame()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            assert(m_state == EState::Idle);
+            m_state = EState::Rendering;
+        }
+        m_stateChanged.notify_all();
+    }
+
+    void DisplayRenderThread::waitUntilRendered()
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_stateChanged.wait(lock, [this]() { return m_state != EState::Rendering; });
+    }
+
+    void DisplayRenderThread::waitUntilIdle()
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_stateChanged.wait(lock, [this]() { return m_state == EState::Idle; });
+    }
+
+    Bool DisplayRenderThread::isIdle() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_state == EState::Idle;
+    }
+
+    Bool DisplayRenderThread::isRendering() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_state == EState::Rendering;
+    }
+
+    void DisplayRenderThread::setState(EState state)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_state = state;
+        }
+        m_stateChanged.notify_all();
+    }
+
+    void DisplayRenderThread::run()
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_stateChanged.wait(lock, [this]() { return m_stopRequested || m_state == EState::Rendering; });
+                if (m_stopRequested)
+                    return;
+            }
+
+            m_renderFunction();
+            setState(EState::Presenting);
+            m_presentFunction();
+            setState(EState::Idle);
+        }
+    }
+}
@@ -7,6 +7,8 @@
 //  -------------------------------------------------------------------------
 
 #include "RendererLib/IntersectionUtils.h"
+#include "RendererLib/TriangleBVH.h"
+#include "RendererLib/TransformationLinkCachedScene.h"
 #include "Math3d/Matrix44f.h"
 #include "Math3d/Vector2i.h"
 #include "Math3d/Vector4.h"
@@ -92,16 +94,16 @@ namespace ramses_internal
         return TestPointInTriangle(triangle, planeNormal, intersectionPointInModelSpace);
     }
 
-    bool IntersectionUtils::TestGeometryPicked(const Vector2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const Matrix44f& modelMatrix, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector3& intersectionPointInModelSpace)
+    void IntersectionUtils::CalculatePickRayInWorldSpace(const Vector2& pickCoordsNDS, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector4& rayOriginWorld, Vector4& rayTargetWorld)
     {
-        assert(geometrySize % 9 == 0);
         // 4D homogeneous Clip Coordinates
         const Vector4 ray_orig_clip(pickCoordsNDS.x, pickCoordsNDS.y, -1.0f, 1.0f);
         const Vector4 ray_target_clip(pickCoordsNDS.x, pickCoordsNDS.y, 1.0f, 1.0f);
 
         // 4D Camera Coordinates
-        Vector4 ray_orig_camera(projectionMatrix.inverse() * ray_orig_clip);
-        Vector4 ray_target_camera(projectionMatrix.inverse() * ray_target_clip);
+        const Matrix44f inverseProjectionMatrix = projectionMatrix.inverse();
+        Vector4 ray_orig_camera(inverseProjectionMatrix * ray_orig_clip);
+        Vector4 ray_target_camera(inverseProjectionMatrix * ray_target_clip);
         ray_orig_camera /=  ray_orig_camera.w;
         ray_target_camera /= ray_target_camera.w;
         ray_orig_camera.w = 1.f;
@@ -109,15 +111,36 @@ namespace ramses_internal
 
         // 4D World Coordinates --> for ray and camera
         const Matrix44f inverseViewMatrix = viewMatrix.inverse();
-        const Vector4 ray_orig_world(inverseViewMatrix * ray_orig_camera);
-        const Vector4 ray_target_world(inverseViewMatrix * ray_target_camera);
+        rayOriginWorld = inverseViewMatrix * ray_orig_camera;
+        rayTargetWorld = inverseViewMatrix * ray_target_camera;
+    }
+
+    bool IntersectionUtils::TestGeometryPickedByRayInWorldSpace(const Vector4& rayOriginWorld, const Vector4& rayTargetWorld, const TriangleBVH& geometryBVH, const Matrix44f& modelMatrix, Vector3& intersectionPointInModelSpace)
+    {
+        // 3D Model Coordinates
+        const Matrix44f inverseModelMatrix = modelMatrix.inverse();
+        Vector3 ray_orig_model(inverseModelMatrix * rayOriginWorld);
+        Vector3 ray_target_model(inverseModelMatrix * rayTargetWorld);
+        const auto ray_dir_model = (ray_target_model - ray_orig_model).normalize();
+
+        float distanceInModelSpace = std::numeric_limits<float>::max();
+        return geometryBVH.intersectRay(ray_orig_model, ray_dir_model, intersectionPointInModelSpace, distanceInModelSpace);
+    }
+
+    bool IntersectionUtils::TestGeometryPicked(const Vector2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const Matrix44f& modelMatrix, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector3& intersectionPointInModelSpace)
+    {
+        assert(geometrySize % 9 == 0);
+        Vector4 rayOriginWorld;
+        Vector4 rayTargetWorld;
+        CalculatePickRayInWorldSpace(pickCoordsNDS, viewMatrix, projectionMatrix, rayOriginWorld, rayTargetWorld);
 
         // 3D Model Coordinates
         const Matrix44f inverseModelMatrix = modelMatrix.inverse();
-        Vector3 ray_orig_model(inverseModelMatrix * ray_orig_world);
-        Vector3 ray_target_model(inverseModelMatrix * ray_target_world);
+        Vector3 ray_orig_model(inverseModelMatrix * rayOriginWorld);
+        Vector3 ray_target_model(inverseModelMatrix * rayTargetWorld);
         const auto ray_dir_model = (ray_target_model - ray_orig_model).normalize();
 
+        // geometry without BVH is tested triangle by triangle, building a BVH only pays off when it is reused for several picks
         bool intersectionResult = false;
         float distanceInModelSpace = std::numeric_limits<float>::max();
 
@@ -144,6 +167,14 @@ namespace ramses_internal
         return intersectionResult;
     }
 
+    bool IntersectionUtils::TestGeometryPicked(const Vector2& pickCoordsNDS, const TriangleBVH& geometryBVH, const Matrix44f& modelMatrix, const Matrix44f& viewMatrix, const Matrix44f& projectionMatrix, Vector3& intersectionPointInModelSpace)
+    {
+        Vector4 rayOriginWorld;
+        Vector4 rayTargetWorld;
+        CalculatePickRayInWorldSpace(pickCoordsNDS, viewMatrix, projectionMatrix, rayOriginWorld, rayTargetWorld);
+        return TestGeometryPickedByRayInWorldSpace(rayOriginWorld, rayTargetWorld, geometryBVH, modelMatrix, intersectionPointInModelSpace);
+    }
+
     void IntersectionUtils::CheckSceneForIntersectedPickableObjects(const TransformationLinkCachedScene& scene, const Vector2i coordsInBufferSpace, PickableObjectIds& pickedObjects)
     {
         assert(pickedObjects.empty());
@@ -194,23 +225,22 @@ namespace ramses_internal
                                                 pickableCamera.frustum.nearPlane,
                                                 pickableCamera.frustum.farPlane));
 
-                const GeometryDataBuffer& geometryBuffer =
-                    scene.getDataBuffer(pickableObject.geometryHandle);
-                assert(geometryBuffer.bufferType == EDataBufferType::VertexBuffer);
-                assert(geometryBuffer.dataType == EDataType::EDataType_Vector3F);
-                const float*  geometryBufferFloat =
-                    reinterpret_cast<const float*>(geometryBuffer.data.data());
-                const UInt32 geometrySize = geometryBuffer.usedSize / sizeof(float);
-                assert(0 == geometrySize % 9);
+                const TriangleBVH& geometryBVH = scene.getPickableGeometryBVH(pickableObject.geometryHandle);
+                if (geometryBVH.isEmpty())
+                    continue;
+
+                Vector4 rayOriginWorld;
+                Vector4 rayTargetWorld;
+                CalculatePickRayInWorldSpace(coordsNDS, cameraViewMatrix, projectionMatrix, rayOriginWorld, rayTargetWorld);
+
+                // broad phase: skip pickables whose world space bounds are missed by pick ray before transforming the ray into their model space
+                const TriangleBVH::BoundingBox worldBounds = geometryBVH.getBoundingBox().transform(modelMatrix);
+                const Vector3 rayDirWorld = Vector3(rayTargetWorld) - Vector3(rayOriginWorld);
+                if (!worldBounds.intersectRay(Vector3(rayOriginWorld), rayDirWorld.inverse(), std::numeric_limits<float>::max()))
+                    continue;
 
                 Vector3 intersectionPointInModelSpace;
-                if (IntersectionUtils::TestGeometryPicked(coordsNDS,
-                                                            geometryBufferFloat,
-                                                            geometrySize,
-                                                            modelMatrix,
-                                                            cameraViewMatrix,
-                                                            projectionMatrix,
-                                                            intersectionPointInModelSpace))
+                if (TestGeometryPickedByRayInWorldSpace(rayOriginWorld, rayTargetWorld, geometryBVH, modelMatrix, intersectionPointInModelSpace))
                 {
                     const Vector4 intersectionPointInClipSpace = projectionMatrix * cameraViewMatrix * modelMatrix * Vector4(intersectionPointInModelSpace);
                     const Vector4 intersectionPointInNDS = intersectionPointInClipSpace / intersectionPointInClipSpace.w;
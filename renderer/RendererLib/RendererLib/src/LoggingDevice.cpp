@@ -263,6 +263,33 @@ namespace ramses_internal
         m_logContext << "activate shader [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
+    DeviceResourceHandle LoggingDevice::startShaderCompilation(const EffectResource& effect)
+    {
+        m_logContext << "start shader compilation " << effect.getName() << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool LoggingDevice::isShaderCompilationFinished(DeviceResourceHandle)
+    {
+        return true;
+    }
+
+    DeviceResourceHandle LoggingDevice::finishShaderCompilation(DeviceResourceHandle pendingShader, const EffectResource& effect)
+    {
+        m_logContext << "finish shader compilation " << effect.getName() << " [handle: " << pendingShader << "]" << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    UniformDataVersion LoggingDevice::getActiveShaderUniformDataVersion() const
+    {
+        return {};
+    }
+
+    void LoggingDevice::setActiveShaderUniformDataVersion(const UniformDataVersion& version)
+    {
+        UNUSED(version);
+    }
+
     DeviceResourceHandle LoggingDevice::allocateTexture2D(UInt32 width, UInt32 height, ETextureFormat format, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes)
     {
         m_logContext << "allocate texture2d [ (w,h):(" << width << "," << height << ") mipLevelCount:" << mipLevelCount << " format:" << EnumToString(format) << "textureSwizzle:"<< EnumToString(swizzle[0]) << ";" << EnumToString(swizzle[1]) << ";" << EnumToString(swizzle[2]) << ";" << EnumToString(swizzle[3]) << ";" << " totalSizeInBytes:" << totalSizeInBytes << "]" << RendererLogContext::NewLine;
@@ -312,6 +339,48 @@ namespace ramses_internal
         logResourceActivation("texture", handle, field);
     }
 
+    DeviceResourceHandle LoggingDevice::allocateStagingBuffer(UInt32 sizeInBytes)
+    {
+        m_logContext << "allocate staging buffer [size: " << sizeInBytes << "]" << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Byte* LoggingDevice::getStagingBufferData(DeviceResourceHandle)
+    {
+        return nullptr;
+    }
+
+    void LoggingDevice::deleteStagingBuffer(DeviceResourceHandle handle)
+    {
+        m_logContext << "delete staging buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
+    }
+
+    void LoggingDevice::uploadTextureDataFromStagingBuffer(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize)
+    {
+        m_logContext << "update texture data from staging buffer [handle:" << handle << " mipLevel:" << mipLevel << " z:" << z << " (w,h,d):(" << width << "," << height << "," << depth << ") staging buffer:" << stagingBuffer << " offset:" << offset << " dataSize:" << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
+    void LoggingDevice::uploadBufferDataFromStagingBuffer(DeviceResourceHandle handle, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize)
+    {
+        m_logContext << "upload buffer data from staging buffer [device handle: " << handle << " staging buffer: " << stagingBuffer << " offset: " << offset << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
+    DeviceResourceHandle LoggingDevice::insertFence()
+    {
+        m_logContext << "insert fence" << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    Bool LoggingDevice::isFenceSignaled(DeviceResourceHandle)
+    {
+        return true;
+    }
+
+    void LoggingDevice::deleteFence(DeviceResourceHandle handle)
+    {
+        m_logContext << "delete fence [handle: " << handle << "]" << RendererLogContext::NewLine;
+    }
+
     DeviceResourceHandle LoggingDevice::uploadRenderBuffer(const RenderBuffer& renderBuffer)
     {
         m_logContext << "upload render buffer [type: " << EnumToString(renderBuffer.type) << "]" << RendererLogContext::NewLine;
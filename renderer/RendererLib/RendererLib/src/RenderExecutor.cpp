@@ -10,16 +10,169 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
+#include "Resource/EffectResource.h"
+#include <algorithm>
+#include <string>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // semantics which differ per renderable and are set as array element per instance when batching draw calls
+        Bool IsModelDependentSemantic(EFixedSemantics semantics)
+        {
+            switch (semantics)
+            {
+            case EFixedSemantics_ModelMatrix:
+            case EFixedSemantics_ModelViewMatrix:
+            case EFixedSemantics_ModelViewMatrix33:
+            case EFixedSemantics_ModelViewProjectionMatrix:
+            case EFixedSemantics_NormalMatrix:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        DepthStencilState GetDepthStencilState(const RenderState& renderState)
+        {
+            DepthStencilState depthStencilState;
+            depthStencilState.m_depthFunc          = renderState.depthFunc;
+            depthStencilState.m_depthWrite         = renderState.depthWrite;
+            depthStencilState.m_stencilFunc        = renderState.stencilFunc;
+            depthStencilState.m_stencilMask        = renderState.stencilMask;
+            depthStencilState.m_stencilOpDepthFail = renderState.stencilOpDepthFail;
+            depthStencilState.m_stencilOpDepthPass = renderState.stencilOpDepthPass;
+            depthStencilState.m_stencilOpFail      = renderState.stencilOpFail;
+            depthStencilState.m_stencilRefValue    = renderState.stencilRefValue;
+            return depthStencilState;
+        }
+
+        BlendState GetBlendState(const RenderState& renderState)
+        {
+            BlendState blendState;
+            blendState.m_blendFactorSrcColor = renderState.blendFactorSrcColor;
+            blendState.m_blendFactorDstColor = renderState.blendFactorDstColor;
+            blendState.m_blendFactorSrcAlpha = renderState.blendFactorSrcAlpha;
+            blendState.m_blendFactorDstAlpha = renderState.blendFactorDstAlpha;
+            blendState.m_blendOperationColor = renderState.blendOperationColor;
+            blendState.m_blendOperationAlpha = renderState.blendOperationAlpha;
+            blendState.m_colorWriteMask      = renderState.colorWriteMask;
+            return blendState;
+        }
+
+        RasterizerState GetRasterizerState(const RenderState& renderState)
+        {
+            RasterizerState rasterizerState;
+            rasterizerState.m_cullMode = renderState.cullMode;
+            rasterizerState.m_drawMode = renderState.drawMode;
+            return rasterizerState;
+        }
+
+        Bool AreSamplerStatesEqual(const TextureSamplerStates& states, const TextureSamplerStates& otherStates)
+        {
+            return states.m_addressModeU == otherStates.m_addressModeU
+                && states.m_addressModeV == otherStates.m_addressModeV
+                && states.m_addressModeR == otherStates.m_addressModeR
+                && states.m_minSamplingMode == otherStates.m_minSamplingMode
+                && states.m_magSamplingMode == otherStates.m_magSamplingMode
+                && states.m_anisotropyLevel == otherStates.m_anisotropyLevel;
+        }
+
+        template <typename T>
+        Bool AreArraysEqual(const T* values, const T* otherValues, UInt32 elementCount)
+        {
+            return std::equal(values, values + elementCount, otherValues);
+        }
+
+        Bool IsIdentifierCharacter(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+
+        size_t FindIdentifier(const std::string& source, const std::string& identifier, size_t from)
+        {
+            size_t pos = source.find(identifier, from);
+            while (pos != std::string::npos)
+            {
+                const size_t end = pos + identifier.size();
+                if ((pos == 0u || !IsIdentifierCharacter(source[pos - 1u])) && (end == source.size() || !IsIdentifierCharacter(source[end])))
+                    return pos;
+                pos = source.find(identifier, end);
+            }
+            return std::string::npos;
+        }
+
+        size_t SkipWhitespace(const std::string& source, size_t pos)
+        {
+            while (pos < source.size() && (source[pos] == ' ' || source[pos] == '\t' || source[pos] == '\r' || source[pos] == '\n'))
+                ++pos;
+            return pos;
+        }
+
+        // checks every use of uniform other than its declaration, declaration is the statement containing 'uniform' keyword
+        Bool IsUniformUsedOnlyWithInstanceIdIndex(const std::string& source, const std::string& uniformName, Bool instanceIdIndexAllowed)
+        {
+            for (size_t pos = FindIdentifier(source, uniformName, 0u); pos != std::string::npos; pos = FindIdentifier(source, uniformName, pos + uniformName.size()))
+            {
+                const size_t statementEnd = source.find_last_of(";{}", pos);
+                const size_t statementStart = (statementEnd == std::string::npos ? 0u : statementEnd + 1u);
+                const std::string statement = source.substr(statementStart, pos - statementStart);
+                if (FindIdentifier(statement, "uniform", 0u) != std::string::npos)
+                    continue;
+
+                if (!instanceIdIndexAllowed)
+                    return false;
+
+                static const std::string InstanceId("gl_InstanceID");
+                size_t indexPos = SkipWhitespace(source, pos + uniformName.size());
+                if (indexPos >= source.size() || source[indexPos] != '[')
+                    return false;
+                indexPos = SkipWhitespace(source, indexPos + 1u);
+                if (source.compare(indexPos, InstanceId.size(), InstanceId) != 0)
+                    return false;
+                indexPos = SkipWhitespace(source, indexPos + InstanceId.size());
+                if (indexPos >= source.size() || source[indexPos] != ']')
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
     UInt32 RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
-    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer)
+    RenderExecutor::RenderExecutor(IDevice& device, const FrameBufferInfo& frameBuffer, const SceneRenderExecutionIterator& renderFrom, const FrameTimer* frameTimer, Bool drawCallBatchingEnabled)
         : m_state(device, frameBuffer, renderFrom, frameTimer)
+        , m_drawCallBatchingEnabled(drawCallBatchingEnabled)
     {
     }
 
+    Bool RenderExecutor::EffectSupportsDrawCallBatching(const EffectResource& effect)
+    {
+        const std::string vertexShader(effect.getVertexShader());
+        const std::string fragmentShader(effect.getFragmentShader());
+
+        Bool hasModelDependentSemantics = false;
+        for (const auto& uniformInput : effect.getUniformInputs())
+        {
+            if (!IsModelDependentSemantic(uniformInput.semantics))
+                continue;
+
+            // merged renderables are drawn as instances of single draw call, each instance has to pick its own array element
+            const std::string uniformName(uniformInput.inputName.c_str());
+            if (uniformInput.elementCount < 2u
+                || !IsUniformUsedOnlyWithInstanceIdIndex(vertexShader, uniformName, true)
+                || !IsUniformUsedOnlyWithInstanceIdIndex(fragmentShader, uniformName, false))
+            {
+                return false;
+            }
+            hasModelDependentSemantics = true;
+        }
+
+        return hasModelDependentSemantics;
+    }
+
     SceneRenderExecutionIterator RenderExecutor::executeScene(const RendererCachedScene& scene, const Matrix44f& rendererViewMatrix) const
     {
         setGlobalInternalStates(scene, rendererViewMatrix);
@@ -34,6 +187,7 @@ namespace ramses_internal
                 if (!executeRenderPass(scene, passInfo.getRenderPassHandle()))
                 {
                     assert(m_state.m_currentRenderIterator.getFlattenedRenderableIdx() > 0);
+                    scene.trackRenderedRenderables(m_state.m_numCulledRenderables, m_state.m_numRenderedRenderables, m_state.m_numMergedDrawCalls);
                     return m_state.m_currentRenderIterator;
                 }
                 break;
@@ -45,6 +199,7 @@ namespace ramses_internal
             }
         }
 
+        scene.trackRenderedRenderables(m_state.m_numCulledRenderables, m_state.m_numRenderedRenderables, m_state.m_numMergedDrawCalls);
         return {};
     }
 
@@ -89,15 +244,222 @@ namespace ramses_internal
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
+            UInt32 numRenderablesProcessed = 1u;
             if (!scene.renderableResourcesDirty(renderableHandle))
             {
-                setRenderableInternalStates(renderableHandle);
-                setSemanticDataFields();
-                executeRenderable();
+                // culling has to be decided before any cached state is modified for the renderable
+                if (isRenderableCulled(renderableHandle))
+                {
+                    ++m_state.m_numCulledRenderables;
+                }
+                else
+                {
+                    setRenderableInternalStates(renderableHandle);
+                    const Bool batchRenderables = m_drawCallBatchingEnabled && scene.getRenderableEffectSupportsDrawCallBatching(renderableHandle);
+                    if (batchRenderables)
+                    {
+                        numRenderablesProcessed = collectRenderablesToBatch(orderedRenderables);
+                        const UInt32 numMergedRenderables = static_cast<UInt32>(m_state.m_batchedRenderables.size()) - 1u;
+                        m_state.m_numMergedDrawCalls += numMergedRenderables;
+                        m_state.m_numRenderedRenderables += numMergedRenderables;
+                    }
+                    else
+                    {
+                        m_state.m_batchedRenderables.clear();
+                    }
+                    setSemanticDataFields(batchRenderables);
+                    executeRenderable();
+                    ++m_state.m_numRenderedRenderables;
+                }
+            }
+
+            Bool timeBudgetCheckDue = false;
+            for (UInt32 i = 0u; i < numRenderablesProcessed; ++i)
+            {
+                m_state.m_currentRenderIterator.incrementRenderableIdx();
+                timeBudgetCheckDue = timeBudgetCheckDue || (m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u);
+            }
+
+            if (timeBudgetCheckDue && m_state.hasExceededTimeBudgetForRendering())
+                return false;
+        }
+
+        return true;
+    }
+
+    UInt32 RenderExecutor::collectRenderablesToBatch(const RenderableVector& orderedRenderables) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        m_state.m_batchedRenderables.clear();
+        m_state.m_batchedRenderables.push_back(m_state.getRenderable());
+
+        const UInt32 maxBatchSize = getMaxBatchSize();
+        const UInt32 firstRenderableIdx = m_state.m_currentRenderIterator.getRenderableIdx();
+        UInt32 renderableIdx = firstRenderableIdx + 1u;
+        while (m_state.m_batchedRenderables.size() < maxBatchSize && renderableIdx < orderedRenderables.size())
+        {
+            const RenderableHandle renderableHandle = orderedRenderables[renderableIdx];
+            // renderables which are not rendered anyway do not interrupt batch
+            if (!scene.renderableResourcesDirty(renderableHandle))
+            {
+                if (isRenderableCulled(renderableHandle))
+                    ++m_state.m_numCulledRenderables;
+                else if (canBeBatchedWithCurrentRenderable(renderableHandle))
+                    m_state.m_batchedRenderables.push_back(renderableHandle);
+                else
+                    break;
+            }
+            ++renderableIdx;
+        }
+
+        return renderableIdx - firstRenderableIdx;
+    }
+
+    UInt32 RenderExecutor::getMaxBatchSize() const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        // instances drawn by renderable itself cannot be combined with instances created by batching
+        if (isRenderableInstanced(m_state.getRenderable()))
+            return 1u;
+
+        const Renderable& renderable = scene.getRenderable(m_state.getRenderable());
+        // batch is limited by smallest model dependent semantic array of effect
+        const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        const DataLayout& dataLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(uniformData));
+        UInt32 maxBatchSize = 0u;
+        for (DataFieldHandle field(0u); field < dataLayout.getFieldCount(); ++field)
+        {
+            const DataFieldInfo& fieldInfo = dataLayout.getField(field);
+            if (IsModelDependentSemantic(fieldInfo.semantics))
+                maxBatchSize = (maxBatchSize == 0u ? fieldInfo.elementCount : std::min(maxBatchSize, fieldInfo.elementCount));
+        }
+
+        return std::max(maxBatchSize, 1u);
+    }
+
+    Bool RenderExecutor::canBeBatchedWithCurrentRenderable(RenderableHandle renderableHandle) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        const Renderable& renderable = scene.getRenderable(m_state.getRenderable());
+        const Renderable& otherRenderable = scene.getRenderable(renderableHandle);
+
+        if (otherRenderable.instanceCount != 1u
+            || otherRenderable.startIndex != renderable.startIndex
+            || otherRenderable.indexCount != renderable.indexCount
+            || otherRenderable.startVertex != renderable.startVertex
+            || scene.getRenderableEffectDeviceHandle(renderableHandle) != m_state.shaderDeviceHandle.getState())
+        {
+            return false;
+        }
+
+        const DataInstanceHandle vertexData = renderable.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataInstanceHandle otherVertexData = otherRenderable.dataInstances[ERenderableDataSlotType_Geometry];
+        if (otherVertexData != vertexData)
+        {
+            // different geometry data instances are compatible if they use same vertex buffers in same way
+            const DeviceHandleVector& geometryDeviceHandles = scene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()];
+            if (scene.getLayoutOfDataInstance(otherVertexData) != scene.getLayoutOfDataInstance(vertexData)
+                || scene.getCachedHandlesForVertexAttributes()[otherVertexData.asMemoryHandle()] != geometryDeviceHandles)
+            {
+                return false;
+            }
+
+            if (hasInstancedVertexAttributes(otherVertexData))
+                return false;
+        }
+
+        if (otherRenderable.renderState != renderable.renderState)
+        {
+            const RenderState& otherRenderState = scene.getRenderState(otherRenderable.renderState);
+            if (otherRenderState.scissorTest != m_state.scissorState.m_scissorTest
+                || !(otherRenderState.scissorRegion == m_state.scissorState.m_scissorRegion)
+                || GetDepthStencilState(otherRenderState) != m_state.depthStencilState.getState()
+                || GetBlendState(otherRenderState) != m_state.blendState.getState()
+                || GetRasterizerState(otherRenderState) != m_state.rasterizerState.getState())
+            {
+                return false;
             }
-            m_state.m_currentRenderIterator.incrementRenderableIdx();
+        }
 
-            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+        const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        const DataInstanceHandle otherUniformData = otherRenderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        if (otherUniformData != uniformData)
+        {
+            const DataLayoutHandle dataLayoutHandle = scene.getLayoutOfDataInstance(uniformData);
+            if (scene.getLayoutOfDataInstance(otherUniformData) != dataLayoutHandle)
+                return false;
+
+            return hasEqualUniformValues(uniformData, otherUniformData, scene.getDataLayout(dataLayoutHandle));
+        }
+
+        return true;
+    }
+
+    Bool RenderExecutor::hasEqualUniformValues(DataInstanceHandle uniformData, DataInstanceHandle otherUniformData, const DataLayout& dataLayout) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        for (DataFieldHandle field(0u); field < dataLayout.getFieldCount(); ++field)
+        {
+            const DataFieldInfo& fieldInfo = dataLayout.getField(field);
+            // semantic values are set by renderer, model dependent ones per batched instance
+            if (fieldInfo.semantics != EFixedSemantics_Invalid)
+                continue;
+
+            const UInt32 elementCount = fieldInfo.elementCount;
+            Bool equal = false;
+            switch (fieldInfo.dataType)
+            {
+            case EDataType_Float:
+                equal = AreArraysEqual(scene.getDataFloatArray(uniformData, field), scene.getDataFloatArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Vector2F:
+                equal = AreArraysEqual(scene.getDataVector2fArray(uniformData, field), scene.getDataVector2fArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Vector3F:
+                equal = AreArraysEqual(scene.getDataVector3fArray(uniformData, field), scene.getDataVector3fArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Vector4F:
+                equal = AreArraysEqual(scene.getDataVector4fArray(uniformData, field), scene.getDataVector4fArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Matrix22F:
+                equal = AreArraysEqual(scene.getDataMatrix22fArray(uniformData, field), scene.getDataMatrix22fArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Matrix33F:
+                equal = AreArraysEqual(scene.getDataMatrix33fArray(uniformData, field), scene.getDataMatrix33fArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Matrix44F:
+                equal = AreArraysEqual(scene.getDataMatrix44fArray(uniformData, field), scene.getDataMatrix44fArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Int32:
+                equal = AreArraysEqual(scene.getDataIntegerArray(uniformData, field), scene.getDataIntegerArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Vector2I:
+                equal = AreArraysEqual(scene.getDataVector2iArray(uniformData, field), scene.getDataVector2iArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Vector3I:
+                equal = AreArraysEqual(scene.getDataVector3iArray(uniformData, field), scene.getDataVector3iArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_Vector4I:
+                equal = AreArraysEqual(scene.getDataVector4iArray(uniformData, field), scene.getDataVector4iArray(otherUniformData, field), elementCount);
+                break;
+            case EDataType_DataReference:
+                equal = (scene.getDataReference(uniformData, field) == scene.getDataReference(otherUniformData, field));
+                break;
+            case EDataType_TextureSampler:
+            {
+                const TextureSamplerHandle sampler = scene.getDataTextureSamplerHandle(uniformData, field);
+                const TextureSamplerHandle otherSampler = scene.getDataTextureSamplerHandle(otherUniformData, field);
+                const DeviceHandleVector& textureDeviceHandles = scene.getCachedHandlesForTextureSamplers();
+                equal = (sampler == otherSampler)
+                    || (textureDeviceHandles[sampler.asMemoryHandle()] == textureDeviceHandles[otherSampler.asMemoryHandle()]
+                        && AreSamplerStatesEqual(scene.getTextureSampler(sampler).states, scene.getTextureSampler(otherSampler).states));
+                break;
+            }
+            default:
+                break;
+            }
+
+            if (!equal)
                 return false;
         }
 
@@ -133,6 +495,36 @@ namespace ramses_internal
         }
     }
 
+    Bool RenderExecutor::isRenderableCulled(RenderableHandle renderableHandle) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        const BoundingBox& boundingBox = scene.getRenderable(renderableHandle).boundingBox;
+        // bounding box covers base mesh only, instances can be placed anywhere
+        if (boundingBox.isEmpty() || isRenderableInstanced(renderableHandle))
+            return false;
+
+        return boundingBox.isOutsideOfClipVolume(m_state.getViewProjectionMatrix() * scene.getRenderableWorldMatrix(renderableHandle));
+    }
+
+    Bool RenderExecutor::isRenderableInstanced(RenderableHandle renderableHandle) const
+    {
+        const Renderable& renderable = m_state.getScene().getRenderable(renderableHandle);
+        return renderable.instanceCount != 1u || hasInstancedVertexAttributes(renderable.dataInstances[ERenderableDataSlotType_Geometry]);
+    }
+
+    Bool RenderExecutor::hasInstancedVertexAttributes(DataInstanceHandle vertexData) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        const UInt attributesCount = scene.getCachedHandlesForVertexAttributes()[vertexData.asMemoryHandle()].size() - 1u;
+        for (DataFieldHandle attributeField(0u); attributeField < attributesCount; ++attributeField)
+        {
+            if (scene.getDataResource(vertexData, attributeField + 1u).instancingDivisor != 0u)
+                return true;
+        }
+
+        return false;
+    }
+
     void RenderExecutor::executeRenderStates() const
     {
         IDevice& device = m_state.getDevice();
@@ -199,21 +591,55 @@ namespace ramses_internal
         const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
         const DataLayout& dataLayout = renderScene.getDataLayout(dataLayoutHandle);
         const UInt32 uniformsCount = dataLayout.getFieldCount();
+
+        // uniform values kept by active shader are still valid if neither uniform data nor any referenced data changed since set,
+        // textures are bound to units shared by all shaders and must be activated always
+        const UniformDataVersion uniformDataVersion = getUniformDataVersion(uniformData, dataLayout);
+        const Bool uniformsUpToDate = (device.getActiveShaderUniformDataVersion() == uniformDataVersion);
+
         for (DataFieldHandle constantField(0u); constantField < uniformsCount; ++constantField)
         {
             const DataFieldInfo& field = dataLayout.getField(constantField);
             if (field.dataType == EDataType_DataReference)
             {
-                DataInstanceHandle dataRef = renderScene.getDataReference(uniformData, constantField);
-                const DataLayoutHandle dataRefLayout = renderScene.getLayoutOfDataInstance(dataRef);
-                const EDataType dataTypeRef = renderScene.getDataLayout(dataRefLayout).getField(DataFieldHandle(0u)).dataType;
-                executeConstant(dataTypeRef, 1u, dataRef, DataFieldHandle(0u), constantField);
+                if (!uniformsUpToDate)
+                {
+                    DataInstanceHandle dataRef = renderScene.getDataReference(uniformData, constantField);
+                    const DataLayoutHandle dataRefLayout = renderScene.getLayoutOfDataInstance(dataRef);
+                    const EDataType dataTypeRef = renderScene.getDataLayout(dataRefLayout).getField(DataFieldHandle(0u)).dataType;
+                    executeConstant(dataTypeRef, 1u, dataRef, DataFieldHandle(0u), constantField);
+                }
             }
-            else
+            else if (!uniformsUpToDate || field.dataType == EDataType_TextureSampler)
             {
                 executeConstant(field.dataType, field.elementCount, uniformData, constantField, constantField);
             }
         }
+
+        if (!uniformsUpToDate)
+        {
+            device.setActiveShaderUniformDataVersion(uniformDataVersion);
+        }
+    }
+
+    UniformDataVersion RenderExecutor::getUniformDataVersion(DataInstanceHandle uniformData, const DataLayout& dataLayout) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
+
+        // versions are unique and increasing, any change of referenced data is therefore reflected in maximum of their versions
+        UniformDataVersion version;
+        version.dataVersion = renderScene.getDataInstanceVersion(uniformData);
+        const UInt32 uniformsCount = dataLayout.getFieldCount();
+        for (DataFieldHandle constantField(0u); constantField < uniformsCount; ++constantField)
+        {
+            if (dataLayout.getField(constantField).dataType == EDataType_DataReference)
+            {
+                const DataInstanceHandle dataRef = renderScene.getDataReference(uniformData, constantField);
+                version.referencedDataVersion = std::max(version.referencedDataVersion, renderScene.getDataInstanceVersion(dataRef));
+            }
+        }
+
+        return version;
     }
 
     void RenderExecutor::executeConstant(EDataType dataType, UInt32 elementCount, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const
@@ -343,13 +769,17 @@ namespace ramses_internal
             device.activateIndexBuffer(m_state.indexBufferDeviceHandle.getState());
         }
 
+        // batched renderables are drawn as instances of current renderable
+        const UInt32 numBatchedRenderables = static_cast<UInt32>(m_state.m_batchedRenderables.size());
+        const UInt32 instanceCount = (numBatchedRenderables > 1u ? numBatchedRenderables : renderable.instanceCount);
+
         if (hasIndexArray)
         {
-            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, instanceCount);
         }
         else
         {
-            device.drawTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawTriangles(renderable.startIndex, renderable.indexCount, instanceCount);
         }
     }
 
@@ -378,32 +808,9 @@ namespace ramses_internal
         m_state.scissorState.m_scissorTest = renderState.scissorTest;
         m_state.scissorState.m_scissorRegion = renderState.scissorRegion;
 
-        DepthStencilState depthStencilState;
-        depthStencilState.m_depthFunc          = renderState.depthFunc;
-        depthStencilState.m_depthWrite         = renderState.depthWrite;
-        depthStencilState.m_stencilFunc        = renderState.stencilFunc;
-        depthStencilState.m_stencilMask        = renderState.stencilMask;
-        depthStencilState.m_stencilOpDepthFail = renderState.stencilOpDepthFail;
-        depthStencilState.m_stencilOpDepthPass = renderState.stencilOpDepthPass;
-        depthStencilState.m_stencilOpFail      = renderState.stencilOpFail;
-        depthStencilState.m_stencilRefValue    = renderState.stencilRefValue;
-        m_state.depthStencilState.setState(depthStencilState);
-
-
-        BlendState blendState;
-        blendState.m_blendFactorSrcColor = renderState.blendFactorSrcColor;
-        blendState.m_blendFactorDstColor = renderState.blendFactorDstColor;
-        blendState.m_blendFactorSrcAlpha = renderState.blendFactorSrcAlpha;
-        blendState.m_blendFactorDstAlpha = renderState.blendFactorDstAlpha;
-        blendState.m_blendOperationColor = renderState.blendOperationColor;
-        blendState.m_blendOperationAlpha = renderState.blendOperationAlpha;
-        blendState.m_colorWriteMask      = renderState.colorWriteMask;
-        m_state.blendState.setState(blendState);
-
-        RasterizerState rasterizerState;
-        rasterizerState.m_cullMode = renderState.cullMode;
-        rasterizerState.m_drawMode = renderState.drawMode;
-        m_state.rasterizerState.setState(rasterizerState);
+        m_state.depthStencilState.setState(GetDepthStencilState(renderState));
+        m_state.blendState.setState(GetBlendState(renderState));
+        m_state.rasterizerState.setState(GetRasterizerState(renderState));
     }
 
     void RenderExecutor::activateRenderTarget(RenderTargetHandle renderTarget) const
@@ -507,7 +914,79 @@ namespace ramses_internal
         }
     }
 
-    void RenderExecutor::setSemanticDataFields() const
+    void RenderExecutor::resolveAndSetSemanticArrayDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, UInt32 elementCount, Bool batchedRenderables) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
+        // semantic data is 'cached' directly in scene, for this special case non-const access is needed
+        IScene& scene = const_cast<RendererCachedScene&>(renderScene);
+
+        // array element i belongs to i-th batched renderable (gl_InstanceID), unused elements repeat last value.
+        // Without batching renderable is drawn as single instance and only first element is updated.
+        auto& matrices = m_state.m_batchedMatrices;
+        matrices.clear();
+        const RenderableHandle currentRenderable = m_state.getRenderable();
+        const UInt32 numInstances = batchedRenderables ? static_cast<UInt32>(m_state.m_batchedRenderables.size()) : 1u;
+        for (UInt32 instance = 0u; instance < numInstances; ++instance)
+        {
+            const RenderableHandle renderable = batchedRenderables ? m_state.m_batchedRenderables[instance] : currentRenderable;
+            const Matrix44f& modelMatrix = renderScene.getRenderableWorldMatrix(renderable);
+            switch (semantics)
+            {
+            case EFixedSemantics_ModelMatrix:
+                matrices.push_back(modelMatrix);
+                break;
+            case EFixedSemantics_ModelViewMatrix:
+            case EFixedSemantics_ModelViewMatrix33:
+                matrices.push_back(m_state.getViewMatrix() * modelMatrix);
+                break;
+            case EFixedSemantics_ModelViewProjectionMatrix:
+                matrices.push_back(m_state.getProjectionMatrix() * (m_state.getViewMatrix() * modelMatrix));
+                break;
+            case EFixedSemantics_NormalMatrix:
+                matrices.push_back((m_state.getViewMatrix() * modelMatrix).inverse().transpose());
+                break;
+            default:
+                assert(false && "Semantics is not model dependent");
+                break;
+            }
+        }
+
+        if (semantics == EFixedSemantics_ModelViewMatrix33)
+        {
+            auto& matrices33 = m_state.m_batchedMatrices33;
+            if (batchedRenderables)
+            {
+                matrices33.clear();
+                for (const auto& matrix : matrices)
+                    matrices33.push_back(Matrix33f(matrix));
+                matrices33.resize(elementCount, matrices33.back());
+            }
+            else
+            {
+                const Matrix33f* currentValues = scene.getDataMatrix33fArray(dataInstHandle, dataFieldHandle);
+                matrices33.assign(currentValues, currentValues + elementCount);
+                matrices33.front() = Matrix33f(matrices.front());
+            }
+            scene.setDataMatrix33fArray(dataInstHandle, dataFieldHandle, elementCount, matrices33.data());
+        }
+        else
+        {
+            if (batchedRenderables)
+            {
+                matrices.resize(elementCount, matrices.back());
+            }
+            else
+            {
+                const Matrix44f firstElement = matrices.front();
+                const Matrix44f* currentValues = scene.getDataMatrix44fArray(dataInstHandle, dataFieldHandle);
+                matrices.assign(currentValues, currentValues + elementCount);
+                matrices.front() = firstElement;
+            }
+            scene.setDataMatrix44fArray(dataInstHandle, dataFieldHandle, elementCount, matrices.data());
+        }
+    }
+
+    void RenderExecutor::setSemanticDataFields(Bool batchedRenderables) const
     {
         const IScene& scene = m_state.getScene();
         const RenderableHandle renderable = m_state.getRenderable();
@@ -518,10 +997,14 @@ namespace ramses_internal
         const UInt32 fieldCount = dataLayout.getFieldCount();
         for (DataFieldHandle i(0u); i < fieldCount; ++i)
         {
-            const EFixedSemantics semantics = dataLayout.getField(i).semantics;
-            if (semantics != EFixedSemantics_Invalid)
+            const DataFieldInfo& field = dataLayout.getField(i);
+            if (IsModelDependentSemantic(field.semantics) && field.elementCount > 1u)
+            {
+                resolveAndSetSemanticArrayDataField(field.semantics, dataInstance, i, field.elementCount, batchedRenderables);
+            }
+            else if (field.semantics != EFixedSemantics_Invalid)
             {
-                resolveAndSetSemanticDataField(semantics, dataInstance, i);
+                resolveAndSetSemanticDataField(field.semantics, dataInstance, i);
             }
         }
     }
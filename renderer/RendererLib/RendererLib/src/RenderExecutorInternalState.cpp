@@ -79,6 +79,11 @@ namespace ramses_internal
         return m_viewMatrix;
     }
 
+    const Matrix44f& RenderExecutorInternalState::getViewProjectionMatrix() const
+    {
+        return m_viewProjectionMatrix;
+    }
+
     const Matrix44f& RenderExecutorInternalState::getModelMatrix() const
     {
         return m_modelMatrix;
@@ -134,6 +139,7 @@ namespace ramses_internal
                         cameraData.frustum.farPlane));
             }
 
+            m_viewProjectionMatrix = m_projectionMatrix * m_viewMatrix;
             viewportState.setState(newViewport);
         }
     }
@@ -141,7 +141,7 @@ namespace ramses_internal
                 if (!scene.renderableResourcesDirty(renderable))
                 {
                     setRenderableInternalStates(renderable);
-                    setSemanticDataFields();
+                    setSemanticDataFields(false);
                     executeRenderable();
                 }
                 else
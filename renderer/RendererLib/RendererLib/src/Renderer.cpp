@@ -23,6 +23,8 @@
 #include "RendererLib/SceneExpirationMonitor.h"
 #include "Platform_Base/PlatformFactory_Base.h"
 #include "Utils/LogMacros.h"
+#include <algorithm>
+#include <iterator>
 
 namespace ramses_internal
 {
@@ -52,6 +54,7 @@ namespace ramses_internal
     {
         assert(m_displays.find(display) != m_displays.cend());
         assert(!hasAnyBufferWithInterruptedRendering());
+        waitForDisplayRendering(display);
         auto& displayInfo = m_displays.find(display)->second;
         displayInfo.buffersSetup.registerDisplayBuffer(bufferDeviceHandle, { 0, 0, width, height }, DefaultClearColor, true, isInterruptible);
         // no need to re-render OB as long as no scene is assigned to it, OB is cleared at creation time
@@ -62,6 +65,7 @@ namespace ramses_internal
     {
         assert(m_displays.find(display) != m_displays.cend());
         assert(!hasAnyBufferWithInterruptedRendering());
+        waitForDisplayRendering(display);
         auto& displayInfo = m_displays[display];
         displayInfo.buffersSetup.unregisterDisplayBuffer(bufferDeviceHandle);
         m_statistics.untrackOffscreenBuffer(display, bufferDeviceHandle);
@@ -95,6 +99,7 @@ namespace ramses_internal
         assert(displayController.isWarpingEnabled());
         displayController.setWarpingMeshData(meshData);
         // re-render framebuffer of the display
+        waitForDisplayRendering(display);
         auto& displayInfo = m_displays.find(display)->second;
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, true);
     }
@@ -109,10 +114,17 @@ namespace ramses_internal
         displayInfo.frameBufferDeviceHandle = display.getDisplayBuffer();
         displayInfo.buffersSetup.registerDisplayBuffer(displayInfo.frameBufferDeviceHandle, { 0, 0, display.getDisplayWidth(), display.getDisplayHeight() }, DefaultClearColor, false, false);
         displayInfo.couldRenderLastFrame = true;
+        displayInfo.frameProfileRenderer.reset(new FrameProfileRenderer(display.getRenderBackend().getDevice(), display.getDisplayWidth(), display.getDisplayHeight()));
 
-        m_scheduledScreenshots.put(displayHandle, ScreenshotInfoVector());
-        auto profileRenderer = new FrameProfileRenderer(display.getRenderBackend().getDevice(), display.getDisplayWidth(), display.getDisplayHeight());
-        m_frameProfileRenderer.put(displayHandle, profileRenderer);
+        if (m_renderThreadPerDisplay)
+        {
+            // other displays keep rendering while displays are added or removed, render thread never looks up its display info
+            DisplayInfo* displayInfoPtr = &displayInfo;
+            displayInfo.profilerStatistics.reset(new FrameProfilerStatistics);
+            displayInfo.renderThread.reset(new DisplayRenderThread(displayHandle,
+                [this, displayHandle, displayInfoPtr]() { renderDisplayOnRenderThread(displayHandle, *displayInfoPtr); },
+                [this, displayHandle, displayInfoPtr]() { presentDisplayOnRenderThread(displayHandle, *displayInfoPtr); }));
+        }
     }
 
     void Renderer::createDisplayContext(const DisplayConfig& displayConfig, DisplayHandle display)
@@ -158,16 +170,12 @@ namespace ramses_internal
         DisplayInfo& displayInfo = m_displays.find(display)->second;
         assert(!hasAnyBufferWithInterruptedRendering());
 
+        // display thread is stopped before display is destroyed
+        displayInfo.renderThread.reset();
         IDisplayController& displayController = *displayInfo.displayController;
         displayController.validateRenderingStatusHealthy();
 
         m_displays.erase(display);
-        m_scheduledScreenshots.remove(display);
-
-        assert(m_frameProfileRenderer.contains(display));
-        auto renderer = *m_frameProfileRenderer.get(display);
-        delete renderer;
-        m_frameProfileRenderer.remove(display);
     }
 
     const DisplaySetup& Renderer::getDisplaySetup(DisplayHandle displayHandle) const
@@ -324,16 +332,19 @@ namespace ramses_internal
         }
     }
 
-    void Renderer::renderToFramebuffer(DisplayHandle displayHandle, DisplayHandle& activeDisplay)
+    void Renderer::renderToFramebuffer(DisplayHandle displayHandle, DisplayInfo& displayInfo, DisplayHandle& activeDisplay, FrameProfilerStatistics& profilerStatistics)
     {
-        auto& displayInfo = m_displays.find(displayHandle)->second;
         assert(displayInfo.couldRenderLastFrame);
         IDisplayController& display = *displayInfo.displayController;
+        displayInfo.renderedFrameResults.framebufferRendered = false;
         const DisplayBufferInfo& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayInfo.frameBufferDeviceHandle);
         if (!displayBufferInfo.needsRerender)
         {
             // notify clients even if nothing rendered but frame was consumed
-            display.getEmbeddedCompositingManager().notifyClients();
+            if (displayInfo.renderThread)
+                displayInfo.embeddedCompositingClientsToNotify = true;
+            else
+                display.getEmbeddedCompositingManager().notifyClients();
             return;
         }
 
@@ -341,7 +352,8 @@ namespace ramses_internal
 
         display.clearBuffer(displayInfo.frameBufferDeviceHandle, displayBufferInfo.clearColor);
 
-        m_tempScenesRendered.clear();
+        const auto& renderedScenes = displayInfo.renderedFrameResults.renderedScenes;
+        const size_t firstRenderedScene = renderedScenes.size();
         const auto& assignedScenes = displayBufferInfo.scenes;
         for (const auto& sceneInfo : assignedScenes)
         {
@@ -349,31 +361,28 @@ namespace ramses_internal
             {
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
                 display.renderScene(scene, displayInfo.frameBufferDeviceHandle, displayBufferInfo.viewport);
-                onSceneWasRendered(scene);
-                m_tempScenesRendered.push_back(sceneInfo.sceneId);
+                OnSceneWasRendered(displayInfo, scene);
             }
         }
         LOG_TRACE_F(CONTEXT_PROFILING, ([&](StringOutputStream& logStream)
         {
             logStream << "Renderer::renderToFramebuffer (display " << displayHandle.asMemoryHandle() << ") rendered scenes:";
-            for (auto sceneId : m_tempScenesRendered)
-                logStream << " " << sceneId;
+            for (size_t i = firstRenderedScene; i < renderedScenes.size(); ++i)
+                logStream << " " << renderedScenes[i].sceneId;
         }));
 
         display.executePostProcessing();
 
-        auto profileRenderer = *m_frameProfileRenderer.get(displayHandle);
-        profileRenderer->renderStatistics(m_profilerStatistics);
+        displayInfo.frameProfileRenderer->renderStatistics(profilerStatistics);
 
-        processScheduledScreenshots(displayHandle, display, activeDisplay);
+        ProcessScheduledScreenshots(displayHandle, displayInfo, activeDisplay);
 
-        m_tempDisplaysToSwapBuffers.push_back(displayHandle);
+        displayInfo.renderedFrameResults.framebufferRendered = true;
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayInfo.frameBufferDeviceHandle, false);
     }
 
-    void Renderer::renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay)
+    void Renderer::renderToOffscreenBuffers(DisplayHandle displayHandle, DisplayInfo& displayInfo, DisplayHandle& activeDisplay)
     {
-        auto& displayInfo = m_displays.find(displayHandle)->second;
         assert(displayInfo.couldRenderLastFrame);
         IDisplayController& display = *displayInfo.displayController;
 
@@ -388,7 +397,8 @@ namespace ramses_internal
             const auto& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayBuffer);
             display.clearBuffer(displayBuffer, displayBufferInfo.clearColor);
 
-            m_tempScenesRendered.clear();
+            const auto& renderedScenes = displayInfo.renderedFrameResults.renderedScenes;
+            const size_t firstRenderedScene = renderedScenes.size();
             const auto& assignedScenes = displayBufferInfo.scenes;
             for (const auto& sceneInfo : assignedScenes)
             {
@@ -396,29 +406,27 @@ namespace ramses_internal
                 {
                     const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
                     display.renderScene(scene, displayBuffer, displayBufferInfo.viewport);
-                    onSceneWasRendered(scene);
-                    m_tempScenesRendered.push_back(sceneInfo.sceneId);
+                    OnSceneWasRendered(displayInfo, scene);
                 }
             }
             LOG_TRACE_F(CONTEXT_PROFILING, ([&](StringOutputStream& logStream)
             {
                 logStream << "Renderer::renderToOffscreenBuffers (display " << displayHandle.asMemoryHandle() << ") OB" << displayBuffer.asMemoryHandle() << " rendered scenes:";
-                for (auto sceneId : m_tempScenesRendered)
-                    logStream << " " << sceneId;
+                for (size_t i = firstRenderedScene; i < renderedScenes.size(); ++i)
+                    logStream << " " << renderedScenes[i].sceneId;
             }));
 
-            m_statistics.offscreenBufferSwapped(displayHandle, displayBuffer, false);
+            displayInfo.renderedFrameResults.swappedOffscreenBuffers.push_back({ displayBuffer, false });
             displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, false);
         }
     }
 
-    void Renderer::renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayHandle& activeDisplay, Bool& interrupted)
+    void Renderer::renderToInterruptibleOffscreenBuffers(DisplayHandle displayHandle, DisplayInfo& displayInfo, DisplayHandle& activeDisplay, const FrameTimer& frameTimer, RendererInterruptState& interruptState, Bool& interrupted)
     {
-        auto& displayInfo = m_displays.find(displayHandle)->second;
         assert(displayInfo.couldRenderLastFrame);
         IDisplayController& display = *displayInfo.displayController;
 
-        const auto& displayBuffersToRender = displayInfo.buffersSetup.getInterruptibleOffscreenBuffersToRender(m_rendererInterruptState.getInterruptedDisplayBuffer());
+        const auto& displayBuffersToRender = displayInfo.buffersSetup.getInterruptibleOffscreenBuffersToRender(interruptState.getInterruptedDisplayBuffer());
         if (displayBuffersToRender.empty())
             return;
 
@@ -428,7 +436,7 @@ namespace ramses_internal
         {
             const auto& displayBufferInfo = displayInfo.buffersSetup.getDisplayBuffer(displayBuffer);
 
-            if (!m_rendererInterruptState.isInterrupted(displayHandle, displayBuffer))
+            if (!interruptState.isInterrupted(displayHandle, displayBuffer))
             {
                 // remove buffer from list of buffers to re-render as soon as we start rendering into it (even if it gets interrupted later on)
                 displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, false);
@@ -445,31 +453,31 @@ namespace ramses_internal
 
                 // if there was any rendering interrupted, skip till get to the interrupted scene
                 const SceneId sceneId = sceneInfo.sceneId;
-                if (m_rendererInterruptState.isInterrupted() && !m_rendererInterruptState.isInterrupted(displayHandle, displayBuffer, sceneId))
+                if (interruptState.isInterrupted() && !interruptState.isInterrupted(displayHandle, displayBuffer, sceneId))
                     continue;
 
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
-                const SceneRenderExecutionIterator interruptState = display.renderScene(scene, displayBuffer, displayBufferInfo.viewport, m_rendererInterruptState.getExecutorState(), &m_frameTimer);
+                const SceneRenderExecutionIterator executorState = display.renderScene(scene, displayBuffer, displayBufferInfo.viewport, interruptState.getExecutorState(), &frameTimer);
 
-                if (RendererInterruptState::IsInterrupted(interruptState))
+                if (RendererInterruptState::IsInterrupted(executorState))
                 {
-                    m_rendererInterruptState = { displayHandle, displayBuffer, sceneId, interruptState };
+                    interruptState = { displayHandle, displayBuffer, sceneId, executorState };
                     LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToInterruptibleOffscreenBuffers interrupted rendering to OB " << displayBuffer.asMemoryHandle() << " on display " << displayHandle.asMemoryHandle() << ", scene " << sceneId.getValue());
                     interrupted = true;
-                    m_statistics.offscreenBufferInterrupted(displayHandle, displayBuffer);
+                    displayInfo.renderedFrameResults.interruptedOffscreenBuffers.push_back(displayBuffer);
                     break;
                 }
-                m_rendererInterruptState = {};
+                interruptState = {};
 
-                onSceneWasRendered(scene);
+                OnSceneWasRendered(displayInfo, scene);
                 LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToInterruptibleOffscreenBuffers scene fully rendered to interruptible OB " << displayBuffer.asMemoryHandle() << " on display " << displayHandle.asMemoryHandle() << ", scene " << sceneId.getValue());
             }
 
-            if (m_rendererInterruptState.isInterrupted())
+            if (interruptState.isInterrupted())
                 break;
 
             displayInfo.displayController->getRenderBackend().getDevice().swapDoubleBufferedRenderTarget(displayBuffer);
-            m_statistics.offscreenBufferSwapped(displayHandle, displayBuffer, true);
+            displayInfo.renderedFrameResults.swappedOffscreenBuffers.push_back({ displayBuffer, true });
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToInterruptibleOffscreenBuffers interruptible OB " << displayBuffer.asMemoryHandle() << " swapped");
 
             //re-render framebuffer in next frame to reflect (finished!) changes in OB
@@ -481,17 +489,6 @@ namespace ramses_internal
     {
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin");
 
-        if (!m_skipUnmodifiedBuffers)
-        {
-            //mark all displays as modified (and hence re-render everything)
-            for (auto& display : m_displays)
-            {
-                auto& displayBufferSetup = display.second.buffersSetup;
-                for (const auto& buffer : displayBufferSetup.getDisplayBuffers())
-                    displayBufferSetup.setDisplayBufferToBeRerendered(buffer.first, true);
-            }
-        }
-
         DisplayHandle activeDisplay;
         m_tempDisplaysToSwapBuffers.clear();
         m_tempDisplaysToRender.clear();
@@ -501,24 +498,47 @@ namespace ramses_internal
         if(nullptr != m_windowEventsPollingManager)
             m_windowEventsPollingManager->pollWindowsTillAnyCanRender();
 
-        for (const auto& displayIt : m_displays)
+        for (auto& displayIt : m_displays)
         {
+            DisplayInfo& displayInfo = displayIt.second;
+            if (displayInfo.renderThread)
+            {
+                // display still rendering or presenting its previous frame on its render thread is skipped, it renders at its own pace
+                if (!displayInfo.renderThread->isIdle())
+                    continue;
+                applyRenderedFrameResults(displayIt.first, displayInfo);
+                applyPresentedFrameResults(displayIt.first, displayInfo);
+            }
+
+            if (!m_skipUnmodifiedBuffers)
+                MarkAllBuffersToBeRerendered(displayInfo);
+
             handleDisplayEvents(displayIt.first);
-            if (displayIt.second.couldRenderLastFrame)
+            if (displayInfo.couldRenderLastFrame)
                 m_tempDisplaysToRender.push_back(displayIt.first);
         }
         m_profilerStatistics.endRegion(FrameProfilerStatistics::ERegion::HandleDisplayEvents);
 
+        if (m_renderThreadPerDisplay)
+        {
+            startDisplayFramesOnRenderThreads();
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop end");
+            return;
+        }
+
         m_profilerStatistics.startRegion(FrameProfilerStatistics::ERegion::DrawScenes);
         // FRAMEBUFFER AND OFFSCREEN BUFFERS
         for (auto displayHandle : m_tempDisplaysToRender)
         {
+            DisplayInfo& displayInfo = m_displays.find(displayHandle)->second;
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to offscreen buffers on display " << displayHandle.asMemoryHandle());
-            renderToOffscreenBuffers(displayHandle, activeDisplay);
+            renderToOffscreenBuffers(displayHandle, displayInfo, activeDisplay);
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to offscreen buffers on display " << displayHandle.asMemoryHandle());
 
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to backbuffer on display " << displayHandle.asMemoryHandle());
-            renderToFramebuffer(displayHandle, activeDisplay);
+            renderToFramebuffer(displayHandle, displayInfo, activeDisplay, m_profilerStatistics);
+            if (displayInfo.renderedFrameResults.framebufferRendered)
+                m_tempDisplaysToSwapBuffers.push_back(displayHandle);
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to backbuffer on display " << displayHandle.asMemoryHandle());
         }
 
@@ -531,13 +551,16 @@ namespace ramses_internal
             if (!m_rendererInterruptState.isInterrupted() || m_rendererInterruptState.isInterrupted(displayHandle))
             {
                 Bool interrupted = false;
-                renderToInterruptibleOffscreenBuffers(displayHandle, activeDisplay, interrupted);
+                renderToInterruptibleOffscreenBuffers(displayHandle, m_displays.find(displayHandle)->second, activeDisplay, m_frameTimer, m_rendererInterruptState, interrupted);
                 if (interrupted)
                     break;
             }
 
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop finished frame to interruptible offscreen buffers on display " << displayHandle.asMemoryHandle());
         }
+
+        for (auto displayHandle : m_tempDisplaysToRender)
+            applyRenderedFrameResults(displayHandle, m_displays.find(displayHandle)->second);
         m_profilerStatistics.endRegion(FrameProfilerStatistics::ERegion::DrawScenes);
 
         // SWAP BUFFERS
@@ -557,11 +580,114 @@ namespace ramses_internal
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop end");
     }
 
-    void Renderer::onSceneWasRendered(const RendererCachedScene& scene)
+    void Renderer::startDisplayFramesOnRenderThreads()
+    {
+        // rendering of a display is not waited for here, scenes and setup of a display are modified by the updating thread
+        // only when its render thread is not reading them (see waitForDisplayRendering)
+        for (auto displayHandle : m_tempDisplaysToRender)
+        {
+            auto& displayInfo = m_displays.find(displayHandle)->second;
+
+            // hand over state that is modified by updating thread while render thread renders
+            displayInfo.renderedFrameResults.interruptState = displayInfo.interruptState;
+            displayInfo.frameTimer = m_frameTimer;
+            if (displayInfo.frameProfileRenderer->isEnabled())
+                *displayInfo.profilerStatistics = m_profilerStatistics;
+
+            // a context can be current on one thread only, release it in case it was enabled here to upload resources
+            displayInfo.displayController->disableContext();
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::startDisplayFramesOnRenderThreads start frame on display " << displayHandle.asMemoryHandle());
+            displayInfo.renderThread->startFrame();
+        }
+    }
+
+    void Renderer::renderDisplayOnRenderThread(DisplayHandle displayHandle, DisplayInfo& displayInfo)
+    {
+        IDevice& device = displayInfo.displayController->getRenderBackend().getDevice();
+        device.resetDrawCallCount();
+
+        DisplayHandle activeDisplay;
+        renderToOffscreenBuffers(displayHandle, displayInfo, activeDisplay);
+        renderToFramebuffer(displayHandle, displayInfo, activeDisplay, *displayInfo.profilerStatistics);
+        Bool interrupted = false;
+        renderToInterruptibleOffscreenBuffers(displayHandle, displayInfo, activeDisplay, displayInfo.frameTimer, displayInfo.renderedFrameResults.interruptState, interrupted);
+
+        displayInfo.renderedFrameResults.drawCallCount = device.getDrawCallCount();
+        displayInfo.contextEnabledOnRenderThread = activeDisplay.isValid();
+        LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderDisplayOnRenderThread finished rendering on display " << displayHandle.asMemoryHandle());
+    }
+
+    void Renderer::presentDisplayOnRenderThread(DisplayHandle displayHandle, DisplayInfo& displayInfo)
+    {
+        IDisplayController& displayController = *displayInfo.displayController;
+
+        if (displayInfo.renderedFrameResults.framebufferRendered)
+        {
+            displayController.swapBuffers();
+            ++displayInfo.presentedFrameCount;
+            displayInfo.embeddedCompositingClientsToNotify = true;
+            LOG_TRACE(CONTEXT_PROFILING, "Renderer::presentDisplayOnRenderThread swapBuffers on display " << displayHandle.asMemoryHandle());
+        }
+
+        if (displayInfo.contextEnabledOnRenderThread)
+            displayController.disableContext();
+    }
+
+    void Renderer::applyPresentedFrameResults(DisplayHandle display, DisplayInfo& displayInfo)
+    {
+        for (UInt32 i = 0u; i < displayInfo.presentedFrameCount; ++i)
+            m_statistics.framebufferSwapped(display);
+        displayInfo.presentedFrameCount = 0u;
+
+        // embedded compositor is used from updating thread only, clients are notified here instead of on render thread
+        if (displayInfo.embeddedCompositingClientsToNotify)
+        {
+            displayInfo.displayController->getEmbeddedCompositingManager().notifyClients();
+            displayInfo.embeddedCompositingClientsToNotify = false;
+        }
+    }
+
+    void Renderer::OnSceneWasRendered(DisplayInfo& displayInfo, const RendererCachedScene& scene)
     {
         scene.markAllRenderOncePassesAsRendered();
-        m_expirationMonitor.onRendered(scene.getSceneId());
-        m_statistics.sceneRendered(scene.getSceneId());
+        const auto renderingStatistics = scene.collectRenderingStatistics();
+        displayInfo.renderedFrameResults.renderedScenes.push_back({ scene.getSceneId(), renderingStatistics.numCulled, renderingStatistics.numRendered, renderingStatistics.numMergedDrawCalls });
+    }
+
+    void Renderer::applyRenderedFrameResults(DisplayHandle display, DisplayInfo& displayInfo)
+    {
+        auto& results = displayInfo.renderedFrameResults;
+
+        for (const auto& scene : results.renderedScenes)
+        {
+            m_expirationMonitor.onRendered(scene.sceneId);
+            m_statistics.sceneRendered(scene.sceneId);
+            m_statistics.trackRenderablesCulling(scene.sceneId, scene.numCulled, scene.numRendered);
+            m_statistics.trackMergedDrawCalls(scene.sceneId, scene.numMergedDrawCalls);
+        }
+        for (const auto& buffer : results.swappedOffscreenBuffers)
+            m_statistics.offscreenBufferSwapped(display, buffer.first, buffer.second);
+        for (const auto buffer : results.interruptedOffscreenBuffers)
+            m_statistics.offscreenBufferInterrupted(display, buffer);
+        m_processedScreenshots.insert(m_processedScreenshots.end(), std::make_move_iterator(results.processedScreenshots.begin()), std::make_move_iterator(results.processedScreenshots.end()));
+
+        results.renderedScenes.clear();
+        results.swappedOffscreenBuffers.clear();
+        results.interruptedOffscreenBuffers.clear();
+        results.processedScreenshots.clear();
+
+        if (displayInfo.renderThread)
+        {
+            displayInfo.interruptState = results.interruptState;
+            displayInfo.lastFrameDrawCallCount = results.drawCallCount;
+        }
+    }
+
+    void Renderer::MarkAllBuffersToBeRerendered(DisplayInfo& displayInfo)
+    {
+        auto& displayBufferSetup = displayInfo.buffersSetup;
+        for (const auto& buffer : displayBufferSetup.getDisplayBuffers())
+            displayBufferSetup.setDisplayBufferToBeRerendered(buffer.first, true);
     }
 
     void Renderer::ActivateDisplayContext(DisplayHandle displayToActivate, DisplayHandle& activeDisplay, IDisplayController& dispController)
@@ -585,6 +711,7 @@ namespace ramses_internal
         assert(m_displays.find(displayHandle) != m_displays.cend());
         assert(m_rendererScenes.hasScene(sceneId));
 
+        waitForDisplayRendering(displayHandle);
         auto& displayInfo = m_displays.find(displayHandle)->second;
         DisplayHandle currentDisplaySceneIsAssignedTo;
         getBufferSceneIsAssignedTo(sceneId, &currentDisplaySceneIsAssignedTo);
@@ -597,6 +724,7 @@ namespace ramses_internal
         assert(m_rendererScenes.hasScene(sceneId));
         const DisplayHandle displayHandle = getDisplaySceneIsAssignedTo(sceneId);
         assert(displayHandle.isValid());
+        waitForDisplayRendering(displayHandle);
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.unassignScene(sceneId);
     }
@@ -608,6 +736,7 @@ namespace ramses_internal
         const auto displayBuffer = getBufferSceneIsAssignedTo(sceneId, &displayHandle);
         assert(displayBuffer.isValid());
         UNUSED(displayBuffer);
+        waitForDisplayRendering(displayHandle);
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setSceneShown(sceneId, show);
     }
@@ -618,6 +747,7 @@ namespace ramses_internal
         const auto displayBuffer = getBufferSceneIsAssignedTo(sceneId, &displayHandle);
         assert(displayHandle.isValid());
         assert(displayBuffer.isValid());
+        waitForDisplayRendering(displayHandle);
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
     }
@@ -627,6 +757,50 @@ namespace ramses_internal
         m_skipUnmodifiedBuffers = enable;
     }
 
+    void Renderer::setRenderThreadPerDisplay(Bool enable)
+    {
+        assert(m_displays.empty());
+        m_renderThreadPerDisplay = enable;
+    }
+
+    Bool Renderer::hasRenderThreadPerDisplay() const
+    {
+        return m_renderThreadPerDisplay;
+    }
+
+    void Renderer::waitForDisplayRenderThread(DisplayHandle display)
+    {
+        const auto displayIt = m_displays.find(display);
+        if (displayIt != m_displays.end() && displayIt->second.renderThread)
+        {
+            displayIt->second.renderThread->waitUntilIdle();
+            applyRenderedFrameResults(display, displayIt->second);
+            applyPresentedFrameResults(display, displayIt->second);
+        }
+    }
+
+    void Renderer::waitForDisplayRendering(DisplayHandle display) const
+    {
+        const auto displayIt = m_displays.find(display);
+        if (displayIt != m_displays.cend() && displayIt->second.renderThread)
+            displayIt->second.renderThread->waitUntilRendered();
+    }
+
+    void Renderer::waitForAllDisplaysRendering() const
+    {
+        for (const auto& displayIt : m_displays)
+        {
+            if (displayIt.second.renderThread)
+                displayIt.second.renderThread->waitUntilRendered();
+        }
+    }
+
+    Bool Renderer::isDisplayBeingRendered(DisplayHandle display) const
+    {
+        const auto displayIt = m_displays.find(display);
+        return displayIt != m_displays.cend() && displayIt->second.renderThread && displayIt->second.renderThread->isRendering();
+    }
+
     DisplayHandle Renderer::getDisplaySceneIsAssignedTo(SceneId sceneId) const
     {
         DisplayHandle display;
@@ -723,7 +897,7 @@ namespace ramses_internal
 
         const UInt32 postProcessorEffects = config.isWarpingEnabled() ? EPostProcessingEffect_Warping : EPostProcessingEffect_None;
         const UInt32 numSamples = (config.getAntialiasingMethod() == EAntiAliasingMethod_MultiSampling) ? config.getAntialiasingSampleCount() : 1u;
-        IDisplayController* displayController = new DisplayController(*renderBackend, numSamples, postProcessorEffects);
+        IDisplayController* displayController = new DisplayController(*renderBackend, numSamples, postProcessorEffects, config.isDrawCallBatchingEnabled());
 
         displayController->setViewPosition(config.getCameraPosition());
         displayController->setViewRotation(config.getCameraRotation());
@@ -737,6 +911,7 @@ namespace ramses_internal
     void Renderer::setClearColor(DisplayHandle displayHandle, DeviceResourceHandle bufferDeviceHandle, const Vector4& clearColor)
     {
         assert(m_displays.find(displayHandle) != m_displays.cend());
+        waitForDisplayRendering(displayHandle);
         auto& displayInfo = m_displays.find(displayHandle)->second;
         displayInfo.buffersSetup.setClearColor(bufferDeviceHandle, clearColor);
     }
@@ -744,28 +919,27 @@ namespace ramses_internal
     void Renderer::scheduleScreenshot(const ScreenshotInfo& screenshot)
     {
         assert(hasDisplayController(screenshot.display));
-        assert(m_scheduledScreenshots.contains(screenshot.display));
+        waitForDisplayRendering(screenshot.display);
 
-        m_scheduledScreenshots.get(screenshot.display)->push_back(screenshot);
+        auto& displayInfo = m_displays.find(screenshot.display)->second;
+        displayInfo.scheduledScreenshots.push_back(screenshot);
 
         // re-render all buffers that the screenshot might depend on
-        auto& displayBufferSetup = m_displays.find(screenshot.display)->second.buffersSetup;
-        for (const auto& buffer : displayBufferSetup.getDisplayBuffers())
-            displayBufferSetup.setDisplayBufferToBeRerendered(buffer.first, true);
+        MarkAllBuffersToBeRerendered(displayInfo);
     }
 
-    void Renderer::processScheduledScreenshots(DisplayHandle display, IDisplayController& controller, DisplayHandle& activeDisplay)
+    void Renderer::ProcessScheduledScreenshots(DisplayHandle display, DisplayInfo& displayInfo, DisplayHandle& activeDisplay)
     {
-        assert(m_scheduledScreenshots.contains(display));
-
-        ScreenshotInfoVector& displayScreenshots = *m_scheduledScreenshots.get(display);
+        IDisplayController& controller = *displayInfo.displayController;
+        ScreenshotInfoVector& displayScreenshots = displayInfo.scheduledScreenshots;
         if (!displayScreenshots.empty())
             ActivateDisplayContext(display, activeDisplay, controller);
 
+        ScreenshotInfoVector& processedScreenshots = displayInfo.renderedFrameResults.processedScreenshots;
         for(const auto& screenshot : displayScreenshots)
         {
-            m_processedScreenshots.push_back(screenshot);
-            ScreenshotInfo& result = m_processedScreenshots.back();
+            processedScreenshots.push_back(screenshot);
+            ScreenshotInfo& result = processedScreenshots.back();
             result.success = controller.readPixels(result.rectangle.x, result.rectangle.y, result.rectangle.width, result.rectangle.height, result.pixelData);
         }
         // processed all screenshots for this display!
@@ -780,19 +954,51 @@ namespace ramses_internal
 
     Bool Renderer::hasAnyBufferWithInterruptedRendering() const
     {
-        return m_rendererInterruptState.isInterrupted();
+        return m_rendererInterruptState.isInterrupted() || std::any_of(m_displays.cbegin(), m_displays.cend(), [](const Displays::value_type& display)
+        {
+            return display.second.interruptState.isInterrupted();
+        });
     }
 
     void Renderer::resetRenderInterruptState()
     {
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::resetRenderInterruptState");
         m_rendererInterruptState = {};
+        waitForAllDisplaysRendering();
+        for (auto& display : m_displays)
+        {
+            display.second.interruptState = {};
+            display.second.renderedFrameResults.interruptState = {};
+        }
     }
 
     FrameProfileRenderer& Renderer::getFrameProfileRenderer(DisplayHandle display)
     {
-        assert(m_frameProfileRenderer.contains(display));
-        return **m_frameProfileRenderer.get(display);
+        assert(m_displays.find(display) != m_displays.cend());
+        waitForDisplayRendering(display);
+        return *m_displays.find(display)->second.frameProfileRenderer;
+    }
+
+    void Renderer::resetDrawCallCounts()
+    {
+        for (auto& displayIt : m_displays)
+        {
+            if (!displayIt.second.renderThread)
+                displayIt.second.displayController->getRenderBackend().getDevice().resetDrawCallCount();
+        }
+    }
+
+    UInt32 Renderer::getDrawCallCount() const
+    {
+        UInt32 drawCallCount = 0u;
+        for (const auto& displayIt : m_displays)
+        {
+            if (displayIt.second.renderThread)
+                drawCallCount += displayIt.second.lastFrameDrawCallCount;
+            else
+                drawCallCount += displayIt.second.displayController->getRenderBackend().getDevice().getDrawCallCount();
+        }
+        return drawCallCount;
     }
 
     void Renderer::updateSystemCompositorController() const
@@ -11,56 +11,159 @@
 #include "FrameBufferInfo.h"
 #include "RenderingPassOrderComparator.h"
 #include <algorithm>
+#include <array>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // sort key layout: [ order (32 bits) | effect rank (12 bits) | geometry data instance (20 bits) ]
+        const UInt32 EffectSortRankBits = 12u;
+        const UInt32 GeometrySortKeyBits = 20u;
+        const UInt32 MaxEffectSortRanks = 1u << EffectSortRankBits;
+        const UInt32 InvalidGeometrySortKey = (1u << GeometrySortKeyBits) - 1u;
+        // below this size comparison sort is faster than radix sort
+        const size_t RadixSortMinEntries = 64u;
+
+        UInt64 CreateRenderableSortKey(Int32 order, UInt32 effectRank, UInt32 geometryKey)
+        {
+            // flipping sign bit maps signed order to unsigned key with same ordering
+            const UInt64 orderKey = static_cast<UInt32>(order) ^ 0x80000000u;
+            return (orderKey << (EffectSortRankBits + GeometrySortKeyBits)) | (UInt64(effectRank) << GeometrySortKeyBits) | geometryKey;
+        }
+
+        // stable LSD radix sort with 8 bit digits, digits equal for all entries are skipped
+        template <typename ENTRY>
+        void RadixSortByKey(std::vector<ENTRY>& entries, std::vector<ENTRY>& scratch)
+        {
+            const UInt32 DigitCount = sizeof(UInt64);
+            std::array<std::array<size_t, 256u>, DigitCount> histograms{};
+            for (const auto& entry : entries)
+            {
+                for (UInt32 digit = 0u; digit < DigitCount; ++digit)
+                    ++histograms[digit][(entry.key >> (digit * 8u)) & 0xFFu];
+            }
+
+            scratch.resize(entries.size());
+            for (UInt32 digit = 0u; digit < DigitCount; ++digit)
+            {
+                auto& histogram = histograms[digit];
+                const UInt32 shift = digit * 8u;
+                if (histogram[(entries.front().key >> shift) & 0xFFu] == entries.size())
+                    continue;
+
+                size_t offset = 0u;
+                for (auto& count : histogram)
+                {
+                    const size_t bucketSize = count;
+                    count = offset;
+                    offset += bucketSize;
+                }
+                for (const auto& entry : entries)
+                    scratch[histogram[(entry.key >> shift) & 0xFFu]++] = entry;
+                entries.swap(scratch);
+            }
+        }
+    }
+
     RendererCachedScene::RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
         : TextureLinkCachedScene(sceneLinksManager, sceneInfo)
         , m_renderableOrderingDirty(true)
+        , m_renderingPassesDirty(true)
+        , m_effectSortRanksDirty(true)
+        , m_effectSortRanksCount(0u)
     {
     }
 
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
     {
         TextureLinkCachedScene::setRenderableVisibility(renderableHandle, visible);
-        m_renderableOrderingDirty = true;
+        // order within groups is not affected, only passes containing the renderable have to be collected again
+        markRenderableRenderGroupsDirty(renderableHandle, false);
+    }
+
+    void RendererCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
+    {
+        TextureLinkCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        if (slot == ERenderableDataSlotType_Geometry)
+            markRenderableRenderGroupsDirty(renderableHandle, true);
+    }
+
+    DataLayoutHandle RendererCachedScene::allocateDataLayout(const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutHandle handle)
+    {
+        const DataLayoutHandle layout = TextureLinkCachedScene::allocateDataLayout(dataFields, effectHash, handle);
+        // relative order of effect ranks is kept, already sorted render groups stay valid
+        m_effectSortRanksDirty = true;
+        return layout;
+    }
+
+    void RendererCachedScene::releaseDataLayout(DataLayoutHandle layoutHandle)
+    {
+        TextureLinkCachedScene::releaseDataLayout(layoutHandle);
+        m_effectSortRanksDirty = true;
     }
 
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
+        for (const auto& renderableEntry : TextureLinkCachedScene::getRenderGroup(groupHandle).renderables)
+        {
+            if (renderableEntry.renderable.asMemoryHandle() < m_renderableRenderGroups.size())
+            {
+                auto& renderableGroups = m_renderableRenderGroups[renderableEntry.renderable.asMemoryHandle()];
+                renderableGroups.erase(std::remove(renderableGroups.begin(), renderableGroups.end(), groupHandle), renderableGroups.end());
+            }
+        }
+
         TextureLinkCachedScene::releaseRenderGroup(groupHandle);
-        m_renderableOrderingDirty = true;
+        markRenderGroupDirty(groupHandle, true);
+        markAllRenderPassesDirty();
     }
 
     void RendererCachedScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, Int32 order)
     {
         TextureLinkCachedScene::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
-        m_renderableOrderingDirty = true;
+
+        if (renderableHandle.asMemoryHandle() >= m_renderableRenderGroups.size())
+            m_renderableRenderGroups.resize(renderableHandle.asMemoryHandle() + 1u);
+        m_renderableRenderGroups[renderableHandle.asMemoryHandle()].push_back(groupHandle);
+
+        markRenderGroupDirty(groupHandle, true);
     }
 
     void RendererCachedScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
         TextureLinkCachedScene::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
-        m_renderableOrderingDirty = true;
+
+        if (renderableHandle.asMemoryHandle() < m_renderableRenderGroups.size())
+        {
+            auto& renderableGroups = m_renderableRenderGroups[renderableHandle.asMemoryHandle()];
+            const auto it = std::find(renderableGroups.begin(), renderableGroups.end(), groupHandle);
+            if (it != renderableGroups.end())
+                renderableGroups.erase(it);
+        }
+
+        // removal keeps remaining renderables sorted
+        markRenderGroupDirty(groupHandle, false);
     }
 
     void RendererCachedScene::releaseRenderPass(RenderPassHandle passHandle)
     {
         m_renderOncePassesToRender.remove(passHandle);
         TextureLinkCachedScene::releaseRenderPass(passHandle);
-        m_renderableOrderingDirty = true;
+        markRenderPassDirty(passHandle);
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::setRenderPassRenderOrder(RenderPassHandle passHandle, Int32 renderOrder)
     {
         TextureLinkCachedScene::setRenderPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     BlitPassHandle RendererCachedScene::allocateBlitPass(RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle /*= BlitPassHandle::Invalid()*/)
     {
         const BlitPassHandle blitPass = TextureLinkCachedScene::allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, passHandle);
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
 
         return blitPass;
     }
@@ -68,19 +171,19 @@ namespace ramses_internal
     void RendererCachedScene::releaseBlitPass(BlitPassHandle passHandle)
     {
         TextureLinkCachedScene::releaseBlitPass(passHandle);
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::setBlitPassRenderOrder(BlitPassHandle passHandle, Int32 renderOrder)
     {
         TextureLinkCachedScene::setBlitPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::setBlitPassEnabled(BlitPassHandle passHandle, Bool isEnabled)
     {
         TextureLinkCachedScene::setBlitPassEnabled(passHandle, isEnabled);
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::setRenderPassEnabled(RenderPassHandle passHandle, Bool isEnabled)
@@ -94,7 +197,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::setRenderPassRenderOnce(RenderPassHandle passHandle, Bool enable)
@@ -108,7 +211,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::retriggerRenderPassRenderOnce(RenderPassHandle passHandle)
@@ -117,32 +220,32 @@ namespace ramses_internal
         if (TextureLinkCachedScene::getRenderPass(passHandle).isEnabled)
         {
             m_renderOncePassesToRender.put(passHandle);
-            m_renderableOrderingDirty = true;
+            markRenderingPassesDirty();
         }
     }
 
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, Int32 order)
     {
         TextureLinkCachedScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
-        m_renderableOrderingDirty = true;
+        markRenderPassDirty(passHandle);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
         TextureLinkCachedScene::removeRenderGroupFromRenderPass(passHandle, groupHandle);
-        m_renderableOrderingDirty = true;
+        markRenderPassDirty(passHandle);
     }
 
     void RendererCachedScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, Int32 order)
     {
         TextureLinkCachedScene::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
-        m_renderableOrderingDirty = true;
+        markRenderGroupDirty(groupHandleParent, true);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         TextureLinkCachedScene::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
-        m_renderableOrderingDirty = true;
+        markRenderGroupDirty(groupHandleParent, false);
     }
 
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
@@ -164,52 +267,132 @@ namespace ramses_internal
 
     void RendererCachedScene::updatePassRenderableSorting()
     {
-        if (m_renderableOrderingDirty)
+        if (!m_renderableOrderingDirty)
+            return;
+
+        const UInt32 totalNumberOfRenderPasses = TextureLinkCachedScene::getRenderPassCount();
+        const UInt32 totalNumberOfRenderGroups = TextureLinkCachedScene::getRenderGroupCount();
+        m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+        m_renderPassNeedsUpdate.resize(totalNumberOfRenderPasses, true);
+        m_renderGroupNeedsSorting.resize(totalNumberOfRenderGroups, true);
+        m_renderGroupChanged.resize(totalNumberOfRenderGroups, true);
+
+        if (m_renderingPassesDirty)
+            updateSortedRenderingPasses();
+
+        //update renderables of render passes which changed or contain changed render groups
+        for (const auto& pass : m_sortedRenderingPasses)
         {
-            m_sortedRenderingPasses.clear();
+            if (ERenderingPassType::RenderPass == pass.getType())
+            {
+                const RenderPassHandle passHandle = pass.getRenderPassHandle();
+                if (m_renderPassNeedsUpdate[passHandle.asMemoryHandle()] || containsDirtyRenderGroup(TextureLinkCachedScene::getRenderPass(passHandle).renderGroups))
+                    updateRenderablesInPass(passHandle);
+            }
+        }
 
-            const UInt32 totalNumberOfRenderPasses = TextureLinkCachedScene::getRenderPassCount();
-            const UInt32 totalNumberOfBlitPasses = TextureLinkCachedScene::getBlitPassCount();
+        std::fill(m_renderGroupChanged.begin(), m_renderGroupChanged.end(), false);
+        m_renderableOrderingDirty = false;
+    }
 
-            //add render passes
-            m_passRenderableOrder.resize(totalNumberOfRenderPasses);
-            for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
+    void RendererCachedScene::updateSortedRenderingPasses()
+    {
+        m_sortedRenderingPasses.clear();
+
+        const UInt32 totalNumberOfRenderPasses = TextureLinkCachedScene::getRenderPassCount();
+        const UInt32 totalNumberOfBlitPasses = TextureLinkCachedScene::getBlitPassCount();
+
+        //add render passes
+        for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
+        {
+            if (shouldRenderPassBeRendered(passHandle))
+            {
+                m_sortedRenderingPasses.emplace_back(passHandle);
+            }
+            else
             {
+                // pass might not be up to date when rendered again
                 m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
-                if (shouldRenderPassBeRendered(passHandle))
-                    m_sortedRenderingPasses.emplace_back(passHandle);
+                m_renderPassNeedsUpdate[passHandle.asMemoryHandle()] = true;
             }
+        }
 
-            //add blit passes
-            for (BlitPassHandle passHandle(0); passHandle < totalNumberOfBlitPasses; ++passHandle)
+        //add blit passes
+        for (BlitPassHandle passHandle(0); passHandle < totalNumberOfBlitPasses; ++passHandle)
+        {
+            if (TextureLinkCachedScene::isBlitPassAllocated(passHandle))
             {
-                if (TextureLinkCachedScene::isBlitPassAllocated(passHandle))
+                const BlitPass& blitPass = TextureLinkCachedScene::getBlitPass(passHandle);
+                if (blitPass.isEnabled)
                 {
-                    const BlitPass& blitPass = TextureLinkCachedScene::getBlitPass(passHandle);
-                    if (blitPass.isEnabled)
-                    {
-                        assert(blitPass.sourceRenderBuffer.isValid());
-                        assert(blitPass.destinationRenderBuffer.isValid());
-                        m_sortedRenderingPasses.emplace_back(passHandle);
-                    }
+                    assert(blitPass.sourceRenderBuffer.isValid());
+                    assert(blitPass.destinationRenderBuffer.isValid());
+                    m_sortedRenderingPasses.emplace_back(passHandle);
                 }
             }
+        }
 
-            //sort
-            RenderingPassOrderComparator comparator(*this);
-            std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
+        //sort
+        RenderingPassOrderComparator comparator(*this);
+        std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
 
-            //update renderables according to sorted render passes
-            for (const auto& pass : m_sortedRenderingPasses)
-            {
-                if (ERenderingPassType::RenderPass == pass.getType())
-                    updateRenderablesInPass(pass.getRenderPassHandle());
-            }
+        m_renderingPassesDirty = false;
+    }
+
+    Bool RendererCachedScene::containsDirtyRenderGroup(const RenderGroupOrderVector& renderGroups) const
+    {
+        for (const auto& renderGroupEntry : renderGroups)
+        {
+            const RenderGroupHandle renderGroup = renderGroupEntry.renderGroup;
+            if (m_renderGroupChanged[renderGroup.asMemoryHandle()] || containsDirtyRenderGroup(TextureLinkCachedScene::getRenderGroup(renderGroup).renderGroups))
+                return true;
+        }
+
+        return false;
+    }
+
+    void RendererCachedScene::markRenderPassDirty(RenderPassHandle passHandle)
+    {
+        if (passHandle.asMemoryHandle() >= m_renderPassNeedsUpdate.size())
+            m_renderPassNeedsUpdate.resize(passHandle.asMemoryHandle() + 1u, true);
+        m_renderPassNeedsUpdate[passHandle.asMemoryHandle()] = true;
+        m_renderableOrderingDirty = true;
+    }
 
-            m_renderableOrderingDirty = false;
+    void RendererCachedScene::markRenderGroupDirty(RenderGroupHandle groupHandle, Bool needsSorting)
+    {
+        if (groupHandle.asMemoryHandle() >= m_renderGroupChanged.size())
+        {
+            m_renderGroupNeedsSorting.resize(groupHandle.asMemoryHandle() + 1u, true);
+            m_renderGroupChanged.resize(groupHandle.asMemoryHandle() + 1u, true);
+        }
+        m_renderGroupChanged[groupHandle.asMemoryHandle()] = true;
+        if (needsSorting)
+            m_renderGroupNeedsSorting[groupHandle.asMemoryHandle()] = true;
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::markRenderableRenderGroupsDirty(RenderableHandle renderableHandle, Bool needsSorting)
+    {
+        if (renderableHandle.asMemoryHandle() < m_renderableRenderGroups.size())
+        {
+            for (const auto groupHandle : m_renderableRenderGroups[renderableHandle.asMemoryHandle()])
+                markRenderGroupDirty(groupHandle, needsSorting);
         }
     }
 
+    void RendererCachedScene::markAllRenderPassesDirty()
+    {
+        std::fill(m_renderPassNeedsUpdate.begin(), m_renderPassNeedsUpdate.end(), true);
+        markRenderingPassesDirty();
+    }
+
+    void RendererCachedScene::markRenderingPassesDirty() const
+    {
+        m_renderingPassesDirty = true;
+        m_renderableOrderingDirty = true;
+    }
+
     const Matrix44f& RendererCachedScene::getRenderableWorldMatrix(RenderableHandle renderable) const
     {
         assert(renderable.asMemoryHandle() < m_renderableMatrices.size());
@@ -219,6 +402,7 @@ namespace ramses_internal
     void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
     {
         RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        orderedRenderables.clear();
 
         // we sort in-place in scene's RenderPass, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderGroupOrderVector& orderedRenderGroups = getRenderPassInternal(passHandle).renderGroups;
@@ -229,6 +413,8 @@ namespace ramses_internal
         {
             addRenderablesFromRenderGroup(orderedRenderables, renderGroup.renderGroup);
         }
+
+        m_renderPassNeedsUpdate[passHandle.asMemoryHandle()] = false;
     }
 
     static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
@@ -244,25 +430,27 @@ namespace ramses_internal
         assert(isRenderGroupAllocated(renderGroupHandle));
 
         RenderGroup& renderGroup = getRenderGroupInternal(renderGroupHandle);
-        // we sort in-place in scene's TopologyRenderGroup, although we don't have to but it might speed up sorting if topology/order changes frequently
-        RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
-        RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
+        // we sort in-place in scene's TopologyRenderGroup, sorted result is kept until content of render group changes
+        if (m_renderGroupNeedsSorting[renderGroupHandle.asMemoryHandle()])
+        {
+            sortRenderGroup(renderGroup);
+            m_renderGroupNeedsSorting[renderGroupHandle.asMemoryHandle()] = false;
+        }
 
-        RenderableComparator renderableComp(*this);
-        std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
-        std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        const RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
+        const RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
 
-        RenderableOrderVector::iterator renderablesIterator = orderedGroupRenderables.begin();
-        RenderGroupOrderVector::iterator renderGroupIterator = orderedRenderGroups.begin();
-        while (renderablesIterator != orderedGroupRenderables.end()
-            || renderGroupIterator != orderedRenderGroups.end())
+        RenderableOrderVector::const_iterator renderablesIterator = orderedGroupRenderables.cbegin();
+        RenderGroupOrderVector::const_iterator renderGroupIterator = orderedRenderGroups.cbegin();
+        while (renderablesIterator != orderedGroupRenderables.cend()
+            || renderGroupIterator != orderedRenderGroups.cend())
         {
-            if (renderGroupIterator == orderedRenderGroups.end())
+            if (renderGroupIterator == orderedRenderGroups.cend())
             {
                 AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
                 ++renderablesIterator;
             }
-            else if (renderablesIterator == orderedGroupRenderables.end())
+            else if (renderablesIterator == orderedGroupRenderables.cend())
             {
                 addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
                 ++renderGroupIterator;
@@ -283,14 +471,101 @@ namespace ramses_internal
         }
     }
 
+    void RendererCachedScene::sortRenderGroup(RenderGroup& renderGroup)
+    {
+        std::sort(renderGroup.renderGroups.begin(), renderGroup.renderGroups.end());
+
+        RenderableOrderVector& renderables = renderGroup.renderables;
+        if (renderables.size() < 2u)
+            return;
+
+        // renderables are sorted by precomputed keys which order them same way as RenderableComparator,
+        // comparator is used only if effects or geometry handles do not fit into key
+        updateEffectSortRanks();
+        Bool keysValid = m_effectSortRanksCount <= MaxEffectSortRanks;
+
+        m_sortEntries.clear();
+        for (auto it = renderables.cbegin(); keysValid && it != renderables.cend(); ++it)
+        {
+            const DataInstanceHandle geometry = TextureLinkCachedScene::getRenderable(it->renderable).dataInstances[ERenderableDataSlotType_Geometry];
+            UInt32 effectRank = 0u;
+            UInt32 geometryKey = InvalidGeometrySortKey;
+            if (geometry.isValid())
+            {
+                effectRank = m_dataLayoutEffectSortRanks[TextureLinkCachedScene::getLayoutOfDataInstance(geometry).asMemoryHandle()];
+                geometryKey = geometry.asMemoryHandle();
+                keysValid = geometryKey < InvalidGeometrySortKey;
+            }
+            m_sortEntries.push_back({ CreateRenderableSortKey(it->order, effectRank, geometryKey), *it });
+        }
+
+        if (!keysValid)
+        {
+            RenderableComparator renderableComp(*this);
+            std::sort(renderables.begin(), renderables.end(), renderableComp);
+            return;
+        }
+
+        if (m_sortEntries.size() < RadixSortMinEntries)
+            std::sort(m_sortEntries.begin(), m_sortEntries.end(), [](const RenderableSortEntry& a, const RenderableSortEntry& b) { return a.key < b.key; });
+        else
+            RadixSortByKey(m_sortEntries, m_sortEntriesScratch);
+
+        for (size_t i = 0u; i < renderables.size(); ++i)
+            renderables[i] = m_sortEntries[i].entry;
+    }
+
+    void RendererCachedScene::updateEffectSortRanks()
+    {
+        if (!m_effectSortRanksDirty)
+            return;
+
+        // invalid hash is smallest and gets rank 0, used also for renderables without geometry
+        m_sortedEffectHashes.clear();
+        m_sortedEffectHashes.push_back(ResourceContentHash::Invalid());
+        const UInt32 totalNumberOfDataLayouts = TextureLinkCachedScene::getDataLayoutCount();
+        for (DataLayoutHandle layout(0u); layout < totalNumberOfDataLayouts; ++layout)
+        {
+            if (TextureLinkCachedScene::isDataLayoutAllocated(layout))
+                m_sortedEffectHashes.push_back(TextureLinkCachedScene::getDataLayout(layout).getEffectHash());
+        }
+        std::sort(m_sortedEffectHashes.begin(), m_sortedEffectHashes.end());
+        m_sortedEffectHashes.erase(std::unique(m_sortedEffectHashes.begin(), m_sortedEffectHashes.end()), m_sortedEffectHashes.end());
+        m_effectSortRanksCount = static_cast<UInt32>(m_sortedEffectHashes.size());
+
+        m_dataLayoutEffectSortRanks.assign(totalNumberOfDataLayouts, 0u);
+        for (DataLayoutHandle layout(0u); layout < totalNumberOfDataLayouts; ++layout)
+        {
+            if (TextureLinkCachedScene::isDataLayoutAllocated(layout))
+            {
+                const auto it = std::lower_bound(m_sortedEffectHashes.cbegin(), m_sortedEffectHashes.cend(), TextureLinkCachedScene::getDataLayout(layout).getEffectHash());
+                m_dataLayoutEffectSortRanks[layout.asMemoryHandle()] = static_cast<UInt32>(it - m_sortedEffectHashes.cbegin());
+            }
+        }
+
+        m_effectSortRanksDirty = false;
+    }
+
     void RendererCachedScene::updateRenderableWorldMatrices()
     {
         m_renderableMatrices.resize(TextureLinkCachedScene::getRenderableCount());
+
+        m_renderableNodes.clear();
         for (const auto& renderables : m_passRenderableOrder)
         {
             for (const auto renderable : renderables)
             {
                 assert(renderable.isValid());
+                m_renderableNodes.push_back(getRenderable(renderable).node);
+            }
+        }
+        updateMatrixCacheBatch(ETransformationMatrixType_World, m_renderableNodes);
+
+        // all matrix caches are up to date after batch update
+        for (const auto& renderables : m_passRenderableOrder)
+        {
+            for (const auto renderable : renderables)
+            {
                 const NodeHandle node = getRenderable(renderable).node;
                 assert(node.isValid());
                 m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
@@ -344,7 +619,7 @@ namespace ramses_internal
             }
         }
 
-        m_renderableOrderingDirty = true;
+        markRenderingPassesDirty();
     }
 
     void RendererCachedScene::markAllRenderOncePassesAsRendered() const
@@ -354,7 +629,21 @@ namespace ramses_internal
             // some render once passes were rendered, remove them from list
             // and force update of cached render pass list for next update
             m_renderOncePassesToRender.clear();
-            m_renderableOrderingDirty = true;
+            markRenderingPassesDirty();
         }
     }
+
+    void RendererCachedScene::trackRenderedRenderables(UInt32 numCulled, UInt32 numRendered, UInt32 numMergedDrawCalls) const
+    {
+        m_renderingStatistics.numCulled += numCulled;
+        m_renderingStatistics.numRendered += numRendered;
+        m_renderingStatistics.numMergedDrawCalls += numMergedDrawCalls;
+    }
+
+    RendererCachedScene::RenderingStatistics RendererCachedScene::collectRenderingStatistics() const
+    {
+        const RenderingStatistics result = m_renderingStatistics;
+        m_renderingStatistics = {};
+        return result;
+    }
 }
@@ -136,6 +136,12 @@ namespace ramses_internal
         m_resources.get(hash)->vramSize = vramSize;
     }
 
+    void RendererClientResourceRegistry::setEffectSupportsDrawCallBatching(const ResourceContentHash& hash, Bool supported)
+    {
+        assert(m_resources.contains(hash));
+        m_resources.get(hash)->effectSupportsDrawCallBatching = supported;
+    }
+
     void RendererClientResourceRegistry::setResourceStatus(const ResourceContentHash& hash, EResourceStatus status, UInt64 updateFrameCounter)
     {
         assert(m_resources.contains(hash));
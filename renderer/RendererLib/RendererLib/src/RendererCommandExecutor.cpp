@@ -165,6 +165,7 @@ namespace ramses_internal
                 LOG_INFO(CONTEXT_RENDERER, " - executing " << EnumToString(commandType) << " displayId " << command.displayHandle);
                 if (m_renderer.hasDisplayController(command.displayHandle) && m_renderer.getDisplayController(command.displayHandle).isWarpingEnabled())
                 {
+                    m_renderer.waitForDisplayRenderThread(command.displayHandle);
                     m_renderer.getDisplayController(command.displayHandle).enableContext();
                     m_renderer.setWarpingMeshData(command.displayHandle, command.warpingData);
                     m_rendererEventCollector.addDisplayEvent(ERendererEventType_WarpingDataUpdated, command.displayHandle);
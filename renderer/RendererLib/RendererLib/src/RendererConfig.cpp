@@ -90,4 +90,14 @@ namespace ramses_internal
     {
         return m_renderThreadLoopTimingReportingPeriod;
     }
+
+    void RendererConfig::setRenderThreadPerDisplayEnabled(Bool enabled)
+    {
+        m_renderThreadPerDisplayEnabled = enabled;
+    }
+
+    Bool RendererConfig::getRenderThreadPerDisplayEnabled() const
+    {
+        return m_renderThreadPerDisplayEnabled;
+    }
 }
@@ -26,6 +26,10 @@
 
 namespace ramses_internal
 {
+    // prewarmed effects are not owned by any scene, reserved scene ID keeps them referenced
+    // (scene ID 0 can be used by clients and therefore cannot be used here)
+    static const SceneId PrewarmedEffectsOwner(std::numeric_limits<UInt64>::max());
+
     RendererResourceManager::RendererResourceManager(
         IResourceProvider& resourceProvider,
         IResourceUploader& uploader,
@@ -35,19 +39,22 @@ namespace ramses_internal
         Bool keepEffects,
         const FrameTimer& frameTimer,
         RendererStatistics& stats,
-        UInt64 clientResourceCacheSize)
+        UInt64 clientResourceCacheSize,
+        ITaskQueue* decompressionTaskQueue)
         : m_id(requesterId)
         , m_resourceProvider(resourceProvider)
         , m_renderBackend(renderBackend)
         , m_embeddedCompositingManager(embeddedCompositingManager)
-        , m_resourceUploadingManager(m_clientResourceRegistry, uploader, renderBackend, keepEffects, frameTimer, stats, clientResourceCacheSize)
+        , m_resourceUploadingManager(m_clientResourceRegistry, uploader, renderBackend, keepEffects, frameTimer, stats, clientResourceCacheSize, decompressionTaskQueue)
         , m_stats(stats)
+        , m_prewarmedEffectsProviderScene(PrewarmedEffectsOwner)
     {
     }
 
     RendererResourceManager::~RendererResourceManager()
     {
         assert(m_sceneResourceRegistryMap.size() == 0u);
+        unreferenceAllClientResourcesForScene(PrewarmedEffectsOwner);
 
         LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::~RendererResourceManager Destroying offscreen buffers");
         for (OffscreenBufferHandle handle(0u); handle < m_offscreenBuffers.getTotalCount(); ++handle)
@@ -69,6 +76,40 @@ namespace ramses_internal
     }
 
     void RendererResourceManager::referenceClientResourcesForScene(SceneId sceneId, const ResourceContentHashVector& resources)
+    {
+        // prewarmed effect requested via provider of another scene might not be available there,
+        // it is re-requested right away via this scene which uses it
+        ResourceContentHashVector prewarmedEffectsToRerequest;
+        for (const auto& resHash : resources)
+        {
+            if (m_clientResourceRegistry.containsResource(resHash))
+            {
+                const ResourceDescriptor& resDesc = m_clientResourceRegistry.getResourceDescriptor(resHash);
+                if (resDesc.status == EResourceStatus_Requested && resDesc.sceneUsage.size() == 1u && resDesc.sceneUsage.front() == PrewarmedEffectsOwner)
+                    prewarmedEffectsToRerequest.push_back(resHash);
+            }
+        }
+
+        addClientResourceRefs(sceneId, resources);
+
+        if (!prewarmedEffectsToRerequest.empty())
+        {
+            LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::referenceClientResourcesForScene re-requesting " << prewarmedEffectsToRerequest.size() << " prewarmed effects via scene " << sceneId);
+            m_resourceProvider.requestResourceAsyncronouslyFromFramework(prewarmedEffectsToRerequest, m_id, sceneId);
+            for (const auto& resHash : prewarmedEffectsToRerequest)
+                m_clientResourceRegistry.setResourceStatus(resHash, EResourceStatus_Requested, m_frameCounter);
+        }
+
+        // resources can only be requested via provider of a scene, prewarmed effects are still not owned by that scene
+        if (m_prewarmedEffectsProviderScene == PrewarmedEffectsOwner)
+        {
+            m_prewarmedEffectsProviderScene = sceneId;
+            addClientResourceRefs(PrewarmedEffectsOwner, m_effectsToPrewarm);
+            m_effectsToPrewarm.clear();
+        }
+    }
+
+    void RendererResourceManager::addClientResourceRefs(SceneId sceneId, const ResourceContentHashVector& resources)
     {
         for (const auto& resHash : resources)
         {
@@ -80,6 +121,20 @@ namespace ramses_internal
         }
     }
 
+    void RendererResourceManager::prewarmEffects(const ResourceContentHashVector& effects)
+    {
+        if (m_prewarmedEffectsProviderScene != PrewarmedEffectsOwner)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::prewarmEffects: requesting " << effects.size() << " effects to be uploaded ahead of use");
+            addClientResourceRefs(PrewarmedEffectsOwner, effects);
+        }
+        else
+        {
+            LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager[" << m_id << "]::prewarmEffects: " << effects.size() << " effects to be uploaded ahead of use will be requested from provider of first scene using this display");
+            m_effectsToPrewarm.insert(m_effectsToPrewarm.end(), effects.cbegin(), effects.cend());
+        }
+    }
+
     void RendererResourceManager::unreferenceClientResourcesForScene(SceneId sceneId, const ResourceContentHashVector& resources)
     {
         for (const auto& resHash : resources)
@@ -95,11 +150,21 @@ namespace ramses_internal
             const ResourceDescriptor& resDesc = m_clientResourceRegistry.getResourceDescriptor(resHash);
             for(const auto& sceneUsage : resDesc.sceneUsage)
             {
-                if (!resourcesPerScene.contains(sceneUsage))
+                SceneId providingScene = sceneUsage;
+                if (sceneUsage == PrewarmedEffectsOwner)
+                {
+                    // prewarmed effect also used by a scene is requested via that scene, otherwise via chosen provider scene
+                    // (if that is gone, request is skipped and effect re-requested later)
+                    if (resDesc.sceneUsage.size() > 1u || m_prewarmedEffectsProviderScene == PrewarmedEffectsOwner)
+                        continue;
+                    providingScene = m_prewarmedEffectsProviderScene;
+                }
+
+                if (!resourcesPerScene.contains(providingScene))
                 {
-                    resourcesPerScene.put(sceneUsage, ResourceContentHashVector());
+                    resourcesPerScene.put(providingScene, ResourceContentHashVector());
                 }
-                resourcesPerScene.get(sceneUsage)->push_back(resHash);
+                resourcesPerScene.get(providingScene)->push_back(resHash);
             }
         }
     }
@@ -147,9 +212,9 @@ namespace ramses_internal
 
                 if (newResource.getResourceObject() == nullptr)
                 {
-                    assert(false);
-                    LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::getRequestedResourcesAlreadyInCache. Failed to deserialize data from cache: #" << res);
-                    return;
+                    // resource will be requested from client as if it was not cached
+                    LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::getRequestedResourcesAlreadyInCache. Failed to get data from cache: #" << res);
+                    continue;
                 }
 
                 // Mimic the same state changes as if the resource had been requested and received over network
@@ -268,6 +333,10 @@ namespace ramses_internal
 
     void RendererResourceManager::unreferenceAllClientResourcesForScene(SceneId sceneId)
     {
+        // next scene referencing resources will provide prewarmed effects not arrived yet
+        if (sceneId == m_prewarmedEffectsProviderScene)
+            m_prewarmedEffectsProviderScene = PrewarmedEffectsOwner;
+
         for (const auto& resDesc : m_clientResourceRegistry.getAllResourceDescriptors())
         {
             if (contains_c(resDesc.value.sceneUsage, sceneId))
@@ -373,6 +442,11 @@ namespace ramses_internal
         return m_clientResourceRegistry.getResourceDescriptor(hash).deviceHandle;
     }
 
+    Bool RendererResourceManager::getClientEffectSupportsDrawCallBatching(const ResourceContentHash& effectHash) const
+    {
+        return m_clientResourceRegistry.getResourceDescriptor(effectHash).effectSupportsDrawCallBatching;
+    }
+
     DeviceResourceHandle RendererResourceManager::getRenderTargetDeviceHandle(RenderTargetHandle handle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
@@ -19,7 +19,10 @@ namespace ramses_internal
     {
         std::vector<Byte> readBuffer(resourceSize);
 
-        cache->getResourceData(resourceId, readBuffer.data(), resourceSize);
+        if (!cache->getResourceData(resourceId, readBuffer.data(), resourceSize))
+        {
+            return ManagedResource();
+        }
 
         BinaryInputStream resourceStream(readBuffer.data());
         const IResource* resourceObject = SingleResourceSerialization::DeserializeResource(resourceStream, resourceId);
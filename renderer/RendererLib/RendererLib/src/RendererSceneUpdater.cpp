@@ -10,6 +10,7 @@
 #include "Scene/SceneActionApplier.h"
 #include "Scene/SceneResourceChanges.h"
 #include "Scene/SceneResourceUtils.h"
+#include "Scene/SceneActionUtils.h"
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererAPI/IDisplayController.h"
 #include "RendererAPI/ISurface.h"
@@ -39,6 +40,17 @@
 
 namespace ramses_internal
 {
+    namespace
+    {
+        UInt GetNumberOfPendingClientFlushes(const PendingFlushes& pendingFlushes)
+        {
+            UInt numClientFlushes = 0u;
+            for (const auto& pendingFlush : pendingFlushes)
+                numClientFlushes += pendingFlush.numberOfClientFlushes;
+            return numClientFlushes;
+        }
+    }
+
     RendererSceneUpdater::RendererSceneUpdater(
         Renderer& renderer,
         RendererScenes& rendererScenes,
@@ -46,7 +58,8 @@ namespace ramses_internal
         RendererEventCollector& eventCollector,
         FrameTimer& frameTimer,
         SceneExpirationMonitor& expirationMonitor,
-        IRendererResourceCache* rendererResourceCache)
+        IRendererResourceCache* rendererResourceCache,
+        ITaskQueue* parallelProcessingQueue)
         : m_renderer(renderer)
         , m_rendererScenes(rendererScenes)
         , m_sceneStateExecutor(sceneStateExecutor)
@@ -54,7 +67,8 @@ namespace ramses_internal
         , m_frameTimer(frameTimer)
         , m_expirationMonitor(expirationMonitor)
         , m_rendererResourceCache(rendererResourceCache)
-        , m_animationSystemFactory(EAnimationSystemOwner_Renderer)
+        , m_parallelProcessingQueue(parallelProcessingQueue)
+        , m_animationSystemFactory(EAnimationSystemOwner_Renderer, nullptr, parallelProcessingQueue)
     {
     }
 
@@ -121,7 +135,9 @@ namespace ramses_internal
             IEmbeddedCompositingManager& embeddedCompositingManager = displayController.getEmbeddedCompositingManager();
 
             // ownership of uploadStrategy is transferred into RendererResourceManager
-            RendererResourceManager* resourceManager = new RendererResourceManager(resourceProvider, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(handle.asMemoryHandle()), displayConfig.getKeepEffectsUploaded(), m_frameTimer, m_renderer.getStatistics(), displayConfig.getGPUMemoryCacheSize());
+            RendererResourceManager* resourceManager = new RendererResourceManager(resourceProvider, resourceUploader, renderBackend, embeddedCompositingManager, RequesterID(handle.asMemoryHandle()), displayConfig.getKeepEffectsUploaded(), m_frameTimer, m_renderer.getStatistics(), displayConfig.getGPUMemoryCacheSize(), m_parallelProcessingQueue);
+            if (!displayConfig.getEffectsToPrewarm().empty())
+                resourceManager->prewarmEffects(displayConfig.getEffectsToPrewarm());
             m_displayResourceManagers.put(handle, resourceManager);
             m_rendererEventCollector.addDisplayEvent(ERendererEventType_DisplayCreated, handle);
 
@@ -265,12 +281,21 @@ namespace ramses_internal
             updateScenesDataLinks();
         }
 
+        SceneIdVector scenesToRerenderLater;
         for (const auto scene : m_modifiedScenesToRerender)
         {
             if (m_sceneStateExecutor.getSceneState(scene) == ESceneState::Rendered)
-                m_renderer.markBufferWithSceneAsModified(scene);
+            {
+                // display still renders its previous frame, buffer is marked once the render thread is done with it
+                if (isSceneBeingRendered(scene))
+                    scenesToRerenderLater.push_back(scene);
+                else
+                    m_renderer.markBufferWithSceneAsModified(scene);
+            }
         }
         m_modifiedScenesToRerender.clear();
+        for (const auto scene : scenesToRerenderLater)
+            m_modifiedScenesToRerender.put(scene);
     }
 
     void RendererSceneUpdater::consolidatePendingSceneActions()
@@ -287,14 +312,15 @@ namespace ramses_internal
                 }
                 pendingActionCollectionsForScene.second.clear();
 
-                if (m_rendererScenes.getStagingInfo(sceneId).pendingFlushes.size() > m_maximumPendingFlushesToKillScene)
+                // merged pending flushes still count as all the client flushes they hold
+                if (GetNumberOfPendingClientFlushes(m_rendererScenes.getStagingInfo(sceneId).pendingFlushes) > m_maximumPendingFlushesToKillScene)
                     scenesWithTooManyFlushes.push_back(sceneId);
             }
         }
 
         for (const auto sceneId : scenesWithTooManyFlushes)
         {
-            const auto numPendingFlushes = m_rendererScenes.getStagingInfo(sceneId).pendingFlushes.size();
+            const auto numPendingFlushes = GetNumberOfPendingClientFlushes(m_rendererScenes.getStagingInfo(sceneId).pendingFlushes);
 
             LOG_ERROR(CONTEXT_RENDERER, "Scene " << sceneId.getValue() << " has " << numPendingFlushes << " pending flushes,"
                 << " force applying pending flushes seems to have been interrupted too often and the renderer has no way to catch up without potentially blocking other scenes."
@@ -381,6 +407,44 @@ namespace ramses_internal
         // ownership is taken over (swapped) here, the assumption is that it is throw-away data
         // for caller anyway
         flushInfo.sceneActions.swap(actionsForScene);
+
+        mergeLastPendingFlushWithPrevious(sceneID, pendingFlushes);
+    }
+
+    void RendererSceneUpdater::mergeLastPendingFlushWithPrevious(SceneId sceneID, PendingFlushes& pendingFlushes) const
+    {
+        // previous flush with version tag must be kept separate to report it applied
+        if (pendingFlushes.size() < 2u || pendingFlushes[pendingFlushes.size() - 2u].versionTag.isValid())
+            return;
+
+        PendingFlush& lastFlush = pendingFlushes.back();
+        PendingFlush& previousFlush = pendingFlushes[pendingFlushes.size() - 2u];
+
+        // pending flushes are always applied all at once, so intermediate states of setters overwritten
+        // by later flush are never observable and can be dropped.
+        // Only appended actions are checked, setters of flushes merged before stay indexed in the tracker.
+        // Overwritten actions are removed once they make up half of the collection, so merging stays linear in number of actions
+        previousFlush.sceneActions.append(lastFlush.sceneActions);
+        OverwrittenSetterActionsTracker& overwrittenSetterActions = previousFlush.overwrittenSetterActions;
+        const UInt32 numOverwrittenActions = overwrittenSetterActions.update(previousFlush.sceneActions);
+        if (2u * overwrittenSetterActions.getNumberOfOverwrittenActions() > previousFlush.sceneActions.numberOfActions())
+            overwrittenSetterActions.removeOverwrittenActions(previousFlush.sceneActions);
+        LOG_TRACE(CONTEXT_RENDERER, "Flush " << lastFlush.flushIndex << " for scene " << sceneID.getValue() << " merged with previous pending flush "
+            << previousFlush.flushIndex << ", " << numOverwrittenActions << " scene actions overwritten");
+
+        previousFlush.flushIndex = lastFlush.flushIndex;
+        previousFlush.timeInfo = lastFlush.timeInfo;
+        previousFlush.versionTag = lastFlush.versionTag;
+        previousFlush.numberOfClientFlushes += lastFlush.numberOfClientFlushes;
+
+        // resource lists are already consolidated with all previous pending flushes
+        previousFlush.clientResourcesNeeded.swap(lastFlush.clientResourcesNeeded);
+        previousFlush.clientResourcesUnneeded.swap(lastFlush.clientResourcesUnneeded);
+        previousFlush.clientResourcesPendingUnneeded.swap(lastFlush.clientResourcesPendingUnneeded);
+        previousFlush.sceneResourceActions.swap(lastFlush.sceneResourceActions);
+        previousFlush.sceneReferenceActions.insert(previousFlush.sceneReferenceActions.end(), lastFlush.sceneReferenceActions.cbegin(), lastFlush.sceneReferenceActions.cend());
+
+        pendingFlushes.pop_back();
     }
 
     void RendererSceneUpdater::consolidateResourceChanges(PendingFlush& flushInfo, const PendingFlushes& pendingFlushes, const SceneResourceChanges& resourceChanges, ResourceContentHashVector& newlyNeededClientResources) const
@@ -490,13 +554,20 @@ namespace ramses_internal
         if (sceneIsRenderedOrRequested && m_renderer.hasAnyBufferWithInterruptedRendering())
             canApplyFlushes &= !m_renderer.isSceneAssignedToInterruptibleOffscreenBuffer(sceneID);
 
-        if (!canApplyFlushes && sceneIsMapped && pendingFlushes.size() > m_maximumPendingFlushes)
+        // flushes stay pending while the scene is rendered on its display's render thread, other displays are not waited for
+        const Bool sceneIsBeingRendered = isSceneBeingRendered(sceneID);
+        canApplyFlushes &= !sceneIsBeingRendered;
+
+        const UInt numPendingClientFlushes = GetNumberOfPendingClientFlushes(pendingFlushes);
+        if (!canApplyFlushes && sceneIsMapped && numPendingClientFlushes > m_maximumPendingFlushes)
         {
-            LOG_ERROR(CONTEXT_RENDERER, "Force applying pending flushes! Scene " << sceneID.getValue() << " has " << pendingFlushes.size() << " pending flushes, renderer cannot catch up with resource updates.");
+            LOG_ERROR(CONTEXT_RENDERER, "Force applying pending flushes! Scene " << sceneID.getValue() << " has " << numPendingClientFlushes << " pending flushes, renderer cannot catch up with resource updates.");
             logMissingResources(pendingFlushes.back().clientResourcesNeeded, sceneID);
 
             canApplyFlushes = true;
             m_renderer.resetRenderInterruptState();
+            if (sceneIsBeingRendered)
+                waitForSceneRendering(sceneID);
         }
 
         if (canApplyFlushes)
@@ -520,6 +591,7 @@ namespace ramses_internal
         UInt numActionsApplied = 0u;
         for (auto& pendingFlush : pendingFlushes)
         {
+            pendingFlush.overwrittenSetterActions.removeOverwrittenActions(pendingFlush.sceneActions);
             applySceneActions(rendererScene, pendingFlush);
 
             numActionsApplied += pendingFlush.sceneActions.numberOfActions();
@@ -538,7 +610,8 @@ namespace ramses_internal
             }
 
             m_expirationMonitor.onFlushApplied(sceneID, pendingFlush.timeInfo.expirationTimestamp, pendingFlush.versionTag, pendingFlush.flushIndex);
-            m_renderer.getStatistics().flushApplied(sceneID);
+            for (UInt32 i = 0u; i < pendingFlush.numberOfClientFlushes; ++i)
+                m_renderer.getStatistics().flushApplied(sceneID);
 
             // mark scene as modified only if it received scene actions other than those below
             static const std::vector<ESceneActionId> SceneActionsIgnoredForMarkingAsModified = { ESceneActionId_Flush, ESceneActionId_SetAckFlushState };
@@ -632,6 +705,7 @@ namespace ramses_internal
                 {
                     const SceneId sceneId = updatedStreamTexture.key;
                     const RendererCachedScene& rendererScene = m_rendererScenes.getScene(sceneId);
+                    waitForSceneRendering(sceneId);
 
                     const StreamTextureHandleVector& streamTexturesPerScene = updatedStreamTexture.value;
                     for(const auto& streamTexture : streamTexturesPerScene)
@@ -651,8 +725,9 @@ namespace ramses_internal
         for (const auto sceneIt : m_rendererScenes)
         {
             const SceneId sceneId = sceneIt.key;
-            // update resource cache only if scene is actually rendered
-            if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered)
+            // update resource cache only if scene is actually rendered,
+            // scene being rendered on its display's render thread is updated in one of next loops
+            if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered && !isSceneBeingRendered(sceneId))
             {
                 const DisplayHandle displayHandle = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
                 assert(displayHandle.isValid());
@@ -713,9 +788,10 @@ namespace ramses_internal
                     }
                 }
 
-                if (!canBeMapped && stagingInfo.pendingFlushes.size() > m_maximumPendingFlushes)
+                const UInt numPendingClientFlushes = GetNumberOfPendingClientFlushes(stagingInfo.pendingFlushes);
+                if (!canBeMapped && numPendingClientFlushes > m_maximumPendingFlushes)
                 {
-                    LOG_ERROR(CONTEXT_RENDERER, "Force mapping scene " << sceneId.getValue() << " due to " << stagingInfo.pendingFlushes.size() << " pending flushes, renderer cannot catch up with resource updates.");
+                    LOG_ERROR(CONTEXT_RENDERER, "Force mapping scene " << sceneId.getValue() << " due to " << numPendingClientFlushes << " pending flushes, renderer cannot catch up with resource updates.");
                     logMissingResources(stagingInfo.clientResourcesInUse, sceneId);
 
                     canBeMapped = true;
@@ -748,7 +824,7 @@ namespace ramses_internal
             if (!pendingFlushes.empty())
             {
                 LOG_ERROR(CONTEXT_RENDERER, "Scene " << sceneId.getValue() << " - expected no pending flushes at this point");
-                assert(pendingFlushes.size() > m_maximumPendingFlushes);
+                assert(GetNumberOfPendingClientFlushes(pendingFlushes) > m_maximumPendingFlushes);
             }
         }
 
@@ -834,6 +910,8 @@ namespace ramses_internal
         case ESceneState::MapRequested:
         case ESceneState::Subscribed:
         case ESceneState::SubscriptionPending:
+            // render threads look up their scenes
+            m_renderer.waitForAllDisplaysRendering();
             m_rendererScenes.destroyScene(sceneID);
             m_renderer.getStatistics().untrackScene(sceneID);
             RFALLTHROUGH;
@@ -1015,6 +1093,8 @@ namespace ramses_internal
     {
         if (m_sceneStateExecutor.checkIfCanBeSubscriptionPending(sceneInfo.sceneID))
         {
+            // render threads look up their scenes
+            m_renderer.waitForAllDisplaysRendering();
             m_rendererScenes.createScene(sceneInfo);
             m_sceneStateExecutor.setSubscriptionPending(sceneInfo.sceneID);
         }
@@ -1168,6 +1248,7 @@ namespace ramses_internal
             }
         }
 
+        waitForSceneRendering(consumerSceneId);
         m_rendererScenes.getSceneLinksManager().createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
         m_renderer.resetRenderInterruptState();
@@ -1191,6 +1272,7 @@ namespace ramses_internal
             return;
         }
 
+        waitForSceneRendering(consumerSceneId);
         m_rendererScenes.getSceneLinksManager().createBufferLink(buffer, consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
         m_renderer.resetRenderInterruptState();
@@ -1198,6 +1280,7 @@ namespace ramses_internal
 
     void RendererSceneUpdater::handleDataUnlinkRequest(SceneId consumerSceneId, DataSlotId consumerId)
     {
+        waitForSceneRendering(consumerSceneId);
         m_rendererScenes.getSceneLinksManager().removeDataLink(consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
         m_renderer.resetRenderInterruptState();
@@ -1279,7 +1362,7 @@ namespace ramses_internal
         for (const auto& scene : m_rendererScenes)
         {
             const SceneId sceneID = scene.key;
-            if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered)
+            if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered && !isSceneBeingRendered(sceneID))
             {
                 RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneID);
                 for (auto handle = AnimationSystemHandle(0); handle < renderScene.getAnimationSystemCount(); ++handle)
@@ -1317,6 +1400,9 @@ namespace ramses_internal
         {
             if (m_scenesNeedingTransformationCacheUpdate.contains(sceneId))
             {
+                // updating a consumer also updates transformation caches of its providers which can be assigned to any display
+                if (m_renderer.hasRenderThreadPerDisplay())
+                    m_renderer.waitForAllDisplaysRendering();
                 RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
                 renderScene.updateRenderableWorldMatricesWithLinks();
                 m_scenesNeedingTransformationCacheUpdate.remove(sceneId);
@@ -1326,6 +1412,8 @@ namespace ramses_internal
         // update rest of scenes that have no dependencies
         for(const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
         {
+            if (isSceneBeingRendered(sceneId))
+                continue;
             RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
             renderScene.updateRenderableWorldMatrices();
         }
@@ -1350,7 +1438,7 @@ namespace ramses_internal
             const SceneId sceneID = rendererScene.key;
             if (dataRefLinkManager.getDependencyChecker().hasDependencyAsConsumer(sceneID))
             {
-                if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered)
+                if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered && !isSceneBeingRendered(sceneID))
                 {
                     DataReferenceLinkCachedScene& scene = m_rendererScenes.getScene(sceneID);
                     dataRefLinkManager.resolveLinksForConsumerScene(scene);
@@ -1459,8 +1547,26 @@ namespace ramses_internal
     {
         if (activeDisplay != displayToActivate)
         {
+            m_renderer.waitForDisplayRenderThread(displayToActivate);
             m_renderer.getDisplayController(displayToActivate).getRenderBackend().getSurface().enable();
             activeDisplay = displayToActivate;
         }
     }
+
+    Bool RendererSceneUpdater::isSceneBeingRendered(SceneId sceneId) const
+    {
+        if (!m_renderer.hasRenderThreadPerDisplay())
+            return false;
+        const DisplayHandle display = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
+        return display.isValid() && m_renderer.isDisplayBeingRendered(display);
+    }
+
+    void RendererSceneUpdater::waitForSceneRendering(SceneId sceneId) const
+    {
+        if (!m_renderer.hasRenderThreadPerDisplay())
+            return;
+        const DisplayHandle display = m_renderer.getDisplaySceneIsAssignedTo(sceneId);
+        if (display.isValid())
+            m_renderer.waitForDisplayRendering(display);
+    }
 }
@@ -31,6 +31,18 @@ namespace ramses_internal
         m_sceneStatistics[sceneId].numRendered++;
     }
 
+    void RendererStatistics::trackRenderablesCulling(SceneId sceneId, UInt numCulled, UInt numRendered)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numRenderablesCulled += numCulled;
+        sceneStats.numRenderablesRendered += numRendered;
+    }
+
+    void RendererStatistics::trackMergedDrawCalls(SceneId sceneId, UInt numMerged)
+    {
+        m_sceneStatistics[sceneId].numMergedDrawCalls += numMerged;
+    }
+
     void RendererStatistics::offscreenBufferSwapped(DisplayHandle displayHandle, DeviceResourceHandle offscreenBuffer, bool isInterruptible)
     {
         auto& obStat = m_displayStatistics[displayHandle].offscreenBufferStatistics[offscreenBuffer];
@@ -50,10 +62,11 @@ namespace ramses_internal
         m_displayStatistics[display].numFrameBufferSwapped++;
     }
 
-    void RendererStatistics::clientResourceUploaded(UInt byteSize)
+    void RendererStatistics::clientResourceUploaded(UInt byteSize, std::chrono::microseconds uploadTime)
     {
         m_clientResourcesUploaded++;
         m_clientResourcesBytesUploaded += byteSize;
+        m_clientResourceUploadTimes.record(uploadTime.count());
     }
 
     void RendererStatistics::sceneResourceUploaded(SceneId sceneId, UInt byteSize)
@@ -79,6 +92,7 @@ namespace ramses_internal
     {
         m_shadersCompiled++;
         m_microsecondsForShaderCompilation += microsecondsUsed.count();
+        m_shaderCompileTimes.record(microsecondsUsed.count());
         if (microsecondsUsed > m_maximumDurationShaderTime)
         {
             m_maximumDurationShaderTime = microsecondsUsed;
@@ -102,6 +116,7 @@ namespace ramses_internal
         sceneStats.numClientResourcesRemovedPerFlush.update(numRemovedClientResources);
         sceneStats.numSceneResourceActionsPerFlush.update(numSceneResourceActions);
         sceneStats.flushLatency.update(static_cast<int64_t>(latency.count()));
+        sceneStats.flushLatencyHistogram.record(std::max<int64_t>(latency.count(), 0));
     }
 
     void RendererStatistics::flushApplied(SceneId sceneId)
@@ -153,6 +168,9 @@ namespace ramses_internal
             m_frameDurationMin = frameDuration;
         else if (frameDuration > m_frameDurationMax)
             m_frameDurationMax = frameDuration;
+        // very first frame has no previous frame to measure its duration from
+        if (m_lastFrameTick != 0u)
+            m_frameDurations.record(frameDuration);
 
         // update 'gap' measurements - max number of consecutive frames with some action happening or not
         for (auto& sceneStat : m_sceneStatistics)
@@ -180,10 +198,13 @@ namespace ramses_internal
         m_drawCalls = 0u;
         m_frameDurationMin = std::numeric_limits<UInt32>::max();
         m_frameDurationMax = 0u;
+        m_frameDurations.reset();
         m_clientResourcesUploaded = 0u;
         m_clientResourcesBytesUploaded = 0u;
+        m_clientResourceUploadTimes.reset();
         m_shadersCompiled = 0u;
         m_microsecondsForShaderCompilation = 0u;
+        m_shaderCompileTimes.reset();
         m_maximumDurationShaderName = "";
         m_maximumDurationShaderTime = std::chrono::microseconds(0u);
         m_maximumDurationShaderScene = SceneId::Invalid();
@@ -206,9 +227,13 @@ namespace ramses_internal
             sceneStat.numClientResourcesRemovedPerFlush.reset();
             sceneStat.numSceneResourceActionsPerFlush.reset();
             sceneStat.flushLatency.reset();
+            sceneStat.flushLatencyHistogram.reset();
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numRenderablesCulled = 0u;
+            sceneStat.numRenderablesRendered = 0u;
+            sceneStat.numMergedDrawCalls = 0u;
         }
 
         for (auto& dispStat : m_displayStatistics)
@@ -241,12 +266,26 @@ namespace ramses_internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawcallsPerFrame " << getDrawCallsPerFrame() <<
             ", numFrames " << m_frameNumber;
+        if (m_frameDurations.getCount() > 0u)
+        {
+            str << ", frameTime(p50/p95/p99/max) ";
+            m_frameDurations.writePercentilesToStream(str);
+            str << "us";
+        }
         if (m_clientResourcesUploaded > 0u)
+        {
             str << ", clientResUploaded " << m_clientResourcesUploaded << " (" << m_clientResourcesBytesUploaded << " B)";
+            str << ", uploadTime(p50/p95/p99/max) ";
+            m_clientResourceUploadTimes.writePercentilesToStream(str);
+            str << "us";
+        }
         if (m_shadersCompiled > 0u)
         {
             str << ", shadersCompiled " << m_shadersCompiled << " for total ms:" << m_microsecondsForShaderCompilation / 1000;
             str << ", avg microsec " << m_microsecondsForShaderCompilation / m_shadersCompiled;
+            str << ", compileTime(p50/p95/p99/max) ";
+            m_shaderCompileTimes.writePercentilesToStream(str);
+            str << "us";
             str << "; longest: " << m_maximumDurationShaderName << " from scene:" << m_maximumDurationShaderScene << " ms:" << m_maximumDurationShaderTime.count() / 1000;
         }
         str << "\n";
@@ -285,12 +324,19 @@ namespace ramses_internal
             {
                 str << ", actions/F (" << numSceneActionsPerFlush.minValue << "/" << numSceneActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneActionsPerFlush.sum) / sceneStats.numFlushesArrived << ")";
                 str << ", dt/F (" << flushLatency.minValue << "/" << flushLatency.maxValue << "/" << static_cast<float>(flushLatency.sum) / sceneStats.numFlushesArrived << ")";
+                str << ", dt/F(p50/p95/p99/max) (";
+                sceneStats.flushLatencyHistogram.writePercentilesToStream(str);
+                str << ")";
                 str << ", RC+/F (" << numClientResourcesAddedPerFlush.minValue << "/" << numClientResourcesAddedPerFlush.maxValue << "/" << static_cast<float>(numClientResourcesAddedPerFlush.sum) / sceneStats.numFlushesArrived << ")";
                 str << ", RC-/F (" << numClientResourcesRemovedPerFlush.minValue << "/" << numClientResourcesRemovedPerFlush.maxValue << "/" << static_cast<float>(numClientResourcesRemovedPerFlush.sum) / sceneStats.numFlushesArrived << ")";
                 str << ", RS/F (" << numSceneResourceActionsPerFlush.minValue << "/" << numSceneResourceActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneResourceActionsPerFlush.sum) / sceneStats.numFlushesArrived << ")";
             }
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.numRenderablesCulled > 0u)
+                str << ", renderablesCulled " << sceneStats.numRenderablesCulled << "/" << sceneStats.numRenderablesCulled + sceneStats.numRenderablesRendered;
+            if (sceneStats.numMergedDrawCalls > 0u)
+                str << ", drawCallsMerged " << sceneStats.numMergedDrawCalls;
             str << "\n";
         }
 
@@ -38,6 +38,7 @@ namespace ramses_internal
         resizeContainerIfSmaller(m_dataInstancesDirty, sizeInfo.datainstanceCount);
         resizeContainerIfSmaller(m_textureSamplersDirty, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_effectDeviceHandleCache, sizeInfo.renderableCount);
+        resizeContainerIfSmaller(m_effectSupportsDrawCallBatchingCache, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForVertexAttributes, sizeInfo.datainstanceCount);
         resizeContainerIfSmaller(m_deviceHandleCacheForTextures, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_renderTargetCache, sizeInfo.renderTargetCount);
@@ -51,6 +52,7 @@ namespace ramses_internal
         const UInt32 indexIntoCache = renderable.asMemoryHandle();
         assert(indexIntoCache < m_effectDeviceHandleCache.size());
         m_effectDeviceHandleCache[indexIntoCache] = DeviceResourceHandle::Invalid();
+        m_effectSupportsDrawCallBatchingCache[indexIntoCache] = false;
         setRenderableResourcesDirtyFlag(renderable, true);
         return renderable;
     }
@@ -125,6 +127,7 @@ namespace ramses_internal
         const UInt32 indexIntoCache = renderableHandle.asMemoryHandle();
         assert(indexIntoCache < m_effectDeviceHandleCache.size());
         m_effectDeviceHandleCache[indexIntoCache] = DeviceResourceHandle::Invalid();
+        m_effectSupportsDrawCallBatchingCache[indexIntoCache] = false;
 
         setRenderableResourcesDirtyFlag(renderableHandle, true);
     }
@@ -207,6 +210,13 @@ namespace ramses_internal
         return m_effectDeviceHandleCache[renderableAsIndex];
     }
 
+    Bool ResourceCachedScene::getRenderableEffectSupportsDrawCallBatching(RenderableHandle renderable) const
+    {
+        const UInt32 renderableAsIndex = renderable.asMemoryHandle();
+        assert(renderableAsIndex < m_effectSupportsDrawCallBatchingCache.size());
+        return m_effectSupportsDrawCallBatchingCache[renderableAsIndex];
+    }
+
     const DeviceHandleCache& ResourceCachedScene::getCachedHandlesForVertexAttributes() const
     {
         return m_deviceHandleCacheForVertexAttributes;
@@ -257,7 +267,10 @@ namespace ramses_internal
             effectHash = getDataLayout(layoutHandle).getEffectHash();
         }
 
-        return CheckAndUpdateDeviceHandle(resourceAccessor, m_effectDeviceHandleCache[renderable.asMemoryHandle()], effectHash);
+        const Bool effectUploaded = CheckAndUpdateDeviceHandle(resourceAccessor, m_effectDeviceHandleCache[renderable.asMemoryHandle()], effectHash);
+        m_effectSupportsDrawCallBatchingCache[renderable.asMemoryHandle()] = effectUploaded && resourceAccessor.getClientEffectSupportsDrawCallBatching(effectHash);
+
+        return effectUploaded;
     }
 
     Bool ResourceCachedScene::checkAndUpdateTextureResources(const IResourceDeviceHandleAccessor& resourceAccessor, const IEmbeddedCompositingManager& embeddedCompositingManager, RenderableHandle renderable)
@@ -649,6 +662,7 @@ namespace ramses_internal
         }
 
         std::fill(m_effectDeviceHandleCache.begin(), m_effectDeviceHandleCache.end(), DeviceResourceHandle::Invalid());
+        std::fill(m_effectSupportsDrawCallBatchingCache.begin(), m_effectSupportsDrawCallBatchingCache.end(), false);
         std::fill(m_deviceHandleCacheForTextures.begin(), m_deviceHandleCacheForTextures.end(), DeviceResourceHandle::Invalid());
         std::fill(m_renderTargetCache.begin(), m_renderTargetCache.end(), DeviceResourceHandle::Invalid());
         std::fill(m_blitPassCache.begin(), m_blitPassCache.end(), DeviceResourceHandle::Invalid());
@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/ResourceStagingThread.h"
+#include "Resource/IResource.h"
+#include "Utils/LogMacros.h"
+#include <cstring>
+
+namespace ramses_internal
+{
+    ResourceStagingThread::ResourceStagingThread()
+        : m_thread("R_ResStaging")
+    {
+        m_thread.start(*this);
+    }
+
+    ResourceStagingThread::~ResourceStagingThread()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stopRequested = true;
+        }
+        m_jobAdded.notify_all();
+        m_thread.join();
+    }
+
+    void ResourceStagingThread::stageResource(const ResourceContentHash& hash, const IResource& resource, Byte* stagingMemory)
+    {
+        assert(stagingMemory != nullptr);
+        assert(resource.isDeCompressedAvailable());
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_jobs.push_back({ hash, &resource, stagingMemory });
+        }
+        m_jobAdded.notify_one();
+    }
+
+    void ResourceStagingThread::getStagedResources(ResourceContentHashVector& stagedResources)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        stagedResources.insert(stagedResources.end(), m_stagedResources.cbegin(), m_stagedResources.cend());
+        m_stagedResources.clear();
+    }
+
+    void ResourceStagingThread::run()
+    {
+        for (;;)
+        {
+            StagingJob job;
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_jobAdded.wait(lock, [this]() { return m_stopRequested || !m_jobs.empty(); });
+                if (m_stopRequested)
+                    return;
+                job = m_jobs.front();
+                m_jobs.pop_front();
+            }
+
+            const ResourceBlob& data = job.resource->getResourceData();
+            std::memcpy(job.stagingMemory, data.data(), data.size());
+            LOG_TRACE(CONTEXT_RENDERER, "ResourceStagingThread::run: staged resource #" << job.hash << " (" << data.size() << " B)");
+
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stagedResources.push_back(job.hash);
+        }
+    }
+}
@@ -91,7 +91,39 @@ namespace ramses_internal
         }
     }
 
-    DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize)
+    DeviceResourceHandle ResourceUploader::uploadResourceFromStagingBuffer(IRenderBackend& renderBackend, const ResourceDescriptor& rd, DeviceResourceHandle stagingBuffer, UInt32& outVRAMSize)
+    {
+        const IResource& resourceObject = *rd.resource.getResourceObject();
+        IDevice& device = renderBackend.getDevice();
+        outVRAMSize = resourceObject.getDecompressedDataSize();
+
+        switch (resourceObject.getTypeID())
+        {
+        case EResourceType_VertexArray:
+        {
+            const ArrayResource* vertArray = resourceObject.convertTo<ArrayResource>();
+            const DeviceResourceHandle deviceHandle = device.allocateVertexBuffer(vertArray->getElementType(), vertArray->getDecompressedDataSize());
+            device.uploadBufferDataFromStagingBuffer(deviceHandle, stagingBuffer, 0u, vertArray->getDecompressedDataSize());
+            return deviceHandle;
+        }
+        case EResourceType_IndexArray:
+        {
+            const ArrayResource* indexArray = resourceObject.convertTo<ArrayResource>();
+            const DeviceResourceHandle deviceHandle = device.allocateIndexBuffer(indexArray->getElementType(), indexArray->getDecompressedDataSize());
+            device.uploadBufferDataFromStagingBuffer(deviceHandle, stagingBuffer, 0u, indexArray->getDecompressedDataSize());
+            return deviceHandle;
+        }
+        case EResourceType_Texture2D:
+        case EResourceType_Texture3D:
+        case EResourceType_TextureCube:
+            return uploadTexture(device, *resourceObject.convertTo<TextureResource>(), outVRAMSize, stagingBuffer);
+        default:
+            assert(false && "Unexpected resource type");
+            return DeviceResourceHandle::Invalid();
+        }
+    }
+
+    DeviceResourceHandle ResourceUploader::uploadTexture(IDevice& device, const TextureResource& texture, UInt32& vramSize, DeviceResourceHandle stagingBuffer)
     {
         const Bool generateMipsFlag = texture.getGenerateMipChainFlag();
         const auto& mipDataSizes = texture.getMipDataSizes();
@@ -118,8 +150,17 @@ namespace ramses_internal
         }
         assert(textureDeviceHandle.isValid());
 
-        // upload texture data
+        // upload texture data, either directly or from staging buffer which holds the data in same layout
         const Byte* pData = reinterpret_cast<const Byte*>(texture.getData());
+        UInt32 dataOffset = 0u;
+        const auto uploadMipData = [&](UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, UInt32 dataSize)
+        {
+            if (stagingBuffer.isValid())
+                device.uploadTextureDataFromStagingBuffer(textureDeviceHandle, mipLevel, z, width, height, depth, stagingBuffer, dataOffset, dataSize);
+            else
+                device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, z, width, height, depth, pData + dataOffset, dataSize);
+            dataOffset += dataSize;
+        };
         switch (texture.getTypeID())
         {
         case EResourceType_Texture2D:
@@ -129,8 +170,7 @@ namespace ramses_internal
                 const UInt32 width = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
                 const UInt32 height = TextureMathUtils::GetMipSize(mipLevel, texture.getHeight());
                 const UInt32 depth = TextureMathUtils::GetMipSize(mipLevel, texture.getDepth());
-                device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, 0u, width, height, depth, pData, mipDataSizes[mipLevel]);
-                pData += mipDataSizes[mipLevel];
+                uploadMipData(mipLevel, 0u, width, height, depth, mipDataSizes[mipLevel]);
             }
             break;
         case EResourceType_TextureCube:
@@ -141,8 +181,7 @@ namespace ramses_internal
                 {
                     const UInt32 faceSize = TextureMathUtils::GetMipSize(mipLevel, texture.getWidth());
                     // texture faceID is encoded in Z offset
-                    device.uploadTextureData(textureDeviceHandle, mipLevel, 0u, 0u, faceId, faceSize, faceSize, 1u, pData, mipDataSizes[mipLevel]);
-                    pData += mipDataSizes[mipLevel];
+                    uploadMipData(mipLevel, faceId, faceSize, faceSize, 1u, mipDataSizes[mipLevel]);
                 }
             }
             break;
@@ -173,13 +212,7 @@ namespace ramses_internal
             return handle;
         }
 
-        if (!m_supportedFormatsReported)
-        {
-            std::vector<BinaryShaderFormatID> supportedFormats;
-            device.getSupportedBinaryProgramFormats(supportedFormats);
-            m_binaryShaderCache->deviceSupportsBinaryShaderFormats(supportedFormats);
-            m_supportedFormatsReported = true;
-        }
+        reportSupportedBinaryShaderFormats(device);
 
         if (m_binaryShaderCache->hasBinaryShader(hash))
         {
@@ -211,18 +244,76 @@ namespace ramses_internal
         auto steadyDiff = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - steadyNow);
         m_stats.shaderCompiled(steadyDiff, effect.getName(), sceneid);
 
-        if (sourceShaderHandle.isValid() && m_binaryShaderCache->shouldBinaryShaderBeCached(hash, sceneid))
+        storeBinaryShaderToCache(device, sourceShaderHandle, hash, sceneid);
+
+        return sourceShaderHandle;
+    }
+
+    DeviceResourceHandle ResourceUploader::startEffectCompilation(IRenderBackend& renderBackend, const ResourceDescriptor& rd)
+    {
+        const EffectResource& effect = *rd.resource.getResourceObject()->convertTo<EffectResource>();
+        IDevice& device = renderBackend.getDevice();
+
+        if (m_binaryShaderCache)
+        {
+            reportSupportedBinaryShaderFormats(device);
+            // binary shader upload does not compile, it is done synchronously
+            if (m_binaryShaderCache->hasBinaryShader(rd.hash))
+                return DeviceResourceHandle::Invalid();
+        }
+
+        return device.startShaderCompilation(effect);
+    }
+
+    Bool ResourceUploader::isEffectCompilationFinished(IRenderBackend& renderBackend, DeviceResourceHandle pendingEffect)
+    {
+        return renderBackend.getDevice().isShaderCompilationFinished(pendingEffect);
+    }
+
+    DeviceResourceHandle ResourceUploader::finishEffectCompilation(IRenderBackend& renderBackend, const ResourceDescriptor& rd, DeviceResourceHandle pendingEffect, UInt32& outVRAMSize)
+    {
+        const EffectResource& effect = *rd.resource.getResourceObject()->convertTo<EffectResource>();
+        IDevice& device = renderBackend.getDevice();
+        const SceneId sceneid = (rd.sceneUsage.empty() ? SceneId::Invalid() : rd.sceneUsage.front());
+        outVRAMSize = effect.getDecompressedDataSize();
+
+        // only time render thread is blocked is reported, compilation itself ran in parallel
+        auto steadyNow = std::chrono::steady_clock::now();
+        const DeviceResourceHandle shaderHandle = device.finishShaderCompilation(pendingEffect, effect);
+        auto steadyDiff = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - steadyNow);
+        m_stats.shaderCompiled(steadyDiff, effect.getName(), sceneid);
+
+        if (m_binaryShaderCache)
+            storeBinaryShaderToCache(device, shaderHandle, rd.hash, sceneid);
+
+        return shaderHandle;
+    }
+
+    void ResourceUploader::reportSupportedBinaryShaderFormats(IDevice& device)
+    {
+        assert(m_binaryShaderCache);
+        if (!m_supportedFormatsReported)
+        {
+            std::vector<BinaryShaderFormatID> supportedFormats;
+            device.getSupportedBinaryProgramFormats(supportedFormats);
+            m_binaryShaderCache->deviceSupportsBinaryShaderFormats(supportedFormats);
+            m_supportedFormatsReported = true;
+        }
+    }
+
+    void ResourceUploader::storeBinaryShaderToCache(IDevice& device, DeviceResourceHandle shaderHandle, ResourceContentHash hash, SceneId sceneid)
+    {
+        assert(m_binaryShaderCache);
+        if (shaderHandle.isValid() && m_binaryShaderCache->shouldBinaryShaderBeCached(hash, sceneid))
         {
             UInt8Vector binaryShader;
             BinaryShaderFormatID format;
-            if (device.getBinaryShader(sourceShaderHandle, binaryShader, format))
+            if (device.getBinaryShader(shaderHandle, binaryShader, format))
             {
                 assert(binaryShader.size() != 0u);
                 m_binaryShaderCache->storeBinaryShader(hash, sceneid, &binaryShader.front(), static_cast<UInt32>(binaryShader.size()), format);
             }
         }
-
-        return sourceShaderHandle;
     }
 
     UInt32 ResourceUploader::EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, UInt32 numMipLevelsToAllocate)
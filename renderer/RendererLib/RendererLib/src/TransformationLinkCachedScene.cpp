@@ -63,6 +63,34 @@ namespace ramses_internal
         SceneLinkScene::releaseDataSlot(handle);
     }
 
+    void TransformationLinkCachedScene::releaseDataBuffer(DataBufferHandle handle)
+    {
+        m_pickableGeometryBVHs.remove(handle);
+        SceneLinkScene::releaseDataBuffer(handle);
+    }
+
+    void TransformationLinkCachedScene::updateDataBuffer(DataBufferHandle handle, UInt32 offsetInBytes, UInt32 dataSizeInBytes, const Byte* data)
+    {
+        m_pickableGeometryBVHs.remove(handle);
+        SceneLinkScene::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+    }
+
+    const TriangleBVH& TransformationLinkCachedScene::getPickableGeometryBVH(DataBufferHandle geometryBuffer) const
+    {
+        const auto it = m_pickableGeometryBVHs.find(geometryBuffer);
+        if (it != m_pickableGeometryBVHs.end())
+            return it->value;
+
+        const GeometryDataBuffer& geometryDataBuffer = getDataBuffer(geometryBuffer);
+        assert(geometryDataBuffer.bufferType == EDataBufferType::VertexBuffer);
+        assert(geometryDataBuffer.dataType == EDataType::EDataType_Vector3F);
+        const float* geometryBufferFloat = reinterpret_cast<const float*>(geometryDataBuffer.data.data());
+        const UInt32 geometrySize = geometryDataBuffer.usedSize / sizeof(float);
+        assert(0 == geometrySize % 9);
+
+        return m_pickableGeometryBVHs.put(geometryBuffer, TriangleBVH(geometryBufferFloat, geometrySize))->value;
+    }
+
     void TransformationLinkCachedScene::propagateDirtyToConsumers(NodeHandle startNode) const
     {
         assert(m_dirtyPropagationTraversalBuffer.empty());
@@ -0,0 +1,225 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/TriangleBVH.h"
+#include "Math3d/Vector4.h"
+#include <algorithm>
+#include <array>
+
+namespace ramses_internal
+{
+    void TriangleBVH::BoundingBox::extend(const Vector3& point)
+    {
+        min.set(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+        max.set(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+    }
+
+    void TriangleBVH::BoundingBox::extend(const BoundingBox& other)
+    {
+        extend(other.min);
+        extend(other.max);
+    }
+
+    bool TriangleBVH::BoundingBox::isValid() const
+    {
+        return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+    }
+
+    TriangleBVH::BoundingBox TriangleBVH::BoundingBox::transform(const Matrix44f& matrix) const
+    {
+        BoundingBox transformedBox;
+        if (!isValid())
+            return transformedBox;
+
+        for (UInt32 corner = 0u; corner < 8u; ++corner)
+        {
+            const Vector4 point((corner & 1u) ? max.x : min.x, (corner & 2u) ? max.y : min.y, (corner & 4u) ? max.z : min.z, 1.f);
+            transformedBox.extend(Vector3(matrix * point));
+        }
+        return transformedBox;
+    }
+
+    bool TriangleBVH::BoundingBox::intersectRay(const Vector3& rayOrigin, const Vector3& rayInvDir, float maxDistance) const
+    {
+        // NaN from 0 * inf (ray in slab plane) is ignored by min/max argument order
+        float distanceNear = 0.f;
+        float distanceFar = maxDistance;
+        for (UInt32 axis = 0u; axis < 3u; ++axis)
+        {
+            const float distanceToMin = (min[axis] - rayOrigin[axis]) * rayInvDir[axis];
+            const float distanceToMax = (max[axis] - rayOrigin[axis]) * rayInvDir[axis];
+            distanceNear = std::max(distanceNear, std::min(distanceToMin, distanceToMax));
+            distanceFar = std::min(distanceFar, std::max(distanceToMin, distanceToMax));
+        }
+        return distanceNear <= distanceFar;
+    }
+
+    TriangleBVH::TriangleBVH(const float* geometry, size_t geometrySize)
+    {
+        assert(geometrySize % 9 == 0);
+        const UInt32 triangleCount = static_cast<UInt32>(geometrySize / 9);
+        if (triangleCount == 0u)
+            return;
+
+        std::vector<IntersectionUtils::Triangle> triangles(triangleCount);
+        std::vector<BoundingBox> triangleBounds(triangleCount);
+        std::vector<BuildEntry> buildEntries(triangleCount);
+
+        for (UInt32 i = 0u; i < triangleCount; ++i)
+        {
+            const float* triData = &geometry[i * 9u];
+            IntersectionUtils::Triangle& triangle = triangles[i];
+            std::copy(triData + 0, triData + 3, triangle.v0.data);
+            std::copy(triData + 3, triData + 6, triangle.v1.data);
+            std::copy(triData + 6, triData + 9, triangle.v2.data);
+
+            BoundingBox& bounds = triangleBounds[i];
+            bounds.extend(triangle.v0);
+            bounds.extend(triangle.v1);
+            bounds.extend(triangle.v2);
+
+            // pad bounds so that hits computed on triangle edges or on axis aligned (flat) triangles
+            // are not rejected by rounding errors of the slab test
+            const float magnitude = std::max({ std::abs(bounds.min.x), std::abs(bounds.min.y), std::abs(bounds.min.z), std::abs(bounds.max.x), std::abs(bounds.max.y), std::abs(bounds.max.z), 1.f });
+            const Vector3 padding(magnitude * std::numeric_limits<float>::epsilon() * 16.f);
+            bounds.min -= padding;
+            bounds.max += padding;
+
+            buildEntries[i] = { (triangle.v0 + triangle.v1 + triangle.v2) * (1.f / 3.f), i };
+        }
+
+        m_nodes.reserve(2u * (triangleCount / MaxTrianglesPerLeaf + 1u));
+        buildNode(buildEntries, triangleBounds, 0u, triangleCount);
+
+        m_triangles.reserve(triangleCount);
+        for (const auto& entry : buildEntries)
+            m_triangles.push_back(triangles[entry.triangleIdx]);
+    }
+
+    UInt32 TriangleBVH::buildNode(std::vector<BuildEntry>& buildEntries, const std::vector<BoundingBox>& triangleBounds, UInt32 begin, UInt32 end)
+    {
+        const UInt32 nodeIdx = static_cast<UInt32>(m_nodes.size());
+        m_nodes.push_back({});
+
+        BoundingBox centroidBounds;
+        for (UInt32 i = begin; i < end; ++i)
+            centroidBounds.extend(buildEntries[i].centroid);
+
+        const Vector3 centroidExtent = centroidBounds.max - centroidBounds.min;
+        UInt32 splitAxis = 0u;
+        if (centroidExtent.y > centroidExtent[splitAxis])
+            splitAxis = 1u;
+        if (centroidExtent.z > centroidExtent[splitAxis])
+            splitAxis = 2u;
+
+        const UInt32 triangleCount = end - begin;
+        // all centroids at same position cannot be split any further
+        if (triangleCount <= MaxTrianglesPerLeaf || centroidExtent[splitAxis] <= 0.f)
+        {
+            Node& leaf = m_nodes[nodeIdx];
+            for (UInt32 i = begin; i < end; ++i)
+                leaf.bounds.extend(triangleBounds[buildEntries[i].triangleIdx]);
+            leaf.firstTriangleOrRightChild = begin;
+            leaf.triangleCount = triangleCount;
+            return nodeIdx;
+        }
+
+        // median split along largest centroid extent keeps the tree balanced and its depth logarithmic
+        const UInt32 middle = begin + triangleCount / 2u;
+        std::nth_element(buildEntries.begin() + begin, buildEntries.begin() + middle, buildEntries.begin() + end,
+            [splitAxis](const BuildEntry& a, const BuildEntry& b) { return a.centroid[splitAxis] < b.centroid[splitAxis]; });
+
+        const UInt32 leftChildIdx = buildNode(buildEntries, triangleBounds, begin, middle);
+        const UInt32 rightChildIdx = buildNode(buildEntries, triangleBounds, middle, end);
+
+        // inner node bounds are merged bottom-up from children instead of iterating all its triangles
+        Node& node = m_nodes[nodeIdx];
+        node.bounds = m_nodes[leftChildIdx].bounds;
+        node.bounds.extend(m_nodes[rightChildIdx].bounds);
+        node.firstTriangleOrRightChild = rightChildIdx;
+        node.splitAxis = splitAxis;
+
+        return nodeIdx;
+    }
+
+    bool TriangleBVH::isEmpty() const
+    {
+        return m_nodes.empty();
+    }
+
+    UInt32 TriangleBVH::getTriangleCount() const
+    {
+        return static_cast<UInt32>(m_triangles.size());
+    }
+
+    const TriangleBVH::BoundingBox& TriangleBVH::getBoundingBox() const
+    {
+        return m_nodes.empty() ? m_emptyBounds : m_nodes.front().bounds;
+    }
+
+    bool TriangleBVH::intersectRay(const Vector3& rayOrigin, const Vector3& rayDir, Vector3& intersectionPoint, float& distanceRayOriginToIntersection) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        const Vector3 rayInvDir = rayDir.inverse();
+        bool intersectionResult = false;
+        float nearestDistance = std::numeric_limits<float>::max();
+
+        // median split guarantees depth of at most log2(triangle count), i.e. at most 32 nodes pending at a time
+        std::array<UInt32, 64> nodesToVisit;
+        UInt32 nodesToVisitCount = 0u;
+        nodesToVisit[nodesToVisitCount++] = 0u;
+
+        while (nodesToVisitCount > 0u)
+        {
+            const UInt32 nodeIdx = nodesToVisit[--nodesToVisitCount];
+            const Node& node = m_nodes[nodeIdx];
+            if (!node.bounds.intersectRay(rayOrigin, rayInvDir, nearestDistance))
+                continue;
+
+            if (node.triangleCount > 0u)
+            {
+                const UInt32 endTriangle = node.firstTriangleOrRightChild + node.triangleCount;
+                for (UInt32 triangleIdx = node.firstTriangleOrRightChild; triangleIdx < endTriangle; ++triangleIdx)
+                {
+                    float distanceResult = 0.f;
+                    Vector3 intersection;
+                    if (IntersectionUtils::IntersectRayVsTriangle(m_triangles[triangleIdx], rayOrigin, rayDir, intersection, distanceResult) && distanceResult < nearestDistance)
+                    {
+                        intersectionResult = true;
+                        nearestDistance = distanceResult;
+                        intersectionPoint = intersection;
+                    }
+                }
+            }
+            else
+            {
+                // visit child closer to ray origin first so that farther one can be culled by found intersection
+                const UInt32 leftChildIdx = nodeIdx + 1u;
+                const UInt32 rightChildIdx = node.firstTriangleOrRightChild;
+                assert(nodesToVisitCount + 2u <= nodesToVisit.size());
+                if (rayDir[node.splitAxis] >= 0.f)
+                {
+                    nodesToVisit[nodesToVisitCount++] = rightChildIdx;
+                    nodesToVisit[nodesToVisitCount++] = leftChildIdx;
+                }
+                else
+                {
+                    nodesToVisit[nodesToVisitCount++] = leftChildIdx;
+                    nodesToVisit[nodesToVisitCount++] = rightChildIdx;
+                }
+            }
+        }
+
+        if (intersectionResult)
+            distanceRayOriginToIntersection = nearestDistance;
+
+        return intersectionResult;
+    }
+}
@@ -31,13 +31,14 @@ namespace ramses_internal
         IRendererSceneEventSender& rendererSceneSender,
         IPlatformFactory& platformFactory,
         RendererStatistics& rendererStatistics,
-        const String& monitorFilename)
+        const String& monitorFilename,
+        ITaskQueue* parallelProcessingQueue)
         : m_rendererCommandBuffer(commandBuffer)
         , m_rendererScenes(m_rendererEventCollector)
         , m_expirationMonitor(m_rendererScenes, m_rendererEventCollector)
         , m_renderer(platformFactory, m_rendererScenes, m_rendererEventCollector, m_frameTimer, m_expirationMonitor, rendererStatistics)
         , m_sceneStateExecutor(m_renderer, rendererSceneSender, m_rendererEventCollector)
-        , m_rendererSceneUpdater(m_renderer, m_rendererScenes, m_sceneStateExecutor, m_rendererEventCollector, m_frameTimer, m_expirationMonitor)
+        , m_rendererSceneUpdater(m_renderer, m_rendererScenes, m_sceneStateExecutor, m_rendererEventCollector, m_frameTimer, m_expirationMonitor, nullptr, parallelProcessingQueue)
         , m_sceneControlLogic(m_rendererSceneUpdater)
         , m_rendererCommandExecutor(m_renderer, m_rendererCommandBuffer, m_rendererSceneUpdater, m_sceneControlLogic, m_rendererEventCollector, m_frameTimer)
         , m_sceneReferenceLogic(m_rendererScenes, m_sceneControlLogic, m_rendererSceneUpdater, rendererSceneSender)
@@ -102,14 +103,7 @@ namespace ramses_internal
     {
         LOG_TRACE(CONTEXT_PROFILING, "WindowedRenderer::render() start render section of frame");
 
-        for (DisplayHandle handle(0u); handle < m_renderer.getDisplayControllerCount(); ++handle)
-        {
-            if (m_renderer.hasDisplayController(handle))
-            {
-                m_renderer.getDisplayController(handle).getRenderBackend().getDevice().resetDrawCallCount();
-            }
-        }
-
+        m_renderer.resetDrawCallCounts();
         m_renderer.doOneRenderLoop();
         processScreenshotResults();
 
@@ -135,20 +129,14 @@ namespace ramses_internal
         m_renderer.getStatistics().frameFinished(drawCalls);
         m_renderer.getProfilerStatistics().markFrameFinished(sleepTime);
 
-        UInt32 drawCallCount(0u);
         UInt32 usedGPUMemory(0u);
-        const IDevice* device = nullptr;
         for (DisplayHandle handle(0u); handle < m_renderer.getDisplayControllerCount(); ++handle)
         {
             if (m_renderer.hasDisplayController(handle))
-            {
-                device = &m_renderer.getDisplayController(handle).getRenderBackend().getDevice();
-                drawCallCount += device->getDrawCallCount();
-                usedGPUMemory += device->getTotalGpuMemoryUsageInKB();
-            }
+                usedGPUMemory += m_renderer.getDisplayController(handle).getRenderBackend().getDevice().getTotalGpuMemoryUsageInKB();
         }
 
-        m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::DrawCalls, drawCallCount);
+        m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::DrawCalls, m_renderer.getDrawCallCount());
         m_renderer.getProfilerStatistics().setCounterValue(FrameProfilerStatistics::ECounter::UsedGPUMemory, usedGPUMemory / 1024);
 
         const UInt64 timeNowMs = PlatformTime::GetMillisecondsMonotonic();
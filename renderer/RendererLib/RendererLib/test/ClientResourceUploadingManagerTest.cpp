@@ -26,6 +26,9 @@ public:
     AClientResourceUploadingManager(bool keepEffects = false, UInt64 clientResourceCacheSize = 0u)
         : dummyResource(EResourceType_IndexArray, 5, EDataType_UInt16, reinterpret_cast<const Byte*>(m_dummyData), ResourceCacheFlag_DoNotCache, String())
         , dummyEffectResource("", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache)
+        , largeData(ClientResourceUploadingManager::LargeResourceByteSizeThreshold / 2 + 1, 0x1C)
+        , largeResource(EResourceType_IndexArray, static_cast<UInt32>(largeData.size()), EDataType_UInt16, reinterpret_cast<const Byte*>(largeData.data()), ResourceCacheFlag_DoNotCache, String())
+        , stagingMemory(largeResource.getDecompressedDataSize(), 0u)
         , dummyManagedResourceCallback(managedResourceDeleter)
         , sceneId(66u)
         , frameTimer()
@@ -42,7 +45,7 @@ public:
 
         if (effectResource)
         {
-            ManagedResource managedRes(dummyEffectResource, dummyManagedResourceCallback);
+            ManagedResource managedRes((nullptr != resource ? *resource : dummyEffectResource), dummyManagedResourceCallback);
             resourceRegistry.setResourceData(hash, managedRes, DeviceResourceHandle::Invalid(), EResourceType_Effect);
         }
         else
@@ -100,6 +103,30 @@ public:
         EXPECT_FALSE(resourceRegistry.containsResource(hash));
     }
 
+    void expectResourceStaged()
+    {
+        EXPECT_CALL(rendererBackend.deviceMock, allocateStagingBuffer(largeResource.getDecompressedDataSize())).WillOnce(Return(stagingBuffer));
+        EXPECT_CALL(rendererBackend.deviceMock, getStagingBufferData(stagingBuffer)).WillOnce(Return(stagingMemory.data()));
+    }
+
+    void updateUntilTransferredFromStagingBuffer(DeviceResourceHandle transferResult = ResourceUploaderMock::FakeResourceDeviceHandle)
+    {
+        bool transferred = false;
+        EXPECT_CALL(uploader, uploadResourceFromStagingBuffer(_, _, stagingBuffer, _)).WillOnce(InvokeWithoutArgs([&]() { transferred = true; return transferResult; }));
+        if (transferResult.isValid())
+            EXPECT_CALL(rendererBackend.deviceMock, insertFence()).WillOnce(Return(fence));
+
+        // staging happens on worker thread, transfer from staging buffer is done on next update after that
+        for (UInt32 i = 0u; i < 10000u && !transferred; ++i)
+        {
+            rendererResourceUploader.uploadAndUnloadPendingResources();
+            if (!transferred)
+                PlatformThread::Sleep(1u);
+        }
+        ASSERT_TRUE(transferred);
+        EXPECT_EQ(0, std::memcmp(stagingMemory.data(), largeResource.getResourceData().data(), stagingMemory.size()));
+    }
+
 protected:
     static const UInt16 m_dummyData[5];
 
@@ -109,6 +136,12 @@ protected:
 
     const ArrayResource dummyResource;
     const EffectResource dummyEffectResource;
+    const std::vector<UInt16> largeData;
+    const ArrayResource largeResource;
+    std::vector<Byte> stagingMemory;
+    const DeviceResourceHandle stagingBuffer{ 771u };
+    const DeviceResourceHandle fence{ 772u };
+    const DeviceResourceHandle pendingEffect{ 773u };
     NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
     ResourceDeleterCallingCallback dummyManagedResourceCallback;
 
@@ -246,6 +279,7 @@ TEST_F(AClientResourceUploadingManager, willUnloadAnyRemainingResourcesWhenDestr
     registerAndProvideResource(res2, true);
     registerAndProvideResource(res3);
 
+    EXPECT_CALL(uploader, startEffectCompilation(_, _));
     EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(3u);
     rendererResourceUploader.uploadAndUnloadPendingResources();
     Mock::VerifyAndClearExpectations(&uploader);
@@ -262,6 +296,7 @@ TEST_F(AClientResourceUploadingManager_KeepingEffects, willNotUnloadEffectResour
     const ResourceContentHash res(1234u, 0u);
     registerAndProvideResource(res, true);
 
+    EXPECT_CALL(uploader, startEffectCompilation(_, _));
     EXPECT_CALL(uploader, uploadResource(_, _, _));
     rendererResourceUploader.uploadAndUnloadPendingResources();
     expectResourceUploaded(res);
@@ -357,6 +392,9 @@ TEST_F(AClientResourceUploadingManager, checksTimeBudgetForEachLargeResourceWhen
     registerAndProvideResource(res2, false, &largeResource);
     registerAndProvideResource(res3, false, &largeResource);
 
+    // device without staging support, large resources are uploaded synchronously
+    EXPECT_CALL(rendererBackend.deviceMock, allocateStagingBuffer(_)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+
     // set budget to infinite to make sure more than just first resource is processed
     // then right after set budget to 0 and test if the other resources were uploaded
     EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(2)
@@ -377,6 +415,187 @@ TEST_F(AClientResourceUploadingManager, checksTimeBudgetForEachLargeResourceWhen
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2);
 }
 
+TEST_F(AClientResourceUploadingManager, stagesLargeResourceAndReportsItUploadedOnlyAfterTransferFenceIsSignaled)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeResource);
+
+    expectResourceStaged();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus_Provided);
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    updateUntilTransferredFromStagingBuffer();
+    expectResourceStatus(res, EResourceStatus_Provided);
+
+    EXPECT_CALL(rendererBackend.deviceMock, isFenceSignaled(fence)).WillOnce(Return(false));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus_Provided);
+
+    EXPECT_CALL(rendererBackend.deviceMock, isFenceSignaled(fence)).WillOnce(Return(true));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteFence(fence));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+    EXPECT_FALSE(rendererResourceUploader.hasAnythingToUpload());
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
+TEST_F(AClientResourceUploadingManager, uploadsLargeResourcesSynchronouslyIfDeviceCannotProvideStagingBuffer)
+{
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    registerAndProvideResource(res1, false, &largeResource);
+    registerAndProvideResource(res2, false, &largeResource);
+
+    // staging is not attempted again after first failure
+    EXPECT_CALL(rendererBackend.deviceMock, allocateStagingBuffer(_)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+    EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(2u);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res1);
+    expectResourceUploaded(res2);
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2u);
+}
+
+TEST_F(AClientResourceUploadingManager, setsBrokenStatusForStagedResourceFailedToUpload)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeResource);
+
+    expectResourceStaged();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer));
+    updateUntilTransferredFromStagingBuffer(DeviceResourceHandle::Invalid());
+    expectResourceUploadFailed(res);
+
+    unregisterResource(res);
+}
+
+TEST_F(AClientResourceUploadingManager, unloadsStagedResourceUnregisteredBeforeItsUploadFinished)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeResource);
+
+    expectResourceStaged();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    updateUntilTransferredFromStagingBuffer();
+
+    unregisterResource(res);
+
+    EXPECT_CALL(rendererBackend.deviceMock, isFenceSignaled(fence)).WillOnce(Return(true));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteFence(fence));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer));
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res);
+}
+
+TEST_F(AClientResourceUploadingManager, releasesStagingResourcesOfUnfinishedUploadWhenDestructed)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &largeResource);
+
+    expectResourceStaged();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    updateUntilTransferredFromStagingBuffer();
+
+    unregisterResource(res);
+
+    EXPECT_CALL(rendererBackend.deviceMock, deleteFence(fence));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer));
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
+TEST_F(AClientResourceUploadingManager, decompressesResourceBeforeStagingIt)
+{
+    largeResource.compress(IResource::CompressionLevel::REALTIME);
+    ArrayResource compressedResource(EResourceType_IndexArray, 0u, EDataType_UInt16, nullptr, ResourceCacheFlag_DoNotCache, String());
+    compressedResource.setCompressedResourceData(CompressedResouceBlob(largeResource.getCompressedResourceData().size(), largeResource.getCompressedResourceData().data()),
+        largeResource.getDecompressedDataSize(), largeResource.getHash());
+    ASSERT_FALSE(compressedResource.isDeCompressedAvailable());
+
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, false, &compressedResource);
+
+    // resource is shared with other threads, staging thread must only read its decompressed data
+    expectResourceStaged();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    EXPECT_TRUE(compressedResource.isDeCompressedAvailable());
+    updateUntilTransferredFromStagingBuffer();
+
+    // finish upload so that local resource is not referenced anymore
+    EXPECT_CALL(rendererBackend.deviceMock, isFenceSignaled(fence)).WillOnce(Return(true));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteFence(fence));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
+TEST_F(AClientResourceUploadingManager, limitsSizeOfStagedUploadsInFlight)
+{
+    const UInt32 numResourcesFittingLimit = ClientResourceUploadingManager::MaxStagedUploadsByteSizeInFlight / largeResource.getDecompressedDataSize();
+    for (UInt32 i = 0u; i <= numResourcesFittingLimit; ++i)
+        registerAndProvideResource(ResourceContentHash(1000u + i, 0u), false, &largeResource);
+
+    // resource exceeding limit is neither staged nor uploaded synchronously
+    EXPECT_CALL(rendererBackend.deviceMock, allocateStagingBuffer(largeResource.getDecompressedDataSize())).Times(numResourcesFittingLimit).WillRepeatedly(Return(stagingBuffer));
+    EXPECT_CALL(rendererBackend.deviceMock, getStagingBufferData(stagingBuffer)).Times(numResourcesFittingLimit).WillRepeatedly(Return(stagingMemory.data()));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    for (UInt32 i = 0u; i <= numResourcesFittingLimit; ++i)
+    {
+        expectResourceStatus(ResourceContentHash(1000u + i, 0u), EResourceStatus_Provided);
+        unregisterResource(ResourceContentHash(1000u + i, 0u));
+    }
+
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer)).Times(numResourcesFittingLimit);
+}
+
+TEST_F(AClientResourceUploadingManager, transfersStagedResourcesWithinTimeBudget)
+{
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    registerAndProvideResource(res1, false, &largeResource);
+    registerAndProvideResource(res2, false, &largeResource);
+
+    EXPECT_CALL(rendererBackend.deviceMock, allocateStagingBuffer(_)).Times(2u).WillRepeatedly(Return(stagingBuffer));
+    EXPECT_CALL(rendererBackend.deviceMock, getStagingBufferData(stagingBuffer)).Times(2u).WillRepeatedly(Return(stagingMemory.data()));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    // at least one transfer is done per update, but no more once out of time budget
+    frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u);
+    UInt32 numTransfers = 0u;
+    EXPECT_CALL(uploader, uploadResourceFromStagingBuffer(_, _, stagingBuffer, _)).Times(2u).WillRepeatedly(InvokeWithoutArgs([&]() { ++numTransfers; return ResourceUploaderMock::FakeResourceDeviceHandle; }));
+    EXPECT_CALL(rendererBackend.deviceMock, insertFence()).Times(2u).WillRepeatedly(Return(fence));
+    EXPECT_CALL(rendererBackend.deviceMock, isFenceSignaled(fence)).WillRepeatedly(Return(false));
+    for (UInt32 i = 0u; i < 10000u && numTransfers < 2u; ++i)
+    {
+        const UInt32 numTransfersBefore = numTransfers;
+        frameTimer.startFrame();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        EXPECT_LE(numTransfers, numTransfersBefore + 1u);
+        if (numTransfers < 2u)
+            PlatformThread::Sleep(1u);
+    }
+    EXPECT_EQ(2u, numTransfers);
+
+    unregisterResource(res1);
+    unregisterResource(res2);
+
+    EXPECT_CALL(rendererBackend.deviceMock, deleteFence(fence)).Times(2u);
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer)).Times(2u);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, _, ResourceUploaderMock::FakeResourceDeviceHandle)).Times(2u);
+}
+
 TEST_F(AClientResourceUploadingManager, checksTimeBudgetForEachEffectWhenUploading)
 {
     const ResourceContentHash res1(1234u, 0u);
@@ -389,6 +608,7 @@ TEST_F(AClientResourceUploadingManager, checksTimeBudgetForEachEffectWhenUploadi
 
     // set budget to infinite to make sure more than just first resource is processed
     // then right after set budget to 0 and test if the other resources were uploaded
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).Times(3);
     EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(2)
         .WillOnce(InvokeWithoutArgs([this]() { frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, std::numeric_limits<UInt64>::max()); return ResourceUploaderMock::FakeResourceDeviceHandle; }))
         .WillOnce(InvokeWithoutArgs([this]() { frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, 0u); return ResourceUploaderMock::FakeResourceDeviceHandle; }));
@@ -407,6 +627,31 @@ TEST_F(AClientResourceUploadingManager, checksTimeBudgetForEachEffectWhenUploadi
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2);
 }
 
+TEST_F(AClientResourceUploadingManager, validatesUploadedEffectForDrawCallBatching)
+{
+    const EffectResource batchableEffect(
+        "uniform mat4 u_model[2];\nvoid main()\n{\n    gl_Position = u_model[gl_InstanceID] * vec4(1.0);\n}\n",
+        "void main()\n{\n}\n",
+        { EffectInputInformation("u_model", 2u, EDataType_Matrix44F, EFixedSemantics_ModelMatrix, EEffectInputTextureType_Invalid) },
+        EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    const ResourceContentHash res1(1234u, 0u);
+    const ResourceContentHash res2(1235u, 0u);
+    registerAndProvideResource(res1, true, &batchableEffect);
+    registerAndProvideResource(res2, true);
+
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).Times(2);
+    EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(2);
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res1);
+    expectResourceUploaded(res2);
+    EXPECT_TRUE(resourceRegistry.getResourceDescriptor(res1).effectSupportsDrawCallBatching);
+    EXPECT_FALSE(resourceRegistry.getResourceDescriptor(res2).effectSupportsDrawCallBatching);
+
+    makeResourceUnused(res1);
+    makeResourceUnused(res2);
+    EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(2);
+}
+
 TEST_F(AClientResourceUploadingManager, uploadsOnlyResourcesFittingIntoTimeBudgetInOneUpdate)
 {
     // using effect resources so that time budget checks happen on every resources, not just once per batch
@@ -425,6 +670,7 @@ TEST_F(AClientResourceUploadingManager, uploadsOnlyResourcesFittingIntoTimeBudge
     frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ClientResourcesUpload, sectionTimeBudgetMiillis * 1000u);
 
     //make sure that not all resources will be uploaded
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).Times(AnyNumber());
     EXPECT_CALL(uploader, uploadResource(_, _, _)).Times(AtMost(3)).WillRepeatedly(InvokeWithoutArgs([&]() {PlatformThread::Sleep(4); return ResourceUploaderMock::FakeResourceDeviceHandle; }));
     frameTimer.startFrame();
     rendererResourceUploader.uploadAndUnloadPendingResources();
@@ -450,11 +696,83 @@ TEST_F(AClientResourceUploadingManager, uploadsOnlyResourcesFittingIntoTimeBudge
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(4);
 }
 
+TEST_F(AClientResourceUploadingManager, reportsEffectUploadedOnlyAfterItsParallelCompilationIsFinished)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).WillOnce(Return(pendingEffect));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus_Provided);
+    EXPECT_TRUE(rendererResourceUploader.hasAnythingToUpload());
+
+    // effect being compiled is not started again
+    EXPECT_CALL(uploader, isEffectCompilationFinished(_, pendingEffect)).WillOnce(Return(false));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceStatus(res, EResourceStatus_Provided);
+
+    EXPECT_CALL(uploader, isEffectCompilationFinished(_, pendingEffect)).WillOnce(Return(true));
+    EXPECT_CALL(uploader, finishEffectCompilation(_, _, pendingEffect, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(res);
+
+    makeResourceUnused(res);
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Effect, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
+TEST_F(AClientResourceUploadingManager, reportsEffectBrokenIfItsParallelCompilationFails)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).WillOnce(Return(pendingEffect));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    EXPECT_CALL(uploader, isEffectCompilationFinished(_, pendingEffect)).WillOnce(Return(true));
+    EXPECT_CALL(uploader, finishEffectCompilation(_, _, pendingEffect, _)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploadFailed(res);
+
+    unregisterResource(res);
+}
+
+TEST_F(AClientResourceUploadingManager, deletesCompiledEffectIfUnregisteredWhileCompiling)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).WillOnce(Return(pendingEffect));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    unregisterResource(res);
+
+    EXPECT_CALL(uploader, isEffectCompilationFinished(_, pendingEffect)).WillOnce(Return(true));
+    EXPECT_CALL(uploader, finishEffectCompilation(_, _, pendingEffect, _));
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Effect, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(res);
+}
+
+TEST_F(AClientResourceUploadingManager, finishesAndDeletesEffectStillCompilingWhenDestructed)
+{
+    const ResourceContentHash res(1234u, 0u);
+    registerAndProvideResource(res, true);
+
+    EXPECT_CALL(uploader, startEffectCompilation(_, _)).WillOnce(Return(pendingEffect));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+
+    unregisterResource(res);
+
+    EXPECT_CALL(uploader, finishEffectCompilation(_, _, pendingEffect, _));
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_Effect, res, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
 TEST_F(AClientResourceUploadingManager_KeepingEffects, doesNotReportKeptEffectAsPendingUnload)
 {
     const ResourceContentHash res(1234u, 0u);
     registerAndProvideResource(res, true);
 
+    EXPECT_CALL(uploader, startEffectCompilation(_, _));
     EXPECT_CALL(uploader, uploadResource(_, _, _));
     rendererResourceUploader.uploadAndUnloadPendingResources();
     expectResourceUploaded(res);
@@ -467,6 +785,34 @@ TEST_F(AClientResourceUploadingManager_KeepingEffects, doesNotReportKeptEffectAs
     EXPECT_CALL(uploader, unloadResource(_, _, _, _)).Times(1u);
 }
 
+TEST_F(AClientResourceUploadingManager_WithVRAMCache, unloadsUnusedCachedResourceToMakeRoomForStagedUploadInFlight)
+{
+    const ResourceContentHash cachedRes(1234u, 0u);
+    const ResourceContentHash largeRes(1235u, 0u);
+    registerAndProvideResource(cachedRes);
+    EXPECT_CALL(uploader, uploadResource(_, _, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUploaded(cachedRes);
+
+    registerAndProvideResource(largeRes, false, &largeResource);
+    expectResourceStaged();
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    updateUntilTransferredFromStagingBuffer();
+
+    // nothing new to upload, but staged upload still in flight needs cache
+    makeResourceUnused(cachedRes);
+    EXPECT_CALL(rendererBackend.deviceMock, isFenceSignaled(fence)).WillOnce(Return(false));
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, cachedRes, _));
+    rendererResourceUploader.uploadAndUnloadPendingResources();
+    expectResourceUnloaded(cachedRes);
+
+    unregisterResource(largeRes);
+
+    EXPECT_CALL(rendererBackend.deviceMock, deleteFence(fence));
+    EXPECT_CALL(rendererBackend.deviceMock, deleteStagingBuffer(stagingBuffer));
+    EXPECT_CALL(uploader, unloadResource(_, EResourceType_IndexArray, largeRes, ResourceUploaderMock::FakeResourceDeviceHandle));
+}
+
 TEST_F(AClientResourceUploadingManager_WithVRAMCache, willUploadResourcesEvenIfExceedingCacheSize)
 {
     // test resource has size of 10 bytes
@@ -311,3 +311,143 @@ TEST_F(ADefaultRendererResourceCache, reportsFailWhenCacheTooSmall)
     createTestFile();
     EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
 }
+
+TEST_F(ADefaultRendererResourceCache, unloadsLeastRecentlyUsedItemWhenOutOfSpace)
+{
+    uint8_t inputBuffer[1000] = {};
+    uint32_t size;
+    ramses::DefaultRendererResourceCache cache(100);
+
+    cache.storeResource(ramses::rendererResourceId_t(1, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    cache.storeResource(ramses::rendererResourceId_t(2, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+
+    // use oldest item, so other one becomes least recently used
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+
+    cache.storeResource(ramses::rendererResourceId_t(3, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(2, 0), size)); // Now gone
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(3, 0), size));
+}
+
+TEST_F(ADefaultRendererResourceCache, countsHitsMissesAndEvictions)
+{
+    uint8_t inputBuffer[100] = {};
+    uint32_t size;
+    ramses::DefaultRendererResourceCache cache(100);
+    EXPECT_EQ(0u, cache.getCacheHitCount());
+    EXPECT_EQ(0u, cache.getCacheMissCount());
+    EXPECT_EQ(0u, cache.getEvictionCount());
+
+    cache.storeResource(ramses::rendererResourceId_t(1, 0), inputBuffer, 60, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(2, 0), size));
+    cache.storeResource(ramses::rendererResourceId_t(2, 0), inputBuffer, 60, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(2, 0), size));
+
+    EXPECT_EQ(2u, cache.getCacheHitCount());
+    EXPECT_EQ(1u, cache.getCacheMissCount());
+    EXPECT_EQ(1u, cache.getEvictionCount());
+}
+
+TEST_F(ADefaultRendererResourceCache, supportsCacheSizeLargerThan4GB)
+{
+    const uint64_t maxSize = 0x100000000ull + 100u;
+    ramses::DefaultRendererResourceCache cache(maxSize);
+    EXPECT_TRUE(cache.shouldResourceBeCached(ramses::rendererResourceId_t(123, 123), std::numeric_limits<uint32_t>::max(), ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7)));
+}
+
+TEST_F(ADefaultRendererResourceCache, keepsUsageOrderWhenSavingAndLoading)
+{
+    uint8_t inputBuffer[100] = {};
+    uint32_t size;
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        cache.storeResource(ramses::rendererResourceId_t(1, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+        cache.storeResource(ramses::rendererResourceId_t(2, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+        EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+        cache.saveToFile(m_saveFilePath.c_str());
+    }
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    loadedCache.storeResource(ramses::rendererResourceId_t(3, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    EXPECT_TRUE(loadedCache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+    EXPECT_FALSE(loadedCache.hasResource(ramses::rendererResourceId_t(2, 0), size));
+}
+
+TEST_F(ADefaultRendererResourceCache, canLoadFromFileLazily)
+{
+    createTestFile();
+
+    ramses::DefaultRendererResourceCache cache(100);
+    EXPECT_TRUE(cache.loadFromFileLazily(m_saveFilePath.c_str()));
+
+    uint8_t data_2[] = {18u, 32u, 13u, 22u, 13u, 221u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 123u, 110u};
+    CheckItemInCache(cache, ramses::rendererResourceId_t(0x0, 0x1), data_2, sizeof(data_2));
+}
+
+TEST_F(ADefaultRendererResourceCache, detectsCorruptDataOnAccessWhenLoadedLazily)
+{
+    createTestFile();
+    // corrupt last byte, which belongs to data of least recently stored resource
+    ramses_internal::File file(m_saveFilePath);
+    UInt fileSize(0);
+    file.getSizeInBytes(fileSize);
+    corruptTestFile(static_cast<uint32_t>(fileSize - 1));
+
+    ramses::DefaultRendererResourceCache cache(100);
+    EXPECT_TRUE(cache.loadFromFileLazily(m_saveFilePath.c_str()));
+
+    const ramses::rendererResourceId_t resId_1(0xFFFFFFFF123, 0x321FFFFFFFF);
+    uint32_t size = 0;
+    ASSERT_TRUE(cache.hasResource(resId_1, size));
+    std::vector<uint8_t> buffer(size);
+    EXPECT_FALSE(cache.getResourceData(resId_1, buffer.data(), size));
+    EXPECT_FALSE(cache.hasResource(resId_1, size));
+
+    // can be stored again
+    uint8_t data_1[] = {17u, 37u, 12u, 23u, 123u, 21u};
+    cache.storeResource(resId_1, data_1, sizeof(data_1), ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    CheckItemInCache(cache, resId_1, data_1, sizeof(data_1));
+}
+
+TEST_F(ADefaultRendererResourceCache, canSaveToSameFileItWasLazilyLoadedFrom)
+{
+    createTestFile();
+
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFileLazily(m_saveFilePath.c_str()));
+        cache.saveToFile(m_saveFilePath.c_str());
+
+        uint8_t data_3[] = {22u};
+        CheckItemInCache(cache, ramses::rendererResourceId_t(0x123456, 0x12345), data_3, sizeof(data_3));
+    }
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    uint8_t data_1[] = {17u, 37u, 12u, 23u, 123u, 21u};
+    CheckItemInCache(loadedCache, ramses::rendererResourceId_t(0xFFFFFFFF123, 0x321FFFFFFFF), data_1, sizeof(data_1));
+}
+
+
+TEST_F(ADefaultRendererResourceCache, canSaveToSameFileItWasLoadedFromViaDifferentPath)
+{
+    createTestFile();
+    const String samePath = String("./") + m_saveFilePath;
+
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        cache.saveToFile(samePath.c_str());
+
+        uint8_t data_2[] = {18u, 32u, 13u, 22u, 13u, 221u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 123u, 110u};
+        CheckItemInCache(cache, ramses::rendererResourceId_t(0x0, 0x1), data_2, sizeof(data_2));
+    }
+
+    ramses::DefaultRendererResourceCache loadedCache(100);
+    EXPECT_TRUE(loadedCache.loadFromFile(m_saveFilePath.c_str()));
+    uint8_t data_1[] = {17u, 37u, 12u, 23u, 123u, 21u};
+    CheckItemInCache(loadedCache, ramses::rendererResourceId_t(0xFFFFFFFF123, 0x321FFFFFFFF), data_1, sizeof(data_1));
+}
@@ -37,6 +37,7 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_TRUE(!m_config.getIntegrityRGLDeviceUnit().isValid());
     EXPECT_FALSE(m_config.getStartVisibleIvi());
     EXPECT_FALSE(m_config.isResizable());
+    EXPECT_FALSE(m_config.isDrawCallBatchingEnabled());
     EXPECT_EQ(ramses_internal::ProjectionParams::Perspective(19.0f, 1280.f / 480.f, 0.1f, 1500.f), m_config.getProjectionParams());
     EXPECT_EQ(0u, m_config.getGPUMemoryCacheSize());
     EXPECT_EQ(ramses_internal::Vector4(0.f,0.f,0.f,1.f), m_config.getClearColor());
@@ -99,6 +100,13 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setResizable(false);
     EXPECT_FALSE(m_config.isResizable());
 
+    m_config.setDrawCallBatchingEnabled(true);
+    EXPECT_TRUE(m_config.isDrawCallBatchingEnabled());
+
+    const ramses_internal::ResourceContentHashVector effects{ ramses_internal::ResourceContentHash(1u, 2u), ramses_internal::ResourceContentHash(3u, 4u) };
+    m_config.setEffectsToPrewarm(effects);
+    EXPECT_EQ(effects, m_config.getEffectsToPrewarm());
+
     ramses_internal::ProjectionParams projParams = ramses_internal::ProjectionParams::Frustum(ramses_internal::ECameraProjectionType_Orthographic,
         0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f);
     m_config.setProjectionParams(projParams);
@@ -54,6 +54,19 @@ namespace ramses_internal
         destroyDisplayController(displayController);
     }
 
+    TEST_F(ADisplayController, disablesContext)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        InSequence seq;
+        EXPECT_CALL(m_renderBackend, getSurface());
+        EXPECT_CALL(m_renderBackend.surfaceMock, disable());
+
+        displayController.disableContext();
+
+        destroyDisplayController(displayController);
+    }
+
     TEST_F(ADisplayController, activatesBufferAndClearsOnClearBuffer)
     {
         const Vector4 clearColor(0.1f, 0.2f, 0.3f, 0.4f);
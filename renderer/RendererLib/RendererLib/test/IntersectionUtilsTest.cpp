@@ -569,3 +569,29 @@ TEST(IntersectionUtilsTest, handlesPickableViewportCorrectly)
     checkSceneForIntersectedPickableObjects(scene, coordsInNDSMissPickablesInTopLeft, dispResolution, {});
     checkSceneForIntersectedPickableObjects(scene, coordsInNDSMissPickablesInBottomRight, dispResolution, {});
 }
+
+TEST(IntersectionUtilsTest, picksUpdatedGeometryWhenGeometryBufferChanges)
+{
+    RendererEventCollector rendererEventCollector;
+    RendererScenes rendererScenes(rendererEventCollector);
+    TransformationLinkCachedScene scene(rendererScenes.getSceneLinksManager(), {});
+    SceneAllocateHelper sceneAllocator(scene);
+    const float vertexPositionsTriangle[] = { -1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f };
+    const Vector2i dispResolution = { 1280, 480 };
+
+    const CameraHandle cameraHandle = preparePickableCamera(scene, sceneAllocator, { 0, 0 }, dispResolution, { -4.f, 0.f, 11.f }, { 0.f, 40.f, 0.f }, { 1.f, 1.f, 1.f });
+    const DataBufferHandle geometryBuffer = prepareGeometryBuffer(scene, sceneAllocator, vertexPositionsTriangle, sizeof(vertexPositionsTriangle));
+    const PickableObjectId pickableId(341u);
+    preparePickableObject(scene, sceneAllocator, geometryBuffer, cameraHandle, pickableId, { 0.1f, 1.0f, -1.0f }, { 70.0f, 0.0f, 0.0f }, { 10.0f, 10.0f, 10.0f });
+
+    const Vector2 coordsInViewportSpaceHit = { 0.310937f, 0.354166f };
+    checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceHit, dispResolution, { pickableId });
+
+    // move triangle away from picked position
+    const float vertexPositionsTriangleMoved[] = { 9.f, 0.f, 0.f, 11.f, 0.f, 0.f, 10.f, 1.f, 0.f };
+    scene.updateDataBuffer(geometryBuffer, 0, sizeof(vertexPositionsTriangleMoved), reinterpret_cast<const Byte*>(vertexPositionsTriangleMoved));
+    checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceHit, dispResolution, {});
+
+    scene.updateDataBuffer(geometryBuffer, 0, sizeof(vertexPositionsTriangle), reinterpret_cast<const Byte*>(vertexPositionsTriangle));
+    checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceHit, dispResolution, { pickableId });
+}
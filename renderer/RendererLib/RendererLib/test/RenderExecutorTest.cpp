@@ -19,6 +19,7 @@
 #include "RendererEventCollector.h"
 #include "SceneAllocateHelper.h"
 #include "PlatformAbstraction/PlatformMath.h"
+#include "Resource/EffectResource.h"
 
 namespace ramses_internal {
 using namespace testing;
@@ -146,6 +147,9 @@ public:
         dataFields[vertPosField.asMemoryHandle()] = DataFieldInfo(EDataType_Vector3Buffer, 1u, EFixedSemantics_VertexPositionAttribute);
         dataFields[vertTexcoordField.asMemoryHandle()] = DataFieldInfo(EDataType_Vector2Buffer, 1u, EFixedSemantics_VertexTexCoordAttribute);
         geometryLayout = sceneAllocator.allocateDataLayout(dataFields, ResourceProviderMock::FakeEffectHash, DataLayoutHandle(2u));
+
+        // fallback outside of any sequence, expectations added inside InSequence blocks get retired once later commands match
+        expectAnyUniformDataVersionQueries();
     }
 
 protected:
@@ -177,6 +181,7 @@ protected:
 
     DataLayoutHandle uniformLayout;
     DataLayoutHandle geometryLayout;
+    DataLayoutHandle batchableUniformLayout;
 
     RenderPassHandle createRenderPassWithCamera(ECameraProjectionType cameraProjType = ECameraProjectionType_Renderer, const Viewport& viewport = { fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight })
     {
@@ -338,6 +343,12 @@ protected:
         expectFrameRenderCommands(renderable, expectedModelMatrix, expectedRendererViewMatrix, expectedCameraViewMatrix, projMatrix);
     }
 
+    void expectAnyUniformDataVersionQueries()
+    {
+        EXPECT_CALL(device, getActiveShaderUniformDataVersion()).Times(AnyNumber());
+        EXPECT_CALL(device, setActiveShaderUniformDataVersion(_)).Times(AnyNumber());
+    }
+
     void expectFrameRenderCommands(RenderableHandle /*renderable*/,
         Matrix44f expectedModelMatrix = Matrix44f::Identity,
         Matrix44f expectedRendererViewMatrix = Matrix44f::Identity,
@@ -347,8 +358,12 @@ protected:
         bool expectRenderStateChanges = true,
         bool expectIndexBufferActivation = true,
         UInt32 instanceCount = 1u,
-        bool expectIndexedRendering = true)
+        bool expectIndexedRendering = true,
+        bool expectUniforms = true)
     {
+        // tests interested in uniform data versions have to set their expectations after this call
+        expectAnyUniformDataVersionQueries();
+
         // TODO violin this is not entirely needed, only need to check that draw call is at the end of the commands
         InSequence seq;
 
@@ -380,15 +395,21 @@ protected:
         }
         EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertPosField, 3u, startVertex))                                                                 .RetiresOnSaturation();
         EXPECT_CALL(device, activateVertexBuffer(FakeVertexBufferDeviceHandle, fakeEffectInputs.vertTexcoordField, 4u, startVertex))                                                            .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const Float*>(Pointee(Eq(0.1f)))))                                             .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))                  .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldRendererViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedRendererViewMatrix)))))    .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldCameraViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedCameraViewMatrix)))))        .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                    .RetiresOnSaturation();
+        if (expectUniforms)
+        {
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const Float*>(Pointee(Eq(0.1f)))))                                         .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))              .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldRendererViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedRendererViewMatrix))))).RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldCameraViewMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedCameraViewMatrix)))))    .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const Matrix44f*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                .RetiresOnSaturation();
+        }
         EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureField))                                                                         .RetiresOnSaturation();
         EXPECT_CALL(device, setTextureSampling(textureField, EWrapMethod::Clamp, EWrapMethod::Repeat, EWrapMethod::RepeatMirrored, ESamplingMethod::Nearest_MipMapNearest, ESamplingMethod::Nearest, 2u)).RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                           .RetiresOnSaturation();
-        EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))                   .RetiresOnSaturation();
+        if (expectUniforms)
+        {
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const Float*>(Pointee(Eq(-666.f)))))                                       .RetiresOnSaturation();
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const Matrix22f*>(Pointee(Eq(Matrix22f(1,2,3,4))))))               .RetiresOnSaturation();
+        }
         if (expectIndexBufferActivation)
         {
             EXPECT_CALL(device, activateIndexBuffer(FakeIndexBufferDeviceHandle))                                                                           .RetiresOnSaturation();
@@ -454,11 +475,65 @@ protected:
         Mock::VerifyAndClearExpectations(&renderer);
     }
 
-    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr)
+    DataInstanceHandle createBatchableUniformData(Float value)
+    {
+        // model matrix declared as array can be set per instance of merged draw call, if effect indexes it by instance ID
+        ON_CALL(resourceManager, getClientEffectSupportsDrawCallBatching(ResourceProviderMock::FakeEffectHash)).WillByDefault(Return(true));
+        if (!batchableUniformLayout.isValid())
+            batchableUniformLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{ EDataType_Float }, DataFieldInfo{ EDataType_Matrix44F, 4u, EFixedSemantics_ModelMatrix } }, ResourceProviderMock::FakeEffectHash);
+
+        const DataInstanceHandle uniformData = sceneAllocator.allocateDataInstance(batchableUniformLayout);
+        scene.setDataSingleFloat(uniformData, DataFieldHandle(0u), value);
+        return uniformData;
+    }
+
+    DataInstances createNonInstancedTestDataInstance()
+    {
+        // vertex attributes with instancing divisor would prevent culling and merging of renderables
+        const DataInstances dataInstances = createTestDataInstance();
+        scene.setDataResource(dataInstances.second, vertPosField, ResourceProviderMock::FakeVertArrayHash, DataBufferHandle::Invalid(), 0u);
+        scene.setDataResource(dataInstances.second, vertTexcoordField, ResourceProviderMock::FakeVertArrayHash2, DataBufferHandle::Invalid(), 0u);
+        return dataInstances;
+    }
+
+    DataInstanceHandle createBatchableGeometryData()
+    {
+        return createNonInstancedTestDataInstance().second;
+    }
+
+    RenderableHandle createBatchableRenderable(RenderGroupHandle group, Int32 order, DataInstanceHandle uniformData, DataInstanceHandle geometryData, const Vector3& translation)
+    {
+        const RenderableHandle renderable = createTestRenderable({ uniformData, geometryData });
+        scene.addRenderableToRenderGroup(group, renderable, order);
+        scene.setTranslation(addTransformToRenderable(renderable), translation);
+        return renderable;
+    }
+
+    void expectAnyRenderCommandsExceptDrawCalls()
+    {
+        expectAnyUniformDataVersionQueries();
+        EXPECT_CALL(device, scissorTest(_, _)).Times(AnyNumber());
+        EXPECT_CALL(device, depthFunc(_)).Times(AnyNumber());
+        EXPECT_CALL(device, depthWrite(_)).Times(AnyNumber());
+        EXPECT_CALL(device, stencilFunc(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, stencilOp(_, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, blendOperations(_, _)).Times(AnyNumber());
+        EXPECT_CALL(device, blendFactors(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, colorMask(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, cullMode(_)).Times(AnyNumber());
+        EXPECT_CALL(device, drawMode(_)).Times(AnyNumber());
+        EXPECT_CALL(device, activateShader(_)).Times(AnyNumber());
+        EXPECT_CALL(device, activateVertexBuffer(_, _, _, _)).Times(AnyNumber());
+        EXPECT_CALL(device, activateIndexBuffer(_)).Times(AnyNumber());
+        EXPECT_CALL(device, setConstant(_, _, Matcher<const Float*>(_))).Times(AnyNumber());
+        EXPECT_CALL(device, setConstant(_, _, Matcher<const Matrix44f*>(_))).Times(AnyNumber());
+    }
+
+    SceneRenderExecutionIterator executeScene(SceneRenderExecutionIterator renderFrom = {}, const FrameTimer* frameTimer = nullptr, Bool drawCallBatchingEnabled = false)
     {
         const Viewport vp(fakeViewportX, fakeViewportY, fakeViewportWidth, fakeViewportHeight);
         const FrameBufferInfo fbInfo(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, projectionParams, vp);
-        RenderExecutor executor(device, fbInfo, renderFrom, frameTimer);
+        RenderExecutor executor(device, fbInfo, renderFrom, frameTimer, drawCallBatchingEnabled);
 
         return executor.executeScene(scene, Matrix44f::Identity);
     }
@@ -792,6 +867,149 @@ TEST_F(ARenderExecutor, RendersRenderableWithOrthographicProjection)
     expectRenderingWithProjection(renderable, projMatrix);
 }
 
+TEST_F(ARenderExecutor, RendersRenderableWithBoundingBoxInsideOfViewFrustum)
+{
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+    scene.setRenderableBoundingBox(renderable, BoundingBox(Vector3(-1.f), Vector3(1.f)));
+
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    expectRenderingWithProjection(renderable, projMatrix);
+
+    const auto renderingStatistics = scene.collectRenderingStatistics();
+    EXPECT_EQ(0u, renderingStatistics.numCulled);
+    EXPECT_EQ(1u, renderingStatistics.numRendered);
+}
+
+TEST_F(ARenderExecutor, RendersRenderableWithBoundingBoxIntersectingViewFrustum)
+{
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+    scene.setRenderableBoundingBox(renderable, BoundingBox(Vector3(1.f, -1.f, -1.f), Vector3(10.f, 1.f, 1.f)));
+
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    expectRenderingWithProjection(renderable, projMatrix);
+}
+
+TEST_F(ARenderExecutor, DoesNotRenderRenderableWithBoundingBoxOutsideOfViewFrustum)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createNonInstancedTestDataInstance(), createRenderGroup(pass));
+    scene.setRenderableBoundingBox(renderable, BoundingBox(Vector3(10.f, -1.f, -1.f), Vector3(11.f, 1.f, 1.f)));
+
+    updateScenes();
+    // empty frame
+    expectActivateFramebufferRenderTarget();
+
+    executeScene();
+
+    const auto renderingStatistics = scene.collectRenderingStatistics();
+    EXPECT_EQ(1u, renderingStatistics.numCulled);
+    EXPECT_EQ(0u, renderingStatistics.numRendered);
+}
+
+TEST_F(ARenderExecutor, CullsRenderableUsingItsWorldTransformation)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createNonInstancedTestDataInstance(), createRenderGroup(pass));
+    scene.setRenderableBoundingBox(renderable, BoundingBox(Vector3(-1.f), Vector3(1.f)));
+    const TransformHandle transform = addTransformToNode(scene.getRenderable(renderable).node);
+    scene.setTranslation(transform, Vector3(20.f, 0.f, 0.f));
+
+    updateScenes();
+    // empty frame
+    expectActivateFramebufferRenderTarget();
+
+    executeScene();
+
+    EXPECT_EQ(1u, scene.collectRenderingStatistics().numCulled);
+}
+
+TEST_F(ARenderExecutor, DoesNotCullInstancedRenderableWithBoundingBoxOutsideOfViewFrustum)
+{
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createNonInstancedTestDataInstance(), createRenderGroup(renderPass));
+    const UInt32 instanceCount = 3u;
+    scene.setRenderableInstanceCount(renderable, instanceCount);
+    scene.setRenderableBoundingBox(renderable, BoundingBox(Vector3(10.f, -1.f, -1.f), Vector3(11.f, 1.f, 1.f)));
+
+    updateScenes();
+
+    expectActivateFramebufferRenderTarget();
+    expectAnyRenderCommandsExceptDrawCalls();
+    EXPECT_CALL(device, activateTexture(_, _)).Times(AnyNumber());
+    EXPECT_CALL(device, setTextureSampling(_, _, _, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(device, setConstant(_, _, Matcher<const Matrix22f*>(_))).Times(AnyNumber());
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, instanceCount));
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_EQ(0u, scene.collectRenderingStatistics().numCulled);
+}
+
+TEST_F(ARenderExecutor, DoesNotCullRenderableWithInstancedVertexAttributesAndBoundingBoxOutsideOfViewFrustum)
+{
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+    scene.setRenderableBoundingBox(renderable, BoundingBox(Vector3(10.f, -1.f, -1.f), Vector3(11.f, 1.f, 1.f)));
+
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    expectRenderingWithProjection(renderable, projMatrix);
+    EXPECT_EQ(0u, scene.collectRenderingStatistics().numCulled);
+}
+
+TEST_F(ARenderExecutor, DoesNotSetUniformsAgainIfUniformDataNotChangedSinceSetToShader)
+{
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    updateScenes();
+
+    UniformDataVersion uniformDataVersion;
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
+    EXPECT_CALL(device, setActiveShaderUniformDataVersion(_)).WillOnce(SaveArg<0>(&uniformDataVersion));
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+    EXPECT_NE(UniformDataVersion{}, uniformDataVersion);
+
+    // shader reports uniform data set in previous frame, only textures are activated again
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix, true, true, true, 1u, true, false);
+    EXPECT_CALL(device, getActiveShaderUniformDataVersion()).WillRepeatedly(Return(uniformDataVersion));
+    EXPECT_CALL(device, setActiveShaderUniformDataVersion(_)).Times(0);
+    executeScene();
+}
+
+TEST_F(ARenderExecutor, SetsUniformsAgainIfReferencedDataChangedSinceSetToShader)
+{
+    const RenderPassHandle renderPass = createRenderPassWithCamera();
+    const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    updateScenes();
+
+    UniformDataVersion uniformDataVersion1;
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
+    EXPECT_CALL(device, setActiveShaderUniformDataVersion(_)).WillOnce(SaveArg<0>(&uniformDataVersion1));
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+
+    // modify referenced data and set back to original value so that expectations stay the same
+    scene.setDataSingleFloat(dataRef2, DataFieldHandle(0u), 1.f);
+    scene.setDataSingleFloat(dataRef2, DataFieldHandle(0u), -666.f);
+
+    UniformDataVersion uniformDataVersion2;
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
+    EXPECT_CALL(device, getActiveShaderUniformDataVersion()).WillRepeatedly(Return(uniformDataVersion1));
+    EXPECT_CALL(device, setActiveShaderUniformDataVersion(_)).WillOnce(SaveArg<0>(&uniformDataVersion2));
+    executeScene();
+
+    EXPECT_EQ(uniformDataVersion1.dataVersion, uniformDataVersion2.dataVersion);
+    EXPECT_LT(uniformDataVersion1.referencedDataVersion, uniformDataVersion2.referencedDataVersion);
+}
+
 TEST_F(ARenderExecutor, RendersRenderableInTwoPassesUsingTheSameCamera)
 {
     const RenderPassHandle renderPass1 = createRenderPassWithCamera();
@@ -1161,4 +1379,217 @@ TEST_F(ARenderExecutor, willContinueRenderingWhereLeftOffLastRenderWhenInterrupt
     renderIterator = executeScene(renderIterator, &frameTimer);
     EXPECT_EQ(SceneRenderExecutionIterator(), renderIterator); // finished
 }
+
+TEST_F(ARenderExecutor, MergesConsecutiveCompatibleRenderablesIntoSingleInstancedDrawCall)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometryData = createBatchableGeometryData();
+    const DataInstanceHandle uniformData = createBatchableUniformData(0.5f);
+    createBatchableRenderable(group, 0, uniformData, geometryData, Vector3(1.f, 0.f, 0.f));
+    createBatchableRenderable(group, 1, createBatchableUniformData(0.5f), geometryData, Vector3(2.f, 0.f, 0.f));
+    createBatchableRenderable(group, 2, createBatchableUniformData(0.5f), createBatchableGeometryData(), Vector3(3.f, 0.f, 0.f));
+    updateScenes();
+
+    expectActivateFramebufferRenderTarget();
+    expectAnyRenderCommandsExceptDrawCalls();
+    std::vector<Matrix44f> modelMatrices;
+    EXPECT_CALL(device, setConstant(DataFieldHandle(1u), 4u, Matcher<const Matrix44f*>(_))).WillOnce(Invoke([&](DataFieldHandle, UInt32 count, const Matrix44f* value)
+    {
+        modelMatrices.assign(value, value + count);
+    }));
+    EXPECT_CALL(device, activateTexture(_, _)).Times(AnyNumber());
+    EXPECT_CALL(device, setTextureSampling(_, _, _, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 3u));
+    executeScene({}, nullptr, true);
+    Mock::VerifyAndClearExpectations(&device);
+
+    ASSERT_EQ(4u, modelMatrices.size());
+    EXPECT_THAT(modelMatrices[0], PermissiveMatrixEq(Matrix44f::Translation(Vector3(1.f, 0.f, 0.f))));
+    EXPECT_THAT(modelMatrices[1], PermissiveMatrixEq(Matrix44f::Translation(Vector3(2.f, 0.f, 0.f))));
+    EXPECT_THAT(modelMatrices[2], PermissiveMatrixEq(Matrix44f::Translation(Vector3(3.f, 0.f, 0.f))));
+    EXPECT_THAT(modelMatrices[3], PermissiveMatrixEq(Matrix44f::Translation(Vector3(3.f, 0.f, 0.f))));
+
+    const auto renderingStatistics = scene.collectRenderingStatistics();
+    EXPECT_EQ(3u, renderingStatistics.numRendered);
+    EXPECT_EQ(2u, renderingStatistics.numMergedDrawCalls);
+}
+
+TEST_F(ARenderExecutor, DoesNotMergeRenderablesIfDrawCallBatchingDisabled)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometryData = createBatchableGeometryData();
+    createBatchableRenderable(group, 0, createBatchableUniformData(0.5f), geometryData, Vector3(1.f, 0.f, 0.f));
+    createBatchableRenderable(group, 1, createBatchableUniformData(0.5f), geometryData, Vector3(2.f, 0.f, 0.f));
+    updateScenes();
+
+    expectActivateFramebufferRenderTarget();
+    expectAnyRenderCommandsExceptDrawCalls();
+    std::vector<std::vector<Matrix44f>> modelMatrices;
+    EXPECT_CALL(device, setConstant(DataFieldHandle(1u), 4u, Matcher<const Matrix44f*>(_))).Times(2u).WillRepeatedly(Invoke([&](DataFieldHandle, UInt32 count, const Matrix44f* value)
+    {
+        modelMatrices.emplace_back(value, value + count);
+    }));
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2u);
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+
+    // model matrix array is not filled per instance if not batching
+    ASSERT_EQ(2u, modelMatrices.size());
+    EXPECT_THAT(modelMatrices[0][0], PermissiveMatrixEq(Matrix44f::Translation(Vector3(1.f, 0.f, 0.f))));
+    EXPECT_THAT(modelMatrices[0][1], Not(PermissiveMatrixEq(Matrix44f::Translation(Vector3(1.f, 0.f, 0.f)))));
+    EXPECT_THAT(modelMatrices[1][0], PermissiveMatrixEq(Matrix44f::Translation(Vector3(2.f, 0.f, 0.f))));
+    EXPECT_THAT(modelMatrices[1][1], Not(PermissiveMatrixEq(Matrix44f::Translation(Vector3(2.f, 0.f, 0.f)))));
+
+    const auto renderingStatistics = scene.collectRenderingStatistics();
+    EXPECT_EQ(2u, renderingStatistics.numRendered);
+    EXPECT_EQ(0u, renderingStatistics.numMergedDrawCalls);
+}
+
+TEST_F(ARenderExecutor, DoesNotMergeRenderablesIfEffectNotValidatedForDrawCallBatching)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometryData = createBatchableGeometryData();
+    createBatchableRenderable(group, 0, createBatchableUniformData(0.5f), geometryData, Vector3(1.f, 0.f, 0.f));
+    createBatchableRenderable(group, 1, createBatchableUniformData(0.5f), geometryData, Vector3(2.f, 0.f, 0.f));
+    ON_CALL(resourceManager, getClientEffectSupportsDrawCallBatching(ResourceProviderMock::FakeEffectHash)).WillByDefault(Return(false));
+    updateScenes();
+
+    expectActivateFramebufferRenderTarget();
+    expectAnyRenderCommandsExceptDrawCalls();
+    EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2u);
+    executeScene({}, nullptr, true);
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_EQ(0u, scene.collectRenderingStatistics().numMergedDrawCalls);
+}
+
+TEST_F(ARenderExecutor, DoesNotMergeRenderablesWithDifferentUniformsOrRenderStates)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstanceHandle geometryData = createBatchableGeometryData();
+    createBatchableRenderable(group, 0, createBatchableUniformData(0.5f), geometryData, Vector3(1.f, 0.f, 0.f));
+    createBatchableRenderable(group, 1, createBatchableUniformData(0.5f), geometryData, Vector3(2.f, 0.f, 0.f));
+    createBatchableRenderable(group, 2, createBatchableUniformData(0.7f), geometryData, Vector3(3.f, 0.f, 0.f));
+    const RenderableHandle renderableWithOtherState = createBatchableRenderable(group, 3, createBatchableUniformData(0.7f), geometryData, Vector3(4.f, 0.f, 0.f));
+    scene.setRenderStateDepthWrite(scene.getRenderable(renderableWithOtherState).renderState, EDepthWrite::Disabled);
+    updateScenes();
+
+    expectActivateFramebufferRenderTarget();
+    expectAnyRenderCommandsExceptDrawCalls();
+    {
+        InSequence seq;
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 2u));
+        EXPECT_CALL(device, drawIndexedTriangles(startIndex, indexCount, 1u)).Times(2u);
+    }
+    executeScene({}, nullptr, true);
+    Mock::VerifyAndClearExpectations(&device);
+
+    const auto renderingStatistics = scene.collectRenderingStatistics();
+    EXPECT_EQ(4u, renderingStatistics.numRendered);
+    EXPECT_EQ(1u, renderingStatistics.numMergedDrawCalls);
+}
+
+TEST_F(ARenderExecutor, DoesNotMergeRenderablesIfEffectHasNoModelMatrixArray)
+{
+    const RenderPassHandle pass = createRenderPassWithCamera();
+    const RenderGroupHandle group = createRenderGroup(pass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances, group);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+    scene.addRenderableToRenderGroup(group, renderable2, 1);
+    updateScenes();
+
+    const Matrix44f projMatrix = CameraMatrixHelper::ProjectionMatrix(projectionParams);
+    expectActivateFramebufferRenderTarget();
+    expectFrameRenderCommands(renderable2, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix, false, false, false);
+    expectFrameRenderCommands(renderable1, Matrix44f::Identity, Matrix44f::Identity, Matrix44f::Identity, projMatrix);
+    executeScene({}, nullptr, true);
+    Mock::VerifyAndClearExpectations(&device);
+
+    EXPECT_EQ(0u, scene.collectRenderingStatistics().numMergedDrawCalls);
+}
+
+TEST(ARenderExecutorEffectValidation, supportsDrawCallBatchingIfModelMatrixArrayIsIndexedByInstanceIdInVertexShaderOnly)
+{
+    const EffectInputInformationVector uniforms{ EffectInputInformation("u_mvp", 4u, EDataType_Matrix44F, EFixedSemantics_ModelViewProjectionMatrix, EEffectInputTextureType_Invalid) };
+    const EffectResource effect(
+        "uniform mat4 u_mvp[4];\nattribute vec3 a_position;\nvoid main()\n{\n    gl_Position = u_mvp[ gl_InstanceID ] * vec4(a_position, 1.0);\n}\n",
+        "void main()\n{\n    gl_FragColor = vec4(1.0);\n}\n",
+        uniforms, EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_TRUE(RenderExecutor::EffectSupportsDrawCallBatching(effect));
+}
+
+// effect written following the shader contract documented at ramses::DisplayConfig::setDrawCallBatchingEnabled
+TEST(ARenderExecutorEffectValidation, supportsDrawCallBatchingForEffectFollowingDocumentedShaderContract)
+{
+    const EffectInputInformationVector uniforms
+    {
+        EffectInputInformation("mvpMatrix", 16u, EDataType_Matrix44F, EFixedSemantics_ModelViewProjectionMatrix, EEffectInputTextureType_Invalid),
+        EffectInputInformation("normalMatrix", 16u, EDataType_Matrix44F, EFixedSemantics_NormalMatrix, EEffectInputTextureType_Invalid),
+        EffectInputInformation("lightDirection", 1u, EDataType_Vector3F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid),
+        EffectInputInformation("color", 1u, EDataType_Vector4F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid)
+    };
+    const EffectResource effect(
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "uniform highp mat4 mvpMatrix[16];\n"
+        "uniform highp mat4 normalMatrix[16];\n"
+        "in vec3 a_position;\n"
+        "in vec3 a_normal;\n"
+        "out vec3 v_normal;\n"
+        "void main()\n"
+        "{\n"
+        "    v_normal = mat3(normalMatrix[gl_InstanceID]) * a_normal;\n"
+        "    gl_Position = mvpMatrix[gl_InstanceID] * vec4(a_position, 1.0);\n"
+        "}\n",
+        "#version 300 es\n"
+        "precision highp float;\n"
+        "uniform vec3 lightDirection;\n"
+        "uniform vec4 color;\n"
+        "in vec3 v_normal;\n"
+        "out vec4 fragColor;\n"
+        "void main()\n"
+        "{\n"
+        "    fragColor = color * max(dot(normalize(v_normal), -lightDirection), 0.1);\n"
+        "}\n",
+        uniforms, EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_TRUE(RenderExecutor::EffectSupportsDrawCallBatching(effect));
+}
+
+TEST(ARenderExecutorEffectValidation, doesNotSupportDrawCallBatchingIfModelMatrixArrayIsNotIndexedByInstanceId)
+{
+    const EffectInputInformationVector uniforms{ EffectInputInformation("u_model", 4u, EDataType_Matrix44F, EFixedSemantics_ModelMatrix, EEffectInputTextureType_Invalid) };
+    const EffectResource constantIndex(
+        "uniform mat4 u_model[4];\nvoid main()\n{\n    gl_Position = u_model[gl_InstanceID] * u_model[0] * vec4(1.0);\n}\n",
+        "void main()\n{\n}\n",
+        uniforms, EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_FALSE(RenderExecutor::EffectSupportsDrawCallBatching(constantIndex));
+
+    const EffectResource usedInFragmentShader(
+        "uniform mat4 u_model[4];\nvoid main()\n{\n    gl_Position = u_model[gl_InstanceID] * vec4(1.0);\n}\n",
+        "uniform mat4 u_model[4];\nvoid main()\n{\n    gl_FragColor = u_model[0][0];\n}\n",
+        uniforms, EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_FALSE(RenderExecutor::EffectSupportsDrawCallBatching(usedInFragmentShader));
+}
+
+TEST(ARenderExecutorEffectValidation, doesNotSupportDrawCallBatchingWithoutModelDependentSemanticArrays)
+{
+    const EffectInputInformationVector singleMatrix{ EffectInputInformation("u_model", 1u, EDataType_Matrix44F, EFixedSemantics_ModelMatrix, EEffectInputTextureType_Invalid) };
+    const EffectResource notArray(
+        "uniform mat4 u_model;\nvoid main()\n{\n    gl_Position = u_model * vec4(1.0);\n}\n",
+        "void main()\n{\n}\n",
+        singleMatrix, EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_FALSE(RenderExecutor::EffectSupportsDrawCallBatching(notArray));
+
+    const EffectInputInformationVector noSemantics{ EffectInputInformation("u_color", 1u, EDataType_Vector4F, EFixedSemantics_Invalid, EEffectInputTextureType_Invalid) };
+    const EffectResource noModelDependentSemantics(
+        "void main()\n{\n    gl_Position = vec4(1.0);\n}\n",
+        "uniform vec4 u_color;\nvoid main()\n{\n    gl_FragColor = u_color;\n}\n",
+        noSemantics, EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_FALSE(RenderExecutor::EffectSupportsDrawCallBatching(noModelDependentSemantics));
+}
 }
@@ -9,6 +9,7 @@
 #include "renderer_common_gmock_header.h"
 #include "TestSceneHelper.h"
 #include "RendererLib/RendererCachedScene.h"
+#include "RendererLib/RenderableComparator.h"
 #include "RendererLib/RendererScenes.h"
 #include "RendererEventCollector.h"
 #include "FrameBufferInfo.h"
@@ -1056,6 +1057,112 @@ namespace ramses_internal
         expectOrderedRenderablesInPass(pass, { rend1, rend3, rend5, rend6, rend2, rend4 });
     }
 
+    TEST_F(ARendererCachedScene, reordersRenderablesWhenGeometryChangedAfterUpdate)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+
+        const DataLayoutHandle effect1layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 0 });
+        const DataLayoutHandle effect2layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 3, 0 });
+        const DataInstanceHandle effect1geometry = sceneAllocator.allocateDataInstance(effect1layout);
+        const DataInstanceHandle effect2geometry = sceneAllocator.allocateDataInstance(effect2layout);
+
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, effect2geometry);
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, effect1geometry);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend2, rend1 });
+
+        // effect allocated after group was sorted is ranked between existing ones
+        const DataLayoutHandle effect3layout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 2, 0 });
+        const DataInstanceHandle effect3geometry = sceneAllocator.allocateDataInstance(effect3layout);
+        scene.setRenderableDataInstance(rend3, ERenderableDataSlotType_Geometry, effect3geometry);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend3, rend1 });
+    }
+
+    TEST_F(ARendererCachedScene, ordersLargeRenderGroupSameAsRenderableComparator)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const DataLayoutHandle layouts[] = {
+            sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 3, 0 }),
+            sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 5 }),
+            sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 1, 2 })
+        };
+
+        // enough renderables to be sorted by radix sort, with negative orders and one renderable without geometry per order
+        RenderableOrderVector expectedOrder;
+        for (UInt32 i = 0u; i < 300u; ++i)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable();
+            const Int32 order = static_cast<Int32>((i * 7u) % 5u) - 2;
+            scene.addRenderableToRenderGroup(group, renderable, order);
+            if (i >= 5u)
+                scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(layouts[(i * 13u) % 3u]));
+            expectedOrder.push_back({ renderable, order });
+        }
+        std::sort(expectedOrder.begin(), expectedOrder.end(), RenderableComparator(scene));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        const auto& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
+        ASSERT_EQ(expectedOrder.size(), orderedRenderables.size());
+        for (size_t i = 0u; i < expectedOrder.size(); ++i)
+            EXPECT_EQ(expectedOrder[i].renderable, orderedRenderables[i]);
+    }
+
+    TEST_F(ARendererCachedScene, ordersRenderablesByEffectIfTooManyEffectsForSortKey)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+
+        DataLayoutHandle lastLayout;
+        for (UInt32 i = 0u; i < 5000u; ++i)
+            lastLayout = sceneAllocator.allocateDataLayout({}, ResourceContentHash{ 5000u - i, 0 });
+
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(DataLayoutHandle(2u)));
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(lastLayout));
+        scene.setRenderableDataInstance(rend3, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(DataLayoutHandle(0u)));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, keepsOrderOfRenderablesWhenVisibilityToggled)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle otherPass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle otherGroup = sceneHelper.createRenderGroup(otherPass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        const RenderableHandle otherRend = sceneHelper.createRenderable(otherGroup);
+        scene.removeRenderableFromRenderGroup(group, rend1);
+        scene.addRenderableToRenderGroup(group, rend1, 3);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend3, rend1 });
+        expectOrderedRenderablesInPass(otherPass, { otherRend });
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend1 });
+        expectOrderedRenderablesInPass(otherPass, { otherRend });
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager, sceneHelper.embeddedCompositingManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend3, rend1 });
+        expectOrderedRenderablesInPass(otherPass, { otherRend });
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -22,6 +22,7 @@ TEST(AInternalRendererConfig, hasDefaultValues)
     EXPECT_STREQ("", config.getKPIFileName().c_str());
     EXPECT_EQ(std::chrono::microseconds{10000u}, config.getFrameCallbackMaxPollTime());
     EXPECT_STREQ("", config.getWaylandDisplayForSystemCompositorController().c_str());
+    EXPECT_FALSE(config.getRenderThreadPerDisplayEnabled());
 }
 
 TEST(AInternalRendererConfig, canEnableSystemCompositorControl)
@@ -71,6 +72,14 @@ TEST(AInternalRendererConfig, canSetGetMaxFramecallbackPollTime)
     EXPECT_EQ(std::chrono::microseconds{123u}, config.getFrameCallbackMaxPollTime());
 }
 
+TEST(AInternalRendererConfig, canEnableRenderThreadPerDisplay)
+{
+    ramses_internal::RendererConfig config;
+
+    config.setRenderThreadPerDisplayEnabled(true);
+    EXPECT_TRUE(config.getRenderThreadPerDisplayEnabled());
+}
+
 TEST(AInternalRendererConfig, canSetGetWaylandDisplayForSystemCompositorController)
 {
     ramses_internal::RendererConfig config;
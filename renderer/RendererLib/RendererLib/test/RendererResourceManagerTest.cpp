@@ -652,6 +652,7 @@ TEST_F(ARendererResourceManager, UploadAndDeleteValidShader)
     requestResource(resource, fakeSceneId);
     resourceManager.processArrivedClientResources(nullptr);
     EXPECT_TRUE(resourceManager.hasClientResourcesToBeUploaded());
+    EXPECT_CALL(renderer.deviceMock, startShaderCompilation(_));
     EXPECT_CALL(renderer.deviceMock, uploadShader(_));
     resourceManager.uploadAndUnloadPendingClientResources();
 
@@ -670,6 +671,7 @@ TEST_F(ARendererResourceManager, UploadInvalidShaderResultsInBrokenResource)
     requestResource(resource, fakeSceneId);
     resourceManager.processArrivedClientResources(nullptr);
     EXPECT_TRUE(resourceManager.hasClientResourcesToBeUploaded());
+    EXPECT_CALL(renderer.deviceMock, startShaderCompilation(_));
     EXPECT_CALL(renderer.deviceMock, uploadShader(_)).WillRepeatedly(Return(DeviceResourceHandle::Invalid()));
     resourceManager.uploadAndUnloadPendingClientResources();
 
@@ -683,6 +685,99 @@ TEST_F(ARendererResourceManager, UploadInvalidShaderResultsInBrokenResource)
     unrequestResource(resource, fakeSceneId);
 }
 
+TEST_F(ARendererResourceManager, uploadsPrewarmedEffectWithoutSceneAndKeepsItUntilDestruction)
+{
+    const ResourceContentHash resource = ResourceProviderMock::FakeEffectHash;
+    const ResourceContentHash sceneResource = ResourceProviderMock::FakeVertArrayHash;
+    resourceManager.prewarmEffects({ resource });
+
+    // no scene to request effect from yet
+    resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_EQ(EResourceStatus_Unknown, resourceManager.getClientResourceStatus(resource));
+
+    // first scene using the display provides the prewarmed effect
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, { sceneResource });
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(UnorderedElementsAre(sceneResource, resource), resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.requestAndUnrequestPendingClientResources();
+    resourceManager.processArrivedClientResources(nullptr);
+    EXPECT_CALL(renderer.deviceMock, allocateVertexBuffer(_, _));
+    EXPECT_CALL(renderer.deviceMock, uploadVertexBufferData(_, _, _));
+    EXPECT_CALL(renderer.deviceMock, startShaderCompilation(_));
+    EXPECT_CALL(renderer.deviceMock, uploadShader(_));
+    resourceManager.uploadAndUnloadPendingClientResources();
+    EXPECT_EQ(EResourceStatus_Uploaded, resourceManager.getClientResourceStatus(resource));
+
+    // scene using the effect and releasing it again does not unload it
+    requestResource(resource, fakeSceneId, false);
+    unrequestResource(resource, fakeSceneId);
+    EXPECT_CALL(renderer.deviceMock, deleteVertexBuffer(_));
+    unrequestResource(sceneResource, fakeSceneId);
+    resourceManager.uploadAndUnloadPendingClientResources();
+    EXPECT_EQ(EResourceStatus_Uploaded, resourceManager.getClientResourceStatus(resource));
+    Mock::VerifyAndClearExpectations(&renderer.deviceMock);
+
+    EXPECT_CALL(renderer.deviceMock, deleteShader(_));
+}
+
+TEST_F(ARendererResourceManager, requestsPrewarmedEffectAgainFromNextSceneIfProvidingSceneIsUnloadedBeforeEffectArrived)
+{
+    const ResourceContentHash resource = ResourceProviderMock::FakeEffectHash;
+    const ResourceContentHash sceneResource = ResourceProviderMock::FakeVertArrayHash;
+    const SceneId fakeSceneId2(fakeSceneId.getValue() + 1);
+    resourceManager.prewarmEffects({ resource });
+
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, { sceneResource });
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(UnorderedElementsAre(sceneResource, resource), resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.requestAndUnrequestPendingClientResources();
+
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(sceneResource, resourceManager.getRequesterID()));
+    resourceManager.unreferenceAllClientResourcesForScene(fakeSceneId);
+    resourceManager.requestAndUnrequestPendingClientResources();
+    EXPECT_EQ(EResourceStatus_Requested, resourceManager.getClientResourceStatus(resource));
+
+    // effect did not arrive, re-request goes to provider of next scene using the display
+    resourceManager.referenceClientResourcesForScene(fakeSceneId2, { sceneResource });
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(ResourceContentHashVector{ sceneResource }, resourceManager.getRequesterID(), fakeSceneId2));
+    resourceManager.requestAndUnrequestPendingClientResources();
+
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(ResourceContentHashVector{ resource }, resourceManager.getRequesterID(), fakeSceneId2));
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(ResourceContentHashVector{ sceneResource }, resourceManager.getRequesterID(), fakeSceneId2));
+    for (UInt32 i = 0u; i < 90u; ++i)
+        resourceManager.requestAndUnrequestPendingClientResources();
+
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(sceneResource, resourceManager.getRequesterID()));
+    resourceManager.unreferenceAllClientResourcesForScene(fakeSceneId2);
+    resourceManager.requestAndUnrequestPendingClientResources();
+}
+
+TEST_F(ARendererResourceManager, requestsPrewarmedEffectAgainViaSceneReferencingItBeforeEffectArrived)
+{
+    const ResourceContentHash resource = ResourceProviderMock::FakeEffectHash;
+    const ResourceContentHash sceneResource = ResourceProviderMock::FakeVertArrayHash;
+    const SceneId fakeSceneId2(fakeSceneId.getValue() + 1);
+    resourceManager.prewarmEffects({ resource });
+
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, { sceneResource });
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(UnorderedElementsAre(sceneResource, resource), resourceManager.getRequesterID(), fakeSceneId));
+    resourceManager.requestAndUnrequestPendingClientResources();
+
+    // provider of first scene might not have the effect, scene using it requests it right away
+    EXPECT_CALL(resourceProvider, requestResourceAsyncronouslyFromFramework(ResourceContentHashVector{ resource }, resourceManager.getRequesterID(), fakeSceneId2));
+    resourceManager.referenceClientResourcesForScene(fakeSceneId2, { resource });
+    EXPECT_EQ(EResourceStatus_Requested, resourceManager.getClientResourceStatus(resource));
+    resourceManager.requestAndUnrequestPendingClientResources();
+    Mock::VerifyAndClearExpectations(&resourceProvider);
+
+    // effect is not requested again once it is requested via scene using it
+    resourceManager.referenceClientResourcesForScene(fakeSceneId, { resource });
+    resourceManager.requestAndUnrequestPendingClientResources();
+
+    EXPECT_CALL(resourceProvider, cancelResourceRequest(sceneResource, resourceManager.getRequesterID()));
+    resourceManager.unreferenceAllClientResourcesForScene(fakeSceneId);
+    resourceManager.unreferenceAllClientResourcesForScene(fakeSceneId2);
+    resourceManager.requestAndUnrequestPendingClientResources();
+}
+
 TEST_F(ARendererResourceManager, UnrequestingResourceThatDidNotArriveDoesNotDeleteItFromGPU)
 {
     ResourceContentHash resource = ResourceProviderMock::FakeVertArrayHash;
@@ -813,6 +908,7 @@ TEST_F(ARendererResourceManagerWithDisabledEffectDeletion, DeletesEffectOnlyWhen
     requestResource(resource, fakeSceneId);
     resourceManager.processArrivedClientResources(nullptr);
     EXPECT_TRUE(resourceManager.hasClientResourcesToBeUploaded());
+    EXPECT_CALL(renderer.deviceMock, startShaderCompilation(_));
     EXPECT_CALL(renderer.deviceMock, uploadShader(_));
     resourceManager.uploadAndUnloadPendingClientResources();
     EXPECT_EQ(EResourceStatus_Uploaded, resourceManager.getClientResourceStatus(resource));
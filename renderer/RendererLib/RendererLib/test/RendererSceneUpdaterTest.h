@@ -166,6 +166,17 @@ protected:
         expectEvents(expectedEvents, events);
     }
 
+    void expectSceneEventsInAnyOrder(const std::initializer_list<ERendererEventType> expectedEvents)
+    {
+        RendererEventVector events;
+        RendererEventVector dummy;
+        rendererEventCollector.appendAndConsumePendingEvents(dummy, events);
+        std::vector<ERendererEventType> eventTypes;
+        for (const auto& event : events)
+            eventTypes.push_back(event.eventType);
+        EXPECT_THAT(eventTypes, ::testing::UnorderedElementsAreArray(expectedEvents));
+    }
+
     void expectInternalSceneStateEvents(const std::initializer_list<ERendererEventType> expectedEvents)
     {
         InternalSceneStateEvents events;
@@ -505,6 +516,7 @@ protected:
     {
         if (effect)
         {
+            EXPECT_CALL(renderer.getDisplayMock(displayHandle).m_renderBackend->deviceMock, startShaderCompilation(_));
             EXPECT_CALL(renderer.getDisplayMock(displayHandle).m_renderBackend->deviceMock, uploadShader(_));
         }
         if (indexBuffer)
@@ -678,7 +690,8 @@ protected:
         performFlush(providerSceneIdx);
         performFlush(consumerSceneIdx);
         update();
-        expectSceneEvents({ ERendererEventType_SceneDataSlotConsumerCreated, ERendererEventType_SceneDataSlotProviderCreated });
+        // provider and consumer scene are updated in no particular order
+        expectSceneEventsInAnyOrder({ ERendererEventType_SceneDataSlotConsumerCreated, ERendererEventType_SceneDataSlotProviderCreated });
 
         return{ providerId, consumerId };
     }
@@ -712,7 +725,8 @@ protected:
         performFlush(providerSceneIdx);
         performFlush(consumerSceneIdx);
         update();
-        expectSceneEvents({ ERendererEventType_SceneDataSlotConsumerCreated, ERendererEventType_SceneDataSlotProviderCreated });
+        // provider and consumer scene are updated in no particular order
+        expectSceneEventsInAnyOrder({ ERendererEventType_SceneDataSlotConsumerCreated, ERendererEventType_SceneDataSlotProviderCreated });
 
         return{ providerId, consumerId };
     }
@@ -770,7 +784,8 @@ protected:
         performFlush(providerSceneIdx);
         performFlush(consumerSceneIdx);
         update();
-        expectSceneEvents({ ERendererEventType_SceneDataSlotConsumerCreated, ERendererEventType_SceneDataSlotProviderCreated });
+        // provider and consumer scene are updated in no particular order
+        expectSceneEventsInAnyOrder({ ERendererEventType_SceneDataSlotConsumerCreated, ERendererEventType_SceneDataSlotProviderCreated });
 
         return { providerId, consumerId };
     }
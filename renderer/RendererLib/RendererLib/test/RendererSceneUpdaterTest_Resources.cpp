@@ -9,6 +9,7 @@
 #include "RendererSceneUpdaterTest.h"
 #include "TestRandom.h"
 #include "Resource/EffectResource.h"
+#include "Scene/SceneActionUtils.h"
 #include <memory>
 
 namespace ramses_internal {
@@ -435,6 +436,73 @@ TEST_F(ARendererSceneUpdater, syncFlush_pendingFlushesAreNotAppliedIfResourcesNo
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, syncFlush_blockedPendingFlushesAreMergedKeepingOnlyLastWriteOfSetters)
+{
+    createDisplayAndExpectSuccess();
+    createPublishAndSubscribeScene();
+    mapScene();
+    showScene();
+
+    createRenderable(0u);
+    setRenderableResources(0u, InvalidResource1);
+
+    expectResourceRequest();
+    expectContextEnable();
+    expectRenderableResourcesUploaded(DisplayHandle1, true, false);
+    update();
+    EXPECT_FALSE(lastFlushWasAppliedOnRendererScene());
+
+    for (UInt32 startIndex = 1u; startIndex <= 3u; ++startIndex)
+    {
+        stagingScene[0]->setRenderableStartIndex(renderableHandle, startIndex);
+        performFlush();
+        update();
+        EXPECT_FALSE(lastFlushWasAppliedOnRendererScene());
+    }
+
+    const auto& pendingFlushes = rendererScenes.getStagingInfo(getSceneId()).pendingFlushes;
+    ASSERT_EQ(1u, pendingFlushes.size());
+    EXPECT_EQ(5u, pendingFlushes.front().numberOfClientFlushes);
+    // overwritten setters are removed lazily, at latest when pending flush is applied
+    SceneActionCollection pendingFlushActions = pendingFlushes.front().sceneActions.copy();
+    OverwrittenSetterActionsTracker overwrittenSetterActions = pendingFlushes.front().overwrittenSetterActions;
+    overwrittenSetterActions.removeOverwrittenActions(pendingFlushActions);
+    EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(pendingFlushActions, ESceneActionId_SetRenderableStartIndex));
+    EXPECT_EQ(1u, SceneActionCollectionUtils::CountNumberOfActionsOfType(pendingFlushActions, ESceneActionId_Flush));
+
+    // unblock pending flushes
+    setRenderableResources();
+    expectResourceRequest();
+    expectContextEnable();
+    expectRenderableResourcesUploaded(DisplayHandle1, false, true);
+    update();
+    EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+    EXPECT_EQ(3u, rendererScenes.getScene(getSceneId()).getRenderable(renderableHandle).startIndex);
+
+    expectResourceRequestCancel(InvalidResource1);
+    update();
+
+    hideScene();
+    expectContextEnable();
+    expectRenderableResourcesDeleted();
+    unmapScene();
+    destroyDisplay();
+}
+
+TEST_F(ARendererSceneUpdater, forceUnsubscribesSceneIfMergedPendingFlushesHoldTooManyClientFlushes)
+{
+    createPublishAndSubscribeScene();
+
+    // all flushes are consolidated and merged into single pending flush before they could be applied
+    for (UInt i = 0u; i <= ForceUnsubscribeFlushLimit; ++i)
+        performFlush();
+
+    EXPECT_CALL(sceneEventSender, sendUnsubscribeScene(getSceneId()));
+    update();
+    expectInternalSceneStateEvent(ERendererEventType_SceneUnsubscribedIndirect);
+    EXPECT_FALSE(rendererScenes.hasScene(getSceneId()));
+}
+
 TEST_F(ARendererSceneUpdater, syncFlush_whenSceneBecomesReadyPendingFlushesAreAppliedInOrderAtOnce)
 {
     createDisplayAndExpectSuccess();
@@ -2370,6 +2438,7 @@ TEST_F(ARendererSceneUpdater, confidenceTest_forcePendingFlushWithNewResourcesBe
         {
             EXPECT_CALL(resourceProvider1, popArrivedResources(_)).WillOnce([&](const RequesterID&) { return ManagedResourceVector{ ManagedResource{*prevRequestedResource, resDeleter} }; });
             expectContextEnable();
+            EXPECT_CALL(renderer.getDisplayMock(DisplayHandle1).m_renderBackend->deviceMock, startShaderCompilation(_));
             if (TestRandom::Get(0, 3) == 0)
                 EXPECT_CALL(renderer.getDisplayMock(DisplayHandle1).m_renderBackend->deviceMock, uploadShader(_)).WillOnce(Return(DeviceResourceHandle::Invalid()));
             else
@@ -76,6 +76,36 @@ TEST_F(ARendererStatistics, tracksSceneRenderedCount)
     EXPECT_TRUE(logOutputContains("Scene 22: rendered 3"));
 }
 
+TEST_F(ARendererStatistics, tracksCulledRenderablesOfScene)
+{
+    stats.sceneRendered(sceneId1);
+    stats.trackRenderablesCulling(sceneId1, 2u, 3u);
+    stats.frameFinished(0u);
+    stats.sceneRendered(sceneId1);
+    stats.trackRenderablesCulling(sceneId1, 4u, 1u);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("renderablesCulled 6/10"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("renderablesCulled"));
+}
+
+TEST_F(ARendererStatistics, tracksMergedDrawCallsOfScene)
+{
+    stats.sceneRendered(sceneId1);
+    stats.trackMergedDrawCalls(sceneId1, 5u);
+    stats.frameFinished(0u);
+    stats.sceneRendered(sceneId1);
+    stats.trackMergedDrawCalls(sceneId1, 3u);
+    stats.frameFinished(0u);
+
+    EXPECT_TRUE(logOutputContains("drawCallsMerged 8"));
+
+    stats.reset();
+    EXPECT_FALSE(logOutputContains("drawCallsMerged"));
+}
+
 TEST_F(ARendererStatistics, untracksScene)
 {
     stats.sceneRendered(sceneId1);
@@ -273,18 +303,18 @@ TEST_F(ARendererStatistics, untracksStreamTextureSource)
 
 TEST_F(ARendererStatistics, tracksClientResourceUploads)
 {
-    stats.clientResourceUploaded(2u);
+    stats.clientResourceUploaded(2u, std::chrono::microseconds(5u));
     stats.frameFinished(0u);
-    EXPECT_TRUE(logOutputContains("clientResUploaded 1 (2 B)"));
+    EXPECT_TRUE(logOutputContains("clientResUploaded 1 (2 B), uploadTime(p50/p95/p99/max) 5/5/5/5us"));
 
     stats.reset();
     EXPECT_FALSE(logOutputContains("clientResUploaded"));
 
-    stats.clientResourceUploaded(2u);
-    stats.clientResourceUploaded(77u);
-    stats.clientResourceUploaded(100u);
+    stats.clientResourceUploaded(2u, std::chrono::microseconds(1u));
+    stats.clientResourceUploaded(77u, std::chrono::microseconds(20u));
+    stats.clientResourceUploaded(100u, std::chrono::microseconds(30u));
     stats.frameFinished(0u);
-    EXPECT_TRUE(logOutputContains("clientResUploaded 3 (179 B)"));
+    EXPECT_TRUE(logOutputContains("clientResUploaded 3 (179 B), uploadTime(p50/p95/p99/max) 20/30/30/30us"));
 
     stats.reset();
     EXPECT_FALSE(logOutputContains("clientResUploaded"));
@@ -329,11 +359,23 @@ TEST_F(ARendererStatistics, tracksShaderCompilationAndTimes)
     EXPECT_TRUE(logOutputContains("longest: longest effect name"));
     EXPECT_TRUE(logOutputContains("from scene:125"));
     EXPECT_TRUE(logOutputContains("ms:7"));
+    // percentiles are reported with upper bound of their histogram bucket
+    EXPECT_TRUE(logOutputContains("compileTime(p50/p95/p99/max) 5119/7000/7000/7000us"));
 
     stats.reset();
     EXPECT_FALSE(logOutputContains("shadersCompiled"));
 }
 
+TEST_F(ARendererStatistics, tracksFrameTimePercentiles)
+{
+    // first frame has no duration
+    stats.frameFinished(0u);
+    EXPECT_FALSE(logOutputContains("frameTime(p50/p95/p99/max)"));
+
+    stats.frameFinished(0u);
+    EXPECT_TRUE(logOutputContains("frameTime(p50/p95/p99/max) "));
+}
+
 TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
 {
     for (size_t period = 0u; period < 2u; ++period)
@@ -345,8 +387,8 @@ TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
         stats.framebufferSwapped(disp1);
         stats.frameFinished(0);
 
-        stats.clientResourceUploaded(2u);
-        stats.clientResourceUploaded(77u);
+        stats.clientResourceUploaded(2u, std::chrono::microseconds(10u));
+        stats.clientResourceUploaded(77u, std::chrono::microseconds(40u));
         stats.shaderCompiled(std::chrono::microseconds(0u), "", SceneId(54321));
         stats.shaderCompiled(std::chrono::microseconds(1000u), "slow effect", SceneId(12345));
 
@@ -380,13 +422,13 @@ TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
         EXPECT_TRUE(logOutputContains("FPS [minFrameTime "));
         EXPECT_TRUE(logOutputContains("us, maxFrameTime "));
         EXPECT_TRUE(logOutputContains("], drawcallsPerFrame 25, numFrames 4"));
-        EXPECT_TRUE(logOutputContains("clientResUploaded 2 (79 B)"));
+        EXPECT_TRUE(logOutputContains("clientResUploaded 2 (79 B), uploadTime(p50/p95/p99/max) 10/40/40/40us"));
         EXPECT_TRUE(logOutputContains("shadersCompiled 2"));
         EXPECT_TRUE(logOutputContains("for total ms:1"));
         EXPECT_TRUE(logOutputContains("FB1: 3; OB11: 1 (intr: 1)"));
         EXPECT_TRUE(logOutputContains("FB2: 2"));
-        EXPECT_TRUE(logOutputContains("Scene 11: rendered 2, framesFArrived 3, framesFApplied 1, framesFBlocked 2, maxFramesWithNoFApplied 2, maxFramesFBlocked 2, FArrived 3, FApplied 1, actions/F (123/123/123.0), dt/F (2/6/3.6666667), RC+/F (5/5/5.0), RC-/F (3/3/3.0), RS/F (4/4/4.0), RSUploaded 2 (80 B)"));
-        EXPECT_TRUE(logOutputContains("Scene 22: rendered 2, framesFArrived 2, framesFApplied 1, framesFBlocked 1, maxFramesWithNoFApplied 3, maxFramesFBlocked 1, FArrived 2, FApplied 1, actions/F (6/6/6.0), dt/F (5/11/8.0), RC+/F (7/7/7.0), RC-/F (8/8/8.0), RS/F (9/9/9.0), RSUploaded 1 (200 B)"));
+        EXPECT_TRUE(logOutputContains("Scene 11: rendered 2, framesFArrived 3, framesFApplied 1, framesFBlocked 2, maxFramesWithNoFApplied 2, maxFramesFBlocked 2, FArrived 3, FApplied 1, actions/F (123/123/123.0), dt/F (2/6/3.6666667), dt/F(p50/p95/p99/max) (3/6/6/6), RC+/F (5/5/5.0), RC-/F (3/3/3.0), RS/F (4/4/4.0), RSUploaded 2 (80 B)"));
+        EXPECT_TRUE(logOutputContains("Scene 22: rendered 2, framesFArrived 2, framesFApplied 1, framesFBlocked 1, maxFramesWithNoFApplied 3, maxFramesFBlocked 1, FArrived 2, FApplied 1, actions/F (6/6/6.0), dt/F (5/11/8.0), dt/F(p50/p95/p99/max) (5/11/11/11), RC+/F (7/7/7.0), RC-/F (8/8/8.0), RS/F (9/9/9.0), RSUploaded 1 (200 B)"));
         EXPECT_TRUE(logOutputContains("slow effect"));
         stats.reset();
     }
@@ -25,6 +25,9 @@
 #include "ComponentMocks.h"
 #include "TestSceneHelper.h"
 #include <map>
+#include <thread>
+#include <future>
+#include <functional>
 
 using namespace ramses_internal;
 
@@ -3366,3 +3369,208 @@ TEST_P(ARenderer, reportsSceneAsRenderedToExpirationMonitorOnlyAfterFullyRendere
     expirationMonitor.stopMonitoringScene(sceneIdFB);
     expirationMonitor.stopMonitoringScene(sceneIdOBint);
 }
+
+class ARendererWithRenderThreadPerDisplay : public ARenderer
+{
+public:
+    ARendererWithRenderThreadPerDisplay()
+    {
+        renderer.setRenderThreadPerDisplay(true);
+    }
+
+    void expectFrameRenderedOnRenderThread(DisplayHandle display, Sequence& seq, std::thread::id& renderThreadId, const std::function<void()>& swapAction = [](){}, const std::function<void()>& clearAction = [](){})
+    {
+        DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(display);
+        EXPECT_CALL(*displayMock.m_displayController, handleWindowEvents()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_displayController, canRenderNewFrame()).InSequence(seq).WillOnce(Return(true));
+        // context is released by updating thread before render thread enables it
+        EXPECT_CALL(*displayMock.m_displayController, disableContext()).InSequence(seq);
+        EXPECT_CALL(displayMock.m_renderBackend->deviceMock, resetDrawCallCount()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_displayController, enableContext()).InSequence(seq).WillOnce(Invoke([&renderThreadId]() { renderThreadId = std::this_thread::get_id(); }));
+        EXPECT_CALL(*displayMock.m_displayController, clearBuffer(DisplayControllerMock::FakeFrameBufferHandle, Renderer::DefaultClearColor)).InSequence(seq).WillOnce(InvokeWithoutArgs(clearAction));
+        EXPECT_CALL(*displayMock.m_displayController, executePostProcessing()).InSequence(seq);
+        EXPECT_CALL(displayMock.m_renderBackend->deviceMock, getDrawCallCount()).InSequence(seq).WillOnce(Return(0u));
+        EXPECT_CALL(*displayMock.m_displayController, swapBuffers()).InSequence(seq).WillOnce(Invoke(swapAction));
+        EXPECT_CALL(*displayMock.m_displayController, disableContext()).InSequence(seq);
+    }
+
+    // frame without any modified buffer is still started on render thread but renders nothing,
+    // clients are notified once the updating thread takes over the consumed frame
+    void expectEmptyFrameOnRenderThread(DisplayHandle display, Sequence& seq)
+    {
+        DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(display);
+        EXPECT_CALL(*displayMock.m_displayController, handleWindowEvents()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_displayController, canRenderNewFrame()).InSequence(seq).WillOnce(Return(true));
+        EXPECT_CALL(*displayMock.m_displayController, disableContext()).InSequence(seq);
+        EXPECT_CALL(displayMock.m_renderBackend->deviceMock, resetDrawCallCount()).InSequence(seq);
+        EXPECT_CALL(displayMock.m_renderBackend->deviceMock, getDrawCallCount()).InSequence(seq).WillOnce(Return(0u));
+        EXPECT_CALL(*displayMock.m_displayController, getEmbeddedCompositingManager()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_embeddedCompositingManager, notifyClients()).InSequence(seq);
+    }
+
+    // clients of frame presented on render thread are notified by updating thread when starting next frame
+    void expectEmbeddedCompositingClientsNotified(DisplayHandle display, Sequence& seq, std::thread::id& notifyingThreadId)
+    {
+        DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(display);
+        EXPECT_CALL(*displayMock.m_displayController, getEmbeddedCompositingManager()).InSequence(seq);
+        EXPECT_CALL(*displayMock.m_embeddedCompositingManager, notifyClients()).InSequence(seq).WillOnce(Invoke([&notifyingThreadId]() { notifyingThreadId = std::this_thread::get_id(); }));
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(, ARendererWithRenderThreadPerDisplay, ::testing::Values(false, true));
+
+TEST_P(ARendererWithRenderThreadPerDisplay, rendersAndPresentsEveryDisplayOnItsOwnThread)
+{
+    const DisplayHandle display1 = addDisplayController();
+    const DisplayHandle display2 = addDisplayController();
+    const SceneId scene1(12u);
+    const SceneId scene2(13u);
+    createScene(scene1);
+    createScene(scene2);
+    initiateExpirationMonitoring({ scene1, scene2 });
+    assignSceneToDisplayBuffer(scene1, display1, 0);
+    assignSceneToDisplayBuffer(scene2, display2, 0);
+    showScene(scene1);
+    showScene(scene2);
+
+    Sequence seq1;
+    Sequence seq2;
+    std::thread::id renderThread1;
+    std::thread::id renderThread2;
+    expectFrameRenderedOnRenderThread(display1, seq1, renderThread1);
+    expectFrameRenderedOnRenderThread(display2, seq2, renderThread2);
+    expectSceneRendered(display1, scene1);
+    expectSceneRendered(display2, scene2);
+    doOneRendererLoop();
+
+    // rendered scenes and presented frames are handed back to updating thread when it waits for the render thread,
+    // embedded compositing clients are notified on updating thread
+    std::thread::id notifyingThread1;
+    std::thread::id notifyingThread2;
+    expectEmbeddedCompositingClientsNotified(display1, seq1, notifyingThread1);
+    expectEmbeddedCompositingClientsNotified(display2, seq2, notifyingThread2);
+    renderer.waitForDisplayRenderThread(display1);
+    renderer.waitForDisplayRenderThread(display2);
+    expectScenesReportedToExpirationMonitorAsRendered({ scene1, scene2 });
+    EXPECT_NE(std::this_thread::get_id(), renderThread1);
+    EXPECT_NE(std::this_thread::get_id(), renderThread2);
+    EXPECT_NE(renderThread1, renderThread2);
+    EXPECT_EQ(std::this_thread::get_id(), notifyingThread1);
+    EXPECT_EQ(std::this_thread::get_id(), notifyingThread2);
+
+    hideScene(scene1);
+    hideScene(scene2);
+    unassignScene(scene1);
+    unassignScene(scene2);
+    expirationMonitor.stopMonitoringScene(scene1);
+    expirationMonitor.stopMonitoringScene(scene2);
+}
+
+TEST_P(ARendererWithRenderThreadPerDisplay, skipsDisplayWhichIsStillPresentingItsPreviousFrame)
+{
+    const DisplayHandle display1 = addDisplayController();
+    const DisplayHandle display2 = addDisplayController();
+
+    std::promise<void> swapAllowed;
+    const std::shared_future<void> swapAllowedFuture = swapAllowed.get_future().share();
+    Sequence seq1;
+    Sequence seq2;
+    std::thread::id renderThread1;
+    std::thread::id renderThread2;
+    expectFrameRenderedOnRenderThread(display1, seq1, renderThread1, [swapAllowedFuture]() { swapAllowedFuture.wait(); });
+    expectFrameRenderedOnRenderThread(display2, seq2, renderThread2);
+    doOneRendererLoop();
+    std::thread::id notifyingThread2;
+    expectEmbeddedCompositingClientsNotified(display2, seq2, notifyingThread2);
+    renderer.waitForDisplayRenderThread(display2);
+    EXPECT_EQ(std::this_thread::get_id(), notifyingThread2);
+
+    // display1 blocks in swap and is not touched, display2 has nothing to re-render but starts its next frame
+    expectEmptyFrameOnRenderThread(display2, seq2);
+    doOneRendererLoop();
+    renderer.waitForDisplayRenderThread(display2);
+
+    std::thread::id notifyingThread1;
+    expectEmbeddedCompositingClientsNotified(display1, seq1, notifyingThread1);
+    swapAllowed.set_value();
+    renderer.waitForDisplayRenderThread(display1);
+    EXPECT_EQ(std::this_thread::get_id(), notifyingThread1);
+}
+
+TEST_P(ARendererWithRenderThreadPerDisplay, rendersOtherDisplayAgainWhileOneDisplayIsStillRendering)
+{
+    const DisplayHandle display1 = addDisplayController();
+    const DisplayHandle display2 = addDisplayController();
+
+    std::promise<void> renderingStarted;
+    std::promise<void> renderingAllowed;
+    const std::shared_future<void> renderingAllowedFuture = renderingAllowed.get_future().share();
+    Sequence seq1;
+    Sequence seq2;
+    std::thread::id renderThread1;
+    std::thread::id renderThread2;
+    expectFrameRenderedOnRenderThread(display1, seq1, renderThread1, [](){}, [&renderingStarted, renderingAllowedFuture]() { renderingStarted.set_value(); renderingAllowedFuture.wait(); });
+    expectFrameRenderedOnRenderThread(display2, seq2, renderThread2);
+    doOneRendererLoop();
+    renderingStarted.get_future().wait();
+
+    // renderer loop does not wait for display1 which is blocked in rendering, display2 keeps rendering frames
+    EXPECT_TRUE(renderer.isDisplayBeingRendered(display1));
+    std::thread::id notifyingThread2;
+    expectEmbeddedCompositingClientsNotified(display2, seq2, notifyingThread2);
+    renderer.waitForDisplayRenderThread(display2);
+    expectEmptyFrameOnRenderThread(display2, seq2);
+    doOneRendererLoop();
+    renderer.waitForDisplayRenderThread(display2);
+    expectEmptyFrameOnRenderThread(display2, seq2);
+    doOneRendererLoop();
+    renderer.waitForDisplayRenderThread(display2);
+    EXPECT_TRUE(renderer.isDisplayBeingRendered(display1));
+
+    std::thread::id notifyingThread1;
+    expectEmbeddedCompositingClientsNotified(display1, seq1, notifyingThread1);
+    renderingAllowed.set_value();
+    renderer.waitForDisplayRenderThread(display1);
+    EXPECT_FALSE(renderer.isDisplayBeingRendered(display1));
+}
+
+TEST_P(ARendererWithRenderThreadPerDisplay, keepsInterruptedRenderingStatePerDisplay)
+{
+    const DisplayHandle displayHandle = addDisplayController();
+    const DeviceResourceHandle fakeOffscreenBuffer(313u);
+    renderer.registerOffscreenBuffer(displayHandle, fakeOffscreenBuffer, 1u, 1u, true);
+
+    const SceneId sceneIdOB(13u);
+    createScene(sceneIdOB);
+    assignSceneToDisplayBuffer(sceneIdOB, displayHandle, 0, fakeOffscreenBuffer);
+    showScene(sceneIdOB);
+
+    DisplayStrictMockInfo& displayMock = renderer.getDisplayMock(displayHandle);
+    {
+        InSequence seq;
+        EXPECT_CALL(*displayMock.m_displayController, handleWindowEvents());
+        EXPECT_CALL(*displayMock.m_displayController, canRenderNewFrame()).WillOnce(Return(true));
+        EXPECT_CALL(*displayMock.m_displayController, disableContext());
+        EXPECT_CALL(displayMock.m_renderBackend->deviceMock, resetDrawCallCount());
+        EXPECT_CALL(*displayMock.m_displayController, enableContext());
+        EXPECT_CALL(*displayMock.m_displayController, clearBuffer(DisplayControllerMock::FakeFrameBufferHandle, Renderer::DefaultClearColor));
+        EXPECT_CALL(*displayMock.m_displayController, executePostProcessing());
+        EXPECT_CALL(*displayMock.m_displayController, clearBuffer(fakeOffscreenBuffer, Renderer::DefaultClearColor));
+        // render thread renders with its own copy of frame timer
+        EXPECT_CALL(*displayMock.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneIdOB)), fakeOffscreenBuffer, _, sceneRenderBegin, NotNull())).WillOnce(Return(sceneRenderInterrupted));
+        EXPECT_CALL(displayMock.m_renderBackend->deviceMock, getDrawCallCount()).WillOnce(Return(0u));
+        EXPECT_CALL(*displayMock.m_displayController, swapBuffers());
+        EXPECT_CALL(*displayMock.m_displayController, disableContext());
+        EXPECT_CALL(*displayMock.m_displayController, getEmbeddedCompositingManager());
+        EXPECT_CALL(*displayMock.m_embeddedCompositingManager, notifyClients());
+    }
+    doOneRendererLoop();
+    renderer.waitForDisplayRenderThread(displayHandle);
+
+    EXPECT_TRUE(renderer.hasAnyBufferWithInterruptedRendering());
+    renderer.resetRenderInterruptState();
+    EXPECT_FALSE(renderer.hasAnyBufferWithInterruptedRendering());
+
+    hideScene(sceneIdOB);
+    unassignScene(sceneIdOB);
+}
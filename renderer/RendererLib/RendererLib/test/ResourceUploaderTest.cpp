@@ -229,6 +229,44 @@ TEST_F(AResourceUploader, uploadsTextureCubeResource)
     EXPECT_EQ(6u * (2 * 2 + 1), vramSize);
 }
 
+TEST_F(AResourceUploader, uploadsIndexArrayResourceFromStagingBuffer)
+{
+    const ArrayResource res(EResourceType_IndexArray, 1, EDataType_UInt16, nullptr, ResourceCacheFlag_DoNotCache, String());
+    ManagedResource managedRes(res, dummyManagedResourceCallback);
+    ResourceDescriptor resourceObject;
+    resourceObject.resource = managedRes;
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+
+    const DeviceResourceHandle stagingBuffer(55u);
+    EXPECT_CALL(renderer.deviceMock, allocateIndexBuffer(res.getElementType(), res.getDecompressedDataSize())).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(renderer.deviceMock, uploadBufferDataFromStagingBuffer(DeviceResourceHandle(123), stagingBuffer, 0u, res.getDecompressedDataSize()));
+    EXPECT_EQ(123u, uploader.uploadResourceFromStagingBuffer(renderer, resourceObject, stagingBuffer, vramSize));
+    EXPECT_EQ(res.getDecompressedDataSize(), vramSize);
+}
+
+TEST_F(AResourceUploader, uploadsTextureCubeResourceFromStagingBuffer)
+{
+    const UInt32 mipCount = 2u;
+    const TextureMetaInfo texDesc(2u, 1u, 1u, ETextureFormat_R8, false, DefaultTextureSwizzleArray, { 4, 1 });
+    TextureResource res(EResourceType_TextureCube, texDesc, ResourceCacheFlag_DoNotCache, String());
+    ManagedResource managedRes(res, dummyManagedResourceCallback);
+    ResourceDescriptor resourceObject;
+    resourceObject.resource = managedRes;
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+
+    const DeviceResourceHandle stagingBuffer(55u);
+    InSequence seq;
+    EXPECT_CALL(renderer.deviceMock, allocateTextureCube(2u, ETextureFormat_R8, DefaultTextureSwizzleArray, mipCount, 6 * 5)).WillOnce(Return(DeviceResourceHandle(123)));
+    for (UInt32 i = 0u; i < 6u; ++i)
+    {
+        // data of all faces and mips are stored sequentially in staging buffer
+        EXPECT_CALL(renderer.deviceMock, uploadTextureDataFromStagingBuffer(DeviceResourceHandle(123), 0u, i, 2u, 2u, 1u, stagingBuffer, i * 5u, 4u));
+        EXPECT_CALL(renderer.deviceMock, uploadTextureDataFromStagingBuffer(DeviceResourceHandle(123), 1u, i, 1u, 1u, 1u, stagingBuffer, i * 5u + 4u, 1u));
+    }
+    EXPECT_EQ(123u, uploader.uploadResourceFromStagingBuffer(renderer, resourceObject, stagingBuffer, vramSize));
+    EXPECT_EQ(6u * (2 * 2 + 1), vramSize);
+}
+
 TEST_F(AResourceUploader, uploadsTextureCubeResourceWithMipGen)
 {
     const TextureMetaInfo texDesc(4u, 1u, 1u, ETextureFormat_R8, true, DefaultTextureSwizzleArray, { 16 });
@@ -426,6 +464,52 @@ TEST_F(AResourceUploader, providesSupportedBinaryShaderFormatsOnlyOnce)
     EXPECT_EQ(123u, uploaderWithBinaryProvider.uploadResource(renderer, resourceObject3, vramSize));
 }
 
+TEST_F(AResourceUploader, compilesEffectResourceInParallelAndStoresItToBinaryShaderCacheWhenFinished)
+{
+    BinaryShaderProviderFake binaryShaderProvider;
+    ResourceUploader uploaderWithBinaryProvider(stats, &binaryShaderProvider);
+
+    EffectResource res("", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(Ref(res))).Times(1);
+    ResourceDescriptor resourceObject;
+    resourceObject.hash = res.getHash();
+    resourceObject.resource = ManagedResource{ res, dummyManagedResourceCallback };
+
+    const DeviceResourceHandle pendingShader(321u);
+    EXPECT_CALL(binaryShaderProvider, deviceSupportsBinaryShaderFormats(std::vector<BinaryShaderFormatID>{ DeviceMock::FakeSupportedBinaryShaderFormat }));
+    EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash()));
+    EXPECT_CALL(renderer.deviceMock, startShaderCompilation(Ref(res))).WillOnce(Return(pendingShader));
+    EXPECT_EQ(pendingShader, uploaderWithBinaryProvider.startEffectCompilation(renderer, resourceObject));
+
+    EXPECT_CALL(renderer.deviceMock, isShaderCompilationFinished(pendingShader)).WillOnce(Return(false));
+    EXPECT_FALSE(uploaderWithBinaryProvider.isEffectCompilationFinished(renderer, pendingShader));
+
+    EXPECT_CALL(renderer.deviceMock, finishShaderCompilation(pendingShader, Ref(res))).WillOnce(Return(DeviceResourceHandle(123)));
+    EXPECT_CALL(binaryShaderProvider, shouldBinaryShaderBeCached(res.getHash(), _)).WillOnce(Return(true));
+    EXPECT_CALL(renderer.deviceMock, getBinaryShader(DeviceResourceHandle(123), _, _)).WillOnce(DoAll(SetArgReferee<1>(UInt8Vector(10)), Return(true)));
+    EXPECT_CALL(binaryShaderProvider, storeBinaryShader(res.getHash(), _, _, 10u, _));
+    EXPECT_EQ(123u, uploaderWithBinaryProvider.finishEffectCompilation(renderer, resourceObject, pendingShader, vramSize));
+    EXPECT_EQ(res.getDecompressedDataSize(), vramSize);
+}
+
+TEST_F(AResourceUploader, doesNotCompileEffectInParallelIfBinaryShaderCacheHasIt)
+{
+    EffectResource res("", "", EffectInputInformationVector(), EffectInputInformationVector(), "", ResourceCacheFlag_DoNotCache);
+    EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(Ref(res))).Times(1);
+    ResourceDescriptor resourceObject;
+    resourceObject.hash = res.getHash();
+    resourceObject.resource = ManagedResource{ res, dummyManagedResourceCallback };
+
+    BinaryShaderProviderFake binaryShaderProvider;
+    binaryShaderProvider.m_effectHash = res.getHash();
+    ResourceUploader uploaderWithBinaryProvider(stats, &binaryShaderProvider);
+
+    EXPECT_CALL(binaryShaderProvider, deviceSupportsBinaryShaderFormats(std::vector<BinaryShaderFormatID>{ DeviceMock::FakeSupportedBinaryShaderFormat }));
+    EXPECT_CALL(binaryShaderProvider, hasBinaryShader(res.getHash()));
+    EXPECT_CALL(renderer.deviceMock, startShaderCompilation(_)).Times(0);
+    EXPECT_FALSE(uploaderWithBinaryProvider.startEffectCompilation(renderer, resourceObject).isValid());
+}
+
 TEST_F(AResourceUploader, unloadsVertexArrayResource)
 {
     const DeviceResourceHandle handle(123u);
@@ -0,0 +1,191 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/TriangleBVH.h"
+
+using namespace ramses_internal;
+
+namespace
+{
+    // grid of quads (2 triangles each) in plane z = depth, covering [0, gridSize] in x and y
+    std::vector<float> createGridGeometry(UInt32 gridSize, float depth)
+    {
+        std::vector<float> geometry;
+        for (UInt32 y = 0u; y < gridSize; ++y)
+        {
+            for (UInt32 x = 0u; x < gridSize; ++x)
+            {
+                const float x0 = static_cast<float>(x);
+                const float y0 = static_cast<float>(y);
+                const float x1 = x0 + 1.f;
+                const float y1 = y0 + 1.f;
+                geometry.insert(geometry.end(), { x0, y0, depth, x1, y0, depth, x1, y1, depth });
+                geometry.insert(geometry.end(), { x0, y0, depth, x1, y1, depth, x0, y1, depth });
+            }
+        }
+        return geometry;
+    }
+
+    bool intersectAllTriangles(const std::vector<float>& geometry, const Vector3& rayOrigin, const Vector3& rayDir, Vector3& intersectionPoint)
+    {
+        bool intersectionResult = false;
+        float nearestDistance = std::numeric_limits<float>::max();
+        for (size_t fltIdx = 0u; fltIdx < geometry.size(); fltIdx += 9)
+        {
+            IntersectionUtils::Triangle triangle;
+            std::copy(&geometry[fltIdx + 0], &geometry[fltIdx + 3], triangle.v0.data);
+            std::copy(&geometry[fltIdx + 3], &geometry[fltIdx + 6], triangle.v1.data);
+            std::copy(&geometry[fltIdx + 6], &geometry[fltIdx + 9], triangle.v2.data);
+
+            float distance = 0.f;
+            Vector3 intersection;
+            if (IntersectionUtils::IntersectRayVsTriangle(triangle, rayOrigin, rayDir, intersection, distance) && distance < nearestDistance)
+            {
+                intersectionResult = true;
+                nearestDistance = distance;
+                intersectionPoint = intersection;
+            }
+        }
+        return intersectionResult;
+    }
+}
+
+TEST(ATriangleBVH, isEmptyForEmptyGeometry)
+{
+    const TriangleBVH bvh(nullptr, 0u);
+    EXPECT_TRUE(bvh.isEmpty());
+    EXPECT_EQ(0u, bvh.getTriangleCount());
+    EXPECT_FALSE(bvh.getBoundingBox().isValid());
+
+    Vector3 intersectionPoint;
+    float distance = 0.f;
+    EXPECT_FALSE(bvh.intersectRay(Vector3(0.f, 0.f, 1.f), Vector3(0.f, 0.f, -1.f), intersectionPoint, distance));
+}
+
+TEST(ATriangleBVH, hasBoundingBoxEnclosingAllTriangles)
+{
+    const std::vector<float> geometry{ -1.f, 0.f, 0.f,
+                                        1.f, 0.f, 0.f,
+                                        0.f, 1.f, 0.f,
+
+                                        0.f, -2.f, -3.f,
+                                        4.f,  0.f, -3.f,
+                                        0.f,  1.f,  5.f };
+    const TriangleBVH bvh(geometry.data(), geometry.size());
+    EXPECT_FALSE(bvh.isEmpty());
+    EXPECT_EQ(2u, bvh.getTriangleCount());
+
+    const auto& bounds = bvh.getBoundingBox();
+    EXPECT_NEAR(-1.f, bounds.min.x, 1e-5f);
+    EXPECT_NEAR(-2.f, bounds.min.y, 1e-5f);
+    EXPECT_NEAR(-3.f, bounds.min.z, 1e-5f);
+    EXPECT_NEAR(4.f, bounds.max.x, 1e-5f);
+    EXPECT_NEAR(1.f, bounds.max.y, 1e-5f);
+    EXPECT_NEAR(5.f, bounds.max.z, 1e-5f);
+}
+
+TEST(ATriangleBVH, transformsBoundingBox)
+{
+    TriangleBVH::BoundingBox bounds;
+    bounds.extend(Vector3(-1.f, -2.f, -3.f));
+    bounds.extend(Vector3(1.f, 2.f, 3.f));
+
+    const auto transformedBounds = bounds.transform(Matrix44f::Translation(10.f, 0.f, 0.f) * Matrix44f::Scaling(2.f, 1.f, 1.f));
+    EXPECT_FLOAT_EQ(8.f, transformedBounds.min.x);
+    EXPECT_FLOAT_EQ(-2.f, transformedBounds.min.y);
+    EXPECT_FLOAT_EQ(-3.f, transformedBounds.min.z);
+    EXPECT_FLOAT_EQ(12.f, transformedBounds.max.x);
+    EXPECT_FLOAT_EQ(2.f, transformedBounds.max.y);
+    EXPECT_FLOAT_EQ(3.f, transformedBounds.max.z);
+}
+
+TEST(ATriangleBVH, intersectsRayWithBoundingBox)
+{
+    TriangleBVH::BoundingBox bounds;
+    bounds.extend(Vector3(-1.f, -1.f, -1.f));
+    bounds.extend(Vector3(1.f, 1.f, 1.f));
+
+    const float maxDistance = std::numeric_limits<float>::max();
+    EXPECT_TRUE(bounds.intersectRay(Vector3(0.f, 0.f, 5.f), Vector3(0.f, 0.f, -1.f).inverse(), maxDistance));
+    EXPECT_TRUE(bounds.intersectRay(Vector3(0.f, 0.f, 0.f), Vector3(0.f, 0.f, -1.f).inverse(), maxDistance));
+    // box behind ray origin
+    EXPECT_FALSE(bounds.intersectRay(Vector3(0.f, 0.f, 5.f), Vector3(0.f, 0.f, 1.f).inverse(), maxDistance));
+    // box further than max distance
+    EXPECT_FALSE(bounds.intersectRay(Vector3(0.f, 0.f, 5.f), Vector3(0.f, 0.f, -1.f).inverse(), 3.f));
+    // ray passes next to box
+    EXPECT_FALSE(bounds.intersectRay(Vector3(2.f, 0.f, 5.f), Vector3(0.f, 0.f, -1.f).inverse(), maxDistance));
+}
+
+TEST(ATriangleBVH, findsNearestIntersectionAmongOverlappingTriangles)
+{
+    const std::vector<float> geometry{ -1.0f, 0.0f, -10.0f,
+                                        1.0f, 0.0f, -10.0f,
+                                        0.0f, 1.0f, -10.0f,
+
+                                        0.0f, -1.0f, -3.0f,
+                                        1.0f,  0.0f, -3.0f,
+                                        0.0f,  1.0f, -3.0f,
+
+                                        0.0f, -1.0f, -15.0f,
+                                        1.0f,  0.0f, -15.0f,
+                                        0.0f,  1.0f, -15.0f };
+    const TriangleBVH bvh(geometry.data(), geometry.size());
+
+    Vector3 intersectionPoint;
+    float distance = 0.f;
+    ASSERT_TRUE(bvh.intersectRay(Vector3(0.1f, 0.1f, 1.f), Vector3(0.f, 0.f, -1.f), intersectionPoint, distance));
+    EXPECT_FLOAT_EQ(0.1f, intersectionPoint.x);
+    EXPECT_FLOAT_EQ(0.1f, intersectionPoint.y);
+    EXPECT_FLOAT_EQ(-3.f, intersectionPoint.z);
+    EXPECT_FLOAT_EQ(4.f, distance);
+}
+
+TEST(ATriangleBVH, doesNotIntersectRayMissingAllTriangles)
+{
+    const auto geometry = createGridGeometry(16u, 0.f);
+    const TriangleBVH bvh(geometry.data(), geometry.size());
+
+    Vector3 intersectionPoint;
+    float distance = 0.f;
+    EXPECT_FALSE(bvh.intersectRay(Vector3(-0.5f, 4.f, 1.f), Vector3(0.f, 0.f, -1.f), intersectionPoint, distance));
+    EXPECT_FALSE(bvh.intersectRay(Vector3(4.f, 4.f, 1.f), Vector3(0.f, 0.f, 1.f), intersectionPoint, distance));
+    EXPECT_FALSE(bvh.intersectRay(Vector3(4.f, 4.f, 1.f), Vector3(1.f, 0.f, 0.f), intersectionPoint, distance));
+}
+
+TEST(ATriangleBVH, givesSameResultsAsTestingAllTriangles)
+{
+    // two stacked grids so that nearest hit has to be found across subtrees
+    auto geometry = createGridGeometry(32u, 0.f);
+    const auto backGrid = createGridGeometry(32u, -5.f);
+    geometry.insert(geometry.end(), backGrid.cbegin(), backGrid.cend());
+    const TriangleBVH bvh(geometry.data(), geometry.size());
+    EXPECT_EQ(2u * 32u * 32u * 2u, bvh.getTriangleCount());
+
+    for (UInt32 i = 0u; i < 200u; ++i)
+    {
+        // rays hitting edges and vertices of grid as well as rays missing it
+        const float x = -2.f + 0.25f * static_cast<float>(i % 40u);
+        const float y = -2.f + 0.5f * static_cast<float>(i / 5u);
+        const Vector3 rayOrigin(x, y, 3.f);
+        const Vector3 rayDir = Vector3(0.3f, -0.2f, -1.f).normalize();
+
+        Vector3 expectedIntersection;
+        const bool expectedResult = intersectAllTriangles(geometry, rayOrigin, rayDir, expectedIntersection);
+
+        Vector3 intersection;
+        float distance = 0.f;
+        ASSERT_EQ(expectedResult, bvh.intersectRay(rayOrigin, rayDir, intersection, distance)) << x << " " << y;
+        if (expectedResult)
+        {
+            EXPECT_FLOAT_EQ(expectedIntersection.x, intersection.x);
+            EXPECT_FLOAT_EQ(expectedIntersection.y, intersection.y);
+            EXPECT_FLOAT_EQ(expectedIntersection.z, intersection.z);
+        }
+    }
+}
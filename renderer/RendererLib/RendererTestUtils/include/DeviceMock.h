@@ -79,6 +79,11 @@ namespace ramses_internal
         MOCK_METHOD3(getBinaryShader, Bool(DeviceResourceHandle, UInt8Vector&, BinaryShaderFormatID&));
         MOCK_METHOD1(deleteShader, void(DeviceResourceHandle));
         MOCK_METHOD1(activateShader, void(DeviceResourceHandle));
+        MOCK_METHOD1(startShaderCompilation, DeviceResourceHandle(const EffectResource&));
+        MOCK_METHOD1(isShaderCompilationFinished, Bool(DeviceResourceHandle));
+        MOCK_METHOD2(finishShaderCompilation, DeviceResourceHandle(DeviceResourceHandle, const EffectResource&));
+        MOCK_CONST_METHOD0(getActiveShaderUniformDataVersion, UniformDataVersion());
+        MOCK_METHOD1(setActiveShaderUniformDataVersion, void(const UniformDataVersion&));
 
         MOCK_METHOD6(allocateTexture2D, DeviceResourceHandle(UInt32 width, UInt32 height, ETextureFormat textureFormat, const TextureSwizzleArray& swizzle, UInt32 mipLevelCount, UInt32 totalSizeInBytes));
         MOCK_METHOD6(allocateTexture3D, DeviceResourceHandle(UInt32 width, UInt32 height, UInt32 depth, ETextureFormat textureFormat, UInt32 mipLevelCount, UInt32 totalSizeInBytes));
@@ -90,6 +95,15 @@ namespace ramses_internal
         MOCK_METHOD1(deleteTexture, void(DeviceResourceHandle));
         MOCK_METHOD2(activateTexture, void(DeviceResourceHandle, DataFieldHandle));
 
+        MOCK_METHOD1(allocateStagingBuffer, DeviceResourceHandle(UInt32));
+        MOCK_METHOD1(getStagingBufferData, Byte*(DeviceResourceHandle));
+        MOCK_METHOD1(deleteStagingBuffer, void(DeviceResourceHandle));
+        MOCK_METHOD9(uploadTextureDataFromStagingBuffer, void(DeviceResourceHandle handle, UInt32 mipLevel, UInt32 z, UInt32 width, UInt32 height, UInt32 depth, DeviceResourceHandle stagingBuffer, UInt32 offset, UInt32 dataSize));
+        MOCK_METHOD4(uploadBufferDataFromStagingBuffer, void(DeviceResourceHandle, DeviceResourceHandle, UInt32, UInt32));
+        MOCK_METHOD0(insertFence, DeviceResourceHandle());
+        MOCK_METHOD1(isFenceSignaled, Bool(DeviceResourceHandle));
+        MOCK_METHOD1(deleteFence, void(DeviceResourceHandle));
+
         MOCK_METHOD1(uploadRenderBuffer, DeviceResourceHandle(const RenderBuffer&));
         MOCK_METHOD1(deleteRenderBuffer, void(DeviceResourceHandle));
         MOCK_METHOD6(uploadTextureSampler, DeviceResourceHandle(EWrapMethod, EWrapMethod, EWrapMethod, ESamplingMethod, ESamplingMethod, UInt32));
@@ -33,6 +33,7 @@ public:
     MOCK_METHOD0(handleWindowEvents, void());
     MOCK_CONST_METHOD0(canRenderNewFrame, bool());
     MOCK_METHOD0(enableContext, void());
+    MOCK_METHOD0(disableContext, void());
     MOCK_METHOD0(swapBuffers, void());
     MOCK_METHOD2(clearBuffer, void(DeviceResourceHandle, const Vector4&));
     MOCK_CONST_METHOD2(logSceneContent, void(RendererLogContext& context, const RendererCachedScene& scene));
@@ -119,6 +119,7 @@ class ResourceDeviceHandleAccessorMock : public IResourceDeviceHandleAccessor
 {
 public:
     MOCK_CONST_METHOD1(getClientResourceDeviceHandle, DeviceResourceHandle(const ResourceContentHash& resourceHash));
+    MOCK_CONST_METHOD1(getClientEffectSupportsDrawCallBatching, Bool(const ResourceContentHash& effectHash));
     MOCK_CONST_METHOD2(getRenderTargetDeviceHandle, DeviceResourceHandle(RenderTargetHandle targetHandle, SceneId sceneId));
     MOCK_CONST_METHOD2(getRenderTargetBufferDeviceHandle, DeviceResourceHandle(RenderBufferHandle bufferHandle, SceneId sceneId));
     MOCK_CONST_METHOD4(getBlitPassRenderTargetsDeviceHandle, void(BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle&, DeviceResourceHandle&));
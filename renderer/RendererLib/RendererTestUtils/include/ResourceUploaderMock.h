@@ -24,6 +24,10 @@ namespace ramses_internal
 
         MOCK_METHOD3(uploadResource, DeviceResourceHandle(IRenderBackend&, const ResourceDescriptor&, UInt32&));
         MOCK_METHOD4(unloadResource, void(IRenderBackend&, EResourceType, ResourceContentHash, DeviceResourceHandle));
+        MOCK_METHOD4(uploadResourceFromStagingBuffer, DeviceResourceHandle(IRenderBackend&, const ResourceDescriptor&, DeviceResourceHandle, UInt32&));
+        MOCK_METHOD2(startEffectCompilation, DeviceResourceHandle(IRenderBackend&, const ResourceDescriptor&));
+        MOCK_METHOD2(isEffectCompilationFinished, Bool(IRenderBackend&, DeviceResourceHandle));
+        MOCK_METHOD4(finishEffectCompilation, DeviceResourceHandle(IRenderBackend&, const ResourceDescriptor&, DeviceResourceHandle, UInt32&));
 
         static const DeviceResourceHandle FakeResourceDeviceHandle;
     };
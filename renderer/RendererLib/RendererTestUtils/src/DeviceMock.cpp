@@ -53,6 +53,9 @@ namespace ramses_internal
         ON_CALL(*this, allocateIndexBuffer(_, _)).WillByDefault(Return(FakeIndexBufferDeviceHandle));
         ON_CALL(*this, uploadShader(_)).WillByDefault(Return(FakeShaderDeviceHandle));
         ON_CALL(*this, uploadBinaryShader(_, _, _, _)).WillByDefault(Return(FakeShaderDeviceHandle));
+        ON_CALL(*this, startShaderCompilation(_)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
+        ON_CALL(*this, isShaderCompilationFinished(_)).WillByDefault(Return(true));
+        ON_CALL(*this, finishShaderCompilation(_, _)).WillByDefault(Return(FakeShaderDeviceHandle));
         ON_CALL(*this, allocateTexture2D(_, _, _, _, _, _)).WillByDefault(Return(FakeTextureDeviceHandle));
         ON_CALL(*this, uploadRenderBuffer(_)).WillByDefault(Return(FakeRenderBufferDeviceHandle));
         ON_CALL(*this, uploadTextureSampler(_,_,_,_,_,_)).WillByDefault(Return(FakeTextureSamplerDeviceHandle));
@@ -18,5 +18,9 @@ namespace ramses_internal
     ResourceUploaderMock::ResourceUploaderMock()
     {
         ON_CALL(*this, uploadResource(_, _, _)).WillByDefault(Return(FakeResourceDeviceHandle));
+        ON_CALL(*this, uploadResourceFromStagingBuffer(_, _, _, _)).WillByDefault(Return(FakeResourceDeviceHandle));
+        ON_CALL(*this, startEffectCompilation(_, _)).WillByDefault(Return(DeviceResourceHandle::Invalid()));
+        ON_CALL(*this, isEffectCompilationFinished(_, _)).WillByDefault(Return(true));
+        ON_CALL(*this, finishEffectCompilation(_, _, _, _)).WillByDefault(Return(FakeResourceDeviceHandle));
     }
 };
@@ -0,0 +1,109 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/IntersectionUtils.h"
+#include "RendererLib/TriangleBVH.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include "Math3d/ProjectionParams.h"
+#include "benchmark/benchmark.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // mesh of roughly triangleCount triangles forming a bumpy grid in xy plane centered around origin
+        std::vector<float> CreateMesh(UInt32 triangleCount)
+        {
+            const UInt32 gridSize = std::max(1u, static_cast<UInt32>(std::sqrt(static_cast<float>(triangleCount / 2u))));
+            const float cellSize = 2.f / static_cast<float>(gridSize);
+            const auto vertex = [cellSize](UInt32 x, UInt32 y)
+            {
+                return Vector3(-1.f + static_cast<float>(x) * cellSize, -1.f + static_cast<float>(y) * cellSize, 0.05f * static_cast<float>((x * 7u + y * 13u) % 5u));
+            };
+
+            std::vector<float> geometry;
+            geometry.reserve(gridSize * gridSize * 18u);
+            const auto addTriangle = [&geometry](const Vector3& v0, const Vector3& v1, const Vector3& v2)
+            {
+                geometry.insert(geometry.end(), { v0.x, v0.y, v0.z, v1.x, v1.y, v1.z, v2.x, v2.y, v2.z });
+            };
+            for (UInt32 y = 0u; y < gridSize; ++y)
+            {
+                for (UInt32 x = 0u; x < gridSize; ++x)
+                {
+                    addTriangle(vertex(x, y), vertex(x + 1u, y), vertex(x + 1u, y + 1u));
+                    addTriangle(vertex(x, y), vertex(x + 1u, y + 1u), vertex(x, y + 1u));
+                }
+            }
+            return geometry;
+        }
+
+        struct PickSetup
+        {
+            const Matrix44f modelMatrix = Matrix44f::Identity;
+            const Matrix44f viewMatrix = Matrix44f::Translation(0.f, 0.f, 5.f).inverse();
+            const Matrix44f projectionMatrix = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(30.f, 1.f, 0.1f, 100.f));
+            const Vector2 pickCoords{ 0.13f, -0.07f };
+        };
+
+        void TriangleCounts(benchmark::internal::Benchmark* bench)
+        {
+            bench->RangeMultiplier(8)->Range(64, 256 * 1024);
+        }
+    }
+
+    // picking with BVH cached on renderer scene, i.e. cost of every pick event once geometry was picked before
+    static void BM_IntersectionUtils_TestGeometryPicked_CachedBVH(benchmark::State& state)
+    {
+        const auto mesh = CreateMesh(static_cast<UInt32>(state.range(0)));
+        const TriangleBVH bvh(mesh.data(), mesh.size());
+        const PickSetup setup;
+
+        for (auto _ : state)
+        {
+            Vector3 intersection;
+            benchmark::DoNotOptimize(IntersectionUtils::TestGeometryPicked(setup.pickCoords, bvh, setup.modelMatrix, setup.viewMatrix, setup.projectionMatrix, intersection));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(mesh.size() / 9));
+    }
+    BENCHMARK(BM_IntersectionUtils_TestGeometryPicked_CachedBVH)->Apply(TriangleCounts);
+
+    // first pick after geometry changed, includes building of BVH
+    static void BM_IntersectionUtils_TestGeometryPicked_BuildBVH(benchmark::State& state)
+    {
+        const auto mesh = CreateMesh(static_cast<UInt32>(state.range(0)));
+        const PickSetup setup;
+
+        for (auto _ : state)
+        {
+            const TriangleBVH bvh(mesh.data(), mesh.size());
+            Vector3 intersection;
+            benchmark::DoNotOptimize(IntersectionUtils::TestGeometryPicked(setup.pickCoords, bvh, setup.modelMatrix, setup.viewMatrix, setup.projectionMatrix, intersection));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(mesh.size() / 9));
+    }
+    BENCHMARK(BM_IntersectionUtils_TestGeometryPicked_BuildBVH)->Apply(TriangleCounts);
+
+    // baseline, every triangle of geometry tested against pick ray without BVH
+    static void BM_IntersectionUtils_TestGeometryPicked_BruteForce(benchmark::State& state)
+    {
+        const auto mesh = CreateMesh(static_cast<UInt32>(state.range(0)));
+        const PickSetup setup;
+
+        for (auto _ : state)
+        {
+            Vector3 intersection;
+            benchmark::DoNotOptimize(IntersectionUtils::TestGeometryPicked(setup.pickCoords, mesh.data(), mesh.size(), setup.modelMatrix, setup.viewMatrix, setup.projectionMatrix, intersection));
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(mesh.size() / 9));
+    }
+    BENCHMARK(BM_IntersectionUtils_TestGeometryPicked_BruteForce)->Apply(TriangleCounts);
+}
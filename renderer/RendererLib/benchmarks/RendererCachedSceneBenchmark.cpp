@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2020 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererEventCollector.h"
+
+namespace ramses_internal
+{
+    // measures sorting alone, renderer updates renderable resources together with it
+    class RendererCachedSceneBenchmarkAccess
+    {
+    public:
+        static void UpdatePassRenderableSorting(RendererCachedScene& scene)
+        {
+            scene.updatePassRenderableSorting();
+        }
+    };
+
+    namespace
+    {
+        class RendererSceneFixture
+        {
+        public:
+            explicit RendererSceneFixture(UInt32 nodeCount)
+                : rendererScenes(eventCollector)
+                , scene(rendererScenes.createScene(SceneInfo(SceneId(1u))))
+            {
+                SyntheticScene::Create(scene, nodeCount);
+                RendererCachedSceneBenchmarkAccess::UpdatePassRenderableSorting(scene);
+            }
+
+            RendererEventCollector eventCollector;
+            RendererScenes rendererScenes;
+            RendererCachedScene& scene;
+        };
+    }
+
+    // change of render pass order updates list of sorted passes only, render groups stay sorted
+    static void BM_RendererCachedScene_UpdatePassRenderableSorting(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        RendererSceneFixture fixture(nodeCount);
+
+        for (auto _ : state)
+        {
+            fixture.scene.setRenderPassRenderOrder(RenderPassHandle(0u), 0);
+            RendererCachedSceneBenchmarkAccess::UpdatePassRenderableSorting(fixture.scene);
+            benchmark::DoNotOptimize(fixture.scene.getSortedRenderingPasses().data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+    BENCHMARK(BM_RendererCachedScene_UpdatePassRenderableSorting)->Apply(SyntheticScene::SceneSizes);
+
+    // typical content update: a single renderable gets a new order within its render group
+    static void BM_RendererCachedScene_UpdatePassRenderableSorting_SingleRenderableReordered(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        RendererSceneFixture fixture(nodeCount);
+
+        const RenderGroupHandle group(0u);
+        const RenderableHandle renderable(0u);
+        Int32 order = 0;
+        for (auto _ : state)
+        {
+            fixture.scene.removeRenderableFromRenderGroup(group, renderable);
+            fixture.scene.addRenderableToRenderGroup(group, renderable, ++order);
+            RendererCachedSceneBenchmarkAccess::UpdatePassRenderableSorting(fixture.scene);
+            benchmark::DoNotOptimize(fixture.scene.getOrderedRenderablesForPass(RenderPassHandle(0u)).data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+    BENCHMARK(BM_RendererCachedScene_UpdatePassRenderableSorting_SingleRenderableReordered)->Apply(SyntheticScene::SceneSizes);
+
+    // toggling visibility collects renderables of affected passes again without sorting their render groups
+    static void BM_RendererCachedScene_UpdatePassRenderableSorting_SingleRenderableVisibilityToggled(benchmark::State& state)
+    {
+        const UInt32 nodeCount = static_cast<UInt32>(state.range(0));
+        RendererSceneFixture fixture(nodeCount);
+
+        const RenderableHandle renderable(0u);
+        Bool visible = true;
+        for (auto _ : state)
+        {
+            visible = !visible;
+            fixture.scene.setRenderableVisibility(renderable, visible ? EVisibilityMode::Visible : EVisibilityMode::Invisible);
+            RendererCachedSceneBenchmarkAccess::UpdatePassRenderableSorting(fixture.scene);
+            benchmark::DoNotOptimize(fixture.scene.getOrderedRenderablesForPass(RenderPassHandle(0u)).data());
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+    BENCHMARK(BM_RendererCachedScene_UpdatePassRenderableSorting_SingleRenderableVisibilityToggled)->Apply(SyntheticScene::SceneSizes);
+}
@@ -109,6 +109,21 @@ namespace ramses
         */
         bool loadFromFile(const char* filePath);
 
+        /**
+        * @brief Get number of binary shaders stored in the cache
+        * @return number of binary shaders in the cache
+        */
+        uint32_t getNumberOfBinaryShaders() const;
+
+        /**
+        * @brief Get effect IDs of all binary shaders stored in the cache, e.g. to prewarm them
+        *        using ramses::DisplayConfig::setEffectsToPrewarm
+        * @param[out] effectIds Pointer to first element of an array to be filled with effect IDs
+        * @param[in] numEffectIds Number of elements in \c effectIds array
+        * @return number of effect IDs written to \c effectIds, at most \c numEffectIds
+        */
+        uint32_t getEffectIds(effectId_t* effectIds, uint32_t numEffectIds) const;
+
         /**
         * @brief Used by RamsesRenderer to provide a callback with information on the result of a binary shader upload operation.
         *
@@ -24,10 +24,10 @@ namespace ramses
 
         /**
         * @brief Construct a DefaultRendererResourceCache with a given maximum size. Whenever the size
-        *        limit is exceeded, items will automatically be unloaded in a FIFO-manner.
+        *        limit is exceeded, the least recently used items will automatically be unloaded.
         * @param maxCacheSizeInBytes Maximum size of cache content in bytes
         */
-        DefaultRendererResourceCache(uint32_t maxCacheSizeInBytes);
+        DefaultRendererResourceCache(uint64_t maxCacheSizeInBytes);
 
         /**
         * @brief Destructor of DefaultRendererResourceCache
@@ -85,17 +85,50 @@ namespace ramses
 
         /**
         * @brief Save current content of the cache to a file.
+        *        Saving to the file the cache was loaded from is allowed, the cache copies data still used from that file
+        *        into memory before overwriting it.
         * @param filePath The file path to save to.
         */
         void saveToFile(const char* filePath) const;
 
         /**
         * @brief Load all content from a file. It is assumed that the file has been created using saveToFile(...).
+        *        The file is memory mapped and all resource data is verified during load, but the data is not copied:
+        *        the cache keeps using it from the mapped file until the cache is destroyed, cleared by another load,
+        *        or the content is saved to the same file. The file must therefore not be modified, truncated or
+        *        replaced in place by other means while in use by the cache.
         * @param filePath The file path to load from.
         * @return true if the load was successful.
         */
         bool loadFromFile(const char* filePath);
 
+        /**
+        * @brief Load content from a file lazily. It is assumed that the file has been created using saveToFile(...).
+        *        Only the index of the file is read and verified, resource data is read from the file and verified
+        *        when it is requested the first time. The file must not be modified while in use by the cache.
+        * @param filePath The file path to load from.
+        * @return true if the load was successful.
+        */
+        bool loadFromFileLazily(const char* filePath);
+
+        /**
+        * @brief Get number of hasResource(...) calls which found the resource in the cache.
+        * @return Number of cache hits
+        */
+        uint64_t getCacheHitCount() const;
+
+        /**
+        * @brief Get number of hasResource(...) calls which did not find the resource in the cache.
+        * @return Number of cache misses
+        */
+        uint64_t getCacheMissCount() const;
+
+        /**
+        * @brief Get number of items which were unloaded to make space for new items.
+        * @return Number of evicted items
+        */
+        uint64_t getEvictionCount() const;
+
         /**
          * @brief Deleted copy constructor
          * @param other unused
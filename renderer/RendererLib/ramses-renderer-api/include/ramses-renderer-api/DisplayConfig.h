@@ -337,6 +337,20 @@ namespace ramses
         */
         status_t setGPUMemoryCacheSize(uint64_t size);
 
+        /**
+        * @brief Set effects to be requested and uploaded right after display creation,
+        *        without waiting for a scene to use them. This avoids shader compilation stalls
+        *        when the effects are first used. Prewarmed effects are kept uploaded as long as display exists.
+        *        The list of effect IDs can be taken for example from ramses::BinaryShaderCache::getEffectIds
+        *        after loading the cache from file.
+        *
+        * @param[in] effectIds Pointer to first element of a list of effect IDs, the list is copied
+        * @param[in] numEffectIds Number of elements in \c effectIds array
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setEffectsToPrewarm(const effectId_t* effectIds, uint32_t numEffectIds);
+
         /**
          * @brief Enables/disables resizing of the window (Default=Disabled)
          * @param[in] resizable The resizable flag
@@ -346,6 +360,41 @@ namespace ramses
          */
         status_t setResizable(bool resizable);
 
+        /**
+        * @brief Enables/disables merging of consecutive compatible renderables into a single instanced draw call (Default=Disabled)
+        *        Renderables are merged if they are rendered right after each other and share effect, geometry,
+        *        render state and all other uniform values. At most as many renderables as the smallest semantic
+        *        uniform array size are merged into one draw call.
+        *
+        *        Effects written for single draw calls are never merged. An effect is merged only if its shaders
+        *        follow this contract, which is checked when the effect is uploaded:
+        *        - the effect has at least one model dependent semantic uniform, i.e. one of
+        *          EEffectUniformSemantic_ModelMatrix, EEffectUniformSemantic_ModelViewMatrix,
+        *          EEffectUniformSemantic_ModelViewMatrix33, EEffectUniformSemantic_ModelViewProjectionMatrix
+        *          or EEffectUniformSemantic_NormalMatrix
+        *        - every such uniform is declared as array with at least 2 elements
+        *        - the vertex shader reads these arrays only as name[gl_InstanceID] (GLSL ES 3.00 or later)
+        *        - the fragment shader does not use these uniforms, values needed there have to be passed as varyings
+        *        - the renderable itself is not instanced and has no attributes with instancing divisor
+        *
+        *        Vertex shader following the contract, with uniform semantic set via EffectDescription::setUniformSemantic:
+        *        @code
+        *        #version 300 es
+        *        uniform highp mat4 mvpMatrix[16]; // EEffectUniformSemantic_ModelViewProjectionMatrix
+        *        in vec3 a_position;
+        *        void main()
+        *        {
+        *            gl_Position = mvpMatrix[gl_InstanceID] * vec4(a_position, 1.0);
+        *        }
+        *        @endcode
+        *        Renderables rendered with a single draw call get their value in the first array element.
+        *
+        * @param[in] enabled Flag to enable or disable merging of draw calls
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setDrawCallBatchingEnabled(bool enabled);
+
         /**
         * @brief Sets the clear color of the displays framebuffer (Default=0.0, 0.0, 0.0, 1.0)
         * @param[in] red clear value for red channel
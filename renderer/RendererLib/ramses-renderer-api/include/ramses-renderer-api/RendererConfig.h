@@ -212,6 +212,28 @@ namespace ramses
         */
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        /**
+        * @brief Enable rendering every display on its own thread
+        *        Every display gets a render thread which renders and presents its frames, so that a display
+        *        with slow rendering or slow buffer swap does not delay the frames of other displays.
+        *        Scene updates are still applied on the renderer thread (or the thread calling RamsesRenderer::doOneLoop)
+        *        and all displays finish reading the updated scenes before the next update is applied,
+        *        but a display which is still presenting its last frame is skipped and renders at its own pace.
+        *        The platform must support using display contexts from different threads. Disabled by default.
+        *
+        * @param[in] enabled Flag to enable or disable render thread per display
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        status_t setRenderThreadPerDisplayEnabled(bool enabled);
+
+        /**
+        * @brief Get whether every display is rendered on its own thread
+        *
+        * @return True if render thread per display is enabled
+        */
+        bool isRenderThreadPerDisplayEnabled() const;
+
         /**
         * Stores internal data for implementation specifics of RendererConfig.
         */
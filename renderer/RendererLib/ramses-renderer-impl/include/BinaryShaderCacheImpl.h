@@ -13,6 +13,7 @@
 #include "RendererAPI/Types.h"
 #include "ramses-renderer-api/Types.h"
 #include "SceneAPI/ResourceContentHash.h"
+#include "Transfer/ResourceTypes.h"
 #include "SceneAPI/SceneId.h"
 #include <mutex>
 
@@ -35,6 +36,8 @@ namespace ramses
         void getBinaryShaderData(const ramses_internal::ResourceContentHash& effectId, uint8_t* buffer, uint32_t bufferSize) const;
         void storeBinaryShader(const ramses_internal::ResourceContentHash& effectId, ramses_internal::SceneId sceneId, const uint8_t* binaryShaderData, uint32_t binaryShaderDataSize, binaryShaderFormatId_t binaryShaderFormat);
         void binaryShaderUploaded(ramses_internal::ResourceContentHash effectHash, bool success) const;
+        uint32_t getNumberOfBinaryShaders() const;
+        void getEffectIds(ramses_internal::ResourceContentHashVector& effectIds) const;
 
         void saveToFile(const char* filePath) const;
         bool loadFromFile(const char* filePath);
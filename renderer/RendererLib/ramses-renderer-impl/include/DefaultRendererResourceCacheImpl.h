@@ -13,7 +13,9 @@
 #include "RendererAPI/Types.h"
 #include "ramses-renderer-api/Types.h"
 #include "ramses-renderer-api/IRendererResourceCache.h"
-#include <deque>
+#include "Utils/MemoryMappedFile.h"
+#include <list>
+#include <unordered_map>
 #include <memory>
 
 namespace ramses
@@ -23,7 +25,7 @@ namespace ramses
     class DefaultRendererResourceCacheImpl : public IRendererResourceCache
     {
     public:
-        DefaultRendererResourceCacheImpl(uint32_t maxCacheSizeInBytes);
+        DefaultRendererResourceCacheImpl(uint64_t maxCacheSizeInBytes);
         virtual ~DefaultRendererResourceCacheImpl();
 
         bool virtual hasResource(rendererResourceId_t resourceId, uint32_t& size) const override;
@@ -33,36 +35,81 @@ namespace ramses
 
         void saveToFile(const char* filePath) const;
         bool loadFromFile(const char* filePath);
+        bool loadFromFileLazily(const char* filePath);
 
+        uint64_t getCacheHitCount() const;
+        uint64_t getCacheMissCount() const;
+        uint64_t getEvictionCount() const;
+
+        // file layout: FileHeader, index (item count followed by IndexEntry per item), resource data.
+        // Header checksum covers the index, every index entry has the checksum of its resource data,
+        // so data can be validated lazily on first access.
         struct FileHeader
         {
-            uint32_t fileSize;
+            uint64_t fileSize;
             uint32_t transportVersion;
             uint32_t checksum;
         };
 
-    private:
+        struct IndexEntry
+        {
+            uint64_t resourceIdLow;
+            uint64_t resourceIdHigh;
+            uint64_t dataOffset;
+            uint32_t dataSize;
+            uint32_t dataChecksum;
+        };
 
+    private:
         typedef std::vector<uint8_t> ByteVector;
 
-        bool storeResourceInternal(rendererResourceId_t resourceId, ByteVector& data);
-        void clear();
-        void makeSpaceForNewItem(uint32_t newItemSizeInBytes);
-        void removeOldestItem();
-
-        void iterateDataToSave(IDataFunctor& functor) const;
-
-        struct ResourceData
+        struct CacheEntry
         {
             rendererResourceId_t resourceId;
+            // either owns data or refers to data in m_mappedFile
             ByteVector data;
+            const uint8_t* mappedData;
+            uint32_t size;
+            uint32_t mappedDataChecksum;
+            bool mappedDataVerified;
+            bool mappedDataCorrupt;
         };
 
-        typedef std::deque<ResourceData> ResourceDataTable;
+        struct ResourceIdHash
+        {
+            size_t operator()(const rendererResourceId_t& id) const
+            {
+                // ids are content hashes, low part is already well distributed
+                return static_cast<size_t>(id.lowPart ^ (id.highPart * 31u));
+            }
+        };
+
+        // most recently used entries at the front
+        typedef std::list<CacheEntry> EntryList;
+        typedef std::unordered_map<rendererResourceId_t, EntryList::iterator, ResourceIdHash> EntryIndex;
+
+        bool loadFromFileInternal(const char* filePath, bool verifyAllData);
+        bool insertEntry(CacheEntry&& entry);
+        void removeEntry(EntryIndex::iterator indexIt);
+        CacheEntry* findAndTouch(rendererResourceId_t resourceId) const;
+        bool verifyMappedData(CacheEntry& entry) const;
+        void releaseMappedFile();
+        void clear();
+        void makeSpaceForNewItem(uint64_t newItemSizeInBytes);
+        void removeLeastRecentlyUsedItem();
+
+        void iterateDataToSave(IDataFunctor& functor) const;
+
+        mutable EntryList m_entries;
+        EntryIndex m_index;
+        uint64_t m_maxCacheSizeInBytes;
+        uint64_t m_currentCacheSizeInBytes;
+
+        std::unique_ptr<ramses_internal::MemoryMappedFile> m_mappedFile;
 
-        ResourceDataTable m_resourceData;
-        uint32_t m_maxCacheSizeInBytes;
-        uint32_t m_currentCacheSizeInBytes;
+        mutable uint64_t m_hitCount = 0u;
+        mutable uint64_t m_missCount = 0u;
+        uint64_t m_evictionCount = 0u;
     };
 }
 
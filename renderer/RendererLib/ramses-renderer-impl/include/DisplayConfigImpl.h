@@ -10,6 +10,7 @@
 #define RAMSES_DISPLAYCONFIGIMPL_H
 
 #include "RendererLib/DisplayConfig.h"
+#include "ramses-renderer-api/Types.h"
 #include "StatusObjectImpl.h"
 #include "Utils/CommandLineParser.h"
 
@@ -46,8 +47,10 @@ namespace ramses
         status_t setAndroidNativeWindow(void * nativeWindowPtr);
         status_t setWindowIviVisible(bool visible);
         status_t setResizable(bool resizable);
+        status_t setDrawCallBatchingEnabled(bool enabled);
         status_t keepEffectsUploaded(bool enable);
         status_t setGPUMemoryCacheSize(uint64_t size);
+        status_t setEffectsToPrewarm(const effectId_t* effectIds, uint32_t numEffectIds);
         status_t setClearColor(float red, float green, float blue, float alpha);
         status_t setOffscreen(bool offscreenFlag);
         status_t setWindowsWindowHandle(void* hwnd);
@@ -50,6 +50,9 @@ namespace ramses
         status_t setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period);
         std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        status_t setRenderThreadPerDisplayEnabled(bool enabled);
+        bool isRenderThreadPerDisplayEnabled() const;
+
         //impl methods
         const ramses_internal::RendererConfig& getInternalRendererConfig() const;
 
@@ -10,6 +10,7 @@
 #include "BinaryShaderCacheImpl.h"
 #include "SceneAPI/ResourceContentHash.h"
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
+#include <algorithm>
 
 namespace ramses
 {
@@ -74,6 +75,22 @@ namespace ramses
         return impl.loadFromFile(filePath);
     }
 
+    uint32_t BinaryShaderCache::getNumberOfBinaryShaders() const
+    {
+        return impl.getNumberOfBinaryShaders();
+    }
+
+    uint32_t BinaryShaderCache::getEffectIds(effectId_t* effectIds, uint32_t numEffectIds) const
+    {
+        ramses_internal::ResourceContentHashVector effectHashes;
+        impl.getEffectIds(effectHashes);
+
+        const uint32_t numEffectIdsWritten = std::min(numEffectIds, static_cast<uint32_t>(effectHashes.size()));
+        for (uint32_t i = 0u; i < numEffectIdsWritten; ++i)
+            effectIds[i] = effectId_t{ effectHashes[i].lowPart, effectHashes[i].highPart };
+        return numEffectIdsWritten;
+    }
+
     void BinaryShaderCache::binaryShaderUploaded(effectId_t effectId, bool success) const
     {
         impl.binaryShaderUploaded(ramses_internal::ResourceContentHash(effectId.lowPart, effectId.highPart), success);
@@ -219,6 +219,20 @@ namespace ramses
         }
     }
 
+    uint32_t BinaryShaderCacheImpl::getNumberOfBinaryShaders() const
+    {
+        std::lock_guard<std::mutex> g(m_hashMapLock);
+        return static_cast<uint32_t>(m_binaryShaders.size());
+    }
+
+    void BinaryShaderCacheImpl::getEffectIds(ramses_internal::ResourceContentHashVector& effectIds) const
+    {
+        std::lock_guard<std::mutex> g(m_hashMapLock);
+        effectIds.reserve(m_binaryShaders.size());
+        for (const auto& binaryShader : m_binaryShaders)
+            effectIds.push_back(binaryShader.key);
+    }
+
     bool BinaryShaderCacheImpl::deserializeBinaryShader(ramses_internal::IInputStream& inputStream, ramses_internal::ResourceContentHash& effectId, ramses_internal::UInt8Vector& binaryShaderData, ramses_internal::BinaryShaderFormatID& binaryShaderFormat)
     {
         binaryShaderData.clear();
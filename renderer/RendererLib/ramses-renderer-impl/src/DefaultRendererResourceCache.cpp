@@ -11,7 +11,7 @@
 
 namespace ramses
 {
-    DefaultRendererResourceCache::DefaultRendererResourceCache(uint32_t maxCacheSizeInBytes)
+    DefaultRendererResourceCache::DefaultRendererResourceCache(uint64_t maxCacheSizeInBytes)
         : impl(*new DefaultRendererResourceCacheImpl(maxCacheSizeInBytes))
     { }
 
@@ -49,4 +49,24 @@ namespace ramses
     {
         return impl.loadFromFile(filePath);
     }
+
+    bool DefaultRendererResourceCache::loadFromFileLazily(const char* filePath)
+    {
+        return impl.loadFromFileLazily(filePath);
+    }
+
+    uint64_t DefaultRendererResourceCache::getCacheHitCount() const
+    {
+        return impl.getCacheHitCount();
+    }
+
+    uint64_t DefaultRendererResourceCache::getCacheMissCount() const
+    {
+        return impl.getCacheMissCount();
+    }
+
+    uint64_t DefaultRendererResourceCache::getEvictionCount() const
+    {
+        return impl.getEvictionCount();
+    }
 }
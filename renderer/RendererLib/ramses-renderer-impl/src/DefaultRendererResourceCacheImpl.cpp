@@ -9,12 +9,12 @@
 #include "DefaultRendererResourceCacheImpl.h"
 #include "Utils/File.h"
 #include "Utils/LogMacros.h"
-#include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
 #include "Utils/Adler32Checksum.h"
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "TransportCommon/RamsesTransportProtocolVersion.h"
 #include <cassert>
+#include <string>
 
 namespace ramses
 {
@@ -59,7 +59,7 @@ namespace ramses
         ramses_internal::IOutputStream& m_outputStream;
     };
 
-    DefaultRendererResourceCacheImpl::DefaultRendererResourceCacheImpl(uint32_t maxCacheSizeInBytes)
+    DefaultRendererResourceCacheImpl::DefaultRendererResourceCacheImpl(uint64_t maxCacheSizeInBytes)
         : m_maxCacheSizeInBytes(maxCacheSizeInBytes)
         , m_currentCacheSizeInBytes(0)
     {
@@ -73,43 +73,88 @@ namespace ramses
 
     void DefaultRendererResourceCacheImpl::clear()
     {
-        m_resourceData.clear();
+        m_index.clear();
+        m_entries.clear();
         m_currentCacheSizeInBytes = 0;
+        releaseMappedFile();
     }
 
-    bool DefaultRendererResourceCacheImpl::hasResource(rendererResourceId_t resourceId, uint32_t& size) const
+    void DefaultRendererResourceCacheImpl::releaseMappedFile()
     {
-        for (const auto &it : m_resourceData)
+        // copy all data still referring to the file into memory before unmapping it
+        for (auto& entry : m_entries)
         {
-            if (it.resourceId == resourceId)
+            if (entry.mappedData)
             {
-                size = static_cast<uint32_t>(it.data.size());
-                return true;
+                entry.data.assign(entry.mappedData, entry.mappedData + entry.size);
+                entry.mappedData = nullptr;
             }
         }
+        m_mappedFile.reset();
+    }
+
+    DefaultRendererResourceCacheImpl::CacheEntry* DefaultRendererResourceCacheImpl::findAndTouch(rendererResourceId_t resourceId) const
+    {
+        const auto it = m_index.find(resourceId);
+        if (it == m_index.end() || it->second->mappedDataCorrupt)
+            return nullptr;
+
+        // move to front as most recently used, list iterators stay valid
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &*it->second;
+    }
+
+    bool DefaultRendererResourceCacheImpl::verifyMappedData(CacheEntry& entry) const
+    {
+        if (entry.mappedData && !entry.mappedDataVerified && !entry.mappedDataCorrupt)
+        {
+            ramses_internal::Adler32Checksum checksum;
+            checksum.addData(entry.mappedData, entry.size);
+            entry.mappedDataVerified = (checksum.getResult() == entry.mappedDataChecksum);
+            entry.mappedDataCorrupt = !entry.mappedDataVerified;
+        }
+        return !entry.mappedDataCorrupt;
+    }
 
+    bool DefaultRendererResourceCacheImpl::hasResource(rendererResourceId_t resourceId, uint32_t& size) const
+    {
+        const CacheEntry* entry = findAndTouch(resourceId);
+        if (entry)
+        {
+            ++m_hitCount;
+            size = entry->size;
+            return true;
+        }
+
+        ++m_missCount;
         size = 0;
         return false;
     }
 
     bool DefaultRendererResourceCacheImpl::getResourceData(rendererResourceId_t resourceId, uint8_t* buffer, uint32_t bufferSize) const
     {
-        for (const auto &it : m_resourceData)
+        CacheEntry* entry = findAndTouch(resourceId);
+        if (!entry)
         {
-            if (it.resourceId == resourceId)
-            {
-                if (bufferSize < it.data.size())
-                {
-                    return false;
-                }
+            assert(false);
+            return false;
+        }
 
-                ramses_internal::PlatformMemory::Copy(buffer, it.data.data(), it.data.size());
-                return true;
-            }
+        if (bufferSize < entry->size)
+        {
+            return false;
         }
 
-        assert(false);
-        return false;
+        if (!verifyMappedData(*entry))
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::getResourceData: Checksum was wrong for resource " <<
+                resourceId.lowPart << ":" << resourceId.highPart << " in cache file, entry is ignored");
+            return false;
+        }
+
+        const uint8_t* data = entry->mappedData ? entry->mappedData : entry->data.data();
+        ramses_internal::PlatformMemory::Copy(buffer, data, entry->size);
+        return true;
     }
 
     bool DefaultRendererResourceCacheImpl::shouldResourceBeCached(rendererResourceId_t resourceId, uint32_t resourceDataSize, resourceCacheFlag_t cacheFlag, sceneId_t sceneId) const
@@ -132,85 +177,119 @@ namespace ramses
         UNUSED(cacheFlag);
         UNUSED(sceneId);
 
-        ByteVector data;
-        data.resize(resourceDataSize);
-        ramses_internal::PlatformMemory::Copy(data.data(), resourceData, resourceDataSize);
+        // replace entry with corrupt file data if any
+        const auto it = m_index.find(resourceId);
+        if (it != m_index.end() && it->second->mappedDataCorrupt)
+            removeEntry(it);
+
+        CacheEntry entry = {};
+        entry.resourceId = resourceId;
+        entry.data.assign(resourceData, resourceData + resourceDataSize);
+        entry.size = resourceDataSize;
 
-        const bool storingSuccessful = storeResourceInternal(resourceId, data);
+        const bool storingSuccessful = insertEntry(std::move(entry));
         assert(storingSuccessful);
         UNUSED(storingSuccessful);
     }
 
-    bool DefaultRendererResourceCacheImpl::storeResourceInternal(rendererResourceId_t resourceId, ByteVector& data)
+    bool DefaultRendererResourceCacheImpl::insertEntry(CacheEntry&& entry)
     {
-        uint32_t tempSize;
-        if (hasResource(resourceId, tempSize))
+        if (m_index.find(entry.resourceId) != m_index.end())
         {
             return false;
         }
-        UNUSED(tempSize);
 
-        if (data.size() > m_maxCacheSizeInBytes || data.empty())
+        if (entry.size > m_maxCacheSizeInBytes || entry.size == 0u)
         {
             return false;
         }
 
-        makeSpaceForNewItem(static_cast<uint32_t>(data.size()));
-        if (m_currentCacheSizeInBytes + data.size() > m_maxCacheSizeInBytes)
-        {
-            return false;
-        }
+        makeSpaceForNewItem(entry.size);
 
-        ResourceData newData;
-        newData.data.swap(data);
-        newData.resourceId = resourceId;
-
-        m_resourceData.push_back(newData);
-        m_currentCacheSizeInBytes += static_cast<uint32_t>(newData.data.size());
+        m_currentCacheSizeInBytes += entry.size;
+        m_entries.push_front(std::move(entry));
+        m_index.emplace(m_entries.front().resourceId, m_entries.begin());
 
         return m_currentCacheSizeInBytes <= m_maxCacheSizeInBytes;
     }
 
-    void DefaultRendererResourceCacheImpl::makeSpaceForNewItem(uint32_t newItemSizeInBytes)
+    void DefaultRendererResourceCacheImpl::removeEntry(EntryIndex::iterator indexIt)
+    {
+        m_currentCacheSizeInBytes -= indexIt->second->size;
+        m_entries.erase(indexIt->second);
+        m_index.erase(indexIt);
+    }
+
+    void DefaultRendererResourceCacheImpl::makeSpaceForNewItem(uint64_t newItemSizeInBytes)
     {
         assert(newItemSizeInBytes <= m_maxCacheSizeInBytes);
 
         while (m_currentCacheSizeInBytes + newItemSizeInBytes > m_maxCacheSizeInBytes)
         {
-            removeOldestItem();
+            removeLeastRecentlyUsedItem();
         }
     }
 
-    void DefaultRendererResourceCacheImpl::removeOldestItem()
+    void DefaultRendererResourceCacheImpl::removeLeastRecentlyUsedItem()
+    {
+        assert(!m_entries.empty());
+        removeEntry(m_index.find(m_entries.back().resourceId));
+        ++m_evictionCount;
+    }
+
+    uint64_t DefaultRendererResourceCacheImpl::getCacheHitCount() const
+    {
+        return m_hitCount;
+    }
+
+    uint64_t DefaultRendererResourceCacheImpl::getCacheMissCount() const
+    {
+        return m_missCount;
+    }
+
+    uint64_t DefaultRendererResourceCacheImpl::getEvictionCount() const
     {
-        assert(!m_resourceData.empty());
-        m_currentCacheSizeInBytes -= static_cast<uint32_t>(m_resourceData[0].data.size());
-        m_resourceData.pop_front();
+        return m_evictionCount;
     }
 
     void DefaultRendererResourceCacheImpl::iterateDataToSave(IDataFunctor& functor) const
     {
-        const uint32_t numberOfEntries = static_cast<uint32_t>(m_resourceData.size());
+        // entries are stored from most to least recently used, loading keeps that order
+        const uint32_t numberOfEntries = static_cast<uint32_t>(m_entries.size());
         functor.addData(&numberOfEntries, sizeof(numberOfEntries));
 
-        for (const auto &it : m_resourceData)
+        uint64_t dataOffset = sizeof(FileHeader) + sizeof(numberOfEntries) + numberOfEntries * sizeof(IndexEntry);
+        for (const auto& entry : m_entries)
         {
-            const uint32_t dataSize = static_cast<uint32_t>(it.data.size());
-
-            functor.addData(&it.resourceId, sizeof(it.resourceId));
-            functor.addData(&dataSize, sizeof(dataSize));
-            functor.addData(it.data.data(), dataSize);
+            const uint8_t* data = entry.mappedData ? entry.mappedData : entry.data.data();
+            ramses_internal::Adler32Checksum dataChecksum;
+            dataChecksum.addData(data, entry.size);
+
+            IndexEntry indexEntry = {};
+            indexEntry.resourceIdLow = entry.resourceId.lowPart;
+            indexEntry.resourceIdHigh = entry.resourceId.highPart;
+            indexEntry.dataOffset = dataOffset;
+            indexEntry.dataSize = entry.size;
+            indexEntry.dataChecksum = dataChecksum.getResult();
+            functor.addData(&indexEntry, sizeof(indexEntry));
+
+            dataOffset += entry.size;
         }
     }
 
     void DefaultRendererResourceCacheImpl::saveToFile(const char* filePath) const
     {
+        // overwriting the mapped file would invalidate the mapping, keep all data in memory in that case,
+        // file identity is compared as the same file can be reached via different paths
+        if (m_mappedFile && m_mappedFile->isMappingOf(filePath))
+            const_cast<DefaultRendererResourceCacheImpl*>(this)->releaseMappedFile();
+
         ramses_internal::File file(filePath);
         ramses_internal::BinaryFileOutputStream outputStream(file);
 
         if (outputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
         {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "BinaryShaderCacheImpl::saveToFile: Failed to open for writing " << filePath);
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::saveToFile: Failed to open for writing " << filePath);
             file.close();
             return;
         }
@@ -218,8 +297,12 @@ namespace ramses
         ChecksumDataFunctor checksumFunctor;
         iterateDataToSave(checksumFunctor);
 
+        uint64_t dataSize = 0u;
+        for (const auto& entry : m_entries)
+            dataSize += entry.size;
+
         FileHeader header       = {};
-        header.fileSize         = static_cast<uint32_t>(checksumFunctor.m_totalSize + sizeof(header));
+        header.fileSize         = sizeof(header) + checksumFunctor.m_totalSize + dataSize;
         header.transportVersion = RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR;
         header.checksum         = checksumFunctor.m_checksum.getResult();
 
@@ -227,38 +310,50 @@ namespace ramses
 
         SaveDataFunctor saveFunctor(outputStream);
         iterateDataToSave(saveFunctor);
+
+        for (const auto& entry : m_entries)
+            outputStream.write(entry.mappedData ? entry.mappedData : entry.data.data(), entry.size);
     }
 
     bool DefaultRendererResourceCacheImpl::loadFromFile(const char* filePath)
+    {
+        return loadFromFileInternal(filePath, true);
+    }
+
+    bool DefaultRendererResourceCacheImpl::loadFromFileLazily(const char* filePath)
+    {
+        return loadFromFileInternal(filePath, false);
+    }
+
+    bool DefaultRendererResourceCacheImpl::loadFromFileInternal(const char* filePath, bool verifyAllData)
     {
         clear();
 
         ramses_internal::File file(filePath);
-
         if (!file.exists())
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: file does not exist: " << filePath);
             return false;
         }
 
-        ramses_internal::BinaryFileInputStream inputStream(file);
-        if (inputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+        std::unique_ptr<ramses_internal::MemoryMappedFile> mappedFile(new ramses_internal::MemoryMappedFile(filePath));
+        if (!mappedFile->isMapped())
         {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: failed to load file: " << filePath << " errorstate: " << inputStream.getState());
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: failed to load file: " << filePath);
             return false;
         }
 
-        FileHeader fileHeader;
-
-        ramses_internal::UInt actualFileSize = 0;
-        if (file.getSizeInBytes(actualFileSize) != ramses_internal::EStatus_RAMSES_OK || actualFileSize < sizeof(FileHeader))
+        const uint8_t* fileData = mappedFile->getData();
+        const uint64_t actualFileSize = mappedFile->getSize();
+        if (actualFileSize < sizeof(FileHeader) + sizeof(uint32_t))
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER,
                      "DefaultRendererResourceCacheImpl::loadFromFile: Invalid file size, file is corrupt - cache needs to be repopulated and saved again");
             return false;
         }
 
-        inputStream >> fileHeader.fileSize;
+        FileHeader fileHeader;
+        ramses_internal::PlatformMemory::Copy(&fileHeader, fileData, sizeof(fileHeader));
 
         if (actualFileSize != fileHeader.fileSize)
         {
@@ -268,8 +363,6 @@ namespace ramses
             return false;
         }
 
-        inputStream >> fileHeader.transportVersion;
-
         if (fileHeader.transportVersion != RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR)
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER,
@@ -280,68 +373,75 @@ namespace ramses
             return false;
         }
 
-        ramses_internal::Adler32Checksum calculatedChecksum;
-
-        inputStream >> fileHeader.checksum;
-
         uint32_t itemCount = 0;
-        inputStream >> itemCount;
-        calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&itemCount), sizeof(itemCount));
+        ramses_internal::PlatformMemory::Copy(&itemCount, fileData + sizeof(FileHeader), sizeof(itemCount));
+        const uint64_t indexSize = sizeof(itemCount) + static_cast<uint64_t>(itemCount) * sizeof(IndexEntry);
+        if (indexSize > actualFileSize - sizeof(FileHeader))
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
+                     "DefaultRendererResourceCacheImpl::loadFromFile: Wrong item count: " << itemCount <<
+                     ", file is corrupt - cache needs to be repopulated and saved again");
+            return false;
+        }
 
-        for (uint32_t i = 0; i < itemCount; i++)
+        ramses_internal::Adler32Checksum indexChecksum;
+        indexChecksum.addData(fileData + sizeof(FileHeader), static_cast<uint32_t>(indexSize));
+        if (indexChecksum.getResult() != fileHeader.checksum)
         {
-            uint64_t resIdLowPart = 0;
-            inputStream >> resIdLowPart;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resIdLowPart), sizeof(resIdLowPart));
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
+                     "DefaultRendererResourceCacheImpl::loadFromFile: Checksum was wrong, file is corrupt - cache "
+                     "needs to be repopulated and saved again");
+            return false;
+        }
 
-            uint64_t resIdHighPart = 0;
-            inputStream >> resIdHighPart;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resIdHighPart), sizeof(resIdHighPart));
+        m_mappedFile = std::move(mappedFile);
 
-            uint32_t resourceSize = 0;
-            inputStream >> resourceSize;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resourceSize), sizeof(resourceSize));
+        const uint8_t* indexData = fileData + sizeof(FileHeader) + sizeof(itemCount);
+        const uint64_t dataStart = sizeof(FileHeader) + indexSize;
+        for (uint32_t i = 0; i < itemCount; i++)
+        {
+            IndexEntry indexEntry;
+            ramses_internal::PlatformMemory::Copy(&indexEntry, indexData + i * sizeof(IndexEntry), sizeof(indexEntry));
 
-            if (resourceSize > actualFileSize)
+            if (indexEntry.dataOffset < dataStart || indexEntry.dataOffset > actualFileSize || indexEntry.dataSize > actualFileSize - indexEntry.dataOffset)
             {
-                // resourceSize is larger than whole file size, so it must be wrong
                 LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                    "DefaultRendererResourceCacheImpl::loadFromFile: Wrong resourceSize: " << resourceSize <<
+                    "DefaultRendererResourceCacheImpl::loadFromFile: Wrong resource offset or size: " << indexEntry.dataOffset << "/" << indexEntry.dataSize <<
                     ", file is corrupt - cache needs to be repopulated and saved again");
                 clear();
                 return false;
             }
 
-            ByteVector data;
-            data.resize(resourceSize);
-            inputStream.read(reinterpret_cast<ramses_internal::Char*>(data.data()), resourceSize);
-            calculatedChecksum.addData(data.data(), resourceSize);
+            CacheEntry entry = {};
+            entry.resourceId = rendererResourceId_t(indexEntry.resourceIdLow, indexEntry.resourceIdHigh);
+            entry.mappedData = fileData + indexEntry.dataOffset;
+            entry.size = indexEntry.dataSize;
+            entry.mappedDataChecksum = indexEntry.dataChecksum;
 
-            if (!storeResourceInternal(rendererResourceId_t(resIdLowPart, resIdHighPart), data))
+            if (verifyAllData && !verifyMappedData(entry))
             {
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: storeResourceInternal failed"
-                                << ", either file is corrupt or cache size too small  - cache needs to be repopulated and saved again");
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER,
+                         "DefaultRendererResourceCacheImpl::loadFromFile: Checksum was wrong, file is corrupt - cache "
+                         "needs to be repopulated and saved again");
                 clear();
                 return false;
             }
 
-            if (inputStream.getState() != ramses_internal::EStatus_RAMSES_OK)
+            // file is ordered from most to least recently used, drop the remaining entries if budget is exhausted
+            if (entry.size <= m_maxCacheSizeInBytes && m_currentCacheSizeInBytes + entry.size > m_maxCacheSizeInBytes)
             {
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                         "DefaultRendererResourceCacheImpl::loadFromFile: Reading failed, file is corrupt - cache "
-                         "needs to be repopulated and saved again");
+                LOG_INFO(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: cache size exceeded, skipped " << itemCount - i << " least recently used entries");
+                break;
+            }
+
+            if (!insertEntry(std::move(entry)))
+            {
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: storing entry failed"
+                                << ", either file is corrupt or cache size too small  - cache needs to be repopulated and saved again");
                 clear();
                 return false;
             }
-        }
-
-        if (calculatedChecksum.getResult() != fileHeader.checksum)
-        {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                     "DefaultRendererResourceCacheImpl::loadFromFile: Checksum was wrong, file is corrupt - cache "
-                     "needs to be repopulated and saved again");
-            clear();
-            return false;
+            m_entries.splice(m_entries.end(), m_entries, m_entries.begin());
         }
 
         return true;
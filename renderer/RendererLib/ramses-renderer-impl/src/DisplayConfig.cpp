@@ -208,6 +208,13 @@ namespace ramses
         return status;
     }
 
+    status_t DisplayConfig::setEffectsToPrewarm(const effectId_t* effectIds, uint32_t numEffectIds)
+    {
+        const status_t status = impl.setEffectsToPrewarm(effectIds, numEffectIds);
+        LOG_HL_RENDERER_API2(status, LOG_API_GENERIC_PTR_STRING(effectIds), numEffectIds);
+        return status;
+    }
+
     status_t DisplayConfig::setResizable(bool resizable)
     {
         const status_t status = impl.setResizable(resizable);
@@ -215,6 +222,13 @@ namespace ramses
         return status;
     }
 
+    status_t DisplayConfig::setDrawCallBatchingEnabled(bool enabled)
+    {
+        const status_t status = impl.setDrawCallBatchingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
     status_t DisplayConfig::setClearColor(float red, float green, float blue, float alpha)
     {
         const status_t status = impl.setClearColor(red, green, blue, alpha);
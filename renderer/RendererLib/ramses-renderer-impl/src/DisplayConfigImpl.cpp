@@ -219,6 +219,12 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t DisplayConfigImpl::setDrawCallBatchingEnabled(bool enabled)
+    {
+        m_internalConfig.setDrawCallBatchingEnabled(enabled);
+        return StatusOK;
+    }
+
     status_t DisplayConfigImpl::keepEffectsUploaded(bool enable)
     {
         m_internalConfig.setKeepEffectsUploaded(enable);
@@ -231,6 +237,19 @@ namespace ramses
         return StatusOK;
     }
 
+    status_t DisplayConfigImpl::setEffectsToPrewarm(const effectId_t* effectIds, uint32_t numEffectIds)
+    {
+        if (numEffectIds > 0u && effectIds == nullptr)
+            return addErrorEntry("DisplayConfig::setEffectsToPrewarm failed - effect IDs array is null!");
+
+        ramses_internal::ResourceContentHashVector effects;
+        effects.reserve(numEffectIds);
+        for (uint32_t i = 0u; i < numEffectIds; ++i)
+            effects.push_back(ramses_internal::ResourceContentHash(effectIds[i].lowPart, effectIds[i].highPart));
+        m_internalConfig.setEffectsToPrewarm(effects);
+        return StatusOK;
+    }
+
     status_t DisplayConfigImpl::setClearColor(float red, float green, float blue, float alpha)
     {
         m_internalConfig.setClearColor(ramses_internal::Vector4(red, green, blue, alpha));
@@ -49,7 +49,7 @@ namespace ramses
         , m_rendererFrameworkLogic(framework.getRamsesConnectionStatusUpdateNotifier(), framework.getResourceComponent(), framework.getScenegraphComponent(), m_rendererCommandBuffer, framework.getFrameworkLock())
         , m_platformFactory(platformFactory != nullptr ? platformFactory : ramses_internal::PlatformFactory_Base::CreatePlatformFactory(m_internalConfig))
         , m_resourceUploader(m_rendererStatistics, m_binaryShaderCache.get())
-        , m_renderer(new ramses_internal::WindowedRenderer(m_rendererCommandBuffer, m_rendererFrameworkLogic, *m_platformFactory, m_rendererStatistics, m_internalConfig.getKPIFileName()))
+        , m_renderer(new ramses_internal::WindowedRenderer(m_rendererCommandBuffer, m_rendererFrameworkLogic, *m_platformFactory, m_rendererStatistics, m_internalConfig.getKPIFileName(), &framework.getTaskQueue()))
         , m_systemCompositorEnabled(m_internalConfig.getSystemCompositorControlEnabled())
         , m_loopMode(ramses_internal::ELoopMode::UpdateAndRender)
         , m_rendererLoopThreadWatchdog(framework.getThreadWatchdogConfig().getWatchdogNotificationInterval(ERamsesThreadIdentifier_Renderer), ERamsesThreadIdentifier_Renderer, framework.getThreadWatchdogConfig().getCallBack())
@@ -68,6 +68,8 @@ namespace ramses
             LOG_INFO(ramses_internal::CONTEXT_SMOKETEST, "Ramsh commands registered from RamsesRenderer");
         }
 
+        m_renderer->getRenderer().setRenderThreadPerDisplay(m_internalConfig.getRenderThreadPerDisplayEnabled());
+
         LOG_TRACE(ramses_internal::CONTEXT_PROFILING, "RamsesRenderer::RamsesRenderer finished initializing renderer");
     }
 
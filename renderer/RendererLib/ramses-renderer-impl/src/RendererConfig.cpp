@@ -115,4 +115,16 @@ namespace ramses
         return impl.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    status_t RendererConfig::setRenderThreadPerDisplayEnabled(bool enabled)
+    {
+        const status_t status = impl.setRenderThreadPerDisplayEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    bool RendererConfig::isRenderThreadPerDisplayEnabled() const
+    {
+        return impl.isRenderThreadPerDisplayEnabled();
+    }
+
 }
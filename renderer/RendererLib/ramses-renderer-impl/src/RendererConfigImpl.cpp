@@ -109,6 +109,17 @@ namespace ramses
         return m_internalConfig.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    status_t RendererConfigImpl::setRenderThreadPerDisplayEnabled(bool enabled)
+    {
+        m_internalConfig.setRenderThreadPerDisplayEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool RendererConfigImpl::isRenderThreadPerDisplayEnabled() const
+    {
+        return m_internalConfig.getRenderThreadPerDisplayEnabled();
+    }
+
     const ramses_internal::RendererConfig& RendererConfigImpl::getInternalRendererConfig() const
     {
         return m_internalConfig;
@@ -190,6 +190,28 @@ TEST_F(ADisplayConfig, disablesKeepingOfEffectsInVRAM)
     EXPECT_FALSE(config.impl.getInternalDisplayConfig().getKeepEffectsUploaded());
 }
 
+TEST_F(ADisplayConfig, setsEffectsToPrewarm)
+{
+    const ramses::effectId_t effects[] = { { 1u, 2u }, { 3u, 4u } };
+    EXPECT_EQ(ramses::StatusOK, config.setEffectsToPrewarm(effects, 2u));
+    const ramses_internal::ResourceContentHashVector expectedEffects{ ramses_internal::ResourceContentHash(1u, 2u), ramses_internal::ResourceContentHash(3u, 4u) };
+    EXPECT_EQ(expectedEffects, config.impl.getInternalDisplayConfig().getEffectsToPrewarm());
+}
+
+TEST_F(ADisplayConfig, failsToSetEffectsToPrewarmFromNullArray)
+{
+    EXPECT_NE(ramses::StatusOK, config.setEffectsToPrewarm(nullptr, 2u));
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().getEffectsToPrewarm().empty());
+}
+
+TEST_F(ADisplayConfig, enablesDrawCallBatching)
+{
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallBatchingEnabled(true));
+    EXPECT_TRUE(config.impl.getInternalDisplayConfig().isDrawCallBatchingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallBatchingEnabled(false));
+    EXPECT_FALSE(config.impl.getInternalDisplayConfig().isDrawCallBatchingEnabled());
+}
+
 TEST_F(ADisplayConfig, setsNativeDisplayID)
 {
     EXPECT_EQ(ramses::StatusOK, config.setIntegrityRGLDeviceUnit(2u));
@@ -106,3 +106,12 @@ TEST(ARendererConfig, setsAndGetsLoopCountPeriod)
     EXPECT_EQ(ramses::StatusOK, config.setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds(1234)));
     EXPECT_EQ(std::chrono::milliseconds(1234), config.getRenderThreadLoopTimingReportingPeriod());
 }
+
+TEST(ARendererConfig, enablesRenderThreadPerDisplay)
+{
+    ramses::RendererConfig config;
+    EXPECT_FALSE(config.isRenderThreadPerDisplayEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setRenderThreadPerDisplayEnabled(true));
+    EXPECT_TRUE(config.isRenderThreadPerDisplayEnabled());
+    EXPECT_TRUE(config.impl.getInternalRendererConfig().getRenderThreadPerDisplayEnabled());
+}